@@ -8,6 +8,10 @@
 #include "ui.hpp"
 #include "image.hpp"
 #include "obj.hpp"
+#include "jobs.hpp"
+#include "loader.hpp"
+#include "platform/threading.hpp"
+#include "platform/commandbuffer.hpp"
 
 using Platform::KeyCode;
 
@@ -15,7 +19,12 @@ void LoadMesh( void* app );
 void LoadAlbedo( void* app );
 void LoadNormal( void* app );
 void LoadSpecular( void* app );
+void BenchmarkCompression( void* app );
 bool InitializeRenderContext( Core::AppContext* app );
+void SetModelVertexFormat( Core::AppContext* app );
+void UploadFinishedLoads( Core::AppContext* app );
+void UseModelMaterial( Core::AppContext* app, i32 material );
+void FreeModelMaterials( Core::AppContext* app );
 
 void Render( Core::AppContext* app ) {
 
@@ -38,12 +47,29 @@ void Render( Core::AppContext* app ) {
     api->ClearBuffer();
 
     api->UseShader( &ctx->blinnPhongShader );
-    api->UseTexture2D( &ctx->modelAlbedoTexture, RENDER_CONTEXT_ALBEDO_TEXTURE_UNIT );
-    api->UseTexture2D( &ctx->modelSpecularTexture, RENDER_CONTEXT_SPECULAR_TEXTURE_UNIT );
-    api->UseTexture2D( &ctx->modelNormalTexture, RENDER_CONTEXT_NORMAL_TEXTURE_UNIT );
 
+    Core::MeshView modelView = {};
+    Core::CreateMeshView(
+        &ctx->modelInfo,
+        ctx->modelTransform,
+        &ctx->camera,
+        ctx->viewport.y,
+        &modelView
+    );
+    // NOTE(alicia): deferred renderer sorts opaque draws nearest first
+    Platform::SetCommandSortDepth( modelView.distance );
     api->UseVertexArray( &ctx->modelVertexArray );
-    api->DrawVertexArray( &ctx->modelVertexArray );
+    if( ctx->modelMaterialCount == 0 ) {
+        UseModelMaterial( app, -1 );
+        Core::DrawSubMeshes( &ctx->modelVertexArray, &ctx->modelInfo, &modelView, api );
+    } else {
+        // NOTE(alicia): sub-meshes without material are drawn first
+        for( i32 material = -1; material < (i32)ctx->modelMaterialCount; ++material ) {
+            UseModelMaterial( app, material );
+            Core::DrawMaterialSubMeshes( &ctx->modelVertexArray, &ctx->modelInfo, &modelView, material, api );
+        }
+    }
+    Platform::SetCommandSortDepth( 0.0f );
 
     api->SetBlendingEnable( true );
     app->ui->renderInterface( api, ctx );
@@ -121,6 +147,8 @@ void Core::OnUpdate( AppContext* app ) {
                     LoadSpecular( app );
                 } else if( input->IsKeyDown( KeyCode::N ) ) {
                     LoadNormal( app );
+                } else if( input->IsKeyDown( KeyCode::B ) ) {
+                    BenchmarkCompression( app );
                 }
                 
                 if( input->IsKeyDown( KeyCode::R ) ) {
@@ -164,6 +192,7 @@ void Core::OnUpdate( AppContext* app ) {
         camera->recalculateView();
         camera->recalculateProjection();
         camera->recalculateBasis();
+        UploadFinishedLoads( app );
         Render(app);
     }
 }
@@ -179,6 +208,14 @@ const usize NUMBER_OF_CLEAR_COLORS = 3;
 bool Core::OnInit( AppContext* app ) {
     app->isRunning = true;
     app->rendererAPI.Initialize();
+    // NOTE(alicia): main thread also runs jobs while it waits on them,
+    // there is always at least one worker so loads never block the main thread
+    u32 processorCount = Platform::GetProcessorCount();
+    app->jobQueue = Core::CreateJobQueue( processorCount > 1 ? processorCount - 1 : 1 );
+    Core::OBJParseOptions meshOptions = {};
+    meshOptions.packVertices = true;
+    meshOptions.memoryBudget = MESH_LOAD_MEMORY_BUDGET;
+    Core::CreateLoader( app->jobQueue, &meshOptions, &app->loader );
     app->renderContext.viewport = app->windowDimensions;
     
     const char* openSansFilePath = "./resources/open_sans/OpenSans-Regular.ttf";
@@ -319,11 +356,11 @@ bool InitializeRenderContext( Core::AppContext* app ) {
     )) {
         return false;
     }
-    smath::mat4 bpTransform = smath::mat4::translate( 0.0f, 0.0f, 2.0f );
+    ctx->modelTransform = smath::mat4::translate( 0.0f, 0.0f, 2.0f );
     api->UniformMat4(
         &ctx->blinnPhongShader,
         ctx->blinnPhongUniformTransform,
-        &bpTransform
+        &ctx->modelTransform
     );
     if(!api->GetUniformID(
         &ctx->blinnPhongShader,
@@ -346,8 +383,38 @@ bool InitializeRenderContext( Core::AppContext* app ) {
         0
     );
 
+    if(!api->GetUniformID(
+        &ctx->blinnPhongShader,
+        "u_packedVertex",
+        &ctx->blinnPhongUniformPackedVertex
+    )) {
+        return false;
+    }
+    if(!api->GetUniformID(
+        &ctx->blinnPhongShader,
+        "u_uvOriginTop",
+        &ctx->blinnPhongUniformUVOriginTop
+    )) {
+        return false;
+    }
+    if(!api->GetUniformID(
+        &ctx->blinnPhongShader,
+        "u_positionOffset",
+        &ctx->blinnPhongUniformPositionOffset
+    )) {
+        return false;
+    }
+    if(!api->GetUniformID(
+        &ctx->blinnPhongShader,
+        "u_positionScale",
+        &ctx->blinnPhongUniformPositionScale
+    )) {
+        return false;
+    }
+    SetModelVertexFormat( app );
+
     smath::mat3 bpNormalMat = smath::mat3::identity();
-    if(!smath::mat3::normalMat( bpTransform, bpNormalMat )) {
+    if(!smath::mat3::normalMat( ctx->modelTransform, bpNormalMat )) {
         LOG_DEBUG("normal mat failed!");
     }
     api->UniformMat3(
@@ -381,27 +448,6 @@ bool InitializeRenderContext( Core::AppContext* app ) {
         32.0f
     );
 
-    if(!api->GetUniformID(
-        &ctx->fontShader,
-        "u_transform",
-        &ctx->fontShaderUniformTransform
-    )) {
-        return false;
-    }
-    if(!api->GetUniformID(
-        &ctx->fontShader,
-        "u_fontCoords",
-        &ctx->fontShaderUniformFontCoords
-    )) {
-        return false;
-    }
-    if(!api->GetUniformID(
-        &ctx->fontShader,
-        "u_color",
-        &ctx->fontShaderUniformColor
-    )) {
-        return false;
-    }
     if(!api->GetUniformID(
         &ctx->boundsShader,
         "u_transform",
@@ -409,13 +455,6 @@ bool InitializeRenderContext( Core::AppContext* app ) {
     )) {
         return false;
     }
-    smath::vec4 defaultFontColor = smath::vec4::one();
-    api->UniformVec4(
-        &ctx->fontShader,
-        ctx->fontShaderUniformColor,
-        &defaultFontColor
-    );
-
     smath::mat4 mat2d = smath::mat4::ortho(
         0.0f,
         (f32)app->windowDimensions.x,
@@ -492,7 +531,8 @@ bool InitializeRenderContext( Core::AppContext* app ) {
         Platform::TextureWrapMode::CLAMP,
         Platform::TextureWrapMode::CLAMP,
         Platform::TextureMinFilter::LINEAR,
-        Platform::TextureMagFilter::LINEAR
+        Platform::TextureMagFilter::LINEAR,
+        nullptr
     );
 
     u8 tex[] = {
@@ -505,7 +545,8 @@ bool InitializeRenderContext( Core::AppContext* app ) {
         Platform::TextureWrapMode::CLAMP,
         Platform::TextureWrapMode::CLAMP,
         Platform::TextureMinFilter::NEAREST_MIPMAP_NEAREST,
-        Platform::TextureMagFilter::NEAREST
+        Platform::TextureMagFilter::NEAREST,
+        nullptr
     );
     ctx->modelSpecularTexture = api->CreateTexture2D(
         1, 1, tex,
@@ -514,7 +555,8 @@ bool InitializeRenderContext( Core::AppContext* app ) {
         Platform::TextureWrapMode::CLAMP,
         Platform::TextureWrapMode::CLAMP,
         Platform::TextureMinFilter::NEAREST_MIPMAP_NEAREST,
-        Platform::TextureMagFilter::NEAREST
+        Platform::TextureMagFilter::NEAREST,
+        nullptr
     );
     ctx->modelNormalTexture = api->CreateTexture2D(
         1, 1, tex,
@@ -523,57 +565,17 @@ bool InitializeRenderContext( Core::AppContext* app ) {
         Platform::TextureWrapMode::CLAMP,
         Platform::TextureWrapMode::CLAMP,
         Platform::TextureMinFilter::NEAREST_MIPMAP_NEAREST,
-        Platform::TextureMagFilter::NEAREST
+        Platform::TextureMagFilter::NEAREST,
+        nullptr
     );
     api->SetUnPackAlignment( RENDERER_PACK_ALIGNMENT_DEFAULT );
 
     Platform::Free( app->defaultFontAtlas.bitmap );
     app->defaultFontAtlas.bitmap = nullptr;
 
-    f32 fontVertices[] = {
-        /*POSITION*/ 0.0f, 1.0f, /*UV*/ 0.0f, 1.0f,
-        /*POSITION*/ 1.0f, 1.0f, /*UV*/ 1.0f, 1.0f,
-        /*POSITION*/ 0.0f, 0.0f, /*UV*/ 0.0f, 0.0f,
-        /*POSITION*/ 1.0f, 0.0f, /*UV*/ 1.0f, 0.0f
-    };
-    const usize FONT_VERTEX_COUNT = 16;
-    u16 fontIndices[] = {
-        2, 1, 0,
-        1, 2, 3
-    };
-    const usize FONT_INDEX_COUNT = 6;
-
-    ctx->fontVertexArray = api->CreateVertexArray();
-    api->UseVertexArray( &ctx->fontVertexArray );
-
-    Platform::VertexBufferElement fontVertexElements[] = {
-        { Platform::DataStructure::VEC4, Platform::DataType::FLOAT, false }
-    };
-    const usize FONT_VERTEX_ELEMENTS = 1;
-    Platform::VertexBufferLayout fontVertexLayout = Platform::CreateVertexBufferLayout(
-        FONT_VERTEX_ELEMENTS,
-        fontVertexElements
-    );
-
-    Platform::VertexBuffer fontVertexBuffer = api->CreateVertexBuffer(
-        FONT_VERTEX_COUNT * sizeof(f32),
-        &fontVertices,
-        fontVertexLayout
-    );
-    api->VertexArrayBindVertexBuffer(
-        &ctx->fontVertexArray,
-        fontVertexBuffer
-    );
-
-    Platform::IndexBuffer fontIndexBuffer = api->CreateIndexBuffer(
-        FONT_INDEX_COUNT,
-        fontIndices,
-        Platform::DataType::UNSIGNED_SHORT
-    );
-    api->VertexArrayBindIndexBuffer(
-        &ctx->fontVertexArray,
-        fontIndexBuffer
-    );
+    if( !Core::CreateTextBatch( api, TEXT_BATCH_GLYPH_CAPACITY, &ctx->textBatch ) ) {
+        return false;
+    }
 
     // NOTE(alicia): bounds mesh
 
@@ -623,39 +625,37 @@ bool InitializeRenderContext( Core::AppContext* app ) {
     );
 
     Core::vertex bpVertices[] = {
-        { /*POS*/ {  0.5f,  0.5f, -0.5f }, /*UV*/ { 1.0f, 1.0f }, /*NORM*/ { 0.0, 0.0f, -1.0f }, {}, {} },
-        { /*POS*/ {  0.5f, -0.5f, -0.5f }, /*UV*/ { 1.0f, 0.0f }, /*NORM*/ { 0.0, 0.0f, -1.0f }, {}, {} },
-        { /*POS*/ { -0.5f,  0.5f, -0.5f }, /*UV*/ { 0.0f, 1.0f }, /*NORM*/ { 0.0, 0.0f, -1.0f }, {}, {} },
-        { /*POS*/ { -0.5f, -0.5f, -0.5f }, /*UV*/ { 0.0f, 0.0f }, /*NORM*/ { 0.0, 0.0f, -1.0f }, {}, {} },
-
-        { /*POS*/ {  0.5f,  0.5f, 0.5f }, /*UV*/ { 1.0f, 1.0f }, /*NORM*/ { 0.0f, 0.0f, 1.0f }, {}, {} },
-        { /*POS*/ {  0.5f, -0.5f, 0.5f }, /*UV*/ { 1.0f, 0.0f }, /*NORM*/ { 0.0f, 0.0f, 1.0f }, {}, {} },
-        { /*POS*/ { -0.5f,  0.5f, 0.5f }, /*UV*/ { 0.0f, 1.0f }, /*NORM*/ { 0.0f, 0.0f, 1.0f }, {}, {} },
-        { /*POS*/ { -0.5f, -0.5f, 0.5f }, /*UV*/ { 0.0f, 0.0f }, /*NORM*/ { 0.0f, 0.0f, 1.0f }, {}, {} },
-
-        { /*POS*/ { -0.5f,  0.5f,  0.5f, }, /*UV*/ { 1.0f, 1.0f }, /*NORM*/ { -1.0f, 0.0f, 0.0f, }, {}, {} },
-        { /*POS*/ { -0.5f,  0.5f, -0.5f, }, /*UV*/ { 1.0f, 0.0f }, /*NORM*/ { -1.0f, 0.0f, 0.0f, }, {}, {} },
-        { /*POS*/ { -0.5f, -0.5f,  0.5f, }, /*UV*/ { 0.0f, 1.0f }, /*NORM*/ { -1.0f, 0.0f, 0.0f, }, {}, {} },
-        { /*POS*/ { -0.5f, -0.5f, -0.5f, }, /*UV*/ { 0.0f, 0.0f }, /*NORM*/ { -1.0f, 0.0f, 0.0f, }, {}, {} },
-
-        { /*POS*/ {  0.5f,  0.5f,  0.5f, }, /*UV*/ { 1.0f, 1.0f }, /*NORM*/ { 1.0f, 0.0f, 0.0f, }, {}, {} },
-        { /*POS*/ {  0.5f,  0.5f, -0.5f, }, /*UV*/ { 1.0f, 0.0f }, /*NORM*/ { 1.0f, 0.0f, 0.0f, }, {}, {} },
-        { /*POS*/ {  0.5f, -0.5f,  0.5f, }, /*UV*/ { 0.0f, 1.0f }, /*NORM*/ { 1.0f, 0.0f, 0.0f, }, {}, {} },
-        { /*POS*/ {  0.5f, -0.5f, -0.5f, }, /*UV*/ { 0.0f, 0.0f }, /*NORM*/ { 1.0f, 0.0f, 0.0f, }, {}, {} },
-
-        { /*POS*/ {  0.5f,  0.5f,  0.5f, }, /*UV*/ { 1.0f, 1.0f }, /*NORM*/ { 0.0f, 1.0f, 0.0f, }, {}, {} },
-        { /*POS*/ {  0.5f,  0.5f, -0.5f, }, /*UV*/ { 1.0f, 0.0f }, /*NORM*/ { 0.0f, 1.0f, 0.0f, }, {}, {} },
-        { /*POS*/ { -0.5f,  0.5f,  0.5f, }, /*UV*/ { 0.0f, 1.0f }, /*NORM*/ { 0.0f, 1.0f, 0.0f, }, {}, {} },
-        { /*POS*/ { -0.5f,  0.5f, -0.5f, }, /*UV*/ { 0.0f, 0.0f }, /*NORM*/ { 0.0f, 1.0f, 0.0f, }, {}, {} },
-
-        { /*POS*/ {  0.5f, -0.5f,  0.5f, }, /*UV*/ { 1.0f, 1.0f }, /*NORM*/ { 0.0f, -1.0f, 0.0f, }, {}, {} },
-        { /*POS*/ {  0.5f, -0.5f, -0.5f, }, /*UV*/ { 1.0f, 0.0f }, /*NORM*/ { 0.0f, -1.0f, 0.0f, }, {}, {} },
-        { /*POS*/ { -0.5f, -0.5f,  0.5f, }, /*UV*/ { 0.0f, 1.0f }, /*NORM*/ { 0.0f, -1.0f, 0.0f, }, {}, {} },
-        { /*POS*/ { -0.5f, -0.5f, -0.5f, }, /*UV*/ { 0.0f, 0.0f }, /*NORM*/ { 0.0f, -1.0f, 0.0f, }, {}, {} },
+        { /*POS*/ {  0.5f,  0.5f, -0.5f }, /*UV*/ { 1.0f, 1.0f }, /*NORM*/ { 0.0, 0.0f, -1.0f }, {} },
+        { /*POS*/ {  0.5f, -0.5f, -0.5f }, /*UV*/ { 1.0f, 0.0f }, /*NORM*/ { 0.0, 0.0f, -1.0f }, {} },
+        { /*POS*/ { -0.5f,  0.5f, -0.5f }, /*UV*/ { 0.0f, 1.0f }, /*NORM*/ { 0.0, 0.0f, -1.0f }, {} },
+        { /*POS*/ { -0.5f, -0.5f, -0.5f }, /*UV*/ { 0.0f, 0.0f }, /*NORM*/ { 0.0, 0.0f, -1.0f }, {} },
+
+        { /*POS*/ {  0.5f,  0.5f, 0.5f }, /*UV*/ { 1.0f, 1.0f }, /*NORM*/ { 0.0f, 0.0f, 1.0f }, {} },
+        { /*POS*/ {  0.5f, -0.5f, 0.5f }, /*UV*/ { 1.0f, 0.0f }, /*NORM*/ { 0.0f, 0.0f, 1.0f }, {} },
+        { /*POS*/ { -0.5f,  0.5f, 0.5f }, /*UV*/ { 0.0f, 1.0f }, /*NORM*/ { 0.0f, 0.0f, 1.0f }, {} },
+        { /*POS*/ { -0.5f, -0.5f, 0.5f }, /*UV*/ { 0.0f, 0.0f }, /*NORM*/ { 0.0f, 0.0f, 1.0f }, {} },
+
+        { /*POS*/ { -0.5f,  0.5f,  0.5f, }, /*UV*/ { 1.0f, 1.0f }, /*NORM*/ { -1.0f, 0.0f, 0.0f, }, {} },
+        { /*POS*/ { -0.5f,  0.5f, -0.5f, }, /*UV*/ { 1.0f, 0.0f }, /*NORM*/ { -1.0f, 0.0f, 0.0f, }, {} },
+        { /*POS*/ { -0.5f, -0.5f,  0.5f, }, /*UV*/ { 0.0f, 1.0f }, /*NORM*/ { -1.0f, 0.0f, 0.0f, }, {} },
+        { /*POS*/ { -0.5f, -0.5f, -0.5f, }, /*UV*/ { 0.0f, 0.0f }, /*NORM*/ { -1.0f, 0.0f, 0.0f, }, {} },
+
+        { /*POS*/ {  0.5f,  0.5f,  0.5f, }, /*UV*/ { 1.0f, 1.0f }, /*NORM*/ { 1.0f, 0.0f, 0.0f, }, {} },
+        { /*POS*/ {  0.5f,  0.5f, -0.5f, }, /*UV*/ { 1.0f, 0.0f }, /*NORM*/ { 1.0f, 0.0f, 0.0f, }, {} },
+        { /*POS*/ {  0.5f, -0.5f,  0.5f, }, /*UV*/ { 0.0f, 1.0f }, /*NORM*/ { 1.0f, 0.0f, 0.0f, }, {} },
+        { /*POS*/ {  0.5f, -0.5f, -0.5f, }, /*UV*/ { 0.0f, 0.0f }, /*NORM*/ { 1.0f, 0.0f, 0.0f, }, {} },
+
+        { /*POS*/ {  0.5f,  0.5f,  0.5f, }, /*UV*/ { 1.0f, 1.0f }, /*NORM*/ { 0.0f, 1.0f, 0.0f, }, {} },
+        { /*POS*/ {  0.5f,  0.5f, -0.5f, }, /*UV*/ { 1.0f, 0.0f }, /*NORM*/ { 0.0f, 1.0f, 0.0f, }, {} },
+        { /*POS*/ { -0.5f,  0.5f,  0.5f, }, /*UV*/ { 0.0f, 1.0f }, /*NORM*/ { 0.0f, 1.0f, 0.0f, }, {} },
+        { /*POS*/ { -0.5f,  0.5f, -0.5f, }, /*UV*/ { 0.0f, 0.0f }, /*NORM*/ { 0.0f, 1.0f, 0.0f, }, {} },
+
+        { /*POS*/ {  0.5f, -0.5f,  0.5f, }, /*UV*/ { 1.0f, 1.0f }, /*NORM*/ { 0.0f, -1.0f, 0.0f, }, {} },
+        { /*POS*/ {  0.5f, -0.5f, -0.5f, }, /*UV*/ { 1.0f, 0.0f }, /*NORM*/ { 0.0f, -1.0f, 0.0f, }, {} },
+        { /*POS*/ { -0.5f, -0.5f,  0.5f, }, /*UV*/ { 0.0f, 1.0f }, /*NORM*/ { 0.0f, -1.0f, 0.0f, }, {} },
+        { /*POS*/ { -0.5f, -0.5f, -0.5f, }, /*UV*/ { 0.0f, 0.0f }, /*NORM*/ { 0.0f, -1.0f, 0.0f, }, {} },
     };
 
-    Core::calculateTangentBasis( sizeof(bpVertices) / sizeof(Core::vertex), bpVertices );
-
     u32 bpIndices[] {
         0, 1, 2,
         3, 2, 1,
@@ -676,6 +676,12 @@ bool InitializeRenderContext( Core::AppContext* app ) {
         21, 22, 23,
     };
 
+    Core::calculateTangentBasis(
+        sizeof(bpIndices) / sizeof(u32), bpIndices,
+        sizeof(bpVertices) / sizeof(Core::vertex), bpVertices,
+        nullptr
+    );
+
     ctx->modelVertexArray = api->CreateVertexArray();
     api->UseVertexArray( &ctx->modelVertexArray );
 
@@ -717,9 +723,14 @@ void Core::OnClose( AppContext* app ) {
     );
     app->rendererAPI.DeleteVertexArrays(
         RENDER_CONTEXT_VERTEX_ARRAY_COUNT,
-        &app->renderContext.fontVertexArray
+        &app->renderContext.boundsVertexArray
     );
+    Core::FreeTextBatch( &app->rendererAPI, &app->renderContext.textBatch );
+    Core::FreeMeshInfo( &app->renderContext.modelInfo );
+    FreeModelMaterials( app );
     delete app->ui;
+    Core::DestroyLoader( &app->loader );
+    Core::DestroyJobQueue( app->jobQueue );
 }
 
 void Core::OnResolutionUpdate( AppContext* app, i32 width, i32 height ) {
@@ -755,144 +766,235 @@ void Core::OnAppDeactivated( AppContext* app ) {
     Platform::SetCursorLocked(false);
 }
 
-void LoadMesh( void* params ) {
-    Core::AppContext* app = (Core::AppContext*)params;
-    Platform::File meshFile = {};
-    if( Platform::UserLoadFile( "Load Mesh", &meshFile ) ) {
-
-        Platform::VertexArray va = {};
-        if( Core::ParseOBJ( &meshFile, &va, &app->rendererAPI ) ) {
-            app->rendererAPI.DeleteVertexArrays( 1, &app->renderContext.modelVertexArray );
-            app->renderContext.modelVertexArray = va;
-        }
+void SetModelVertexFormat( Core::AppContext* app ) {
+    Platform::RendererAPI* api = &app->rendererAPI;
+    Core::RenderContext*   ctx = &app->renderContext;
+
+    // NOTE(alicia): packed positions are 0.0-1.0 across mesh bounds
+    smath::vec3 positionOffset = smath::vec3(0.0f);
+    smath::vec3 positionScale  = smath::vec3(1.0f);
+    if( ctx->modelInfo.packed ) {
+        positionOffset = ctx->modelInfo.boundsMin;
+        positionScale  = ctx->modelInfo.boundsMax - ctx->modelInfo.boundsMin;
+    }
+
+    api->UniformInt(
+        &ctx->blinnPhongShader,
+        ctx->blinnPhongUniformPackedVertex,
+        ctx->modelInfo.packed ? 1 : 0
+    );
+    api->UniformInt(
+        &ctx->blinnPhongShader,
+        ctx->blinnPhongUniformUVOriginTop,
+        ctx->modelInfo.uvOriginTop ? 1 : 0
+    );
+    api->UniformVec3(
+        &ctx->blinnPhongShader,
+        ctx->blinnPhongUniformPositionOffset,
+        &positionOffset
+    );
+    api->UniformVec3(
+        &ctx->blinnPhongShader,
+        ctx->blinnPhongUniformPositionScale,
+        &positionScale
+    );
+}
 
-        Platform::FreeFile( &meshFile );
+/// @brief Pick file on the main thread and load it on the job queue
+void RequestUserLoad( Core::AppContext* app, const char* dialogTitle, Core::LoadType type ) {
+    char filePath[USER_FILE_PATH_MAX_LEN];
+    if( Platform::UserPickFile( dialogTitle, USER_FILE_PATH_MAX_LEN, filePath ) ) {
+        Core::RequestLoad( &app->loader, type, filePath );
     }
     app->input = {};
 }
 
+void LoadMesh( void* params ) {
+    RequestUserLoad( (Core::AppContext*)params, "Load Mesh", Core::LoadType::MESH );
+}
+
 void LoadAlbedo( void* params ) {
-    Core::AppContext* app = (Core::AppContext*)params;
-    Platform::File albedoFile = {};
-    if( Platform::UserLoadFile( "Load Albedo Texture", &albedoFile ) ) {
-
-        Core::Image image = {};
-        if( Core::ReadImage( albedoFile.size, albedoFile.data, &image ) ) {
-
-            app->rendererAPI.DeleteTextures2D( 1, &app->renderContext.modelAlbedoTexture );
-
-            Platform::TextureFormat textureFormat = Platform::TextureFormat::R;
-            switch( image.colorComponentCount ) {
-                case 1: textureFormat = Platform::TextureFormat::R; break;
-                case 2: textureFormat = Platform::TextureFormat::RG; break;
-                case 3: textureFormat = Platform::TextureFormat::RGB; break;
-                case 4: textureFormat = Platform::TextureFormat::RGBA; break;
-                default: break;
-            }
+    RequestUserLoad( (Core::AppContext*)params, "Load Albedo Texture", Core::LoadType::ALBEDO_TEXTURE );
+}
 
-            app->renderContext.modelAlbedoTexture = app->rendererAPI.CreateTexture2D(
-                image.width,
-                image.height,
-                image.data,
-                textureFormat,
-                Platform::DataType::UNSIGNED_BYTE,
-                Platform::TextureWrapMode::CLAMP,
-                Platform::TextureWrapMode::CLAMP,
-                Platform::TextureMinFilter::LINEAR,
-                Platform::TextureMagFilter::LINEAR
-            );
+void LoadNormal( void* params ) {
+    RequestUserLoad( (Core::AppContext*)params, "Load Normal Texture", Core::LoadType::NORMAL_TEXTURE );
+}
 
-            Core::FreeImage( &image );
+void LoadSpecular( void* params ) {
+    RequestUserLoad( (Core::AppContext*)params, "Load Specular Texture", Core::LoadType::SPECULAR_TEXTURE );
+}
 
-        }
+void BenchmarkCompression( void* params ) {
+    RequestUserLoad( (Core::AppContext*)params, "Benchmark Texture Compression", Core::LoadType::COMPRESSION_BENCHMARK );
+}
 
-        Platform::FreeFile( &albedoFile );
+/// @brief Replace model texture with loaded texture.
+/// Textures with precomputed mips are sampled trilinearly
+void UploadTexture(
+    Core::AppContext* app,
+    const Core::TextureUploadData* data,
+    Platform::Texture2D* texture,
+    Platform::TextureWrapMode wrap,
+    Platform::TextureMinFilter minFilter
+) {
+    if( data->levelCount > 1 ) {
+        minFilter = Platform::TextureMinFilter::LINEAR_MIPMAP_LINEAR;
     }
-    app->input = {};
+    app->rendererAPI.DeleteTextures2D( 1, texture );
+    Core::UploadTextureData( data, wrap, minFilter, &app->rendererAPI, texture );
 }
 
-void LoadNormal( void* params ) {
-    Core::AppContext* app = (Core::AppContext*)params;
-    Platform::File normalFile = {};
-    if( Platform::UserLoadFile( "Load Normal Texture", &normalFile ) ) {
-
-        Core::Image image = {};
-        if( Core::ReadImage( normalFile.size, normalFile.data, &image ) ) {
-
-            app->rendererAPI.DeleteTextures2D( 1, &app->renderContext.modelNormalTexture );
-
-            Platform::TextureFormat textureFormat = Platform::TextureFormat::R;
-            switch( image.colorComponentCount ) {
-                case 1: textureFormat = Platform::TextureFormat::R; break;
-                case 2: textureFormat = Platform::TextureFormat::RG; break;
-                case 3: textureFormat = Platform::TextureFormat::RGB; break;
-                case 4: textureFormat = Platform::TextureFormat::RGBA; break;
-                default: break;
+/// @brief Bind maps of model material, or model textures if material is -1
+void UseModelMaterial( Core::AppContext* app, i32 material ) {
+    Core::RenderContext* ctx = &app->renderContext;
+    Platform::Texture2D* textures[MATERIAL_MAP_COUNT] = {
+        &ctx->modelAlbedoTexture,
+        &ctx->modelSpecularTexture,
+        &ctx->modelNormalTexture
+    };
+    const u32 units[MATERIAL_MAP_COUNT] = {
+        RENDER_CONTEXT_ALBEDO_TEXTURE_UNIT,
+        RENDER_CONTEXT_SPECULAR_TEXTURE_UNIT,
+        RENDER_CONTEXT_NORMAL_TEXTURE_UNIT
+    };
+    bool normalTexturePresent = ctx->modelNormalTexturePresent;
+    if( material >= 0 ) {
+        const Core::Material& modelMaterial = ctx->modelMaterials[material];
+        ucycles( MATERIAL_MAP_COUNT ) {
+            if( modelMaterial.images[i] >= 0 ) {
+                textures[i] = &ctx->modelTextures[modelMaterial.images[i]];
             }
-
-            app->renderContext.modelNormalTexture = app->rendererAPI.CreateTexture2D(
-                image.width,
-                image.height,
-                image.data,
-                textureFormat,
-                Platform::DataType::UNSIGNED_BYTE,
-                Platform::TextureWrapMode::CLAMP,
-                Platform::TextureWrapMode::CLAMP,
-                Platform::TextureMinFilter::NEAREST,
-                Platform::TextureMagFilter::LINEAR
-            );
-            app->rendererAPI.UniformInt(
-                &app->renderContext.blinnPhongShader,
-                app->renderContext.blinnPhongUniformNormalTexturePresent,
-                1
-            );
-
-            Core::FreeImage( &image );
-
         }
-
-        Platform::FreeFile( &normalFile );
+        normalTexturePresent = normalTexturePresent ||
+            modelMaterial.images[(usize)Core::MaterialMap::NORMAL] >= 0;
+    }
+    ucycles( MATERIAL_MAP_COUNT ) {
+        app->rendererAPI.UseTexture2D( textures[i], units[i] );
+    }
+    if( ctx->modelMaterialCount > 0 ) {
+        app->rendererAPI.UniformInt(
+            &ctx->blinnPhongShader,
+            ctx->blinnPhongUniformNormalTexturePresent,
+            normalTexturePresent ? 1 : 0
+        );
     }
-    app->input = {};
 }
 
-void LoadSpecular( void* params ) {
-    Core::AppContext* app = (Core::AppContext*)params;
-    Platform::File specularFile = {};
-    if( Platform::UserLoadFile( "Load Specular Texture", &specularFile ) ) {
-
-        Core::Image image = {};
-        if( Core::ReadImage( specularFile.size, specularFile.data, &image ) ) {
-
-            app->rendererAPI.DeleteTextures2D( 1, &app->renderContext.modelSpecularTexture );
-
-            Platform::TextureFormat textureFormat = Platform::TextureFormat::R;
-            switch( image.colorComponentCount ) {
-                case 1: textureFormat = Platform::TextureFormat::R; break;
-                case 2: textureFormat = Platform::TextureFormat::RG; break;
-                case 3: textureFormat = Platform::TextureFormat::RGB; break;
-                case 4: textureFormat = Platform::TextureFormat::RGBA; break;
-                default: break;
-            }
+/// @brief Delete material textures of model
+void FreeModelMaterials( Core::AppContext* app ) {
+    Core::RenderContext* ctx = &app->renderContext;
+    if( ctx->modelTextures ) {
+        app->rendererAPI.DeleteTextures2D( ctx->modelTextureCount, ctx->modelTextures );
+        Platform::Free( ctx->modelTextures );
+    }
+    if( ctx->modelMaterials ) {
+        Platform::Free( ctx->modelMaterials );
+    }
+    ctx->modelTextureCount  = 0;
+    ctx->modelTextures      = nullptr;
+    ctx->modelMaterialCount = 0;
+    ctx->modelMaterials     = nullptr;
+}
 
-            app->renderContext.modelSpecularTexture = app->rendererAPI.CreateTexture2D(
-                image.width,
-                image.height,
-                image.data,
-                textureFormat,
-                Platform::DataType::UNSIGNED_BYTE,
-                Platform::TextureWrapMode::CLAMP,
-                Platform::TextureWrapMode::CLAMP,
-                Platform::TextureMinFilter::NEAREST,
-                Platform::TextureMagFilter::LINEAR
+/// @brief Replace model materials with decoded ones, materials are moved out of set
+void UploadModelMaterials( Core::AppContext* app, Core::MaterialSet* materials ) {
+    Core::RenderContext* ctx = &app->renderContext;
+    FreeModelMaterials( app );
+    if( materials->materialCount == 0 ) {
+        app->rendererAPI.UniformInt(
+            &ctx->blinnPhongShader,
+            ctx->blinnPhongUniformNormalTexturePresent,
+            ctx->modelNormalTexturePresent ? 1 : 0
+        );
+        return;
+    }
+    ctx->modelTextures = (Platform::Texture2D*)Platform::Alloc( materials->textureCount * sizeof(Platform::Texture2D) );
+    if( !ctx->modelTextures && materials->textureCount ) {
+        LOG_ERROR( "App > Failed to allocate material textures!" );
+        return;
+    }
+    ctx->modelTextureCount = materials->textureCount;
+    // NOTE(alicia): textures that failed to load have no texture, no material refers to them
+    ucycles( materials->textureCount ) {
+        if( materials->textures[i].levelCount ) {
+            UploadTexture(
+                app, &materials->textures[i],
+                &ctx->modelTextures[i],
+                Platform::TextureWrapMode::REPEAT, Platform::TextureMinFilter::LINEAR
             );
+        }
+    }
+    ctx->modelMaterialCount = materials->materialCount;
+    ctx->modelMaterials     = materials->materials;
+    materials->materialCount = 0;
+    materials->materials     = nullptr;
+}
 
-            Core::FreeImage( &image );
+/// @brief Upload finished loads until frame's upload budget runs out.
+/// Current model and textures stay in use until their replacement is uploaded
+void UploadFinishedLoads( Core::AppContext* app ) {
+    Core::RenderContext* ctx = &app->renderContext;
+
+    u64 start  = Platform::GetPerformanceCounter();
+    u64 budget = (u64)( LOADER_UPLOAD_BUDGET_MS * (f64)Platform::GetPerformanceFrequency() / 1000.0 );
+    while( Core::LoadRequest* request = Core::NextFinishedLoad( &app->loader ) ) {
+        if( request->success ) {
+            switch( request->type ) {
+                case Core::LoadType::MESH: {
+                    Platform::VertexArray va = {};
+                    Core::MeshInfo info = {};
+                    Core::UploadMeshData( &request->mesh, &va, &info, &app->rendererAPI );
+                    app->rendererAPI.DeleteVertexArrays( 1, &ctx->modelVertexArray );
+                    Core::FreeMeshInfo( &ctx->modelInfo );
+                    ctx->modelVertexArray = va;
+                    ctx->modelInfo        = info;
+                    SetModelVertexFormat( app );
+                    UploadModelMaterials( app, &request->materials );
+                } break;
+                case Core::LoadType::ALBEDO_TEXTURE: {
+                    UploadTexture(
+                        app, &request->texture,
+                        &ctx->modelAlbedoTexture,
+                        Platform::TextureWrapMode::CLAMP, Platform::TextureMinFilter::LINEAR
+                    );
+                } break;
+                case Core::LoadType::SPECULAR_TEXTURE: {
+                    UploadTexture(
+                        app, &request->texture,
+                        &ctx->modelSpecularTexture,
+                        Platform::TextureWrapMode::CLAMP, Platform::TextureMinFilter::NEAREST
+                    );
+                } break;
+                case Core::LoadType::NORMAL_TEXTURE: {
+                    UploadTexture(
+                        app, &request->texture,
+                        &ctx->modelNormalTexture,
+                        Platform::TextureWrapMode::CLAMP, Platform::TextureMinFilter::NEAREST
+                    );
+                    ctx->modelNormalTexturePresent = true;
+                    app->rendererAPI.UniformInt(
+                        &ctx->blinnPhongShader,
+                        ctx->blinnPhongUniformNormalTexturePresent,
+                        1
+                    );
+                } break;
+                // NOTE(alicia): results are logged by the worker
+                case Core::LoadType::COMPRESSION_BENCHMARK: break;
+            }
+        }
+        Core::FreeLoadRequest( request );
 
+        if( Platform::GetPerformanceCounter() - start >= budget ) {
+            break;
         }
+    }
 
-        Platform::FreeFile( &specularFile );
+    // NOTE(alicia): loads are requested earlier in the frame,
+    // compare against last frame so new loads show up as well as finished ones
+    u32 pendingLoadCount = Core::PendingLoadCount( &app->loader );
+    if( pendingLoadCount != app->lastPendingLoadCount ) {
+        app->ui->statusLabel().setText( pendingLoadCount ? "Loading..." : "" );
+        app->lastPendingLoadCount = pendingLoadCount;
     }
-    app->input = {};
 }
-
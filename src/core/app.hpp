@@ -9,18 +9,21 @@
 #include "platform/io.hpp"
 #include "font.hpp"
 #include "renderex.hpp"
+#include "mesh.hpp"
+#include "loader.hpp"
+#include "ui.hpp"
 
 namespace Core {
 
 // forward declarations
-enum class Anchor;
-enum class ButtonState;
-typedef void (*ButtonCallbackFN)(void* params);
-class UserInterface;
+struct JobQueue;
 
 inline const char* PROGRAM_TITLE     = "Model Viewer | Version 0.2 ";
 inline const usize PROGRAM_TITLE_LEN = 27;
 
+/// @brief Peak memory a mesh load may use, larger files are streamed and built out-of-core
+inline const usize MESH_LOAD_MEMORY_BUDGET = (usize)GIGABYTES(1);
+
 inline const f32 MAX_CAMERA_Y_ROTATION  = 0.959930888888889f;
 inline const f32 CAMERA_SENSITIVITY     = 200.0f;
 inline const f32 CAMERA_MOVE_LERP_SPEED = 25.0f;
@@ -81,7 +84,7 @@ struct Input {
 #define RENDER_CONTEXT_TEXTURE_COUNT 4
 #define RENDER_CONTEXT_SHADER_COUNT 3
 #define RENDER_CONTEXT_UNIFORM_BUFFER_COUNT 4
-#define RENDER_CONTEXT_VERTEX_ARRAY_COUNT 3
+#define RENDER_CONTEXT_VERTEX_ARRAY_COUNT 2
 struct RenderContext {
     Core::lightBuffer lights;
     Core::camera camera;
@@ -91,9 +94,21 @@ struct RenderContext {
     Platform::Texture2D modelSpecularTexture;
     Platform::Texture2D modelNormalTexture;
 
-    Platform::VertexArray fontVertexArray;
+    /// @brief Textures of model materials, one per material image
+    usize                modelTextureCount;
+    Platform::Texture2D* modelTextures;
+    /// @brief Materials of model, images index model textures.
+    /// Maps a material doesn't have fall back to the model textures above
+    usize                modelMaterialCount;
+    Core::Material*      modelMaterials;
+    bool                 modelNormalTexturePresent;
+
+    /// @brief Glyph quads of every label, drawn once per frame
+    Core::TextBatch       textBatch;
     Platform::VertexArray boundsVertexArray;
     Platform::VertexArray modelVertexArray;
+    Core::MeshInfo        modelInfo;
+    smath::mat4           modelTransform;
 
     Platform::UniformBuffer matrices2DBuffer;
     Platform::UniformBuffer matrices3DBuffer;
@@ -110,10 +125,6 @@ struct RenderContext {
     Platform::Shader boundsShader;
     Platform::Shader blinnPhongShader;
 
-    i32 fontShaderUniformTransform;
-    i32 fontShaderUniformFontCoords;
-    i32 fontShaderUniformColor;
-
     i32 boundsShaderUniformTransform;
 
     i32 blinnPhongUniformTransform;
@@ -121,12 +132,20 @@ struct RenderContext {
     i32 blinnPhongUniformSurfaceTint;
     i32 blinnPhongUniformGlossiness;
     i32 blinnPhongUniformNormalTexturePresent;
+    i32 blinnPhongUniformPackedVertex;
+    i32 blinnPhongUniformUVOriginTop;
+    i32 blinnPhongUniformPositionOffset;
+    i32 blinnPhongUniformPositionScale;
 
     f32 targetCameraFOV;
 };
 
 struct AppContext {
     UserInterface* ui;
+    JobQueue* jobQueue;
+    Loader loader;
+    /// @brief Pending loads when status label was last updated
+    u32 lastPendingLoadCount;
     bool isRunning;
     Time time;
     Platform::RendererAPI rendererAPI;
@@ -0,0 +1,895 @@
+/**
+ * Description:  Block compression of textures
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "core/bcn.hpp"
+#include "core/jobs.hpp"
+#include "platform/io.hpp"
+
+// NOTE(alicia): every block is fitted the same way, endpoints are placed on the
+// principal axis of its texels, indices are the nearest palette entries and
+// endpoints are refined with least squares for the chosen indices.
+// nearest indices are searched for four texels at a time.
+
+/// @brief Texels of a block, one plane of 16 values per component
+struct BCBlock {
+    alignas(16) f32 channels[4][16];
+};
+
+/// @brief Blocks of every level and range of blocks encoded by a single job
+struct BCEncodeState {
+    const Core::MipChain* chain;
+    Core::CompressedMipChain* result;
+    Core::BlockFormat  format;
+    Core::BlockQuality quality;
+    usize blockBytes;
+    usize blocksX[IMAGE_MAX_MIP_LEVELS];
+    usize levelBlockOffsets[IMAGE_MAX_MIP_LEVELS + 1];
+};
+struct BCEncodeJob {
+    const BCEncodeState* state;
+    usize firstBlock;
+    usize blockCount;
+};
+
+/// @brief Fraction of second endpoint in every BC7 4-bit palette entry, in 64ths
+static const u32 BC7_WEIGHTS[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+#define BC7_MODE_6 ( 1 << 6 )
+
+const char* Core::BlockFormatToString( BlockFormat format ) {
+    switch( format ) {
+        case BlockFormat::BC1: return "BC1";
+        case BlockFormat::BC3: return "BC3";
+        case BlockFormat::BC4: return "BC4";
+        case BlockFormat::BC5: return "BC5";
+        case BlockFormat::BC7: return "BC7";
+        default: return "UNKNOWN";
+    }
+}
+
+usize Core::BlockFormatBlockBytes( BlockFormat format ) {
+    switch( format ) {
+        case BlockFormat::BC1: return 8;
+        case BlockFormat::BC4: return 8;
+        case BlockFormat::BC3: return 16;
+        case BlockFormat::BC5: return 16;
+        case BlockFormat::BC7: return 16;
+        default: return 0;
+    }
+}
+
+const char* Core::BlockQualityToString( BlockQuality quality ) {
+    switch( quality ) {
+        case BlockQuality::FAST:   return "FAST";
+        case BlockQuality::NORMAL: return "NORMAL";
+        case BlockQuality::HIGH:   return "HIGH";
+        default: return "UNKNOWN";
+    }
+}
+
+Core::BlockFormat Core::ChooseBlockFormat( ImageContent content, i32 colorComponentCount, BlockQuality quality ) {
+    switch( content ) {
+        case ImageContent::NORMAL: return BlockFormat::BC5;
+        case ImageContent::LINEAR: return BlockFormat::BC4;
+        default: break;
+    }
+    if( quality != BlockQuality::FAST ) {
+        return BlockFormat::BC7;
+    }
+    bool alpha = colorComponentCount == 2 || colorComponentCount == 4;
+    return alpha ? BlockFormat::BC3 : BlockFormat::BC1;
+}
+
+/// @brief Read block of level as RGBA, gray is replicated to RGB, missing alpha is opaque
+static void BCFetchBlock(
+    const u8* level, i32 width, i32 height, i32 components,
+    i32 blockX, i32 blockY, BCBlock* block
+) {
+    i32 alphaComponent = components == 2 || components == 4 ? components - 1 : -1;
+    ucycles( 16 ) {
+        i32 x = blockX * BLOCK_SIZE + (i32)( i % BLOCK_SIZE );
+        i32 y = blockY * BLOCK_SIZE + (i32)( i / BLOCK_SIZE );
+        x = x < width  ? x : width  - 1;
+        y = y < height ? y : height - 1;
+        const u8* texel = level + ( (usize)y * (usize)width + (usize)x ) * (usize)components;
+        if( components < 3 ) {
+            block->channels[0][i] = (f32)texel[0];
+            block->channels[1][i] = (f32)texel[0];
+            block->channels[2][i] = (f32)texel[0];
+        } else {
+            block->channels[0][i] = (f32)texel[0];
+            block->channels[1][i] = (f32)texel[1];
+            block->channels[2][i] = (f32)texel[2];
+        }
+        block->channels[3][i] = alphaComponent >= 0 ? (f32)texel[alphaComponent] : 255.0f;
+    }
+}
+
+/// @brief Index of closest palette entry of every texel
+/// @param palette paletteCount entries, four values each, only channelCount are used
+/// @return sum of squared errors
+static f32 BCNearestIndices(
+    const BCBlock* block, u32 firstChannel, u32 channelCount,
+    const f32* palette, u32 paletteCount, u8* indices
+) {
+    // NOTE(alicia): SSE, four texels at a time
+    __m128 totalError = _mm_setzero_ps();
+    for( u32 texel = 0; texel < 16; texel += 4 ) {
+        __m128  bestError = _mm_set1_ps( F32::MAX );
+        __m128i bestIndex = _mm_setzero_si128();
+        ucyclesi( paletteCount, entry ) {
+            __m128 error = _mm_setzero_ps();
+            ucyclesi( channelCount, channel ) {
+                __m128 difference = _mm_sub_ps(
+                    _mm_load_ps( &block->channels[firstChannel + channel][texel] ),
+                    _mm_set1_ps( palette[entry * 4 + channel] )
+                );
+                error = _mm_add_ps( error, _mm_mul_ps( difference, difference ) );
+            }
+            __m128i closer = _mm_castps_si128( _mm_cmplt_ps( error, bestError ) );
+            bestError = _mm_min_ps( error, bestError );
+            bestIndex = _mm_or_si128(
+                _mm_and_si128( closer, _mm_set1_epi32( (i32)entry ) ),
+                _mm_andnot_si128( closer, bestIndex )
+            );
+        }
+        alignas(16) i32 bestIndices[4];
+        _mm_store_si128( (__m128i*)bestIndices, bestIndex );
+        ucycles( 4 ) {
+            indices[texel + i] = (u8)bestIndices[i];
+        }
+        totalError = _mm_add_ps( totalError, bestError );
+    }
+    alignas(16) f32 errors[4];
+    _mm_store_ps( errors, totalError );
+    return errors[0] + errors[1] + errors[2] + errors[3];
+}
+
+static inline f32 BCClampByte( f32 value ) {
+    return smath::clamp( value, 0.0f, 255.0f );
+}
+
+/// @brief Endpoints of segment along principal axis of block that covers every texel
+/// @param iterations number of power iterations the axis is found with
+static void BCFitLine(
+    const BCBlock* block, u32 firstChannel, u32 channelCount, u32 iterations,
+    f32* start, f32* end
+) {
+    f32 mean[4] = {};
+    ucyclesi( channelCount, channel ) {
+        ucycles( 16 ) {
+            mean[channel] += block->channels[firstChannel + channel][i];
+        }
+        mean[channel] /= 16.0f;
+    }
+    f32 covariance[4][4] = {};
+    ucycles( 16 ) {
+        f32 centered[4];
+        ucyclesi( channelCount, channel ) {
+            centered[channel] = block->channels[firstChannel + channel][i] - mean[channel];
+        }
+        ucyclesi( channelCount, row ) {
+            ucyclesi( channelCount, column ) {
+                covariance[row][column] += centered[row] * centered[column];
+            }
+        }
+    }
+
+    // start from the column of the channel that varies the most, it's never orthogonal to the axis
+    usize largest = 0;
+    ucyclesi( channelCount, channel ) {
+        if( covariance[channel][channel] > covariance[largest][largest] ) {
+            largest = channel;
+        }
+    }
+    f32 axis[4] = {};
+    ucyclesi( channelCount, channel ) {
+        axis[channel] = covariance[largest][channel];
+    }
+    ucyclesi( iterations, iteration ) {
+        f32 next[4] = {};
+        f32 length  = 0.0f;
+        ucyclesi( channelCount, row ) {
+            ucyclesi( channelCount, column ) {
+                next[row] += covariance[row][column] * axis[column];
+            }
+            length += next[row] * next[row];
+        }
+        if( length <= 0.0f ) {
+            break;
+        }
+        length = smath::sqrt( length );
+        ucyclesi( channelCount, channel ) {
+            axis[channel] = next[channel] / length;
+        }
+    }
+
+    f32 minT = 0.0f;
+    f32 maxT = 0.0f;
+    ucycles( 16 ) {
+        f32 t = 0.0f;
+        ucyclesi( channelCount, channel ) {
+            t += ( block->channels[firstChannel + channel][i] - mean[channel] ) * axis[channel];
+        }
+        minT = t < minT ? t : minT;
+        maxT = t > maxT ? t : maxT;
+    }
+    ucyclesi( channelCount, channel ) {
+        start[channel] = BCClampByte( mean[channel] + axis[channel] * minT );
+        end[channel]   = BCClampByte( mean[channel] + axis[channel] * maxT );
+    }
+}
+
+/// @brief Least squares endpoints for indices
+/// @param weights fraction of end in every palette entry
+/// @return false if indices don't constrain both endpoints
+static bool BCRefineLine(
+    const BCBlock* block, u32 firstChannel, u32 channelCount,
+    const u8* indices, const f32* weights,
+    f32* start, f32* end
+) {
+    f32 startStart = 0.0f;
+    f32 endEnd     = 0.0f;
+    f32 startEnd   = 0.0f;
+    f32 startTexel[4] = {};
+    f32 endTexel[4]   = {};
+    ucycles( 16 ) {
+        f32 weight = weights[indices[i]];
+        f32 inverse = 1.0f - weight;
+        startStart += inverse * inverse;
+        endEnd     += weight * weight;
+        startEnd   += inverse * weight;
+        ucyclesi( channelCount, channel ) {
+            f32 value = block->channels[firstChannel + channel][i];
+            startTexel[channel] += inverse * value;
+            endTexel[channel]   += weight * value;
+        }
+    }
+    f32 determinant = startStart * endEnd - startEnd * startEnd;
+    if( determinant < 1e-6f ) {
+        return false;
+    }
+    ucyclesi( channelCount, channel ) {
+        start[channel] = BCClampByte(
+            ( startTexel[channel] * endEnd - endTexel[channel] * startEnd ) / determinant );
+        end[channel] = BCClampByte(
+            ( endTexel[channel] * startStart - startTexel[channel] * startEnd ) / determinant );
+    }
+    return true;
+}
+
+static inline u32 BCQuantize( f32 value, u32 maxValue ) {
+    return (u32)( value * (f32)maxValue / 255.0f + 0.5f );
+}
+
+static u16 BCEncode565( const f32* color ) {
+    return (u16)(
+        ( BCQuantize( color[0], 31 ) << 11 ) |
+        ( BCQuantize( color[1], 63 ) << 5 ) |
+        BCQuantize( color[2], 31 )
+    );
+}
+
+static void BCDecode565( u16 packed, f32* color ) {
+    u32 r = ( packed >> 11 ) & 31;
+    u32 g = ( packed >> 5 ) & 63;
+    u32 b = packed & 31;
+    color[0] = (f32)( ( r << 3 ) | ( r >> 2 ) );
+    color[1] = (f32)( ( g << 2 ) | ( g >> 4 ) );
+    color[2] = (f32)( ( b << 3 ) | ( b >> 2 ) );
+    color[3] = 255.0f;
+}
+
+static inline u32 BCRefineIterations( Core::BlockQuality quality ) {
+    switch( quality ) {
+        case Core::BlockQuality::FAST:   return 1;
+        case Core::BlockQuality::NORMAL: return 2;
+        default: return 8;
+    }
+}
+static inline u32 BCAxisIterations( Core::BlockQuality quality ) {
+    return quality == Core::BlockQuality::FAST ? 2 : 8;
+}
+
+/// @brief Encode RGB of block as a four color BC1 block
+static f32 BCEncodeColor( const BCBlock* block, Core::BlockQuality quality, u8* out ) {
+    // fraction of second endpoint in palette entries 0, 1, 2 and 3
+    const f32 weights[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+
+    f32 start[4], end[4];
+    BCFitLine( block, 0, 3, BCAxisIterations( quality ), start, end );
+
+    f32 bestError = F32::MAX;
+    u32 iterationCount = BCRefineIterations( quality );
+    ucyclesi( iterationCount, iteration ) {
+        u16 color0 = BCEncode565( start );
+        u16 color1 = BCEncode565( end );
+        // four color mode needs color0 > color1
+        if( color0 < color1 ) {
+            u16 swap = color0;
+            color0 = color1;
+            color1 = swap;
+        }
+        f32 palette[4 * 4];
+        BCDecode565( color0, palette + 0 );
+        BCDecode565( color1, palette + 4 );
+        ucycles( 3 ) {
+            palette[8 + i]  = ( 2.0f * palette[i] + palette[4 + i] ) / 3.0f;
+            palette[12 + i] = ( palette[i] + 2.0f * palette[4 + i] ) / 3.0f;
+        }
+        u8 indices[16];
+        f32 error = BCNearestIndices( block, 0, 3, palette, color0 == color1 ? 1 : 4, indices );
+        if( error >= bestError ) {
+            break;
+        }
+        bestError = error;
+
+        u32 packedIndices = 0;
+        ucycles( 16 ) {
+            packedIndices |= (u32)indices[i] << ( i * 2 );
+        }
+        out[0] = (u8)( color0 & 0xFF );
+        out[1] = (u8)( color0 >> 8 );
+        out[2] = (u8)( color1 & 0xFF );
+        out[3] = (u8)( color1 >> 8 );
+        ucycles( 4 ) {
+            out[4 + i] = (u8)( packedIndices >> ( i * 8 ) );
+        }
+
+        if( color0 == color1 || !BCRefineLine( block, 0, 3, indices, weights, start, end ) ) {
+            break;
+        }
+    }
+    return bestError;
+}
+
+/// @brief Palette of a BC4 block, eight interpolated values if first endpoint is larger,
+/// otherwise six and 0 and 255
+static void BCSinglePalette( u32 endpoint0, u32 endpoint1, f32* palette ) {
+    f32 first  = (f32)endpoint0;
+    f32 second = (f32)endpoint1;
+    palette[0] = first;
+    palette[4] = second;
+    if( endpoint0 > endpoint1 ) {
+        for( u32 entry = 2; entry < 8; ++entry ) {
+            palette[entry * 4] = ( (f32)( 8 - entry ) * first + (f32)( entry - 1 ) * second ) / 7.0f;
+        }
+    } else {
+        for( u32 entry = 2; entry < 6; ++entry ) {
+            palette[entry * 4] = ( (f32)( 6 - entry ) * first + (f32)( entry - 1 ) * second ) / 5.0f;
+        }
+        palette[6 * 4] = 0.0f;
+        palette[7 * 4] = 255.0f;
+    }
+}
+
+/// @brief Encode channel with endpoints if it's better than best error
+static void BCTrySingle(
+    const BCBlock* block, u32 channel, u32 endpoint0, u32 endpoint1,
+    u8* out, f32* bestError
+) {
+    f32 palette[8 * 4];
+    BCSinglePalette( endpoint0, endpoint1, palette );
+    u8 indices[16];
+    f32 error = BCNearestIndices( block, channel, 1, palette, 8, indices );
+    if( error >= *bestError ) {
+        return;
+    }
+    *bestError = error;
+
+    u64 packedIndices = 0;
+    ucycles( 16 ) {
+        packedIndices |= (u64)indices[i] << ( i * 3 );
+    }
+    out[0] = (u8)endpoint0;
+    out[1] = (u8)endpoint1;
+    ucycles( 6 ) {
+        out[2 + i] = (u8)( packedIndices >> ( i * 8 ) );
+    }
+}
+
+/// @brief Encode single channel of block as a BC4 block
+static f32 BCEncodeSingle( const BCBlock* block, u32 channel, Core::BlockQuality quality, u8* out ) {
+    const f32* values = block->channels[channel];
+    u32 minValue = 255, maxValue = 0;
+    // range without 0 and 255, six value mode has those exactly
+    u32 innerMin = 255, innerMax = 0;
+    ucycles( 16 ) {
+        u32 value = (u32)values[i];
+        minValue = value < minValue ? value : minValue;
+        maxValue = value > maxValue ? value : maxValue;
+        if( value > 0 && value < 255 ) {
+            innerMin = value < innerMin ? value : innerMin;
+            innerMax = value > innerMax ? value : innerMax;
+        }
+    }
+    if( innerMin > innerMax ) {
+        innerMin = innerMax = minValue;
+    }
+
+    f32 bestError = F32::MAX;
+    BCTrySingle( block, channel, maxValue, minValue, out, &bestError );
+    if( quality == Core::BlockQuality::FAST || bestError == 0.0f ) {
+        return bestError;
+    }
+    BCTrySingle( block, channel, innerMin, innerMax, out, &bestError );
+    if( quality != Core::BlockQuality::HIGH ) {
+        return bestError;
+    }
+    // NOTE(alicia): shrinking the range often places interpolated values closer to texels
+    for( u32 shrinkMax = 0; shrinkMax < 4; ++shrinkMax ) {
+        for( u32 shrinkMin = 0; shrinkMin < 4; ++shrinkMin ) {
+            if( shrinkMax + shrinkMin == 0 ) {
+                continue;
+            }
+            if( maxValue >= minValue + shrinkMax + shrinkMin + 1 ) {
+                BCTrySingle( block, channel, maxValue - shrinkMax, minValue + shrinkMin, out, &bestError );
+            }
+            if( innerMax >= innerMin + shrinkMax + shrinkMin ) {
+                BCTrySingle( block, channel, innerMin + shrinkMin, innerMax - shrinkMax, out, &bestError );
+            }
+        }
+    }
+    return bestError;
+}
+
+static void BCPutBits( u8* out, u32* bit, u32 value, u32 count ) {
+    ucycles( count ) {
+        if( value & ( 1u << i ) ) {
+            out[*bit / 8] |= (u8)( 1u << ( *bit % 8 ) );
+        }
+        (*bit)++;
+    }
+}
+
+/// @brief Quantize endpoint to seven bits per component and a shared p-bit
+static void BC7QuantizeEndpoint( const f32* endpoint, u32 pBit, u32* quantized, f32* decoded ) {
+    ucycles( 4 ) {
+        f32 value = ( endpoint[i] - (f32)pBit ) * 0.5f + 0.5f;
+        i32 level = (i32)smath::clamp( value, 0.0f, 127.0f );
+        quantized[i] = (u32)level;
+        decoded[i]   = (f32)( ( quantized[i] << 1 ) | pBit );
+    }
+}
+
+/// @brief p-bit that quantizes endpoint with the least error
+static u32 BC7ChoosePBit( const f32* endpoint ) {
+    f32 errors[2] = {};
+    ucyclesi( 2, pBit ) {
+        u32 quantized[4];
+        f32 decoded[4];
+        BC7QuantizeEndpoint( endpoint, (u32)pBit, quantized, decoded );
+        ucycles( 4 ) {
+            f32 difference = decoded[i] - endpoint[i];
+            errors[pBit] += difference * difference;
+        }
+    }
+    return errors[1] < errors[0] ? 1 : 0;
+}
+
+/// @brief Encode block as a BC7 mode 6 block with endpoints if it's better than best error
+/// @return indices chosen
+static bool BC7TryEndpoints(
+    const BCBlock* block, const f32* start, const f32* end, u32 pBit0, u32 pBit1,
+    u8* out, f32* bestError, u8* bestIndices
+) {
+    u32 quantized[2][4];
+    f32 decoded[2][4];
+    BC7QuantizeEndpoint( start, pBit0, quantized[0], decoded[0] );
+    BC7QuantizeEndpoint( end, pBit1, quantized[1], decoded[1] );
+
+    f32 palette[16 * 4];
+    ucyclesi( 16, entry ) {
+        ucycles( 4 ) {
+            u32 value =
+                ( ( 64 - BC7_WEIGHTS[entry] ) * (u32)decoded[0][i] +
+                BC7_WEIGHTS[entry] * (u32)decoded[1][i] + 32 ) >> 6;
+            palette[entry * 4 + i] = (f32)value;
+        }
+    }
+    u8 indices[16];
+    f32 error = BCNearestIndices( block, 0, 4, palette, 16, indices );
+    if( error >= *bestError ) {
+        return false;
+    }
+    *bestError = error;
+    ucycles( 16 ) {
+        bestIndices[i] = indices[i];
+    }
+
+    // anchor index has an implicit zero top bit, flip segment if it's set
+    u32 first  = 0;
+    u32 second = 1;
+    u32 pBits[2] = { pBit0, pBit1 };
+    if( indices[0] >= 8 ) {
+        first  = 1;
+        second = 0;
+        ucycles( 16 ) {
+            indices[i] = (u8)( 15 - indices[i] );
+        }
+    }
+
+    ucycles( 16 ) {
+        out[i] = 0;
+    }
+    u32 bit = 0;
+    BCPutBits( out, &bit, BC7_MODE_6, 7 );
+    ucycles( 4 ) {
+        BCPutBits( out, &bit, quantized[first][i], 7 );
+        BCPutBits( out, &bit, quantized[second][i], 7 );
+    }
+    BCPutBits( out, &bit, pBits[first], 1 );
+    BCPutBits( out, &bit, pBits[second], 1 );
+    BCPutBits( out, &bit, indices[0], 3 );
+    for( u32 texel = 1; texel < 16; ++texel ) {
+        BCPutBits( out, &bit, indices[texel], 4 );
+    }
+    return true;
+}
+
+/// @brief Encode RGBA of block as a BC7 mode 6 block
+static f32 BCEncodeBC7( const BCBlock* block, Core::BlockQuality quality, u8* out ) {
+    f32 weights[16];
+    ucycles( 16 ) {
+        weights[i] = (f32)BC7_WEIGHTS[i] / 64.0f;
+    }
+
+    f32 start[4], end[4];
+    BCFitLine( block, 0, 4, BCAxisIterations( quality ), start, end );
+
+    f32 bestError = F32::MAX;
+    u32 iterationCount = BCRefineIterations( quality );
+    ucyclesi( iterationCount, iteration ) {
+        f32 previousError = bestError;
+        u8 indices[16];
+        bool improved = false;
+        if( quality == Core::BlockQuality::HIGH ) {
+            ucyclesi( 4, pBits ) {
+                improved |= BC7TryEndpoints(
+                    block, start, end, (u32)pBits & 1, (u32)pBits >> 1,
+                    out, &bestError, indices
+                );
+            }
+        } else {
+            improved = BC7TryEndpoints(
+                block, start, end, BC7ChoosePBit( start ), BC7ChoosePBit( end ),
+                out, &bestError, indices
+            );
+        }
+        if( !improved || bestError >= previousError || bestError == 0.0f ) {
+            break;
+        }
+        if( !BCRefineLine( block, 0, 4, indices, weights, start, end ) ) {
+            break;
+        }
+    }
+    return bestError;
+}
+
+static void BCEncodeBlock( const BCBlock* block, Core::BlockFormat format, Core::BlockQuality quality, u8* out ) {
+    switch( format ) {
+        case Core::BlockFormat::BC1: {
+            BCEncodeColor( block, quality, out );
+        } break;
+        case Core::BlockFormat::BC3: {
+            BCEncodeSingle( block, 3, quality, out );
+            BCEncodeColor( block, quality, out + 8 );
+        } break;
+        case Core::BlockFormat::BC4: {
+            BCEncodeSingle( block, 0, quality, out );
+        } break;
+        case Core::BlockFormat::BC5: {
+            BCEncodeSingle( block, 0, quality, out );
+            BCEncodeSingle( block, 1, quality, out + 8 );
+        } break;
+        case Core::BlockFormat::BC7: {
+            BCEncodeBC7( block, quality, out );
+        } break;
+        default: break;
+    }
+}
+
+static void BCEncodeBlocksJob( void* params ) {
+    BCEncodeJob* job = (BCEncodeJob*)params;
+    const BCEncodeState* state = job->state;
+    const Core::MipChain* chain = state->chain;
+
+    u32 level = 0;
+    BCBlock block;
+    for( usize blockIndex = job->firstBlock; blockIndex < job->firstBlock + job->blockCount; ++blockIndex ) {
+        while( blockIndex >= state->levelBlockOffsets[level + 1] ) {
+            level++;
+        }
+        usize levelBlock = blockIndex - state->levelBlockOffsets[level];
+        BCFetchBlock(
+            chain->data + chain->levelOffsets[level],
+            Core::MipLevelSize( chain->width, level ),
+            Core::MipLevelSize( chain->height, level ),
+            chain->colorComponentCount,
+            (i32)( levelBlock % state->blocksX[level] ),
+            (i32)( levelBlock / state->blocksX[level] ),
+            &block
+        );
+        BCEncodeBlock(
+            &block, state->format, state->quality,
+            state->result->data + blockIndex * state->blockBytes
+        );
+    }
+}
+
+bool Core::CompressMipChain(
+    const MipChain* chain,
+    BlockFormat format,
+    BlockQuality quality,
+    JobQueue* queue,
+    CompressedMipChain* result
+) {
+    *result = {};
+    if( !chain->data || chain->levelCount == 0 || format >= BlockFormat::COUNT ) {
+        return false;
+    }
+    BCEncodeState state = {};
+    state.chain      = chain;
+    state.result     = result;
+    state.format     = format;
+    state.quality    = quality;
+    state.blockBytes = BlockFormatBlockBytes( format );
+
+    result->width      = chain->width;
+    result->height     = chain->height;
+    result->format     = format;
+    result->levelCount = chain->levelCount;
+    ucyclesi( chain->levelCount, level ) {
+        usize blocksX = ( (usize)MipLevelSize( chain->width, (u32)level ) + BLOCK_SIZE - 1 ) / BLOCK_SIZE;
+        usize blocksY = ( (usize)MipLevelSize( chain->height, (u32)level ) + BLOCK_SIZE - 1 ) / BLOCK_SIZE;
+        state.blocksX[level] = blocksX;
+        state.levelBlockOffsets[level + 1] = state.levelBlockOffsets[level] + blocksX * blocksY;
+        result->levelOffsets[level] = state.levelBlockOffsets[level] * state.blockBytes;
+        result->levelSizes[level]   = blocksX * blocksY * state.blockBytes;
+    }
+    usize blockCount = state.levelBlockOffsets[chain->levelCount];
+    result->totalSize = blockCount * state.blockBytes;
+    result->data = (u8*)Platform::Alloc( result->totalSize );
+    if( !result->data ) {
+        LOG_ERROR( "CompressMipChain > Failed to allocate compressed chain!" );
+        *result = {};
+        return false;
+    }
+
+    // NOTE(alicia): levels are independent, so the chain is split into
+    // ranges of blocks regardless of which level they belong to
+    usize chunkCount = JobQueueThreadCount( queue );
+    usize maxChunkCount = blockCount / BLOCK_MIN_JOB_BLOCKS;
+    if( chunkCount > maxChunkCount ) {
+        chunkCount = maxChunkCount;
+    }
+    if( chunkCount > BLOCK_MAX_JOBS ) {
+        chunkCount = BLOCK_MAX_JOBS;
+    }
+    if( chunkCount < 1 ) {
+        chunkCount = 1;
+    }
+    BCEncodeJob jobs[BLOCK_MAX_JOBS];
+    ucycles( chunkCount ) {
+        jobs[i].state      = &state;
+        jobs[i].firstBlock = blockCount * i / chunkCount;
+        jobs[i].blockCount = blockCount * ( i + 1 ) / chunkCount - jobs[i].firstBlock;
+    }
+    if( chunkCount == 1 ) {
+        BCEncodeBlocksJob( &jobs[0] );
+    } else {
+        JobCounter counter = {};
+        ucycles( chunkCount ) {
+            PushJob( queue, BCEncodeBlocksJob, &jobs[i], &counter );
+        }
+        WaitForJobs( queue, &counter );
+    }
+    return true;
+}
+
+void Core::FreeCompressedMipChain( CompressedMipChain* chain ) {
+    if( chain->data ) {
+        Platform::Free( chain->data );
+    }
+    *chain = {};
+}
+
+static u32 BCGetBits( const u8* block, u32* bit, u32 count ) {
+    u32 value = 0;
+    ucycles( count ) {
+        value |= (u32)( ( block[*bit / 8] >> ( *bit % 8 ) ) & 1 ) << i;
+        (*bit)++;
+    }
+    return value;
+}
+
+/// @brief Decode channel of texels from a BC4 block
+static void BCDecodeSingle( const u8* block, u32 channel, u8 texels[16][4] ) {
+    f32 palette[8 * 4];
+    BCSinglePalette( block[0], block[1], palette );
+    u64 packedIndices = 0;
+    ucycles( 6 ) {
+        packedIndices |= (u64)block[2 + i] << ( i * 8 );
+    }
+    ucycles( 16 ) {
+        u32 index = (u32)( packedIndices >> ( i * 3 ) ) & 7;
+        texels[i][channel] = (u8)( palette[index * 4] + 0.5f );
+    }
+}
+
+/// @brief Decode RGB of texels from a four color BC1 block
+static void BCDecodeColor( const u8* block, u8 texels[16][4] ) {
+    f32 palette[4 * 4];
+    BCDecode565( (u16)( block[0] | ( block[1] << 8 ) ), palette + 0 );
+    BCDecode565( (u16)( block[2] | ( block[3] << 8 ) ), palette + 4 );
+    ucycles( 3 ) {
+        palette[8 + i]  = ( 2.0f * palette[i] + palette[4 + i] ) / 3.0f;
+        palette[12 + i] = ( palette[i] + 2.0f * palette[4 + i] ) / 3.0f;
+    }
+    u32 packedIndices = (u32)block[4] | ( (u32)block[5] << 8 ) | ( (u32)block[6] << 16 ) | ( (u32)block[7] << 24 );
+    ucycles( 16 ) {
+        u32 index = ( packedIndices >> ( i * 2 ) ) & 3;
+        ucyclesi( 3, channel ) {
+            texels[i][channel] = (u8)( palette[index * 4 + channel] + 0.5f );
+        }
+    }
+}
+
+/// @brief Decode a BC7 mode 6 block
+static void BCDecodeBC7( const u8* block, u8 texels[16][4] ) {
+    u32 bit = 0;
+    if( BCGetBits( block, &bit, 7 ) != BC7_MODE_6 ) {
+        return;
+    }
+    u32 endpoints[2][4];
+    ucycles( 4 ) {
+        endpoints[0][i] = BCGetBits( block, &bit, 7 ) << 1;
+        endpoints[1][i] = BCGetBits( block, &bit, 7 ) << 1;
+    }
+    u32 pBit0 = BCGetBits( block, &bit, 1 );
+    u32 pBit1 = BCGetBits( block, &bit, 1 );
+    ucycles( 4 ) {
+        endpoints[0][i] |= pBit0;
+        endpoints[1][i] |= pBit1;
+    }
+    ucyclesi( 16, texel ) {
+        u32 index = BCGetBits( block, &bit, texel == 0 ? 3 : 4 );
+        ucycles( 4 ) {
+            texels[texel][i] = (u8)(
+                ( ( 64 - BC7_WEIGHTS[index] ) * endpoints[0][i] + BC7_WEIGHTS[index] * endpoints[1][i] + 32 ) >> 6 );
+        }
+    }
+}
+
+static void BCDecodeBlock( const u8* block, Core::BlockFormat format, u8 texels[16][4] ) {
+    switch( format ) {
+        case Core::BlockFormat::BC1: {
+            BCDecodeColor( block, texels );
+        } break;
+        case Core::BlockFormat::BC3: {
+            BCDecodeSingle( block, 3, texels );
+            BCDecodeColor( block + 8, texels );
+        } break;
+        case Core::BlockFormat::BC4: {
+            BCDecodeSingle( block, 0, texels );
+        } break;
+        case Core::BlockFormat::BC5: {
+            BCDecodeSingle( block, 0, texels );
+            BCDecodeSingle( block + 8, 1, texels );
+        } break;
+        case Core::BlockFormat::BC7: {
+            BCDecodeBC7( block, texels );
+        } break;
+        default: break;
+    }
+}
+
+/// @brief Number of components format keeps
+static u32 BCFormatChannelCount( Core::BlockFormat format ) {
+    switch( format ) {
+        case Core::BlockFormat::BC1: return 3;
+        case Core::BlockFormat::BC4: return 1;
+        case Core::BlockFormat::BC5: return 2;
+        default: return 4;
+    }
+}
+
+void Core::DecompressBlocks( BlockFormat format, i32 width, i32 height, const void* blocks, u8* result ) {
+    i32 blocksX = ( width + BLOCK_SIZE - 1 ) / BLOCK_SIZE;
+    i32 blocksY = ( height + BLOCK_SIZE - 1 ) / BLOCK_SIZE;
+    usize blockBytes = BlockFormatBlockBytes( format );
+    const u8* block = (const u8*)blocks;
+    u8 texels[16][4];
+    for( i32 blockY = 0; blockY < blocksY; ++blockY ) {
+        for( i32 blockX = 0; blockX < blocksX; ++blockX ) {
+            ucycles( 16 ) {
+                texels[i][0] = 0;
+                texels[i][1] = 0;
+                texels[i][2] = 0;
+                texels[i][3] = 255;
+            }
+            BCDecodeBlock( block, format, texels );
+            block += blockBytes;
+            ucycles( 16 ) {
+                i32 x = blockX * BLOCK_SIZE + (i32)( i % BLOCK_SIZE );
+                i32 y = blockY * BLOCK_SIZE + (i32)( i / BLOCK_SIZE );
+                if( x >= width || y >= height ) {
+                    continue;
+                }
+                Platform::MemCopy( 4, texels[i], result + ( (usize)y * (usize)width + (usize)x ) * 4 );
+            }
+        }
+    }
+}
+
+void Core::BenchmarkBlockCompression( const Image* image, JobQueue* queue ) {
+    if( !image->data ) {
+        return;
+    }
+    // single level chain that refers to image
+    MipChain chain = {};
+    chain.width  = image->width;
+    chain.height = image->height;
+    chain.colorComponentCount = image->colorComponentCount;
+    chain.levelCount = 1;
+    chain.totalSize  = image->totalSize;
+    chain.data       = image->data;
+
+    f64 megapixels = (f64)image->width * (f64)image->height / 1000000.0;
+    i32 blocksX = ( image->width + BLOCK_SIZE - 1 ) / BLOCK_SIZE;
+    i32 blocksY = ( image->height + BLOCK_SIZE - 1 ) / BLOCK_SIZE;
+    LOG_INFO( "BenchmarkBlockCompression > %ix%i, %.2f megapixels, %u threads",
+        image->width, image->height, megapixels, JobQueueThreadCount( queue ) );
+
+    ucyclesi( BLOCK_QUALITY_COUNT, quality ) {
+        ucyclesi( BLOCK_FORMAT_COUNT, format ) {
+            CompressedMipChain compressed = {};
+            u64 startTime = Platform::GetPerformanceCounter();
+            if( !CompressMipChain( &chain, (BlockFormat)format, (BlockQuality)quality, queue, &compressed ) ) {
+                continue;
+            }
+            f64 elapsedSeconds = (f64)( Platform::GetPerformanceCounter() - startTime ) /
+                (f64)Platform::GetPerformanceFrequency();
+
+            // error of every texel inside the image, over components format keeps
+            u32 channelCount = BCFormatChannelCount( (BlockFormat)format );
+            f64 squaredError = 0.0;
+            BCBlock block;
+            u8 texels[16][4];
+            for( i32 blockY = 0; blockY < blocksY; ++blockY ) {
+                for( i32 blockX = 0; blockX < blocksX; ++blockX ) {
+                    BCFetchBlock(
+                        image->data, image->width, image->height, image->colorComponentCount,
+                        blockX, blockY, &block
+                    );
+                    BCDecodeBlock(
+                        compressed.data + ( (usize)blockY * (usize)blocksX + (usize)blockX ) *
+                            BlockFormatBlockBytes( (BlockFormat)format ),
+                        (BlockFormat)format, texels
+                    );
+                    ucycles( 16 ) {
+                        if( blockX * BLOCK_SIZE + (i32)( i % BLOCK_SIZE ) >= image->width ||
+                            blockY * BLOCK_SIZE + (i32)( i / BLOCK_SIZE ) >= image->height ) {
+                            continue;
+                        }
+                        ucyclesi( channelCount, channel ) {
+                            f64 difference = (f64)texels[i][channel] - (f64)block.channels[channel][i];
+                            squaredError += difference * difference;
+                        }
+                    }
+                }
+            }
+            f64 rmse = smath::sqrt( (f32)( squaredError /
+                ( (f64)image->width * (f64)image->height * (f64)channelCount ) ) );
+
+            LOG_INFO( "BenchmarkBlockCompression > %s %-6s %8.2f MP/s RMSE %.3f",
+                BlockFormatToString( (BlockFormat)format ),
+                BlockQualityToString( (BlockQuality)quality ),
+                elapsedSeconds > 0.0 ? megapixels / elapsedSeconds : 0.0,
+                rmse
+            );
+            FreeCompressedMipChain( &compressed );
+        }
+    }
+}
@@ -0,0 +1,108 @@
+/**
+ * Description:  Block compression of textures
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "pch.hpp"
+#include "core/image.hpp"
+
+namespace Core {
+
+// forward declaration
+struct JobQueue;
+
+/// @brief Smallest number of blocks worth encoding on its own job
+#define BLOCK_MIN_JOB_BLOCKS 1024
+#define BLOCK_MAX_JOBS 64
+/// @brief Blocks are 4x4 texels in every format
+#define BLOCK_SIZE 4
+
+/// @brief Block compressed formats, every block is 4x4 texels
+enum class BlockFormat : u32 {
+    /// @brief RGB, 8 bytes per block
+    BC1,
+    /// @brief RGBA, BC1 color and BC4 alpha, 16 bytes per block
+    BC3,
+    /// @brief Single component, 8 bytes per block
+    BC4,
+    /// @brief Two components, two BC4 blocks, 16 bytes per block
+    BC5,
+    /// @brief RGBA, 16 bytes per block, only mode 6 is encoded
+    BC7,
+
+    COUNT
+};
+#define BLOCK_FORMAT_COUNT ((usize)Core::BlockFormat::COUNT)
+const char* BlockFormatToString( BlockFormat format );
+/// @brief Number of bytes of a single block of format
+usize BlockFormatBlockBytes( BlockFormat format );
+
+/// @brief Speed and quality trade-off of endpoint fitting
+enum class BlockQuality : u32 {
+    /// @brief Endpoints along a rough principal axis, no refinement
+    FAST,
+    /// @brief Endpoints along principal axis, refined once with least squares
+    NORMAL,
+    /// @brief Endpoints refined until error stops improving, endpoint and p-bit search
+    HIGH,
+
+    COUNT
+};
+#define BLOCK_QUALITY_COUNT ((usize)Core::BlockQuality::COUNT)
+const char* BlockQualityToString( BlockQuality quality );
+
+/// @brief Every level of a mip chain block compressed
+struct CompressedMipChain {
+    i32 width, height;
+    BlockFormat format;
+    u32 levelCount;
+    /// @brief Offset of every level in data, levels are packed back to back starting with full size
+    usize levelOffsets[IMAGE_MAX_MIP_LEVELS];
+    usize levelSizes[IMAGE_MAX_MIP_LEVELS];
+    usize totalSize;
+    u8* data;
+};
+
+/// @brief Format image content is compressed to.
+/// Normal maps are BC5, z is reconstructed from x and y when sampled.
+/// Linear images are BC4, only their first component is kept, as with specular maps.
+/// sRGB color is BC7, or BC1 and BC3 with alpha when quality is FAST
+/// @param content what image represents
+/// @param colorComponentCount number of components of image
+/// @param quality quality preset
+/// @return block format
+BlockFormat ChooseBlockFormat( ImageContent content, i32 colorComponentCount, BlockQuality quality );
+
+/// @brief Block compress every level of mip chain, blocks are encoded in parallel ranges with SSE.
+/// Blocks past the edges of a level repeat its last row and column
+/// @param chain mip chain
+/// @param format format to compress to
+/// @param quality quality preset
+/// @param queue job queue blocks are encoded on, can be nullptr
+/// @param result [out] compressed chain, free with FreeCompressedMipChain
+/// @return true if successful
+bool CompressMipChain(
+    const MipChain* chain,
+    BlockFormat format,
+    BlockQuality quality,
+    JobQueue* queue,
+    CompressedMipChain* result
+);
+void FreeCompressedMipChain( CompressedMipChain* chain );
+
+/// @brief Decode every block of a level to tightly packed RGBA8 texels.
+/// Components format doesn't keep are zero, alpha is 255 unless format keeps it
+/// @param format format of blocks
+/// @param width,height level dimensions in texels
+/// @param blocks blocks of level
+/// @param result [out] width * height * 4 bytes
+void DecompressBlocks( BlockFormat format, i32 width, i32 height, const void* blocks, u8* result );
+
+/// @brief Compress image to every format with every quality preset and
+/// log megapixels per second and RMSE of each
+/// @param image image to compress
+/// @param queue job queue blocks are encoded on, can be nullptr
+void BenchmarkBlockCompression( const Image* image, JobQueue* queue );
+
+} // namespace Core
@@ -0,0 +1,718 @@
+/**
+ * Description:  Binary asset cache
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "core/cache.hpp"
+#include "core/jobs.hpp"
+#include "core/mesh.hpp"
+#include "core/meshlet.hpp"
+#include "core/renderex.hpp"
+#include "core/texture.hpp"
+#include "platform/io.hpp"
+#include "platform/renderer.hpp"
+#include "util.hpp"
+
+/// @brief Size of blocks that are hashed independently
+#define CACHE_HASH_BLOCK_SIZE MEGABYTES(16)
+
+struct HashBlockParams {
+    const u8* data;
+    usize size;
+    u64* result;
+};
+
+static void HashBlockJob( void* params ) {
+    HashBlockParams* block = (HashBlockParams*)params;
+    *block->result = hashBytes( block->size, block->data, 0 );
+}
+
+u64 Core::HashContents( usize size, const void* data, JobQueue* queue ) {
+    if( size <= (usize)CACHE_HASH_BLOCK_SIZE ) {
+        return hashBytes( size, data, 0 );
+    }
+
+    usize blockCount = ( size + CACHE_HASH_BLOCK_SIZE - 1 ) / CACHE_HASH_BLOCK_SIZE;
+    u64* blockHashes = (u64*)Platform::Alloc( blockCount * sizeof(u64) );
+    if( !blockHashes ) {
+        // NOTE(alicia): nowhere to keep block hashes, result won't match HashFileContents
+        // so cached data is rebuilt instead of reused
+        LOG_WARN( "HashContents > Failed to allocate block hashes, hashing %llu bytes as one block!", size );
+        return hashBytes( size, data, (u64)size );
+    }
+    HashBlockParams* blocks = (HashBlockParams*)Platform::Alloc( blockCount * sizeof(HashBlockParams) );
+
+    if( blocks ) {
+        Core::JobCounter counter = {};
+        ucycles( blockCount ) {
+            usize offset = i * CACHE_HASH_BLOCK_SIZE;
+            blocks[i].data   = (const u8*)data + offset;
+            blocks[i].size   = size - offset < (usize)CACHE_HASH_BLOCK_SIZE ? size - offset : CACHE_HASH_BLOCK_SIZE;
+            blocks[i].result = &blockHashes[i];
+            Core::PushJob( queue, HashBlockJob, &blocks[i], &counter );
+        }
+        Core::WaitForJobs( queue, &counter );
+    } else {
+        // NOTE(alicia): same blocks as the jobs, hashed one at a time like HashFileContents
+        LOG_WARN( "HashContents > Failed to allocate job parameters, hashing %llu blocks serially!", blockCount );
+        ucycles( blockCount ) {
+            usize offset    = i * CACHE_HASH_BLOCK_SIZE;
+            usize blockSize = size - offset < (usize)CACHE_HASH_BLOCK_SIZE ? size - offset : CACHE_HASH_BLOCK_SIZE;
+            blockHashes[i] = hashBytes( blockSize, (const u8*)data + offset, 0 );
+        }
+    }
+
+    // NOTE(alicia): final hash is a hash of block hashes, seeded with total size
+    u64 result = hashBytes( blockCount * sizeof(u64), blockHashes, (u64)size );
+
+    if( blocks ) {
+        Platform::Free( blocks );
+    }
+    Platform::Free( blockHashes );
+    return result;
+}
+
+bool Core::HashFileContents( const char* filePath, u64* hash, usize* size ) {
+    Platform::FileStream file = {};
+    if( !Platform::OpenFileStream( filePath, Platform::FileStreamMode::READ, &file ) ) {
+        return false;
+    }
+    *size = file.size;
+
+    // NOTE(alicia): same blocks as HashContents, only one is in memory at a time
+    usize blockSize  = file.size < (usize)CACHE_HASH_BLOCK_SIZE ? file.size : (usize)CACHE_HASH_BLOCK_SIZE;
+    usize blockCount = ( file.size + CACHE_HASH_BLOCK_SIZE - 1 ) / CACHE_HASH_BLOCK_SIZE;
+    u8* block = (u8*)Platform::Alloc( blockSize ? blockSize : 1 );
+    u64* blockHashes = (u64*)Platform::Alloc( ( blockCount ? blockCount : 1 ) * sizeof(u64) );
+    bool success = block && blockHashes;
+    for( usize i = 0; success && i < blockCount; ++i ) {
+        usize offset = i * CACHE_HASH_BLOCK_SIZE;
+        usize readSize = file.size - offset < blockSize ? file.size - offset : blockSize;
+        success = Platform::ReadFileStream( &file, offset, readSize, block ) == readSize;
+        if( success ) {
+            blockHashes[i] = hashBytes( readSize, block, 0 );
+        }
+    }
+    if( success ) {
+        if( file.size <= (usize)CACHE_HASH_BLOCK_SIZE ) {
+            *hash = blockCount ? blockHashes[0] : hashBytes( 0, block, 0 );
+        } else {
+            *hash = hashBytes( blockCount * sizeof(u64), blockHashes, (u64)file.size );
+        }
+    }
+
+    if( block ) {
+        Platform::Free( block );
+    }
+    if( blockHashes ) {
+        Platform::Free( blockHashes );
+    }
+    Platform::CloseFileStream( &file );
+    return success;
+}
+
+void Core::CachePath( u64 hash, const char* extension, usize dstSize, char* dst ) {
+    char hashString[17];
+    u64ToHexString( hash, 17, hashString );
+
+    // NOTE(alicia): source lengths exclude null-terminator except for the last string
+    char directory[CACHE_PATH_MAX_LEN];
+    stringConcat(
+        stringLen( CACHE_DIRECTORY ), CACHE_DIRECTORY,
+        2, "/",
+        CACHE_PATH_MAX_LEN, directory
+    );
+
+    char fileName[CACHE_PATH_MAX_LEN];
+    stringConcat(
+        stringLen( hashString ), hashString,
+        stringLen( extension ) + 1, extension,
+        CACHE_PATH_MAX_LEN, fileName
+    );
+
+    stringConcat(
+        stringLen( directory ), directory,
+        stringLen( fileName ) + 1, fileName,
+        dstSize, dst
+    );
+}
+
+void Core::CreateMeshCacheHeader(
+    u64 sourceHash, usize sourceSize, u32 flags,
+    const Platform::VertexBufferLayout* layout, usize vertexCount,
+    Platform::DataType indexDataType, usize indexCount,
+    usize subMeshCount, usize meshletCount,
+    const MeshMaterialNames* materialNames,
+    const smath::vec3& boundsMin, const smath::vec3& boundsMax,
+    MeshCacheHeader* result
+) {
+    MeshCacheHeader header = {};
+    header.magic      = MESH_CACHE_MAGIC;
+    header.version    = MESH_CACHE_VERSION;
+    header.sourceHash = sourceHash;
+    header.sourceSize = sourceSize;
+    header.flags      = flags;
+
+    header.layoutElementCount = (u32)layout->elementCount;
+    ucycles( layout->elementCount ) {
+        header.layoutStructures[i] = (u32)layout->elements[i].structure;
+        header.layoutDataTypes[i]  = (u32)layout->elements[i].dataType;
+        header.layoutNormalized[i] = layout->elements[i].normalized ? 1 : 0;
+    }
+
+    header.vertexCount  = vertexCount;
+    header.vertexOffset = sizeof(MeshCacheHeader);
+    header.vertexSize   = vertexCount * layout->stride;
+
+    header.indexDataType = (u32)indexDataType;
+    header.indexCount    = indexCount;
+    header.indexOffset   = header.vertexOffset + header.vertexSize;
+    header.indexSize     = indexCount * Platform::DataTypeSize( indexDataType );
+
+    header.subMeshCount  = subMeshCount;
+    header.subMeshOffset = header.indexOffset + header.indexSize;
+    header.subMeshSize   = subMeshCount * sizeof(SubMesh);
+
+    header.meshletCount  = meshletCount;
+    header.meshletOffset = header.subMeshOffset + header.subMeshSize;
+    header.meshletSize   = meshletCount * sizeof(Meshlet);
+
+    header.materialNameOffset = header.meshletOffset + header.meshletSize;
+    if( materialNames ) {
+        header.materialLibraryCount = materialNames->libraryCount;
+        header.materialCount        = materialNames->materialCount;
+        header.materialNameSize     = materialNames->textSize;
+    }
+
+    ucycles( 3 ) {
+        header.boundsMin[i] = boundsMin[i];
+        header.boundsMax[i] = boundsMax[i];
+    }
+    *result = header;
+}
+
+bool Core::WriteMeshCache(
+    u64 sourceHash, usize sourceSize, u32 flags,
+    const Mesh* mesh, const MeshMaterialNames* materialNames
+) {
+    if( !Platform::MakeDirectory( CACHE_DIRECTORY ) ) {
+        LOG_WARN( "MeshCache > Failed to create cache directory!" );
+        return false;
+    }
+
+    char path[CACHE_PATH_MAX_LEN];
+    CachePath( sourceHash, ".mvmesh", CACHE_PATH_MAX_LEN, path );
+
+    Platform::VertexBufferLayout layout;
+    usize vertexDataSize = 0;
+    void* vertexData = CreateMeshVertexData( mesh, ( flags & MESH_CACHE_FLAG_PACKED ) != 0, &layout, &vertexDataSize );
+    DEBUG_ASSERT_LOG( layout.elementCount <= MESH_CACHE_MAX_LAYOUT_ELEMENTS,
+        "MeshCache > Too many layout elements! %llu", layout.elementCount
+    );
+
+    Platform::DataType indexDataType;
+    void* indexData = CreateMeshIndexData( mesh, &indexDataType );
+
+    MeshCacheHeader header;
+    CreateMeshCacheHeader(
+        sourceHash, sourceSize, flags,
+        &layout, mesh->vertexCount,
+        indexDataType, mesh->indexCount,
+        mesh->subMeshCount, mesh->meshletCount,
+        materialNames,
+        mesh->boundsMin, mesh->boundsMax,
+        &header
+    );
+    DEBUG_ASSERT_LOG( header.vertexSize == vertexDataSize,
+        "MeshCache > Vertex data size does not match layout! %llu", vertexDataSize
+    );
+
+    Platform::FreeVertexBufferLayout( &layout );
+
+    bool success =
+        Platform::WriteFile( path, &header, sizeof(MeshCacheHeader), Platform::WriteFileType::CREATE ) &&
+        Platform::WriteFile( path, vertexData, header.vertexSize, Platform::WriteFileType::APPEND ) &&
+        Platform::WriteFile( path, indexData, header.indexSize, Platform::WriteFileType::APPEND ) &&
+        Platform::WriteFile( path, mesh->subMeshes, header.subMeshSize, Platform::WriteFileType::APPEND ) &&
+        Platform::WriteFile( path, mesh->meshlets, header.meshletSize, Platform::WriteFileType::APPEND ) &&
+        Platform::WriteFile(
+            path, materialNames ? materialNames->text : nullptr,
+            header.materialNameSize, Platform::WriteFileType::APPEND
+        );
+
+    FreeMeshIndexData( mesh, indexData );
+    FreeMeshVertexData( mesh, vertexData );
+
+    if( success ) {
+        LOG_INFO( "MeshCache > Wrote \"%s\"", path );
+    } else {
+        LOG_WARN( "MeshCache > Failed to write \"%s\"", path );
+    }
+    return success;
+}
+
+/// @brief Validate cache header against the file it was mapped from
+static bool MeshCacheHeaderValid(
+    const Core::MeshCacheHeader* header, usize fileSize,
+    u64 sourceHash, usize sourceSize, u32 requiredFlags
+) {
+    if(
+        header->magic      != MESH_CACHE_MAGIC   ||
+        header->version    != MESH_CACHE_VERSION ||
+        header->sourceHash != sourceHash         ||
+        header->sourceSize != sourceSize         ||
+        ( header->flags & requiredFlags ) != requiredFlags ||
+        ( header->flags & MESH_CACHE_FLAG_PACKED ) != ( requiredFlags & MESH_CACHE_FLAG_PACKED )
+    ) {
+        return false;
+    }
+    if( header->layoutElementCount == 0 || header->layoutElementCount > MESH_CACHE_MAX_LAYOUT_ELEMENTS ) {
+        return false;
+    }
+    Platform::DataType indexDataType = (Platform::DataType)header->indexDataType;
+    if(
+        indexDataType != Platform::DataType::UNSIGNED_SHORT &&
+        indexDataType != Platform::DataType::UNSIGNED_INT
+    ) {
+        return false;
+    }
+    // NOTE(alicia): a partially written cache fails these
+    if(
+        header->vertexOffset + header->vertexSize > fileSize ||
+        header->indexOffset  + header->indexSize  > fileSize ||
+        header->subMeshOffset + header->subMeshSize > fileSize ||
+        header->meshletOffset + header->meshletSize > fileSize ||
+        header->materialNameOffset + header->materialNameSize > fileSize ||
+        header->indexSize != header->indexCount * Platform::DataTypeSize( indexDataType ) ||
+        header->subMeshSize != header->subMeshCount * sizeof(Core::SubMesh) ||
+        header->meshletSize != header->meshletCount * sizeof(Core::Meshlet)
+    ) {
+        return false;
+    }
+    const Core::SubMesh* subMeshes = (const Core::SubMesh*)( (const u8*)header + header->subMeshOffset );
+    ucycles( header->subMeshCount ) {
+        const Core::SubMesh& subMesh = subMeshes[i];
+        if(
+            (u64)subMesh.firstIndex + subMesh.indexCount  > header->indexCount ||
+            (u64)subMesh.baseVertex + subMesh.vertexCount > header->vertexCount ||
+            (u64)subMesh.firstMeshlet + subMesh.meshletCount > header->meshletCount ||
+            subMesh.lodCount > MESH_MAX_LOD_COUNT
+        ) {
+            return false;
+        }
+        ucyclesi( subMesh.lodCount, level ) {
+            const Core::SubMeshLOD& lod = subMesh.lods[level];
+            if( (u64)lod.firstIndex + lod.indexCount > header->indexCount ) {
+                return false;
+            }
+        }
+    }
+    const Core::Meshlet* meshlets = (const Core::Meshlet*)( (const u8*)header + header->meshletOffset );
+    ucycles( header->meshletCount ) {
+        if( (u64)meshlets[i].firstIndex + meshlets[i].indexCount > header->indexCount ) {
+            return false;
+        }
+    }
+    // NOTE(alicia): every name is null-terminated, so names can be walked without a size
+    const char* names = (const char*)header + header->materialNameOffset;
+    u64 nameCount = 0;
+    ucycles( header->materialNameSize ) {
+        nameCount += names[i] == 0 ? 1 : 0;
+    }
+    if(
+        nameCount != (u64)header->materialLibraryCount + header->materialCount ||
+        ( header->materialNameSize && names[header->materialNameSize - 1] != 0 )
+    ) {
+        return false;
+    }
+    return true;
+}
+
+bool Core::LoadMeshCacheData(
+    u64 sourceHash, usize sourceSize, u32 requiredFlags,
+    MeshUploadData* result
+) {
+    char path[CACHE_PATH_MAX_LEN];
+    CachePath( sourceHash, ".mvmesh", CACHE_PATH_MAX_LEN, path );
+
+    Platform::MappedFile cacheFile = {};
+    if( !Platform::MapFile( path, &cacheFile ) ) {
+        return false;
+    }
+
+    const MeshCacheHeader* header = (const MeshCacheHeader*)cacheFile.data;
+    if(
+        cacheFile.size < sizeof(MeshCacheHeader) ||
+        !MeshCacheHeaderValid( header, cacheFile.size, sourceHash, sourceSize, requiredFlags )
+    ) {
+        LOG_INFO( "MeshCache > \"%s\" is out of date", path );
+        Platform::UnmapFile( &cacheFile );
+        return false;
+    }
+
+    Platform::VertexBufferElement elements[MESH_CACHE_MAX_LAYOUT_ELEMENTS];
+    ucycles( header->layoutElementCount ) {
+        elements[i].structure  = (Platform::DataStructure)header->layoutStructures[i];
+        elements[i].dataType   = (Platform::DataType)header->layoutDataTypes[i];
+        elements[i].normalized = header->layoutNormalized[i] != 0;
+    }
+    Platform::VertexBufferLayout layout = Platform::CreateVertexBufferLayout(
+        header->layoutElementCount,
+        elements
+    );
+    if( header->vertexSize != header->vertexCount * layout.stride ) {
+        LOG_WARN( "MeshCache > \"%s\" vertex layout does not match vertex data!", path );
+        Platform::FreeVertexBufferLayout( &layout );
+        Platform::UnmapFile( &cacheFile );
+        return false;
+    }
+
+    u8* bytes = (u8*)cacheFile.data;
+
+    // NOTE(alicia): vertex and index data are uploaded straight from mapped file
+    *result = {};
+    result->layout         = layout;
+    result->vertexDataSize = header->vertexSize;
+    result->vertexData     = bytes + header->vertexOffset;
+    result->indexCount     = header->indexCount;
+    result->indexDataType  = (Platform::DataType)header->indexDataType;
+    result->indexData      = bytes + header->indexOffset;
+    result->cacheFile      = cacheFile;
+
+    MeshInfo* info = &result->info;
+    info->packed = ( header->flags & MESH_CACHE_FLAG_PACKED ) != 0;
+    ucycles( 3 ) {
+        info->boundsMin[i] = header->boundsMin[i];
+        info->boundsMax[i] = header->boundsMax[i];
+    }
+    info->subMeshes = (SubMesh*)Platform::Alloc( header->subMeshSize );
+    if( info->subMeshes ) {
+        info->subMeshCount = header->subMeshCount;
+        Platform::MemCopy( header->subMeshSize, bytes + header->subMeshOffset, info->subMeshes );
+    }
+    info->meshlets = (Meshlet*)Platform::Alloc( header->meshletSize );
+    if( info->meshlets ) {
+        info->meshletCount = header->meshletCount;
+        Platform::MemCopy( header->meshletSize, bytes + header->meshletOffset, info->meshlets );
+    }
+    CreateMeshDrawList( info );
+
+    if( header->materialNameSize ) {
+        MeshMaterialNames* names = &result->materialNames;
+        names->text = (char*)Platform::Alloc( header->materialNameSize );
+        if( names->text ) {
+            names->libraryCount  = header->materialLibraryCount;
+            names->materialCount = header->materialCount;
+            names->textSize      = header->materialNameSize;
+            Platform::MemCopy( header->materialNameSize, bytes + header->materialNameOffset, names->text );
+        }
+    }
+
+    LOG_INFO( "MeshCache > Loaded \"%s\" %llu vertices %llu indices %llu sub-meshes",
+        path, header->vertexCount, header->indexCount, header->subMeshCount
+    );
+    return true;
+}
+
+#define TEXTURE_CACHE_INDEX_PATH CACHE_DIRECTORY "/textures.mvindex"
+
+/// @brief Header of texture cache index file, entries follow
+struct TextureCacheIndexHeader {
+    u32 magic;
+    u32 version;
+    u32 entryCount;
+    u32 reserved;
+    u64 useCounter;
+};
+
+static u64 TextureCacheKey( u64 sourceHash, u32 variant ) {
+    return hashBytes( sizeof(variant), &variant, sourceHash );
+}
+
+static bool TextureCacheWriteIndex( Core::TextureCache* cache ) {
+    TextureCacheIndexHeader header = {};
+    header.magic      = TEXTURE_CACHE_INDEX_MAGIC;
+    header.version    = TEXTURE_CACHE_VERSION;
+    header.entryCount = cache->entryCount;
+    header.useCounter = cache->useCounter;
+    return
+        Platform::WriteFile(
+            TEXTURE_CACHE_INDEX_PATH, &header, sizeof(header), Platform::WriteFileType::CREATE ) &&
+        Platform::WriteFile(
+            TEXTURE_CACHE_INDEX_PATH, cache->entries, cache->entryCount * sizeof(Core::TextureCacheEntry),
+            Platform::WriteFileType::APPEND
+        );
+}
+
+/// @brief Evict least recently used textures until cache fits in its size limit and has a free entry,
+/// must be called with lock held
+/// @param keep key of texture that is never evicted
+static void TextureCacheEvict( Core::TextureCache* cache, u64 keep ) {
+    // NOTE(alicia): a texture that is mapped by a load in flight can't be removed on every platform,
+    // it stays in the index and the next oldest is evicted instead
+    bool skipped[TEXTURE_CACHE_MAX_ENTRIES] = {};
+    while( cache->totalSize > cache->sizeLimit || cache->entryCount >= TEXTURE_CACHE_MAX_ENTRIES ) {
+        u32 oldest = U32::MAX;
+        ucycles( cache->entryCount ) {
+            if( skipped[i] || cache->entries[i].key == keep ) {
+                continue;
+            }
+            if( oldest == U32::MAX || cache->entries[i].lastUse < cache->entries[oldest].lastUse ) {
+                oldest = (u32)i;
+            }
+        }
+        if( oldest == U32::MAX ) {
+            break;
+        }
+        char path[CACHE_PATH_MAX_LEN];
+        Core::CachePath( cache->entries[oldest].key, ".mvtex", CACHE_PATH_MAX_LEN, path );
+        if( !Platform::RemoveFile( path ) ) {
+            skipped[oldest] = true;
+            continue;
+        }
+        LOG_INFO( "TextureCache > Evicted \"%s\"", path );
+        cache->totalSize -= cache->entries[oldest].size;
+        // swap remove, skipped flags move with entries
+        cache->entryCount--;
+        cache->entries[oldest] = cache->entries[cache->entryCount];
+        skipped[oldest] = skipped[cache->entryCount];
+    }
+}
+
+/// @brief Mark texture as used now, adding it if cache doesn't know it yet, must be called with lock held
+/// @return true if entry was added
+static bool TextureCacheTouch( Core::TextureCache* cache, u64 key, usize size ) {
+    cache->useCounter++;
+    ucycles( cache->entryCount ) {
+        Core::TextureCacheEntry* entry = &cache->entries[i];
+        if( entry->key == key ) {
+            cache->totalSize = cache->totalSize - entry->size + size;
+            entry->size    = size;
+            entry->lastUse = cache->useCounter;
+            return false;
+        }
+    }
+    cache->totalSize += size;
+    TextureCacheEvict( cache, key );
+    if( cache->entryCount >= TEXTURE_CACHE_MAX_ENTRIES ) {
+        cache->totalSize -= size;
+        return false;
+    }
+    Core::TextureCacheEntry* entry = &cache->entries[cache->entryCount++];
+    entry->key     = key;
+    entry->size    = size;
+    entry->lastUse = cache->useCounter;
+    return true;
+}
+
+bool Core::CreateTextureCache( usize sizeLimit, TextureCache* result ) {
+    *result = {};
+    result->sizeLimit = sizeLimit;
+    if( !Platform::SemaphoreCreate( 1, 1, &result->lock ) ) {
+        LOG_ERROR( "TextureCache > Failed to create lock!" );
+        return false;
+    }
+
+    Platform::File index = {};
+    if( Platform::LoadFile( TEXTURE_CACHE_INDEX_PATH, &index ) ) {
+        const TextureCacheIndexHeader* header = (const TextureCacheIndexHeader*)index.data;
+        if(
+            index.size >= sizeof(TextureCacheIndexHeader) &&
+            header->magic   == TEXTURE_CACHE_INDEX_MAGIC &&
+            header->version == TEXTURE_CACHE_VERSION &&
+            header->entryCount <= TEXTURE_CACHE_MAX_ENTRIES &&
+            index.size == sizeof(TextureCacheIndexHeader) + header->entryCount * sizeof(TextureCacheEntry)
+        ) {
+            result->entryCount = header->entryCount;
+            result->useCounter = header->useCounter;
+            Platform::MemCopy(
+                header->entryCount * sizeof(TextureCacheEntry),
+                (const u8*)index.data + sizeof(TextureCacheIndexHeader),
+                result->entries
+            );
+            ucycles( result->entryCount ) {
+                result->totalSize += result->entries[i].size;
+            }
+        } else {
+            LOG_WARN( "TextureCache > Index is out of date, cached textures will be rewritten" );
+        }
+        Platform::FreeFile( &index );
+    }
+
+    // NOTE(alicia): size limit may have shrunk since index was written
+    TextureCacheEvict( result, 0 );
+    LOG_INFO( "TextureCache > %u textures, %llu of %llu bytes",
+        result->entryCount, (u64)result->totalSize, (u64)result->sizeLimit );
+    return true;
+}
+
+void Core::DestroyTextureCache( TextureCache* cache ) {
+    if( !cache->lock.handle ) {
+        return;
+    }
+    if( cache->entryCount && !TextureCacheWriteIndex( cache ) ) {
+        LOG_WARN( "TextureCache > Failed to write index!" );
+    }
+    Platform::SemaphoreDestroy( &cache->lock );
+    *cache = {};
+}
+
+/// @brief Validate texture cache header against the file it was mapped from
+static bool TextureCacheHeaderValid(
+    const Core::TextureCacheHeader* header, usize fileSize,
+    u64 sourceHash, usize sourceSize, u32 variant
+) {
+    if(
+        header->magic      != TEXTURE_CACHE_MAGIC   ||
+        header->version    != TEXTURE_CACHE_VERSION ||
+        header->sourceHash != sourceHash ||
+        header->sourceSize != sourceSize ||
+        header->variant    != variant    ||
+        header->format > (u32)Platform::TextureFormat::BC7_RGBA ||
+        header->width <= 0 || header->height <= 0 ||
+        header->levelCount == 0 || header->levelCount > TEXTURE_MAX_MIP_LEVELS
+    ) {
+        return false;
+    }
+    // NOTE(alicia): a partially written cache fails these
+    ucycles( header->levelCount ) {
+        usize expectedSize = Core::TextureLevelSize(
+            (Platform::TextureFormat)header->format,
+            Core::MipLevelSize( header->width, (u32)i ),
+            Core::MipLevelSize( header->height, (u32)i )
+        );
+        if(
+            header->levelSizes[i] != expectedSize ||
+            header->levelOffsets[i] + header->levelSizes[i] > fileSize
+        ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Core::WriteTextureCache(
+    TextureCache* cache,
+    u64 sourceHash, usize sourceSize, u32 variant,
+    const TextureUploadData* texture
+) {
+    if( texture->levelCount == 0 || texture->levelCount > TEXTURE_MAX_MIP_LEVELS ) {
+        return false;
+    }
+    if( !Platform::MakeDirectory( CACHE_DIRECTORY ) ) {
+        LOG_WARN( "TextureCache > Failed to create cache directory!" );
+        return false;
+    }
+    u64 key = TextureCacheKey( sourceHash, variant );
+    char path[CACHE_PATH_MAX_LEN];
+    CachePath( key, ".mvtex", CACHE_PATH_MAX_LEN, path );
+
+    TextureCacheHeader header = {};
+    header.magic      = TEXTURE_CACHE_MAGIC;
+    header.version    = TEXTURE_CACHE_VERSION;
+    header.sourceHash = sourceHash;
+    header.sourceSize = sourceSize;
+    header.variant    = variant;
+    header.format     = (u32)texture->format;
+    header.width      = texture->width;
+    header.height     = texture->height;
+    header.levelCount = texture->levelCount;
+    u64 offset = sizeof(TextureCacheHeader);
+    ucycles( texture->levelCount ) {
+        header.levelOffsets[i] = offset;
+        header.levelSizes[i]   = texture->levelSizes[i];
+        offset += texture->levelSizes[i];
+    }
+
+    // NOTE(alicia): loads of the same texture can finish at the same time,
+    // only the first writes it and the rest find it already cached
+    Platform::SemaphoreWait( &cache->lock );
+    Platform::MappedFile existing = {};
+    if( Platform::MapFile( path, &existing ) ) {
+        bool valid =
+            existing.size >= sizeof(TextureCacheHeader) &&
+            TextureCacheHeaderValid(
+                (const TextureCacheHeader*)existing.data, existing.size, sourceHash, sourceSize, variant );
+        Platform::UnmapFile( &existing );
+        if( valid ) {
+            TextureCacheTouch( cache, key, offset );
+            Platform::SemaphoreSignal( &cache->lock, 1 );
+            return true;
+        }
+    }
+
+    bool success = Platform::WriteFile( path, &header, sizeof(header), Platform::WriteFileType::CREATE );
+    for( u32 level = 0; success && level < texture->levelCount; ++level ) {
+        success = Platform::WriteFile(
+            path, (void*)texture->levels[level], texture->levelSizes[level],
+            Platform::WriteFileType::APPEND
+        );
+    }
+    bool indexWritten = false;
+    if( success ) {
+        TextureCacheTouch( cache, key, offset );
+        indexWritten = TextureCacheWriteIndex( cache );
+    } else {
+        Platform::RemoveFile( path );
+    }
+    Platform::SemaphoreSignal( &cache->lock, 1 );
+    if( !success ) {
+        LOG_WARN( "TextureCache > Failed to write \"%s\"", path );
+        return false;
+    }
+    if( !indexWritten ) {
+        LOG_WARN( "TextureCache > Failed to write index!" );
+    }
+
+    LOG_INFO( "TextureCache > Wrote \"%s\" %ix%i %u levels %s",
+        path, texture->width, texture->height, texture->levelCount,
+        Platform::TextureFormatToString( texture->format )
+    );
+    return true;
+}
+
+bool Core::LoadTextureCacheData(
+    TextureCache* cache,
+    u64 sourceHash, usize sourceSize, u32 variant,
+    TextureUploadData* result
+) {
+    u64 key = TextureCacheKey( sourceHash, variant );
+    char path[CACHE_PATH_MAX_LEN];
+    CachePath( key, ".mvtex", CACHE_PATH_MAX_LEN, path );
+
+    Platform::MappedFile cacheFile = {};
+    if( !Platform::MapFile( path, &cacheFile ) ) {
+        return false;
+    }
+    const TextureCacheHeader* header = (const TextureCacheHeader*)cacheFile.data;
+    if(
+        cacheFile.size < sizeof(TextureCacheHeader) ||
+        !TextureCacheHeaderValid( header, cacheFile.size, sourceHash, sourceSize, variant )
+    ) {
+        LOG_INFO( "TextureCache > \"%s\" is out of date", path );
+        Platform::UnmapFile( &cacheFile );
+        return false;
+    }
+
+    // NOTE(alicia): levels are uploaded straight from mapped file
+    *result = {};
+    result->width      = header->width;
+    result->height     = header->height;
+    result->format     = (Platform::TextureFormat)header->format;
+    result->levelCount = header->levelCount;
+    ucycles( header->levelCount ) {
+        result->levels[i]     = (const u8*)cacheFile.data + header->levelOffsets[i];
+        result->levelSizes[i] = header->levelSizes[i];
+    }
+    result->cacheFile = cacheFile;
+
+    Platform::SemaphoreWait( &cache->lock );
+    TextureCacheTouch( cache, key, cacheFile.size );
+    Platform::SemaphoreSignal( &cache->lock, 1 );
+
+    LOG_INFO( "TextureCache > Loaded \"%s\" %ix%i %u levels %s",
+        path, result->width, result->height, result->levelCount,
+        Platform::TextureFormatToString( result->format )
+    );
+    return true;
+}
@@ -0,0 +1,229 @@
+/**
+ * Description:  Binary asset cache
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "pch.hpp"
+#include "platform/renderer.hpp"
+#include "platform/threading.hpp"
+
+namespace Core {
+
+// forward declaration
+struct JobQueue;
+struct Mesh;
+struct MeshUploadData;
+struct MeshMaterialNames;
+struct TextureUploadData;
+
+#define CACHE_DIRECTORY "./cache"
+/// @brief Maximum length of a cache file path, including null-terminator
+#define CACHE_PATH_MAX_LEN 64
+
+#define MESH_CACHE_MAGIC   0x534D564D // "MVMS"
+#define MESH_CACHE_VERSION 8
+#define MESH_CACHE_MAX_LAYOUT_ELEMENTS 8
+
+/// @brief Mesh cache flags
+#define MESH_CACHE_FLAG_OPTIMIZED (1 << 0)
+/// @brief Vertices are Core::packedVertex
+#define MESH_CACHE_FLAG_PACKED    (1 << 1)
+/// @brief Sub-meshes have simplified levels
+#define MESH_CACHE_FLAG_LODS      (1 << 2)
+
+/// @brief Header of an .mvmesh file.
+/// Vertex and index data follow at given offsets, in the format they are uploaded in,
+/// followed by sub-meshes, meshlets and material names
+struct MeshCacheHeader {
+    u32 magic;
+    u32 version;
+    u64 sourceHash;
+    u64 sourceSize;
+    u32 flags;
+
+    u32 layoutElementCount;
+    u32 layoutStructures[MESH_CACHE_MAX_LAYOUT_ELEMENTS];
+    u32 layoutDataTypes[MESH_CACHE_MAX_LAYOUT_ELEMENTS];
+    u32 layoutNormalized[MESH_CACHE_MAX_LAYOUT_ELEMENTS];
+
+    u64 vertexCount;
+    u64 vertexOffset;
+    u64 vertexSize;
+
+    u32 indexDataType;
+    u32 reserved;
+    u64 indexCount;
+    u64 indexOffset;
+    u64 indexSize;
+
+    u64 subMeshCount;
+    u64 subMeshOffset;
+    u64 subMeshSize;
+
+    u64 meshletCount;
+    u64 meshletOffset;
+    u64 meshletSize;
+
+    u32 materialLibraryCount;
+    u32 materialCount;
+    u64 materialNameOffset;
+    u64 materialNameSize;
+
+    f32 boundsMin[3];
+    f32 boundsMax[3];
+};
+
+#define TEXTURE_CACHE_MAGIC       0x5854564D // "MVTX"
+#define TEXTURE_CACHE_INDEX_MAGIC 0x4954564D // "MVTI"
+#define TEXTURE_CACHE_VERSION     1
+/// @brief Maximum number of textures kept in cache, least recently used are evicted past this
+#define TEXTURE_CACHE_MAX_ENTRIES 1024
+
+/// @brief Header of an .mvtex file.
+/// Every level follows at given offsets, in the format it is uploaded in
+struct TextureCacheHeader {
+    u32 magic;
+    u32 version;
+    u64 sourceHash;
+    u64 sourceSize;
+    /// @brief How texture was built from source, part of the cache key
+    u32 variant;
+    /// @brief Platform::TextureFormat of every level
+    u32 format;
+    i32 width;
+    i32 height;
+    u32 levelCount;
+    u32 reserved;
+    u64 levelOffsets[TEXTURE_MAX_MIP_LEVELS];
+    u64 levelSizes[TEXTURE_MAX_MIP_LEVELS];
+};
+
+struct TextureCacheEntry {
+    u64 key;
+    u64 size;
+    /// @brief Use counter of cache when texture was last written or loaded
+    u64 lastUse;
+};
+
+/// @brief Textures in cache directory and when they were last used, shared by every thread that loads textures.
+/// Entries are kept in an index file, cache files that aren't in it are never evicted
+struct TextureCache {
+    Platform::Semaphore lock;
+    /// @brief Size of cached textures least recently used are evicted past
+    usize sizeLimit;
+    usize totalSize;
+    u64 useCounter;
+    u32 entryCount;
+    TextureCacheEntry entries[TEXTURE_CACHE_MAX_ENTRIES];
+};
+
+/// @brief Hash contents of a buffer.
+/// Buffer is hashed in fixed size blocks on job queue, result doesn't depend on thread count
+/// @param size size of buffer
+/// @param data buffer
+/// @param queue job queue, can be nullptr
+/// @return content hash
+u64 HashContents( usize size, const void* data, JobQueue* queue );
+
+/// @brief Hash contents of a file without loading it, file is read one block at a time.
+/// Result is identical to HashContents of the whole file
+/// @param filePath path to file
+/// @param hash [out] content hash
+/// @param size [out] size of file
+/// @return false if file could not be read
+bool HashFileContents( const char* filePath, u64* hash, usize* size );
+
+/// @brief Get cache file path for given hash
+/// @param hash content hash
+/// @param extension file extension, including '.'
+/// @param dstSize size of destination buffer, should be CACHE_PATH_MAX_LEN
+/// @param dst destination buffer
+void CachePath( u64 hash, const char* extension, usize dstSize, char* dst );
+
+/// @brief Fill in mesh cache header, data offsets are calculated from counts and layout
+/// @param sourceHash content hash of source file
+/// @param sourceSize size of source file
+/// @param flags mesh cache flags
+/// @param layout vertex layout, at most MESH_CACHE_MAX_LAYOUT_ELEMENTS elements
+/// @param vertexCount number of vertices
+/// @param indexDataType index data type
+/// @param indexCount number of indices
+/// @param subMeshCount number of sub-meshes
+/// @param meshletCount number of meshlets
+/// @param materialNames material names, can be nullptr
+/// @param boundsMin,boundsMax mesh bounds
+/// @param result [out] header
+void CreateMeshCacheHeader(
+    u64 sourceHash, usize sourceSize, u32 flags,
+    const Platform::VertexBufferLayout* layout, usize vertexCount,
+    Platform::DataType indexDataType, usize indexCount,
+    usize subMeshCount, usize meshletCount,
+    const MeshMaterialNames* materialNames,
+    const smath::vec3& boundsMin, const smath::vec3& boundsMax,
+    MeshCacheHeader* result
+);
+
+/// @brief Write mesh to cache file
+/// @param sourceHash content hash of source file
+/// @param sourceSize size of source file
+/// @param flags mesh cache flags, vertices are packed if MESH_CACHE_FLAG_PACKED is set
+/// @param mesh mesh to write
+/// @param materialNames names sub-mesh materials refer to, can be nullptr
+/// @return true if successful
+bool WriteMeshCache(
+    u64 sourceHash, usize sourceSize, u32 flags,
+    const Mesh* mesh, const MeshMaterialNames* materialNames
+);
+
+/// @brief Load mesh from cache file, ready to be uploaded straight to GPU.
+/// Cache file is memory mapped and stays mapped until upload data is freed,
+/// vertex and index data are uploaded without any processing, material names are copied
+/// @param sourceHash content hash of source file
+/// @param sourceSize size of source file
+/// @param requiredFlags flags the cached mesh must have, MESH_CACHE_FLAG_PACKED must match exactly
+/// @param result [out] upload data, free with FreeMeshUploadData
+/// @return true if a valid cache was found
+bool LoadMeshCacheData(
+    u64 sourceHash, usize sourceSize, u32 requiredFlags,
+    MeshUploadData* result
+);
+
+/// @brief Read texture cache index and evict textures past size limit
+/// @param sizeLimit size of cached textures least recently used are evicted past
+/// @param result [out] texture cache, destroy with DestroyTextureCache
+/// @return false if lock could not be created
+bool CreateTextureCache( usize sizeLimit, TextureCache* result );
+/// @brief Write texture cache index, no texture may be loaded or written while it's destroyed
+void DestroyTextureCache( TextureCache* cache );
+
+/// @brief Write texture to cache file in the format it is uploaded in, safe to call from any thread.
+/// Least recently used textures are evicted until cache fits in its size limit
+/// @param cache texture cache
+/// @param sourceHash content hash of source file
+/// @param sourceSize size of source file
+/// @param variant how texture was built from source
+/// @param texture texture to write
+/// @return true if successful or texture was already cached
+bool WriteTextureCache(
+    TextureCache* cache,
+    u64 sourceHash, usize sourceSize, u32 variant,
+    const TextureUploadData* texture
+);
+
+/// @brief Load texture from cache file, safe to call from any thread.
+/// Cache file is memory mapped and stays mapped until upload data is freed,
+/// levels are uploaded without any processing
+/// @param cache texture cache
+/// @param sourceHash content hash of source file
+/// @param sourceSize size of source file
+/// @param variant how texture was built from source
+/// @param result [out] upload data, free with FreeTextureUploadData
+/// @return true if a valid cache was found
+bool LoadTextureCacheData(
+    TextureCache* cache,
+    u64 sourceHash, usize sourceSize, u32 variant,
+    TextureUploadData* result
+);
+
+} // namespace Core
@@ -0,0 +1,1101 @@
+/**
+ * Description:  Binary glTF 2.0 (.glb) loading
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "core/gltf.hpp"
+#include "core/json.hpp"
+#include "core/obj.hpp"
+#include "core/mesh.hpp"
+#include "core/normals.hpp"
+#include "core/renderex.hpp"
+#include "core/cache.hpp"
+#include "core/jobs.hpp"
+#include "platform/io.hpp"
+#include "util.hpp"
+
+static_assert( sizeof(Core::vertex) == 12 * sizeof(f32), "Vertex conversion writes attributes at a stride of twelve floats!" );
+
+/// @brief Accessor component types
+#define GLTF_BYTE           5120
+#define GLTF_UNSIGNED_BYTE  5121
+#define GLTF_SHORT          5122
+#define GLTF_UNSIGNED_SHORT 5123
+#define GLTF_UNSIGNED_INT   5125
+#define GLTF_FLOAT          5126
+
+#define GLTF_MODE_TRIANGLES 4
+
+/// @brief Vertex attributes, in the order they are stored in Core::vertex
+enum GLTFAttribute : u32 {
+    GLTF_POSITION,
+    GLTF_TEXCOORD,
+    GLTF_NORMAL,
+    GLTF_TANGENT,
+
+    GLTF_ATTRIBUTE_COUNT
+};
+static const char* GLTF_ATTRIBUTE_NAMES[GLTF_ATTRIBUTE_COUNT] = { "POSITION", "TEXCOORD_0", "NORMAL", "TANGENT" };
+static const u32 GLTF_ATTRIBUTE_COMPONENTS[GLTF_ATTRIBUTE_COUNT] = { 3, 2, 3, 4 };
+/// @brief Offset of attribute in Core::vertex, in floats
+static const usize GLTF_ATTRIBUTE_OFFSETS[GLTF_ATTRIBUTE_COUNT] = { 0, 3, 5, 8 };
+
+/// @brief Accessor resolved against its buffer view
+struct GLTFAccessor {
+    /// @brief First element, nullptr if primitive doesn't have accessor
+    const u8* data;
+    /// @brief Offset of first element from start of binary chunk
+    usize offset;
+    usize count;
+    /// @brief Distance between elements
+    usize stride;
+    usize elementSize;
+    u32 view;
+    Platform::DataType componentType;
+    u32 componentCount;
+    bool normalized;
+    /// @brief Elements that can be loaded 16 bytes at a time without reading past binary chunk
+    usize packedCount;
+};
+
+struct GLTFPrimitive {
+    GLTFAccessor attributes[GLTF_ATTRIBUTE_COUNT];
+    /// @brief data is nullptr if primitive isn't indexed
+    GLTFAccessor indices;
+    i32 material;
+    /// @brief Position accessor had min and max
+    bool hasBounds;
+    smath::vec3 boundsMin;
+    smath::vec3 boundsMax;
+};
+
+/// @brief Parsed .glb file, points into file memory
+struct GLTFFile {
+    Core::JSONDocument document;
+    const u8* bin;
+    usize binSize;
+    usize primitiveCount;
+    GLTFPrimitive* primitives;
+};
+
+/// @brief Where vertices and indices of every primitive are in the binary chunk
+/// when they can be uploaded as is
+struct GLTFDirectLayout {
+    Platform::VertexBufferElement elements[GLTF_ATTRIBUTE_COUNT];
+    usize elementOffsets[GLTF_ATTRIBUTE_COUNT];
+    usize stride;
+    usize vertexOffset;
+    usize vertexCount;
+    Platform::DataType indexDataType;
+    usize indexOffset;
+    usize indexCount;
+};
+
+/// @brief Vertex and index range of a primitive converted by a single job
+struct GLTFChunk {
+    const GLTFPrimitive* primitive;
+    usize firstVertex;
+    usize vertexCount;
+    /// @brief Vertex firstVertex of primitive
+    Core::vertex* vertices;
+    usize firstIndex;
+    usize indexCount;
+    /// @brief Index firstIndex of primitive
+    u32* indices;
+    /// @brief [out] an index references a vertex that doesn't exist
+    bool invalidIndex;
+    /// @brief [out] bounds of converted positions
+    smath::vec3 boundsMin;
+    smath::vec3 boundsMax;
+};
+
+static inline u32 GLTFRead32( const u8* at ) {
+    return (u32)at[0] | ( (u32)at[1] << 8 ) | ( (u32)at[2] << 16 ) | ( (u32)at[3] << 24 );
+}
+
+/// @brief Read non-negative integer member
+/// @return false if member is present but isn't a non-negative integer, result is defaultValue if member is missing
+static bool GLTFGetInteger(
+    const Core::JSONDocument* document, u32 object, const char* key,
+    usize defaultValue, usize* result
+) {
+    u32 value = Core::JSONGetMember( document, object, key );
+    if( value == JSON_INVALID ) {
+        *result = defaultValue;
+        return true;
+    }
+    f64 number = Core::JSONGetNumber( document, value, -1.0 );
+    if( number < 0.0 || number > 9007199254740992.0 || number != (f64)(u64)number ) {
+        return false;
+    }
+    *result = (usize)number;
+    return true;
+}
+
+static bool GLTFComponentType( usize componentType, Platform::DataType* result ) {
+    switch( componentType ) {
+        case GLTF_BYTE:           *result = Platform::DataType::BYTE;           return true;
+        case GLTF_UNSIGNED_BYTE:  *result = Platform::DataType::UNSIGNED_BYTE;  return true;
+        case GLTF_SHORT:          *result = Platform::DataType::SHORT;          return true;
+        case GLTF_UNSIGNED_SHORT: *result = Platform::DataType::UNSIGNED_SHORT; return true;
+        case GLTF_UNSIGNED_INT:   *result = Platform::DataType::UNSIGNED_INT;   return true;
+        case GLTF_FLOAT:          *result = Platform::DataType::FLOAT;          return true;
+        default: return false;
+    }
+}
+
+static u32 GLTFComponentCount( const Core::JSONDocument* document, u32 type ) {
+    if( Core::JSONStringCmp( document, type, "SCALAR" ) ) {
+        return 1;
+    }
+    if( Core::JSONStringCmp( document, type, "VEC2" ) ) {
+        return 2;
+    }
+    if( Core::JSONStringCmp( document, type, "VEC3" ) ) {
+        return 3;
+    }
+    if( Core::JSONStringCmp( document, type, "VEC4" ) ) {
+        return 4;
+    }
+    return 0;
+}
+
+/// @brief Resolve accessor against its buffer view and check that every element is inside the binary chunk
+static bool GLTFReadAccessor( const GLTFFile* file, usize index, GLTFAccessor* result ) {
+    const Core::JSONDocument* document = &file->document;
+    *result = {};
+
+    u32 accessor = Core::JSONGetElement( document, Core::JSONGetMember( document, 0, "accessors" ), (u32)index );
+    if( accessor == JSON_INVALID ) {
+        LOG_ERROR( "GLTF > Accessor %llu does not exist!", (u64)index );
+        return false;
+    }
+    if( Core::JSONGetMember( document, accessor, "sparse" ) != JSON_INVALID ) {
+        LOG_ERROR( "GLTF > Accessor %llu is sparse, sparse accessors are not supported!", (u64)index );
+        return false;
+    }
+
+    usize viewIndex = 0, componentType = 0, accessorOffset = 0;
+    if(
+        Core::JSONGetMember( document, accessor, "bufferView" ) == JSON_INVALID ||
+        !GLTFGetInteger( document, accessor, "bufferView", 0, &viewIndex ) ||
+        !GLTFGetInteger( document, accessor, "componentType", 0, &componentType ) ||
+        !GLTFGetInteger( document, accessor, "count", 0, &result->count ) ||
+        !GLTFGetInteger( document, accessor, "byteOffset", 0, &accessorOffset ) ||
+        !GLTFComponentType( componentType, &result->componentType )
+    ) {
+        LOG_ERROR( "GLTF > Accessor %llu is invalid or has no buffer view!", (u64)index );
+        return false;
+    }
+    result->componentCount = GLTFComponentCount( document, Core::JSONGetMember( document, accessor, "type" ) );
+    if( !result->componentCount ) {
+        LOG_ERROR( "GLTF > Accessor %llu is not a scalar or vector!", (u64)index );
+        return false;
+    }
+    result->normalized  = Core::JSONGetBool( document, Core::JSONGetMember( document, accessor, "normalized" ), false );
+    result->elementSize = Platform::DataTypeSize( result->componentType ) * result->componentCount;
+
+    u32 view = Core::JSONGetElement( document, Core::JSONGetMember( document, 0, "bufferViews" ), (u32)viewIndex );
+    usize buffer = 0, viewOffset = 0, viewLength = 0, viewStride = 0;
+    if(
+        view == JSON_INVALID ||
+        !GLTFGetInteger( document, view, "buffer", 0, &buffer ) ||
+        !GLTFGetInteger( document, view, "byteOffset", 0, &viewOffset ) ||
+        !GLTFGetInteger( document, view, "byteLength", 0, &viewLength ) ||
+        !GLTFGetInteger( document, view, "byteStride", 0, &viewStride )
+    ) {
+        LOG_ERROR( "GLTF > Buffer view %llu is invalid!", (u64)viewIndex );
+        return false;
+    }
+    // NOTE(alicia): first buffer of a .glb without uri is the binary chunk, external buffers are not loaded
+    if( buffer != 0 || !file->bin ) {
+        LOG_ERROR( "GLTF > Buffer view %llu is not in the binary chunk, external buffers are not supported!", (u64)viewIndex );
+        return false;
+    }
+    // NOTE(alicia): spec limits stride to 4..252 in steps of 4
+    if( viewStride && ( viewStride < 4 || viewStride > 252 || viewStride % 4 || viewStride < result->elementSize ) ) {
+        LOG_ERROR( "GLTF > Buffer view %llu has invalid stride!", (u64)viewIndex );
+        return false;
+    }
+    result->view   = (u32)viewIndex;
+    result->stride = viewStride ? viewStride : result->elementSize;
+
+    // NOTE(alicia): every term is checked against what's left of the view so nothing can wrap
+    if(
+        viewOffset > file->binSize || viewLength > file->binSize - viewOffset ||
+        accessorOffset > viewLength
+    ) {
+        LOG_ERROR( "GLTF > Accessor %llu reads past its buffer view!", (u64)index );
+        return false;
+    }
+    if( result->count ) {
+        usize available = viewLength - accessorOffset;
+        usize last      = result->count - 1;
+        if(
+            result->elementSize > available ||
+            last > ( available - result->elementSize ) / result->stride
+        ) {
+            LOG_ERROR( "GLTF > Accessor %llu reads past its buffer view!", (u64)index );
+            return false;
+        }
+    }
+    result->offset = viewOffset + accessorOffset;
+    result->data = file->bin + result->offset;
+
+    if( result->count && result->offset + 16 <= file->binSize ) {
+        result->packedCount = ( file->binSize - result->offset - 16 ) / result->stride + 1;
+        if( result->packedCount > result->count ) {
+            result->packedCount = result->count;
+        }
+    }
+    return true;
+}
+
+/// @brief Check that attribute has a type the converter reads
+static bool GLTFAttributeValid( u32 attribute, const GLTFAccessor* accessor ) {
+    if( accessor->componentCount != GLTF_ATTRIBUTE_COMPONENTS[attribute] ) {
+        return false;
+    }
+    // NOTE(alicia): integer attributes come from KHR_mesh_quantization, 32-bit integers are never allowed
+    return accessor->componentType != Platform::DataType::UNSIGNED_INT;
+}
+
+static bool GLTFReadPrimitive( const GLTFFile* file, u32 primitive, GLTFPrimitive* result ) {
+    const Core::JSONDocument* document = &file->document;
+    *result = {};
+
+    u32 attributes = Core::JSONGetMember( document, primitive, "attributes" );
+    usize positionAccessor = 0;
+    ucyclesi( GLTF_ATTRIBUTE_COUNT, attribute ) {
+        u32 value = Core::JSONGetMember( document, attributes, GLTF_ATTRIBUTE_NAMES[attribute] );
+        if( value == JSON_INVALID ) {
+            continue;
+        }
+        usize accessorIndex = 0;
+        GLTFAccessor* accessor = &result->attributes[attribute];
+        if(
+            !GLTFGetInteger( document, attributes, GLTF_ATTRIBUTE_NAMES[attribute], 0, &accessorIndex ) ||
+            !GLTFReadAccessor( file, accessorIndex, accessor )
+        ) {
+            return false;
+        }
+        if( attribute == GLTF_POSITION ) {
+            positionAccessor = accessorIndex;
+        }
+        if( !GLTFAttributeValid( attribute, accessor ) ) {
+            LOG_ERROR( "GLTF > %s has an invalid type!", GLTF_ATTRIBUTE_NAMES[attribute] );
+            return false;
+        }
+    }
+
+    const GLTFAccessor* positions = &result->attributes[GLTF_POSITION];
+    if( !positions->data ) {
+        LOG_ERROR( "GLTF > Primitive has no positions!" );
+        return false;
+    }
+    ucyclesi( GLTF_ATTRIBUTE_COUNT, attribute ) {
+        if( result->attributes[attribute].data && result->attributes[attribute].count != positions->count ) {
+            LOG_ERROR( "GLTF > %s count does not match position count!", GLTF_ATTRIBUTE_NAMES[attribute] );
+            return false;
+        }
+    }
+    if( positions->count > U32::MAX ) {
+        LOG_ERROR( "GLTF > Primitive has too many vertices!" );
+        return false;
+    }
+
+    if( Core::JSONGetMember( document, primitive, "indices" ) != JSON_INVALID ) {
+        usize accessorIndex = 0;
+        if(
+            !GLTFGetInteger( document, primitive, "indices", 0, &accessorIndex ) ||
+            !GLTFReadAccessor( file, accessorIndex, &result->indices )
+        ) {
+            return false;
+        }
+        if(
+            result->indices.componentCount != 1 ||
+            result->indices.stride != result->indices.elementSize ||
+            result->indices.componentType == Platform::DataType::BYTE ||
+            result->indices.componentType == Platform::DataType::SHORT ||
+            result->indices.componentType == Platform::DataType::FLOAT
+        ) {
+            LOG_ERROR( "GLTF > Indices have an invalid type!" );
+            return false;
+        }
+    }
+    usize indexCount = result->indices.data ? result->indices.count : positions->count;
+    if( indexCount % 3 != 0 || indexCount > U32::MAX ) {
+        LOG_ERROR( "GLTF > Primitive has an invalid number of indices!" );
+        return false;
+    }
+
+    usize material = 0;
+    if( Core::JSONGetMember( document, primitive, "material" ) == JSON_INVALID ) {
+        result->material = -1;
+    } else if( GLTFGetInteger( document, primitive, "material", 0, &material ) && material <= (usize)I32::MAX ) {
+        result->material = (i32)material;
+    } else {
+        LOG_ERROR( "GLTF > Primitive material is invalid!" );
+        return false;
+    }
+
+    // NOTE(alicia): position accessors are required to have bounds, but not every exporter writes them
+    u32 accessor = Core::JSONGetElement( document, Core::JSONGetMember( document, 0, "accessors" ), (u32)positionAccessor );
+    u32 boundsMin = Core::JSONGetMember( document, accessor, "min" );
+    u32 boundsMax = Core::JSONGetMember( document, accessor, "max" );
+    result->hasBounds = Core::JSONGetCount( document, boundsMin ) == 3 && Core::JSONGetCount( document, boundsMax ) == 3;
+    if( result->hasBounds ) {
+        ucycles( 3 ) {
+            result->boundsMin[i] = (f32)Core::JSONGetNumber( document, Core::JSONGetElement( document, boundsMin, (u32)i ), 0.0 );
+            result->boundsMax[i] = (f32)Core::JSONGetNumber( document, Core::JSONGetElement( document, boundsMax, (u32)i ), 0.0 );
+        }
+    }
+    return true;
+}
+
+static void GLTFFreeFile( GLTFFile* file ) {
+    Core::FreeJSON( &file->document );
+    if( file->primitives ) {
+        Platform::Free( file->primitives );
+    }
+    *file = {};
+}
+
+/// @brief Parse .glb container and JSON, resolve every triangle primitive
+static bool GLTFParseFile( usize size, const void* data, GLTFFile* result ) {
+    *result = {};
+    const u8* bytes = (const u8*)data;
+
+    if( size < 20 || GLTFRead32( bytes ) != GLB_MAGIC ) {
+        LOG_ERROR( "GLTF > File is not a .glb!" );
+        return false;
+    }
+    if( GLTFRead32( bytes + 4 ) != GLB_VERSION ) {
+        LOG_ERROR( "GLTF > Only glTF 2.0 is supported!" );
+        return false;
+    }
+    usize length = GLTFRead32( bytes + 8 );
+    if( length > size ) {
+        LOG_ERROR( "GLTF > File is truncated!" );
+        return false;
+    }
+    // NOTE(alicia): 12 byte header, 8 byte JSON chunk header and at least one byte of JSON
+    if( length < 28 ) {
+        LOG_ERROR( "GLTF > File is too small to hold a JSON chunk!" );
+        return false;
+    }
+
+    usize jsonLength = GLTFRead32( bytes + 12 );
+    if( GLTFRead32( bytes + 16 ) != GLB_CHUNK_JSON || jsonLength > length - 20 ) {
+        LOG_ERROR( "GLTF > First chunk is not JSON!" );
+        return false;
+    }
+    const char* json = (const char*)( bytes + 20 );
+
+    // NOTE(alicia): binary chunk is optional, chunks are 4-byte aligned
+    usize binChunk = 20 + ( ( jsonLength + 3 ) & ~(usize)3 );
+    if( binChunk + 8 <= length && GLTFRead32( bytes + binChunk + 4 ) == GLB_CHUNK_BIN ) {
+        usize binLength = GLTFRead32( bytes + binChunk );
+        if( binLength > length - binChunk - 8 ) {
+            LOG_ERROR( "GLTF > Binary chunk is truncated!" );
+            return false;
+        }
+        result->bin     = bytes + binChunk + 8;
+        result->binSize = binLength;
+    }
+
+    if( !Core::ParseJSON( jsonLength, json, &result->document ) ) {
+        return false;
+    }
+    const Core::JSONDocument* document = &result->document;
+    if( document->values[0].type != Core::JSONType::OBJECT ) {
+        LOG_ERROR( "GLTF > JSON chunk is not an object!" );
+        GLTFFreeFile( result );
+        return false;
+    }
+
+    // NOTE(alicia): compressed geometry can't be read without its decoder, other extensions only change materials
+    u32 required = Core::JSONGetMember( document, 0, "extensionsRequired" );
+    ucycles( Core::JSONGetCount( document, required ) ) {
+        u32 extension = Core::JSONGetElement( document, required, (u32)i );
+        if(
+            Core::JSONStringCmp( document, extension, "KHR_draco_mesh_compression" ) ||
+            Core::JSONStringCmp( document, extension, "EXT_meshopt_compression" )
+        ) {
+            LOG_ERROR( "GLTF > File requires a compression extension, compressed meshes are not supported!" );
+            GLTFFreeFile( result );
+            return false;
+        }
+    }
+
+    u32 meshes = Core::JSONGetMember( document, 0, "meshes" );
+    usize primitiveCount = 0;
+    ucycles( Core::JSONGetCount( document, meshes ) ) {
+        u32 mesh = Core::JSONGetElement( document, meshes, (u32)i );
+        primitiveCount += Core::JSONGetCount( document, Core::JSONGetMember( document, mesh, "primitives" ) );
+    }
+    result->primitives = (GLTFPrimitive*)Platform::Alloc( primitiveCount * sizeof(GLTFPrimitive) );
+    if( !result->primitives && primitiveCount ) {
+        LOG_ERROR( "GLTF > Failed to allocate primitives!" );
+        GLTFFreeFile( result );
+        return false;
+    }
+
+    ucyclesi( Core::JSONGetCount( document, meshes ), meshIndex ) {
+        u32 mesh       = Core::JSONGetElement( document, meshes, (u32)meshIndex );
+        u32 primitives = Core::JSONGetMember( document, mesh, "primitives" );
+        ucycles( Core::JSONGetCount( document, primitives ) ) {
+            u32 primitive = Core::JSONGetElement( document, primitives, (u32)i );
+            usize mode = 0;
+            if( !GLTFGetInteger( document, primitive, "mode", GLTF_MODE_TRIANGLES, &mode ) || mode != GLTF_MODE_TRIANGLES ) {
+                LOG_WARN( "GLTF > Skipped primitive %llu of mesh %llu, only triangle lists are supported", (u64)i, (u64)meshIndex );
+                continue;
+            }
+            if( !GLTFReadPrimitive( result, primitive, &result->primitives[result->primitiveCount] ) ) {
+                GLTFFreeFile( result );
+                return false;
+            }
+            result->primitiveCount++;
+        }
+    }
+
+    if( !result->primitiveCount ) {
+        LOG_ERROR( "GLTF > File has no triangles!" );
+        GLTFFreeFile( result );
+        return false;
+    }
+    return true;
+}
+
+/// @brief Vertex buffer element an attribute is uploaded as
+/// @return false if renderer can't read attribute as is
+static bool GLTFDirectElement( u32 attribute, const GLTFAccessor* accessor, Platform::VertexBufferElement* result ) {
+    Platform::DataType type = accessor->componentType;
+    bool valid = false;
+    if( type == Platform::DataType::FLOAT ) {
+        valid = !accessor->normalized;
+    } else if( attribute == GLTF_TEXCOORD ) {
+        valid = accessor->normalized &&
+            ( type == Platform::DataType::UNSIGNED_BYTE || type == Platform::DataType::UNSIGNED_SHORT );
+    } else if( attribute != GLTF_POSITION ) {
+        // NOTE(alicia): packed vertices are the only ones shader expects quantized positions for
+        valid = accessor->normalized &&
+            ( type == Platform::DataType::BYTE || type == Platform::DataType::SHORT );
+    }
+    switch( accessor->componentCount ) {
+        case 2:  result->structure = Platform::DataStructure::VEC2; break;
+        case 3:  result->structure = Platform::DataStructure::VEC3; break;
+        default: result->structure = Platform::DataStructure::VEC4; break;
+    }
+    result->dataType   = type;
+    result->normalized = accessor->normalized;
+    return valid;
+}
+
+/// @brief Find a single vertex buffer layout and index range every primitive fits in.
+/// Attributes have to be interleaved in one buffer view at the same offsets in every primitive,
+/// primitives are then vertex ranges of that view
+/// @param subMeshes [out] sub-mesh of every primitive
+/// @return false if primitives can't be uploaded as is
+static bool GLTFFindDirectLayout( const GLTFFile* file, GLTFDirectLayout* result, Core::SubMesh* subMeshes ) {
+    *result = {};
+    const GLTFPrimitive* firstPrimitive = &file->primitives[0];
+    ucyclesi( GLTF_ATTRIBUTE_COUNT, attribute ) {
+        const GLTFAccessor* accessor = &firstPrimitive->attributes[attribute];
+        if( !accessor->data || !GLTFDirectElement( attribute, accessor, &result->elements[attribute] ) ) {
+            return false;
+        }
+    }
+    const GLTFAccessor* firstPositions = &firstPrimitive->attributes[GLTF_POSITION];
+    result->stride        = firstPositions->stride;
+    result->indexDataType = firstPrimitive->indices.componentType;
+    result->vertexOffset  = U64::MAX;
+    result->indexOffset   = U64::MAX;
+    if(
+        !firstPrimitive->indices.data ||
+        ( result->indexDataType != Platform::DataType::UNSIGNED_SHORT &&
+          result->indexDataType != Platform::DataType::UNSIGNED_INT )
+    ) {
+        return false;
+    }
+
+    ucycles( file->primitiveCount ) {
+        const GLTFPrimitive* primitive = &file->primitives[i];
+        ucyclesi( GLTF_ATTRIBUTE_COUNT, attribute ) {
+            const GLTFAccessor* accessor = &primitive->attributes[attribute];
+            Platform::VertexBufferElement element = {};
+            if(
+                !accessor->data ||
+                accessor->view != firstPositions->view ||
+                accessor->stride != result->stride ||
+                !GLTFDirectElement( attribute, accessor, &element ) ||
+                element.dataType != result->elements[attribute].dataType
+            ) {
+                return false;
+            }
+            if( accessor->offset < result->vertexOffset ) {
+                result->vertexOffset = accessor->offset;
+            }
+        }
+        const GLTFAccessor* indices = &primitive->indices;
+        if(
+            !indices->data ||
+            indices->view != firstPrimitive->indices.view ||
+            indices->componentType != result->indexDataType
+        ) {
+            return false;
+        }
+        if( indices->offset < result->indexOffset ) {
+            result->indexOffset = indices->offset;
+        }
+    }
+
+    usize indexSize = Platform::DataTypeSize( result->indexDataType );
+    ucycles( file->primitiveCount ) {
+        const GLTFPrimitive* primitive = &file->primitives[i];
+        usize baseVertex = 0;
+        ucyclesi( GLTF_ATTRIBUTE_COUNT, attribute ) {
+            const GLTFAccessor* accessor = &primitive->attributes[attribute];
+            usize relative      = accessor->offset - result->vertexOffset;
+            usize elementOffset = relative % result->stride;
+            if( i == 0 ) {
+                result->elementOffsets[attribute] = elementOffset;
+                if( elementOffset + accessor->elementSize > result->stride ) {
+                    return false;
+                }
+            } else if( elementOffset != result->elementOffsets[attribute] ) {
+                return false;
+            }
+            if( attribute == GLTF_POSITION ) {
+                baseVertex = relative / result->stride;
+            } else if( relative / result->stride != baseVertex ) {
+                return false;
+            }
+        }
+
+        usize relativeIndex = primitive->indices.offset - result->indexOffset;
+        if( relativeIndex % indexSize != 0 ) {
+            return false;
+        }
+        usize vertexCount = primitive->attributes[GLTF_POSITION].count;
+        usize firstIndex  = relativeIndex / indexSize;
+        if( baseVertex + vertexCount > result->vertexCount ) {
+            result->vertexCount = baseVertex + vertexCount;
+        }
+        if( firstIndex + primitive->indices.count > result->indexCount ) {
+            result->indexCount = firstIndex + primitive->indices.count;
+        }
+
+        Core::SubMesh* subMesh = &subMeshes[i];
+        *subMesh = {};
+        subMesh->firstIndex  = (u32)firstIndex;
+        subMesh->indexCount  = (u32)primitive->indices.count;
+        subMesh->baseVertex  = (u32)baseVertex;
+        subMesh->vertexCount = (u32)vertexCount;
+        subMesh->material    = primitive->material;
+    }
+
+    // NOTE(alicia): renderer derives vertex count from buffer size, so the last vertex needs a whole stride
+    return
+        result->vertexCount <= U32::MAX && result->indexCount <= U32::MAX &&
+        result->vertexCount * result->stride <= file->binSize - result->vertexOffset &&
+        result->indexCount * indexSize <= file->binSize - result->indexOffset;
+}
+
+/// @brief Check that every index of a primitive references one of its vertices
+static bool GLTFIndicesValid( const GLTFAccessor* indices, usize vertexCount ) {
+    u32 largest = 0;
+    if( indices->componentType == Platform::DataType::UNSIGNED_SHORT ) {
+        const u16* at = (const u16*)indices->data;
+        ucycles( indices->count ) {
+            largest = at[i] > largest ? at[i] : largest;
+        }
+    } else {
+        const u32* at = (const u32*)indices->data;
+        ucycles( indices->count ) {
+            largest = at[i] > largest ? at[i] : largest;
+        }
+    }
+    return !indices->count || largest < vertexCount;
+}
+
+/// @brief Point upload data straight into the binary chunk
+/// @param file mapped file, moved into upload data if successful
+/// @return false if primitives can't be uploaded as is
+static bool GLTFUploadDirect( const GLTFFile* gltf, Platform::MappedFile* file, Core::MeshUploadData* result ) {
+    Core::SubMesh* subMeshes = (Core::SubMesh*)Platform::Alloc( gltf->primitiveCount * sizeof(Core::SubMesh) );
+    if( !subMeshes ) {
+        return false;
+    }
+    GLTFDirectLayout layout = {};
+    bool direct = GLTFFindDirectLayout( gltf, &layout, subMeshes );
+    for( usize i = 0; direct && i < gltf->primitiveCount; ++i ) {
+        direct = GLTFIndicesValid( &gltf->primitives[i].indices, gltf->primitives[i].attributes[GLTF_POSITION].count );
+    }
+    if( !direct ) {
+        Platform::Free( subMeshes );
+        return false;
+    }
+
+    *result = {};
+    result->layout = Platform::CreateVertexBufferLayout( GLTF_ATTRIBUTE_COUNT, layout.elements );
+    ucycles( GLTF_ATTRIBUTE_COUNT ) {
+        result->layout.elementOffsets[i] = layout.elementOffsets[i];
+    }
+    result->layout.stride  = layout.stride;
+    result->vertexDataSize = layout.vertexCount * layout.stride;
+    result->vertexData     = (void*)( gltf->bin + layout.vertexOffset );
+    result->indexCount     = layout.indexCount;
+    result->indexDataType  = layout.indexDataType;
+    result->indexData      = (void*)( gltf->bin + layout.indexOffset );
+
+    Core::MeshInfo* info = &result->info;
+    info->subMeshCount = gltf->primitiveCount;
+    info->subMeshes    = subMeshes;
+    info->uvOriginTop  = true;
+
+    // NOTE(alicia): position bounds are required by glTF, primitives without them are scanned
+    info->boundsMin = smath::vec3( F32::MAX );
+    info->boundsMax = smath::vec3( -F32::MAX );
+    ucycles( gltf->primitiveCount ) {
+        const GLTFPrimitive* primitive = &gltf->primitives[i];
+        const GLTFAccessor* positions  = &primitive->attributes[GLTF_POSITION];
+        smath::vec3 primitiveMin = primitive->boundsMin;
+        smath::vec3 primitiveMax = primitive->boundsMax;
+        if( !primitive->hasBounds ) {
+            primitiveMin = smath::vec3( F32::MAX );
+            primitiveMax = smath::vec3( -F32::MAX );
+            ucyclesi( positions->count, vertex ) {
+                smath::vec3 position;
+                Platform::MemCopy( sizeof(smath::vec3), positions->data + vertex * positions->stride, &position );
+                ucyclesi( 3, axis ) {
+                    if( position[axis] < primitiveMin[axis] ) {
+                        primitiveMin[axis] = position[axis];
+                    }
+                    if( position[axis] > primitiveMax[axis] ) {
+                        primitiveMax[axis] = position[axis];
+                    }
+                }
+            }
+        }
+        ucyclesi( 3, axis ) {
+            if( primitiveMin[axis] < info->boundsMin[axis] ) {
+                info->boundsMin[axis] = primitiveMin[axis];
+            }
+            if( primitiveMax[axis] > info->boundsMax[axis] ) {
+                info->boundsMax[axis] = primitiveMax[axis];
+            }
+        }
+    }
+
+    if( !Core::CreateMeshDrawList( info ) ) {
+        LOG_ERROR( "LoadGLBFile > Failed to allocate upload data!" );
+        Core::FreeMeshUploadData( result );
+        return false;
+    }
+    result->cacheFile = *file;
+    *file = {};
+
+    LOG_INFO( "LoadGLBFile > Uploading buffer views as is, %llu vertices %llu indices %llu sub-meshes",
+        (u64)layout.vertexCount, (u64)layout.indexCount, (u64)info->subMeshCount
+    );
+    return true;
+}
+
+/// @brief Load 16 bytes of an element as float components, integers are converted as is
+static inline __m128 GLTFLoadElement( const u8* at, Platform::DataType type ) {
+    __m128i value;
+    switch( type ) {
+        case Platform::DataType::FLOAT:
+            return _mm_loadu_ps( (const f32*)at );
+        case Platform::DataType::UNSIGNED_BYTE:
+            value = _mm_cvtsi32_si128( (i32)GLTFRead32( at ) );
+            value = _mm_unpacklo_epi8( value, _mm_setzero_si128() );
+            value = _mm_unpacklo_epi16( value, _mm_setzero_si128() );
+            break;
+        case Platform::DataType::BYTE:
+            // NOTE(alicia): byte ends up in the top of each lane, arithmetic shift sign-extends it
+            value = _mm_cvtsi32_si128( (i32)GLTFRead32( at ) );
+            value = _mm_unpacklo_epi8( value, value );
+            value = _mm_srai_epi32( _mm_unpacklo_epi16( value, value ), 24 );
+            break;
+        case Platform::DataType::UNSIGNED_SHORT:
+            value = _mm_loadl_epi64( (const __m128i*)at );
+            value = _mm_unpacklo_epi16( value, _mm_setzero_si128() );
+            break;
+        case Platform::DataType::SHORT:
+            value = _mm_loadl_epi64( (const __m128i*)at );
+            value = _mm_srai_epi32( _mm_unpacklo_epi16( value, value ), 16 );
+            break;
+        default:
+            return _mm_setzero_ps();
+    }
+    return _mm_cvtepi32_ps( value );
+}
+
+/// @brief Convert attribute of a vertex range into vertices.
+/// Components past the attribute's are zeroed and may be written over the next attribute,
+/// so attributes have to be converted in vertex order
+static void GLTFConvertAttribute(
+    const GLTFAccessor* accessor, u32 attribute,
+    usize first, usize count, f32* out,
+    __m128* boundsMin, __m128* boundsMax
+) {
+    f32 scale = 1.0f;
+    bool clamp = false;
+    if( accessor->normalized ) {
+        switch( accessor->componentType ) {
+            case Platform::DataType::UNSIGNED_BYTE:  scale = 1.0f / 255.0f;   break;
+            case Platform::DataType::UNSIGNED_SHORT: scale = 1.0f / 65535.0f; break;
+            case Platform::DataType::BYTE:           scale = 1.0f / 127.0f;   clamp = true; break;
+            case Platform::DataType::SHORT:          scale = 1.0f / 32767.0f; clamp = true; break;
+            default: break;
+        }
+    }
+    __m128 scales = _mm_set1_ps( scale );
+    __m128 minusOne = _mm_set1_ps( -1.0f );
+    // NOTE(alicia): glTF uvs start at the top of the image, images are flipped on load so v is flipped to match
+    __m128 flip = attribute == GLTF_TEXCOORD ? _mm_setr_ps( 1.0f, -1.0f, 1.0f, 1.0f ) : _mm_set1_ps( 1.0f );
+    __m128 bias = attribute == GLTF_TEXCOORD ? _mm_setr_ps( 0.0f, 1.0f, 0.0f, 0.0f ) : _mm_setzero_ps();
+    __m128 mask = _mm_castsi128_ps( accessor->componentCount == 3 ?
+        _mm_setr_epi32( -1, -1, -1, 0 ) : _mm_set1_epi32( -1 ) );
+
+    const u8* element = accessor->data + first * accessor->stride;
+    for( usize i = first; i < first + count; ++i, element += accessor->stride, out += 12 ) {
+        __m128 value;
+        if( i < accessor->packedCount ) {
+            value = GLTFLoadElement( element, accessor->componentType );
+        } else {
+            u8 padded[16] = {};
+            Platform::MemCopy( accessor->elementSize, element, padded );
+            value = GLTFLoadElement( padded, accessor->componentType );
+        }
+        value = _mm_mul_ps( value, scales );
+        if( clamp ) {
+            value = _mm_max_ps( value, minusOne );
+        }
+        value = _mm_and_ps( _mm_add_ps( _mm_mul_ps( value, flip ), bias ), mask );
+
+        if( accessor->componentCount == 2 ) {
+            _mm_storel_pi( (__m64*)out, value );
+        } else {
+            _mm_storeu_ps( out, value );
+        }
+        if( attribute == GLTF_POSITION ) {
+            *boundsMin = _mm_min_ps( *boundsMin, value );
+            *boundsMax = _mm_max_ps( *boundsMax, value );
+        }
+    }
+}
+
+/// @brief Convert index range to 32-bit indices
+/// @return false if an index references a vertex that doesn't exist
+static bool GLTFConvertIndices( const GLTFAccessor* indices, usize first, usize count, usize vertexCount, u32* out ) {
+    if( !vertexCount ) {
+        return count == 0;
+    }
+    u32 largest = (u32)( vertexCount - 1 );
+    usize i = 0;
+    switch( indices->componentType ) {
+        case Platform::DataType::UNSIGNED_SHORT: {
+            const u16* at = (const u16*)indices->data + first;
+            // NOTE(alicia): saturating subtract is only non-zero for indices past the largest
+            __m128i limit   = _mm_set1_epi16( (i16)(u16)( largest < U16::MAX ? largest : U16::MAX ) );
+            __m128i invalid = _mm_setzero_si128();
+            for( ; i + 8 <= count; i += 8 ) {
+                __m128i value = _mm_loadu_si128( (const __m128i*)( at + i ) );
+                invalid = _mm_or_si128( invalid, _mm_subs_epu16( value, limit ) );
+                _mm_storeu_si128( (__m128i*)( out + i ),     _mm_unpacklo_epi16( value, _mm_setzero_si128() ) );
+                _mm_storeu_si128( (__m128i*)( out + i + 4 ), _mm_unpackhi_epi16( value, _mm_setzero_si128() ) );
+            }
+            if( _mm_movemask_epi8( _mm_cmpeq_epi8( invalid, _mm_setzero_si128() ) ) != 0xFFFF ) {
+                return false;
+            }
+            for( ; i < count; ++i ) {
+                out[i] = at[i];
+                if( out[i] > largest ) {
+                    return false;
+                }
+            }
+        } break;
+        case Platform::DataType::UNSIGNED_INT: {
+            const u32* at = (const u32*)indices->data + first;
+            // NOTE(alicia): SSE2 only compares signed, flipping the sign bit compares unsigned
+            __m128i sign    = _mm_set1_epi32( I32::MIN );
+            __m128i limit   = _mm_xor_si128( _mm_set1_epi32( (i32)largest ), sign );
+            __m128i invalid = _mm_setzero_si128();
+            for( ; i + 4 <= count; i += 4 ) {
+                __m128i value = _mm_loadu_si128( (const __m128i*)( at + i ) );
+                invalid = _mm_or_si128( invalid, _mm_cmpgt_epi32( _mm_xor_si128( value, sign ), limit ) );
+                _mm_storeu_si128( (__m128i*)( out + i ), value );
+            }
+            if( _mm_movemask_epi8( invalid ) ) {
+                return false;
+            }
+            for( ; i < count; ++i ) {
+                out[i] = at[i];
+                if( out[i] > largest ) {
+                    return false;
+                }
+            }
+        } break;
+        default: {
+            const u8* at = indices->data + first;
+            for( ; i < count; ++i ) {
+                out[i] = at[i];
+                if( out[i] > largest ) {
+                    return false;
+                }
+            }
+        } break;
+    }
+    return true;
+}
+
+static void GLTFConvertJob( void* params ) {
+    GLTFChunk* chunk = (GLTFChunk*)params;
+    const GLTFPrimitive* primitive = chunk->primitive;
+    f32* out = (f32*)chunk->vertices;
+
+    __m128 boundsMin = _mm_set1_ps( F32::MAX );
+    __m128 boundsMax = _mm_set1_ps( -F32::MAX );
+    ucyclesi( GLTF_ATTRIBUTE_COUNT, attribute ) {
+        const GLTFAccessor* accessor = &primitive->attributes[attribute];
+        if( accessor->data ) {
+            GLTFConvertAttribute(
+                accessor, attribute,
+                chunk->firstVertex, chunk->vertexCount, out + GLTF_ATTRIBUTE_OFFSETS[attribute],
+                &boundsMin, &boundsMax
+            );
+        } else if( attribute == GLTF_TEXCOORD ) {
+            ucycles( chunk->vertexCount ) {
+                chunk->vertices[i].uv.x = chunk->vertices[i].position.x;
+                chunk->vertices[i].uv.y = chunk->vertices[i].position.y;
+            }
+        }
+    }
+
+    if( primitive->indices.data ) {
+        chunk->invalidIndex = !GLTFConvertIndices(
+            &primitive->indices, chunk->firstIndex, chunk->indexCount,
+            primitive->attributes[GLTF_POSITION].count, chunk->indices
+        );
+    } else {
+        ucycles( chunk->indexCount ) {
+            chunk->indices[i] = (u32)( chunk->firstIndex + i );
+        }
+    }
+
+    f32 bounds[2][4];
+    _mm_storeu_ps( bounds[0], boundsMin );
+    _mm_storeu_ps( bounds[1], boundsMax );
+    chunk->boundsMin = smath::vec3( bounds[0][0], bounds[0][1], bounds[0][2] );
+    chunk->boundsMax = smath::vec3( bounds[1][0], bounds[1][1], bounds[1][2] );
+}
+
+/// @brief Number of jobs a primitive is split into
+static usize GLTFChunkCount( Core::JobQueue* queue, usize vertexCount ) {
+    usize chunkCount = queue ? JobQueueThreadCount( queue ) : 1;
+    if( chunkCount > GLTF_MAX_JOBS ) {
+        chunkCount = GLTF_MAX_JOBS;
+    }
+    if( chunkCount > vertexCount / GLTF_MIN_JOB_VERTICES ) {
+        chunkCount = vertexCount / GLTF_MIN_JOB_VERTICES;
+    }
+    return chunkCount ? chunkCount : 1;
+}
+
+/// @brief Convert every primitive into a mesh, primitives become sub-meshes
+static bool GLTFBuildMesh( const GLTFFile* file, Core::JobQueue* queue, Core::Mesh* result ) {
+    *result = {};
+    u64 startTime = Platform::GetPerformanceCounter();
+
+    usize vertexCount = 0, indexCount = 0, chunkCount = 0;
+    ucycles( file->primitiveCount ) {
+        const GLTFPrimitive* primitive = &file->primitives[i];
+        usize primitiveVertices = primitive->attributes[GLTF_POSITION].count;
+        vertexCount += primitiveVertices;
+        indexCount  += primitive->indices.data ? primitive->indices.count : primitiveVertices;
+        chunkCount  += GLTFChunkCount( queue, primitiveVertices );
+    }
+    if( vertexCount > U32::MAX || indexCount > U32::MAX ) {
+        LOG_ERROR( "BuildGLBMesh > Mesh has too many vertices!" );
+        return false;
+    }
+
+    result->vertices   = (Core::vertex*)Platform::Alloc( vertexCount * sizeof(Core::vertex) );
+    result->indices    = (u32*)Platform::Alloc( indexCount * sizeof(u32) );
+    result->subMeshes  = (Core::SubMesh*)Platform::Alloc( file->primitiveCount * sizeof(Core::SubMesh) );
+    GLTFChunk* chunks  = (GLTFChunk*)Platform::Alloc( chunkCount * sizeof(GLTFChunk) );
+    result->vertexCount  = vertexCount;
+    result->indexCount   = indexCount;
+    result->subMeshCount = file->primitiveCount;
+    if( ( !result->vertices && vertexCount ) || ( !result->indices && indexCount ) || !result->subMeshes || !chunks ) {
+        LOG_ERROR( "BuildGLBMesh > Failed to allocate mesh!" );
+        if( chunks ) {
+            Platform::Free( chunks );
+        }
+        Core::FreeMesh( result );
+        return false;
+    }
+
+    usize baseVertex = 0, firstIndex = 0, chunk = 0;
+    ucycles( file->primitiveCount ) {
+        const GLTFPrimitive* primitive = &file->primitives[i];
+        Core::SubMesh* subMesh = &result->subMeshes[i];
+        subMesh->firstIndex  = (u32)firstIndex;
+        subMesh->indexCount  = (u32)( primitive->indices.data ? primitive->indices.count : primitive->attributes[GLTF_POSITION].count );
+        subMesh->baseVertex  = (u32)baseVertex;
+        subMesh->vertexCount = (u32)primitive->attributes[GLTF_POSITION].count;
+        subMesh->material    = primitive->material;
+
+        usize primitiveChunks  = GLTFChunkCount( queue, subMesh->vertexCount );
+        usize verticesPerChunk = ( subMesh->vertexCount + primitiveChunks - 1 ) / primitiveChunks;
+        usize indicesPerChunk  = ( subMesh->indexCount + primitiveChunks - 1 ) / primitiveChunks;
+        ucyclesi( primitiveChunks, part ) {
+            GLTFChunk* current = &chunks[chunk++];
+            usize firstVertex = part * verticesPerChunk < subMesh->vertexCount ? part * verticesPerChunk : subMesh->vertexCount;
+            usize firstChunkIndex = part * indicesPerChunk < subMesh->indexCount ? part * indicesPerChunk : subMesh->indexCount;
+            current->primitive   = primitive;
+            current->firstVertex = firstVertex;
+            current->vertexCount = subMesh->vertexCount - firstVertex < verticesPerChunk ?
+                subMesh->vertexCount - firstVertex : verticesPerChunk;
+            current->vertices    = result->vertices + baseVertex + firstVertex;
+            current->firstIndex  = firstChunkIndex;
+            current->indexCount  = subMesh->indexCount - firstChunkIndex < indicesPerChunk ?
+                subMesh->indexCount - firstChunkIndex : indicesPerChunk;
+            current->indices     = result->indices + firstIndex + firstChunkIndex;
+        }
+        baseVertex += subMesh->vertexCount;
+        firstIndex += subMesh->indexCount;
+    }
+
+    if( !queue || chunkCount == 1 ) {
+        ucycles( chunkCount ) {
+            GLTFConvertJob( &chunks[i] );
+        }
+    } else {
+        Core::JobCounter counter = {};
+        ucycles( chunkCount ) {
+            Core::PushJob( queue, GLTFConvertJob, &chunks[i], &counter );
+        }
+        Core::WaitForJobs( queue, &counter );
+    }
+
+    bool invalidIndex = false;
+    result->boundsMin = smath::vec3( F32::MAX );
+    result->boundsMax = smath::vec3( -F32::MAX );
+    ucycles( chunkCount ) {
+        invalidIndex = invalidIndex || chunks[i].invalidIndex;
+        if( chunks[i].vertexCount == 0 ) {
+            continue;
+        }
+        ucyclesi( 3, axis ) {
+            if( chunks[i].boundsMin[axis] < result->boundsMin[axis] ) {
+                result->boundsMin[axis] = chunks[i].boundsMin[axis];
+            }
+            if( chunks[i].boundsMax[axis] > result->boundsMax[axis] ) {
+                result->boundsMax[axis] = chunks[i].boundsMax[axis];
+            }
+        }
+    }
+    Platform::Free( chunks );
+    if( invalidIndex ) {
+        LOG_ERROR( "BuildGLBMesh > Index references an invalid vertex!" );
+        Core::FreeMesh( result );
+        return false;
+    }
+
+    f64 elapsedSeconds = (f64)( Platform::GetPerformanceCounter() - startTime ) /
+        (f64)Platform::GetPerformanceFrequency();
+    LOG_INFO( "BuildGLBMesh > Converted %llu primitives in %.3fs on %llu jobs, %llu vertices %llu triangles",
+        (u64)file->primitiveCount,
+        elapsedSeconds,
+        (u64)chunkCount,
+        (u64)result->vertexCount,
+        (u64)result->indexCount / 3
+    );
+
+    // NOTE(alicia): generated attributes only come from the primitive's own triangles
+    ucycles( file->primitiveCount ) {
+        const GLTFPrimitive* primitive = &file->primitives[i];
+        Core::SubMesh subMesh = result->subMeshes[i];
+        Core::Mesh view = {};
+        view.vertexCount  = subMesh.vertexCount;
+        view.vertices     = result->vertices + subMesh.baseVertex;
+        view.indexCount   = subMesh.indexCount;
+        view.indices      = result->indices + subMesh.firstIndex;
+        view.subMeshCount = 1;
+        view.subMeshes    = &subMesh;
+        subMesh.firstIndex = 0;
+        subMesh.baseVertex = 0;
+
+        if( !primitive->attributes[GLTF_NORMAL].data && !Core::GenerateMeshNormals( &view, queue ) ) {
+            Core::FreeMesh( result );
+            return false;
+        }
+        if( !primitive->attributes[GLTF_TANGENT].data ) {
+            Core::calculateTangentBasis(
+                view.indexCount, view.indices,
+                view.vertexCount, view.vertices,
+                queue
+            );
+        }
+    }
+    return true;
+}
+
+bool Core::BuildGLBMesh( usize size, const void* data, JobQueue* queue, Mesh* result ) {
+    GLTFFile file = {};
+    if( !GLTFParseFile( size, data, &file ) ) {
+        return false;
+    }
+    bool built = GLTFBuildMesh( &file, queue, result );
+    GLTFFreeFile( &file );
+    return built;
+}
+
+bool Core::LoadGLBFile( const char* filePath, const OBJParseOptions* options, MeshUploadData* result ) {
+    usize subStrPos = 0;
+    if( !subStringPos( filePath, ".glb", &subStrPos ) ) {
+        LOG_WARN("LoadGLBFile > Attempted to parse a file that is not a glb!");
+        return false;
+    }
+
+    Platform::MappedFile file = {};
+    if( !Platform::MapFile( filePath, &file ) ) {
+        LOG_ERROR( "LoadGLBFile > Failed to map \"%s\"!", filePath );
+        return false;
+    }
+    GLTFFile gltf = {};
+    if( !GLTFParseFile( file.size, file.data, &gltf ) ) {
+        Platform::UnmapFile( &file );
+        return false;
+    }
+    if( GLTFUploadDirect( &gltf, &file, result ) ) {
+        GLTFFreeFile( &gltf );
+        return true;
+    }
+
+    Core::JobQueue* queue = options ? options->jobQueue : nullptr;
+    usize sourceSize = file.size;
+
+    u64 sourceHash = 0;
+    if( !options || !options->skipCache ) {
+        sourceHash = Core::HashContents( file.size, file.data, queue );
+        if( Core::LoadMeshCacheData( sourceHash, sourceSize, MeshCacheFlags( options ), result ) ) {
+            GLTFFreeFile( &gltf );
+            Platform::UnmapFile( &file );
+            return true;
+        }
+    }
+
+    Core::Mesh mesh = {};
+    bool built = GLTFBuildMesh( &gltf, queue, &mesh );
+    GLTFFreeFile( &gltf );
+    Platform::UnmapFile( &file );
+    if( !built ) {
+        return false;
+    }
+    return FinishMeshLoad( &mesh, nullptr, sourceHash, sourceSize, options, result );
+}
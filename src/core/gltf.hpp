@@ -0,0 +1,51 @@
+/**
+ * Description:  Binary glTF 2.0 (.glb) loading
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "pch.hpp"
+
+namespace Core {
+
+// forward declaration
+struct JobQueue;
+struct Mesh;
+struct MeshUploadData;
+struct OBJParseOptions;
+
+#define GLB_MAGIC      0x46546C67 // "glTF"
+#define GLB_VERSION    2
+#define GLB_CHUNK_JSON 0x4E4F534A // "JSON"
+#define GLB_CHUNK_BIN  0x004E4942 // "BIN\0"
+
+/// @brief Smallest number of vertices worth converting on its own job
+#define GLTF_MIN_JOB_VERTICES 65536
+#define GLTF_MAX_JOBS 64
+
+/// @brief Build mesh from .glb file in memory.
+/// Every triangle primitive of every mesh becomes a sub-mesh with its material index,
+/// node transforms are not applied. Accessors are converted straight from the binary chunk
+/// in parallel vertex ranges with SSE, whatever their component type and stride.
+/// uvs are flipped to a bottom-left origin, vertices without uvs use position xy.
+/// Primitives without normals get angle-weighted smooth normals, primitives without tangents get generated ones
+/// @param size size of file in bytes
+/// @param data file memory, usually a mapped file
+/// @param queue job queue accessors are converted on, can be nullptr
+/// @param result [out] mesh, free with FreeMesh
+/// @return true if successful
+bool BuildGLBMesh( usize size, const void* data, JobQueue* queue, Mesh* result );
+
+/// @brief Load .glb model from path without touching the GPU, safe to call from any thread.
+/// File is mapped, if every primitive reads position, uv, normal and tangent from a single
+/// interleaved buffer view in a format the renderer takes as is, and indices are a single range,
+/// upload data points straight into the mapped binary chunk, without levels or meshlets.
+/// Otherwise the mesh is read from the mesh cache if possible, or built with BuildGLBMesh
+/// and finished like an .obj model. Crease angle and memory budget options are not used
+/// @param filePath path to file
+/// @param options parse options, nullptr for defaults
+/// @param result [out] upload data, free with FreeMeshUploadData
+/// @return true if successful
+bool LoadGLBFile( const char* filePath, const OBJParseOptions* options, MeshUploadData* result );
+
+} // namespace Core
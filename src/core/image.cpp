@@ -4,6 +4,7 @@
  * File Created: November 22, 2022 
 */
 #include "core/image.hpp"
+#include "core/jobs.hpp"
 #include "platform/io.hpp"
 
 #define STB_IMAGE_IMPLEMENTATION
@@ -11,9 +12,37 @@
 
 #define COLLECT_ALL_CHANNELS 0
 
+/// @brief Swap rows top to bottom, in place
+static void ImageFlipRows( u8* data, usize rowSize, usize rowCount ) {
+    if( rowCount < 2 ) {
+        return;
+    }
+    u8* top    = data;
+    u8* bottom = data + ( rowCount - 1 ) * rowSize;
+    while( top < bottom ) {
+        usize i = 0;
+        // NOTE(alicia): SSE
+        // swap 16 bytes at a time, tail of row one byte at a time
+        for( ; i + 16 <= rowSize; i += 16 ) {
+            __m128i a = _mm_loadu_si128( (const __m128i*)( top + i ) );
+            __m128i b = _mm_loadu_si128( (const __m128i*)( bottom + i ) );
+            _mm_storeu_si128( (__m128i*)( top + i ), b );
+            _mm_storeu_si128( (__m128i*)( bottom + i ), a );
+        }
+        for( ; i < rowSize; ++i ) {
+            u8 byte   = top[i];
+            top[i]    = bottom[i];
+            bottom[i] = byte;
+        }
+        top    += rowSize;
+        bottom -= rowSize;
+    }
+}
+
 bool Core::ReadImage( usize filesize, void* file, Image* result ) {
 
-    stbi_set_flip_vertically_on_load( true );
+    // NOTE(alicia): stbi_set_flip_vertically_on_load is global state shared by every thread,
+    // rows are flipped here instead
     result->data = stbi_load_from_memory(
         (u8*)file,
         filesize,
@@ -29,13 +58,421 @@ bool Core::ReadImage( usize filesize, void* file, Image* result ) {
         return false;
     }
 
-    result->totalSize = (usize)(result->width * result->height * result->colorComponentCount);
+    result->totalSize = (usize)result->width * (usize)result->height * (usize)result->colorComponentCount;
+    ImageFlipRows(
+        result->data,
+        (usize)result->width * (usize)result->colorComponentCount,
+        (usize)result->height
+    );
 
     return true;
 
 }
+
+struct ImageReadParams {
+    const Platform::File* file;
+    Core::Image* result;
+    bool success;
+};
+
+static void ImageReadJob( void* params ) {
+    ImageReadParams* read = (ImageReadParams*)params;
+    read->success = Core::ReadImage( read->file->size, read->file->data, read->result );
+}
+
+usize Core::ReadImages( usize fileCount, const Platform::File* files, JobQueue* queue, Image* results ) {
+    if( fileCount == 0 ) {
+        return 0;
+    }
+    u64 startTime = Platform::GetPerformanceCounter();
+
+    ImageReadParams* reads = (ImageReadParams*)Platform::Alloc( fileCount * sizeof(ImageReadParams) );
+    if( !reads ) {
+        LOG_ERROR( "ReadImages > Failed to allocate jobs!" );
+        ucycles( fileCount ) {
+            results[i] = {};
+        }
+        return 0;
+    }
+
+    ucycles( fileCount ) {
+        reads[i].file   = &files[i];
+        reads[i].result = &results[i];
+    }
+    // NOTE(alicia): images are few and large, every image is its own job
+    if( fileCount == 1 ) {
+        ImageReadJob( &reads[0] );
+    } else {
+        Core::JobCounter counter = {};
+        ucycles( fileCount ) {
+            Core::PushJob( queue, ImageReadJob, &reads[i], &counter );
+        }
+        Core::WaitForJobs( queue, &counter );
+    }
+
+    usize readCount = 0;
+    usize totalSize = 0;
+    ucycles( fileCount ) {
+        if( reads[i].success ) {
+            readCount++;
+            totalSize += results[i].totalSize;
+        }
+    }
+    Platform::Free( reads );
+
+    f64 elapsedSeconds = (f64)( Platform::GetPerformanceCounter() - startTime ) /
+        (f64)Platform::GetPerformanceFrequency();
+    LOG_INFO( "ReadImages > Read %llu of %llu images ( %.1fMB ) in %.3fs on %llu threads",
+        readCount,
+        fileCount,
+        (f64)totalSize / (f64)MEGABYTES(1),
+        elapsedSeconds,
+        (usize)JobQueueThreadCount( queue )
+    );
+    return readCount;
+}
+
 void Core::FreeImage( Image* image ) {
     if( image->data ) {
         stbi_image_free( image->data );
     }
 }
+
+/// @brief Number of taps of the Kaiser filter in each dimension
+#define IMAGE_KAISER_TAPS  8
+#define IMAGE_KAISER_ALPHA 4.0f
+
+/// @brief Separable downsampling kernel, destination texel x reads source texels 2x + firstTap + k
+struct MipKernel {
+    i32 firstTap;
+    u32 tapCount;
+    f32 weights[IMAGE_KAISER_TAPS];
+};
+
+/// @brief How components are decoded before and encoded after filtering
+struct MipCodec {
+    /// @brief Decoded value of every byte of every component
+    f32 decode[4][256];
+    /// @brief Component is sRGB color
+    bool srgb[4];
+    /// @brief First three components are a unit vector
+    bool normal;
+    /// @brief Linear value halfway between every pair of neighbouring sRGB bytes
+    f32 srgbThresholds[255];
+};
+
+struct MipLevelJob {
+    const MipKernel* kernel;
+    const MipCodec* codec;
+    i32 components;
+    const u8* src;
+    i32 srcWidth, srcHeight;
+    u8* dst;
+    i32 dstWidth, dstHeight;
+    i32 firstRow, rowCount;
+    bool failed;
+};
+
+static f32 ImageSRGBToLinear( f32 value ) {
+    return value <= 0.04045f ? value / 12.92f : smath::pow( ( value + 0.055f ) / 1.055f, 2.4f );
+}
+
+/// @brief Zeroth order modified Bessel function of the first kind
+static f32 ImageBesselI0( f32 x ) {
+    f32 sum  = 1.0f;
+    f32 term = 1.0f;
+    f32 halfX = x * 0.5f;
+    for( u32 k = 1; k < 32; ++k ) {
+        term *= halfX / (f32)k;
+        sum  += term * term;
+        if( term * term < sum * 1e-8f ) {
+            break;
+        }
+    }
+    return sum;
+}
+
+static void ImageCreateKernel( Core::MipFilter filter, MipKernel* result ) {
+    *result = {};
+    if( filter == Core::MipFilter::BOX ) {
+        result->firstTap   = 0;
+        result->tapCount   = 2;
+        result->weights[0] = 0.5f;
+        result->weights[1] = 0.5f;
+        return;
+    }
+    // NOTE(alicia): destination texel centers fall between two source texels,
+    // so taps are at half texel distances and weights are the same for every texel
+    result->firstTap = -( IMAGE_KAISER_TAPS / 2 - 1 );
+    result->tapCount = IMAGE_KAISER_TAPS;
+    f32 halfWidth = (f32)IMAGE_KAISER_TAPS * 0.5f;
+    f32 sum = 0.0f;
+    ucycles( IMAGE_KAISER_TAPS ) {
+        f32 distance = (f32)i - halfWidth + 0.5f;
+        // sinc with cutoff at half the source frequency
+        f32 x    = F32::PI * distance * 0.5f;
+        f32 sinc = smath::sin( x ) / x;
+        f32 t    = distance / halfWidth;
+        f32 window = ImageBesselI0( IMAGE_KAISER_ALPHA * smath::sqrt( 1.0f - t * t ) ) /
+            ImageBesselI0( IMAGE_KAISER_ALPHA );
+        result->weights[i] = sinc * window;
+        sum += result->weights[i];
+    }
+    ucycles( IMAGE_KAISER_TAPS ) {
+        result->weights[i] /= sum;
+    }
+}
+
+static void ImageCreateCodec( Core::ImageContent content, i32 components, MipCodec* result ) {
+    *result = {};
+    result->normal = content == Core::ImageContent::NORMAL && components >= 3;
+    // alpha is the last component of gray-alpha and rgba images
+    i32 colorComponents = components == 2 || components == 4 ? components - 1 : components;
+    ucycles( 4 ) {
+        result->srgb[i] = content == Core::ImageContent::SRGB && (i32)i < colorComponents;
+    }
+    ucyclesi( 256, byte ) {
+        f32 value = (f32)byte / 255.0f;
+        ucycles( 4 ) {
+            if( result->normal && i < 3 ) {
+                result->decode[i][byte] = value * 2.0f - 1.0f;
+            } else if( result->srgb[i] ) {
+                result->decode[i][byte] = ImageSRGBToLinear( value );
+            } else {
+                result->decode[i][byte] = value;
+            }
+        }
+    }
+    ucycles( 255 ) {
+        result->srgbThresholds[i] = ImageSRGBToLinear( ( (f32)i + 0.5f ) / 255.0f );
+    }
+}
+
+static inline u8 ImageEncodeUnorm( f32 value ) {
+    value = smath::clamp( value, 0.0f, 1.0f );
+    return (u8)( value * 255.0f + 0.5f );
+}
+
+/// @brief Closest sRGB byte of linear value, found with a binary search of thresholds
+static inline u8 ImageEncodeSRGB( const MipCodec* codec, f32 value ) {
+    u32 low  = 0;
+    u32 high = 255;
+    while( low < high ) {
+        u32 middle = ( low + high ) / 2;
+        if( codec->srgbThresholds[middle] < value ) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return (u8)low;
+}
+
+static inline i32 ImageClampTap( i32 tap, i32 size ) {
+    return tap < 0 ? 0 : ( tap >= size ? size - 1 : tap );
+}
+
+/// @brief Filter destination rows of job, vertically into a row of source width then horizontally
+static void ImageMipLevelJob( void* params ) {
+    MipLevelJob* job = (MipLevelJob*)params;
+    const MipKernel* kernel = job->kernel;
+    const MipCodec*  codec  = job->codec;
+    i32 components = job->components;
+    usize srcRowLength = (usize)job->srcWidth * (usize)components;
+    usize dstRowLength = (usize)job->dstWidth * (usize)components;
+
+    f32* scratch = (f32*)Platform::Alloc( ( srcRowLength * 2 + dstRowLength ) * sizeof(f32) );
+    if( !scratch ) {
+        job->failed = true;
+        return;
+    }
+    f32* decoded  = scratch;
+    f32* vertical = decoded + srcRowLength;
+    f32* filtered = vertical + srcRowLength;
+
+    for( i32 y = job->firstRow; y < job->firstRow + job->rowCount; ++y ) {
+        ucycles( srcRowLength ) {
+            vertical[i] = 0.0f;
+        }
+        ucyclesi( kernel->tapCount, tap ) {
+            i32 srcY = ImageClampTap( y * 2 + kernel->firstTap + (i32)tap, job->srcHeight );
+            const u8* srcRow = job->src + (usize)srcY * srcRowLength;
+            ucycles( srcRowLength ) {
+                decoded[i] = codec->decode[i % (usize)components][srcRow[i]];
+            }
+            // NOTE(alicia): SSE
+            __m128 weight = _mm_set1_ps( kernel->weights[tap] );
+            usize i = 0;
+            for( ; i + 4 <= srcRowLength; i += 4 ) {
+                __m128 sum = _mm_loadu_ps( vertical + i );
+                sum = _mm_add_ps( sum, _mm_mul_ps( weight, _mm_loadu_ps( decoded + i ) ) );
+                _mm_storeu_ps( vertical + i, sum );
+            }
+            for( ; i < srcRowLength; ++i ) {
+                vertical[i] += kernel->weights[tap] * decoded[i];
+            }
+        }
+
+        for( i32 x = 0; x < job->dstWidth; ++x ) {
+            f32* texel = filtered + (usize)x * (usize)components;
+            if( components == 4 ) {
+                // NOTE(alicia): SSE
+                __m128 sum = _mm_setzero_ps();
+                ucyclesi( kernel->tapCount, tap ) {
+                    i32 srcX = ImageClampTap( x * 2 + kernel->firstTap + (i32)tap, job->srcWidth );
+                    __m128 srcTexel = _mm_loadu_ps( vertical + (usize)srcX * 4 );
+                    sum = _mm_add_ps( sum, _mm_mul_ps( _mm_set1_ps( kernel->weights[tap] ), srcTexel ) );
+                }
+                _mm_storeu_ps( texel, sum );
+            } else {
+                cycles( components ) {
+                    texel[i] = 0.0f;
+                }
+                ucyclesi( kernel->tapCount, tap ) {
+                    i32 srcX = ImageClampTap( x * 2 + kernel->firstTap + (i32)tap, job->srcWidth );
+                    const f32* srcTexel = vertical + (usize)srcX * (usize)components;
+                    cycles( components ) {
+                        texel[i] += kernel->weights[tap] * srcTexel[i];
+                    }
+                }
+            }
+            if( codec->normal ) {
+                f32 length = smath::sqrt( texel[0] * texel[0] + texel[1] * texel[1] + texel[2] * texel[2] );
+                if( length > 0.0f ) {
+                    texel[0] /= length;
+                    texel[1] /= length;
+                    texel[2] /= length;
+                } else {
+                    texel[0] = 0.0f;
+                    texel[1] = 0.0f;
+                    texel[2] = 1.0f;
+                }
+            }
+        }
+
+        u8* dstRow = job->dst + (usize)y * dstRowLength;
+        ucycles( dstRowLength ) {
+            usize component = i % (usize)components;
+            if( codec->normal && component < 3 ) {
+                dstRow[i] = ImageEncodeUnorm( filtered[i] * 0.5f + 0.5f );
+            } else if( codec->srgb[component] ) {
+                dstRow[i] = ImageEncodeSRGB( codec, filtered[i] );
+            } else {
+                dstRow[i] = ImageEncodeUnorm( filtered[i] );
+            }
+        }
+    }
+
+    Platform::Free( scratch );
+}
+
+bool Core::GenerateMipChain( const Image* image, MipFilter filter, ImageContent content, JobQueue* queue, MipChain* result ) {
+    u64 startTime = Platform::GetPerformanceCounter();
+
+    *result = {};
+    if( !image->data || image->width <= 0 || image->height <= 0 ) {
+        return false;
+    }
+    i32 components = image->colorComponentCount;
+    result->width  = image->width;
+    result->height = image->height;
+    result->colorComponentCount = components;
+
+    i32 largest = image->width > image->height ? image->width : image->height;
+    result->levelCount = 1;
+    while( ( largest >> result->levelCount ) > 0 && result->levelCount < IMAGE_MAX_MIP_LEVELS ) {
+        result->levelCount++;
+    }
+    ucycles( result->levelCount ) {
+        result->levelOffsets[i] = result->totalSize;
+        result->totalSize +=
+            (usize)MipLevelSize( image->width, (u32)i ) *
+            (usize)MipLevelSize( image->height, (u32)i ) *
+            (usize)components;
+    }
+    result->data = (u8*)Platform::Alloc( result->totalSize );
+    MipCodec* codec = (MipCodec*)Platform::Alloc( sizeof(MipCodec) );
+    if( !result->data || !codec ) {
+        LOG_ERROR( "GenerateMipChain > Failed to allocate mip chain!" );
+        if( codec ) {
+            Platform::Free( codec );
+        }
+        FreeMipChain( result );
+        return false;
+    }
+    Platform::MemCopy( image->totalSize, image->data, result->data );
+
+    MipKernel kernel;
+    ImageCreateKernel( filter, &kernel );
+    ImageCreateCodec( content, components, codec );
+
+    bool success = true;
+    MipLevelJob jobs[IMAGE_MIP_MAX_JOBS];
+    for( u32 level = 1; success && level < result->levelCount; ++level ) {
+        i32 dstWidth  = MipLevelSize( image->width, level );
+        i32 dstHeight = MipLevelSize( image->height, level );
+
+        usize chunkCount = JobQueueThreadCount( queue );
+        usize maxChunkCount = ( (usize)dstWidth * (usize)dstHeight ) / IMAGE_MIP_MIN_JOB_TEXELS;
+        if( chunkCount > maxChunkCount ) {
+            chunkCount = maxChunkCount;
+        }
+        if( chunkCount > IMAGE_MIP_MAX_JOBS ) {
+            chunkCount = IMAGE_MIP_MAX_JOBS;
+        }
+        if( chunkCount > (usize)dstHeight ) {
+            chunkCount = (usize)dstHeight;
+        }
+        if( chunkCount < 1 ) {
+            chunkCount = 1;
+        }
+
+        ucycles( chunkCount ) {
+            MipLevelJob* job = &jobs[i];
+            *job = {};
+            job->kernel     = &kernel;
+            job->codec      = codec;
+            job->components = components;
+            job->src        = result->data + result->levelOffsets[level - 1];
+            job->srcWidth   = MipLevelSize( image->width, level - 1 );
+            job->srcHeight  = MipLevelSize( image->height, level - 1 );
+            job->dst        = result->data + result->levelOffsets[level];
+            job->dstWidth   = dstWidth;
+            job->dstHeight  = dstHeight;
+            job->firstRow   = (i32)( (usize)dstHeight * i / chunkCount );
+            job->rowCount   = (i32)( (usize)dstHeight * ( i + 1 ) / chunkCount ) - job->firstRow;
+        }
+        if( chunkCount == 1 ) {
+            ImageMipLevelJob( &jobs[0] );
+        } else {
+            JobCounter counter = {};
+            ucycles( chunkCount ) {
+                PushJob( queue, ImageMipLevelJob, &jobs[i], &counter );
+            }
+            WaitForJobs( queue, &counter );
+        }
+        ucycles( chunkCount ) {
+            success = success && !jobs[i].failed;
+        }
+    }
+    Platform::Free( codec );
+    if( !success ) {
+        LOG_ERROR( "GenerateMipChain > Failed to allocate filter rows!" );
+        FreeMipChain( result );
+        return false;
+    }
+
+    f64 elapsedSeconds = (f64)( Platform::GetPerformanceCounter() - startTime ) /
+        (f64)Platform::GetPerformanceFrequency();
+    LOG_INFO( "GenerateMipChain > %ix%i %u levels in %.3fs",
+        image->width, image->height, result->levelCount, elapsedSeconds
+    );
+    return true;
+}
+
+void Core::FreeMipChain( MipChain* chain ) {
+    if( chain->data ) {
+        Platform::Free( chain->data );
+    }
+    *chain = {};
+}
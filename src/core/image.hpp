@@ -6,7 +6,15 @@
 #pragma once
 #include "pch.hpp"
 
+// forward declaration
+namespace Platform {
+    struct File;
+};
+
 namespace Core {
+
+// forward declaration
+struct JobQueue;
     
 struct Image {
     i32 width, height;
@@ -15,14 +23,76 @@ struct Image {
     u8* data;
 };
 
-/// @brief read image from file
+/// @brief read image from file.
+/// rows are flipped after decoding so the first row is the bottom of the image,
+/// safe to call from any thread
 /// @param filesize byte size of file
 /// @param file file data
 /// @param result result
 /// @return true if successful
 bool ReadImage( usize filesize, void* file, Image* result );
 
+/// @brief Read images from files in parallel, every image is decoded and flipped on its own job
+/// @param fileCount number of files
+/// @param files files to read
+/// @param queue job queue images are decoded on, can be nullptr
+/// @param results [out] an image per file, zeroed if file could not be read, free every image with FreeImage
+/// @return number of images read
+usize ReadImages( usize fileCount, const Platform::File* files, JobQueue* queue, Image* results );
+
 void FreeImage( Image* image );
 
-} // namespace Core
+/// @brief Maximum number of levels in a mip chain, enough for 32768x32768 images
+#define IMAGE_MAX_MIP_LEVELS 16
+/// @brief Smallest number of texels worth filtering on its own job
+#define IMAGE_MIP_MIN_JOB_TEXELS 65536
+#define IMAGE_MIP_MAX_JOBS 64
+
+/// @brief Filter levels are downsampled with
+enum class MipFilter : u32 {
+    /// @brief Average of 2x2 texels
+    BOX,
+    /// @brief Kaiser-windowed sinc over 8x8 texels, sharper than box
+    KAISER
+};
+
+/// @brief What image data represents, decides how levels are filtered
+enum class ImageContent : u32 {
+    /// @brief Components are filtered as they are
+    LINEAR,
+    /// @brief Color components are sRGB, they are filtered in linear space, alpha is filtered as it is
+    SRGB,
+    /// @brief First three components are a unit vector mapped to [0, 255], renormalized after filtering
+    NORMAL
+};
 
+/// @brief Every level of an image, level n is max( 1, size >> n ) in each dimension
+struct MipChain {
+    i32 width, height;
+    i32 colorComponentCount;
+    u32 levelCount;
+    /// @brief Offset of every level in data, levels are packed back to back starting with full size
+    usize levelOffsets[IMAGE_MAX_MIP_LEVELS];
+    usize totalSize;
+    u8* data;
+};
+
+/// @brief Size of mip level in a single dimension
+inline i32 MipLevelSize( i32 size, u32 level ) {
+    i32 result = size >> level;
+    return result > 0 ? result : 1;
+}
+
+/// @brief Generate full mip chain of image.
+/// Every level is filtered from the level before it, rows of large levels are split across jobs
+/// @param image image, level 0 is a copy of it
+/// @param filter downsampling filter
+/// @param content what image data represents
+/// @param queue job queue, can be nullptr
+/// @param result [out] mip chain, free with FreeMipChain
+/// @return false if allocation failed
+bool GenerateMipChain( const Image* image, MipFilter filter, ImageContent content, JobQueue* queue, MipChain* result );
+/// @brief Free mip chain
+void FreeMipChain( MipChain* chain );
+
+} // namespace Core
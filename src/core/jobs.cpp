@@ -0,0 +1,148 @@
+/**
+ * Description:  Job queue
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "core/jobs.hpp"
+#include "platform/io.hpp"
+
+// NOTE(alicia): bounded queue where every entry carries a sequence number.
+// an entry can be written when its sequence equals the write index
+// and can be read when its sequence equals read index + 1.
+// every atomic function is a full barrier so entry contents are visible
+// before the sequence number changes.
+
+#define JOB_QUEUE_MASK ( JOB_QUEUE_CAPACITY - 1 )
+static_assert( ( JOB_QUEUE_CAPACITY & JOB_QUEUE_MASK ) == 0, "Job queue capacity must be a power of two!" );
+
+static bool JobQueueEnqueue( Core::JobQueue* queue, Core::JobFN job, void* params, Core::JobCounter* counter ) {
+    for( ;; ) {
+        i32 position = queue->writeIndex;
+        Core::JobEntry* entry = &queue->entries[position & JOB_QUEUE_MASK];
+        i32 difference = (i32)( (u32)entry->sequence - (u32)position );
+        if( difference == 0 ) {
+            if( Platform::AtomicCompareExchange( &queue->writeIndex, position + 1, position ) == position ) {
+                entry->job     = job;
+                entry->params  = params;
+                entry->counter = counter;
+                // publish, sequence becomes position + 1
+                Platform::AtomicIncrement( &entry->sequence );
+                return true;
+            }
+        } else if( difference < 0 ) {
+            // queue is full
+            return false;
+        }
+    }
+}
+
+static bool JobQueueDequeue( Core::JobQueue* queue, Core::JobEntry* result ) {
+    for( ;; ) {
+        i32 position = queue->readIndex;
+        Core::JobEntry* entry = &queue->entries[position & JOB_QUEUE_MASK];
+        i32 difference = (i32)( (u32)entry->sequence - (u32)( position + 1 ) );
+        if( difference == 0 ) {
+            if( Platform::AtomicCompareExchange( &queue->readIndex, position + 1, position ) == position ) {
+                result->job     = entry->job;
+                result->params  = entry->params;
+                result->counter = entry->counter;
+                // release entry for writing, sequence becomes position + capacity
+                Platform::AtomicAdd( &entry->sequence, JOB_QUEUE_CAPACITY - 1 );
+                return true;
+            }
+        } else if( difference < 0 ) {
+            // queue is empty
+            return false;
+        }
+    }
+}
+
+static void JobWorkerProc( void* params ) {
+    Core::JobQueue* queue = (Core::JobQueue*)params;
+    while( queue->running ) {
+        if( !Core::RunNextJob( queue ) ) {
+            Platform::SemaphoreWait( &queue->semaphore );
+        }
+    }
+}
+
+Core::JobQueue* Core::CreateJobQueue( u32 workerCount ) {
+    if( workerCount > JOB_QUEUE_MAX_THREADS ) {
+        workerCount = JOB_QUEUE_MAX_THREADS;
+    }
+
+    JobQueue* queue = (JobQueue*)Platform::Alloc( sizeof(JobQueue) );
+    if( !queue ) {
+        LOG_ERROR( "Jobs > Failed to allocate job queue!" );
+        return nullptr;
+    }
+    ucycles( JOB_QUEUE_CAPACITY ) {
+        queue->entries[i].sequence = (i32)i;
+    }
+    queue->running = 1;
+
+    if( !Platform::SemaphoreCreate( 0, (u32)I32::MAX, &queue->semaphore ) ) {
+        LOG_ERROR( "Jobs > Failed to create semaphore!" );
+        Platform::Free( queue );
+        return nullptr;
+    }
+
+    ucycles( workerCount ) {
+        if( !Platform::ThreadCreate( JobWorkerProc, queue, &queue->workers[i] ) ) {
+            LOG_WARN( "Jobs > Failed to create worker thread %llu!", i );
+            break;
+        }
+        queue->workerCount++;
+    }
+
+    LOG_INFO( "Jobs > Job queue created with %u worker threads", queue->workerCount );
+    return queue;
+}
+
+void Core::DestroyJobQueue( JobQueue* queue ) {
+    if( !queue ) {
+        return;
+    }
+    Platform::AtomicCompareExchange( &queue->running, 0, 1 );
+    Platform::SemaphoreSignal( &queue->semaphore, queue->workerCount );
+    ucycles( queue->workerCount ) {
+        Platform::ThreadJoin( &queue->workers[i] );
+    }
+    Platform::SemaphoreDestroy( &queue->semaphore );
+    Platform::Free( queue );
+}
+
+void Core::PushJob( JobQueue* queue, JobFN job, void* params, JobCounter* counter ) {
+    if( counter ) {
+        Platform::AtomicIncrement( &counter->pending );
+    }
+    if( !queue || !JobQueueEnqueue( queue, job, params, counter ) ) {
+        job( params );
+        if( counter ) {
+            Platform::AtomicDecrement( &counter->pending );
+        }
+        return;
+    }
+    Platform::SemaphoreSignal( &queue->semaphore, 1 );
+}
+
+bool Core::RunNextJob( JobQueue* queue ) {
+    JobEntry entry = {};
+    if( !JobQueueDequeue( queue, &entry ) ) {
+        return false;
+    }
+    entry.job( entry.params );
+    if( entry.counter ) {
+        Platform::AtomicDecrement( &entry.counter->pending );
+    }
+    return true;
+}
+
+void Core::WaitForJobs( JobQueue* queue, JobCounter* counter ) {
+    while( counter->pending > 0 ) {
+        if( !queue || !RunNextJob( queue ) ) {
+            // NOTE(alicia): SSE
+            _mm_pause();
+        }
+    }
+}
@@ -0,0 +1,67 @@
+/**
+ * Description:  Job queue
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "pch.hpp"
+#include "platform/threading.hpp"
+
+namespace Core {
+
+/// @brief Job entry point
+typedef void (*JobFN)( void* params );
+
+/// @brief Number of unfinished jobs in a batch.
+/// Zero-initialize before pushing jobs with it
+struct JobCounter {
+    volatile i32 pending;
+};
+
+#define JOB_QUEUE_CAPACITY 1024
+#define JOB_QUEUE_MAX_THREADS 64
+
+struct JobEntry {
+    volatile i32 sequence;
+    JobFN        job;
+    void*        params;
+    JobCounter*  counter;
+};
+
+/// @brief Multi-producer multi-consumer job queue with its own worker threads
+struct JobQueue {
+    JobEntry entries[JOB_QUEUE_CAPACITY];
+    volatile i32 writeIndex;
+    volatile i32 readIndex;
+    volatile i32 running;
+    Platform::Semaphore semaphore;
+    u32 workerCount;
+    Platform::Thread workers[JOB_QUEUE_MAX_THREADS];
+};
+
+/// @brief Create job queue and start its worker threads
+/// @param workerCount number of worker threads, can be zero
+/// @return pointer to job queue, nullptr if failed
+JobQueue* CreateJobQueue( u32 workerCount );
+/// @brief Stop worker threads and free job queue.
+/// Jobs that haven't started yet are discarded
+void DestroyJobQueue( JobQueue* queue );
+/// @brief Push job to queue.
+/// If queue is full, job is run immediately on the calling thread
+/// @param queue job queue
+/// @param job job entry point
+/// @param params parameters passed to job
+/// @param counter optional, incremented now and decremented when job is finished
+void PushJob( JobQueue* queue, JobFN job, void* params, JobCounter* counter );
+/// @brief Run the next job in queue on the calling thread
+/// @return false if queue was empty
+bool RunNextJob( JobQueue* queue );
+/// @brief Wait until every job in counter's batch is finished.
+/// Calling thread runs jobs from queue while it waits
+void WaitForJobs( JobQueue* queue, JobCounter* counter );
+/// @brief Number of threads that run jobs while a thread waits on WaitForJobs
+inline u32 JobQueueThreadCount( const JobQueue* queue ) {
+    return queue ? queue->workerCount + 1 : 1;
+}
+
+} // namespace Core
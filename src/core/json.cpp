@@ -0,0 +1,398 @@
+/**
+ * Description:  Minimal JSON reader
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "core/json.hpp"
+#include "platform/io.hpp"
+
+static const f64 JSON_POWERS_OF_TEN[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+    1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/// @brief Parser state, values is nullptr while counting values
+struct JSONParser {
+    const char* text;
+    usize length;
+    usize at;
+    u32 depth;
+    u32 valueCount;
+    Core::JSONValue* values;
+};
+
+static bool JSONIsSpace( char character ) {
+    return character == ' ' || character == '\t' || character == '\n' || character == '\r';
+}
+static bool JSONIsDigit( char character ) {
+    return character >= '0' && character <= '9';
+}
+
+static void JSONSkipSpace( JSONParser* parser ) {
+    while( parser->at < parser->length && JSONIsSpace( parser->text[parser->at] ) ) {
+        parser->at++;
+    }
+}
+
+/// @brief Add value, only written when parser is not counting
+/// @return index of value
+static u32 JSONPushValue( JSONParser* parser, Core::JSONType type, usize start ) {
+    u32 index = parser->valueCount++;
+    if( parser->values ) {
+        Core::JSONValue* value = &parser->values[index];
+        value->type  = type;
+        value->start = (u32)start;
+    }
+    return index;
+}
+static void JSONEndValue( JSONParser* parser, u32 index, usize end, u32 childCount ) {
+    if( parser->values ) {
+        Core::JSONValue* value = &parser->values[index];
+        value->length     = (u32)( end - value->start );
+        value->childCount = childCount;
+        value->next       = parser->valueCount;
+    }
+}
+
+static bool JSONParseString( JSONParser* parser ) {
+    // NOTE(alicia): skip opening quote, string text starts after it
+    parser->at++;
+    usize start = parser->at;
+    u32 index = JSONPushValue( parser, Core::JSONType::STRING, start );
+    while( parser->at < parser->length ) {
+        char character = parser->text[parser->at];
+        if( character == '"' ) {
+            JSONEndValue( parser, index, parser->at, 0 );
+            parser->at++;
+            return true;
+        }
+        if( character == '\\' ) {
+            parser->at++;
+        } else if( (u8)character < 0x20 ) {
+            return false;
+        }
+        parser->at++;
+    }
+    return false;
+}
+
+static bool JSONParseLiteral( JSONParser* parser, const char* literal, Core::JSONType type ) {
+    usize start = parser->at;
+    while( *literal ) {
+        if( parser->at >= parser->length || parser->text[parser->at] != *literal ) {
+            return false;
+        }
+        parser->at++;
+        literal++;
+    }
+    u32 index = JSONPushValue( parser, type, start );
+    JSONEndValue( parser, index, parser->at, 0 );
+    return true;
+}
+
+static bool JSONParseNumber( JSONParser* parser ) {
+    usize start = parser->at;
+    if( parser->text[parser->at] == '-' ) {
+        parser->at++;
+    }
+    usize digitStart = parser->at;
+    while( parser->at < parser->length && JSONIsDigit( parser->text[parser->at] ) ) {
+        parser->at++;
+    }
+    if( parser->at == digitStart ) {
+        return false;
+    }
+    if( parser->at < parser->length && parser->text[parser->at] == '.' ) {
+        parser->at++;
+        digitStart = parser->at;
+        while( parser->at < parser->length && JSONIsDigit( parser->text[parser->at] ) ) {
+            parser->at++;
+        }
+        if( parser->at == digitStart ) {
+            return false;
+        }
+    }
+    if( parser->at < parser->length && ( parser->text[parser->at] == 'e' || parser->text[parser->at] == 'E' ) ) {
+        parser->at++;
+        if( parser->at < parser->length && ( parser->text[parser->at] == '-' || parser->text[parser->at] == '+' ) ) {
+            parser->at++;
+        }
+        digitStart = parser->at;
+        while( parser->at < parser->length && JSONIsDigit( parser->text[parser->at] ) ) {
+            parser->at++;
+        }
+        if( parser->at == digitStart ) {
+            return false;
+        }
+    }
+    u32 index = JSONPushValue( parser, Core::JSONType::NUMBER, start );
+    JSONEndValue( parser, index, parser->at, 0 );
+    return true;
+}
+
+static bool JSONParseValue( JSONParser* parser );
+
+/// @brief Parse object or array, members of objects are a key string followed by a value
+static bool JSONParseContainer( JSONParser* parser, bool object ) {
+    if( parser->depth >= JSON_MAX_DEPTH ) {
+        return false;
+    }
+    parser->depth++;
+
+    char close = object ? '}' : ']';
+    usize start = parser->at;
+    u32 index = JSONPushValue( parser, object ? Core::JSONType::OBJECT : Core::JSONType::ARRAY, start );
+    parser->at++;
+
+    u32 childCount = 0;
+    JSONSkipSpace( parser );
+    if( parser->at < parser->length && parser->text[parser->at] == close ) {
+        parser->at++;
+        JSONEndValue( parser, index, parser->at, 0 );
+        parser->depth--;
+        return true;
+    }
+
+    for( ;; ) {
+        if( object ) {
+            JSONSkipSpace( parser );
+            if( parser->at >= parser->length || parser->text[parser->at] != '"' ) {
+                return false;
+            }
+            if( !JSONParseString( parser ) ) {
+                return false;
+            }
+            JSONSkipSpace( parser );
+            if( parser->at >= parser->length || parser->text[parser->at] != ':' ) {
+                return false;
+            }
+            parser->at++;
+        }
+        if( !JSONParseValue( parser ) ) {
+            return false;
+        }
+        childCount++;
+
+        JSONSkipSpace( parser );
+        if( parser->at >= parser->length ) {
+            return false;
+        }
+        char character = parser->text[parser->at++];
+        if( character == close ) {
+            break;
+        }
+        if( character != ',' ) {
+            return false;
+        }
+    }
+
+    JSONEndValue( parser, index, parser->at, childCount );
+    parser->depth--;
+    return true;
+}
+
+static bool JSONParseValue( JSONParser* parser ) {
+    JSONSkipSpace( parser );
+    if( parser->at >= parser->length ) {
+        return false;
+    }
+    switch( parser->text[parser->at] ) {
+        case '{': return JSONParseContainer( parser, true );
+        case '[': return JSONParseContainer( parser, false );
+        case '"': return JSONParseString( parser );
+        case 't': return JSONParseLiteral( parser, "true",  Core::JSONType::BOOLEAN );
+        case 'f': return JSONParseLiteral( parser, "false", Core::JSONType::BOOLEAN );
+        case 'n': return JSONParseLiteral( parser, "null",  Core::JSONType::NIL );
+        default:  return JSONParseNumber( parser );
+    }
+}
+
+/// @brief Parse whole document, counts values if parser has no value buffer
+static bool JSONParseDocument( JSONParser* parser ) {
+    if( !JSONParseValue( parser ) ) {
+        return false;
+    }
+    JSONSkipSpace( parser );
+    // NOTE(alicia): trailing null bytes are allowed, glb chunks are padded with spaces but
+    // some exporters pad with zeroes instead
+    while( parser->at < parser->length && parser->text[parser->at] == 0 ) {
+        parser->at++;
+    }
+    return parser->at == parser->length;
+}
+
+bool Core::ParseJSON( usize length, const char* text, JSONDocument* result ) {
+    *result = {};
+    if( length >= U32::MAX ) {
+        LOG_ERROR( "ParseJSON > Document is too large!" );
+        return false;
+    }
+
+    // NOTE(alicia): first pass only counts values so they can be stored in a single allocation
+    JSONParser parser = {};
+    parser.text   = text;
+    parser.length = length;
+    if( !JSONParseDocument( &parser ) ) {
+        LOG_ERROR( "ParseJSON > Invalid JSON at offset %llu!", (u64)parser.at );
+        return false;
+    }
+
+    u32 valueCount = parser.valueCount;
+    parser = {};
+    parser.text   = text;
+    parser.length = length;
+    parser.values = (JSONValue*)Platform::Alloc( valueCount * sizeof(JSONValue) );
+    if( !parser.values ) {
+        LOG_ERROR( "ParseJSON > Failed to allocate %u values!", valueCount );
+        return false;
+    }
+    JSONParseDocument( &parser );
+
+    result->text       = text;
+    result->valueCount = valueCount;
+    result->values     = parser.values;
+    return true;
+}
+
+void Core::FreeJSON( JSONDocument* document ) {
+    if( document->values ) {
+        Platform::Free( document->values );
+    }
+    *document = {};
+}
+
+u32 Core::JSONGetMember( const JSONDocument* document, u32 object, const char* key ) {
+    if( object >= document->valueCount || document->values[object].type != JSONType::OBJECT ) {
+        return JSON_INVALID;
+    }
+    u32 child = object + 1;
+    ucycles( document->values[object].childCount ) {
+        u32 value = child + 1;
+        if( JSONStringCmp( document, child, key ) ) {
+            return value;
+        }
+        child = document->values[value].next;
+    }
+    return JSON_INVALID;
+}
+
+u32 Core::JSONGetElement( const JSONDocument* document, u32 array, u32 index ) {
+    if(
+        array >= document->valueCount ||
+        document->values[array].type != JSONType::ARRAY ||
+        index >= document->values[array].childCount
+    ) {
+        return JSON_INVALID;
+    }
+    u32 child = array + 1;
+    ucycles( index ) {
+        child = document->values[child].next;
+    }
+    return child;
+}
+
+u32 Core::JSONGetCount( const JSONDocument* document, u32 value ) {
+    if( value >= document->valueCount ) {
+        return 0;
+    }
+    return document->values[value].childCount;
+}
+
+f64 Core::JSONGetNumber( const JSONDocument* document, u32 value, f64 defaultValue ) {
+    if( value >= document->valueCount || document->values[value].type != JSONType::NUMBER ) {
+        return defaultValue;
+    }
+    const char* at  = document->text + document->values[value].start;
+    const char* end = at + document->values[value].length;
+
+    bool negative = *at == '-';
+    if( negative ) {
+        at++;
+    }
+
+    // NOTE(alicia): only the first 19 significant digits fit in the mantissa,
+    // any digits past that only move the decimal exponent
+    u64 mantissa   = 0;
+    i32 digitCount = 0;
+    i32 exponent   = 0;
+    while( at < end && JSONIsDigit( *at ) ) {
+        if( digitCount < 19 ) {
+            mantissa = mantissa * 10 + (u64)(*at - '0');
+            if( mantissa != 0 ) {
+                digitCount++;
+            }
+        } else {
+            exponent++;
+        }
+        at++;
+    }
+    if( at < end && *at == '.' ) {
+        at++;
+        while( at < end && JSONIsDigit( *at ) ) {
+            if( digitCount < 19 ) {
+                mantissa = mantissa * 10 + (u64)(*at - '0');
+                if( mantissa != 0 ) {
+                    digitCount++;
+                }
+                exponent--;
+            }
+            at++;
+        }
+    }
+    if( at < end && ( *at == 'e' || *at == 'E' ) ) {
+        at++;
+        bool negativeExponent = false;
+        if( at < end && ( *at == '-' || *at == '+' ) ) {
+            negativeExponent = *at == '-';
+            at++;
+        }
+        i32 explicitExponent = 0;
+        while( at < end && JSONIsDigit( *at ) ) {
+            if( explicitExponent < 10000 ) {
+                explicitExponent = explicitExponent * 10 + (*at - '0');
+            }
+            at++;
+        }
+        exponent += negativeExponent ? -explicitExponent : explicitExponent;
+    }
+
+    f64 result = (f64)mantissa;
+    if( mantissa != 0 ) {
+        while( exponent > 22 ) {
+            result   *= JSON_POWERS_OF_TEN[22];
+            exponent -= 22;
+        }
+        while( exponent < -22 ) {
+            result   /= JSON_POWERS_OF_TEN[22];
+            exponent += 22;
+        }
+        if( exponent >= 0 ) {
+            result *= JSON_POWERS_OF_TEN[exponent];
+        } else {
+            result /= JSON_POWERS_OF_TEN[-exponent];
+        }
+    }
+    return negative ? -result : result;
+}
+
+bool Core::JSONGetBool( const JSONDocument* document, u32 value, bool defaultValue ) {
+    if( value >= document->valueCount || document->values[value].type != JSONType::BOOLEAN ) {
+        return defaultValue;
+    }
+    return document->text[document->values[value].start] == 't';
+}
+
+bool Core::JSONStringCmp( const JSONDocument* document, u32 value, const char* text ) {
+    if( value >= document->valueCount || document->values[value].type != JSONType::STRING ) {
+        return false;
+    }
+    const char* string = document->text + document->values[value].start;
+    u32 length = document->values[value].length;
+    ucycles( length ) {
+        if( text[i] != string[i] ) {
+            return false;
+        }
+    }
+    return text[length] == 0;
+}
@@ -0,0 +1,74 @@
+/**
+ * Description:  Minimal JSON reader
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "pch.hpp"
+
+namespace Core {
+
+/// @brief Deepest nesting of objects and arrays a document may have
+#define JSON_MAX_DEPTH 64
+/// @brief Value index returned when a value is not found
+#define JSON_INVALID U32::MAX
+
+enum class JSONType : u8 {
+    NONE,
+    OBJECT,
+    ARRAY,
+    STRING,
+    NUMBER,
+    BOOLEAN,
+    NIL,
+};
+
+/// @brief Single value of a parsed document.
+/// Values are stored in document order, so children directly follow their parent.
+/// Object members are stored as a STRING key followed by its value
+struct JSONValue {
+    JSONType type;
+    /// @brief Number of elements of an array or members of an object
+    u32 childCount;
+    /// @brief Index of first value after this one and all of its children
+    u32 next;
+    /// @brief Text of value in document, strings without quotes and with escapes left as is
+    u32 start;
+    u32 length;
+};
+
+/// @brief Parsed document, values point into text it was parsed from
+struct JSONDocument {
+    const char* text;
+    u32 valueCount;
+    JSONValue* values;
+};
+
+/// @brief Parse JSON text. Text is not copied and has to outlive document
+/// @param length length of text, doesn't have to be null-terminated
+/// @param text JSON text
+/// @param result [out] document, free with FreeJSON
+/// @return true if text is valid JSON
+bool ParseJSON( usize length, const char* text, JSONDocument* result );
+/// @brief Free document memory
+void FreeJSON( JSONDocument* document );
+
+/// @brief Find member of object by key
+/// @return index of member value, JSON_INVALID if object isn't an object or has no such member
+u32 JSONGetMember( const JSONDocument* document, u32 object, const char* key );
+/// @brief Get element of array
+/// @return index of element, JSON_INVALID if array isn't an array or index is out of range
+u32 JSONGetElement( const JSONDocument* document, u32 array, u32 index );
+/// @brief Number of elements of array or members of object, 0 for any other value or JSON_INVALID
+u32 JSONGetCount( const JSONDocument* document, u32 value );
+/// @brief Read number value
+/// @return number, defaultValue if value isn't a number or is JSON_INVALID
+f64 JSONGetNumber( const JSONDocument* document, u32 value, f64 defaultValue );
+/// @brief Read boolean value
+/// @return boolean, defaultValue if value isn't a boolean or is JSON_INVALID
+bool JSONGetBool( const JSONDocument* document, u32 value, bool defaultValue );
+/// @brief Compare string value to null-terminated text, escapes are compared as written
+/// @return true if value is a string equal to text
+bool JSONStringCmp( const JSONDocument* document, u32 value, const char* text );
+
+} // namespace Core
@@ -0,0 +1,173 @@
+/**
+ * Description:  Asynchronous asset loading
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "core/loader.hpp"
+#include "core/ply.hpp"
+#include "core/stl.hpp"
+#include "core/gltf.hpp"
+#include "platform/io.hpp"
+#include "util.hpp"
+
+// NOTE(alicia): finished loads use the same sequence scheme as the job queue.
+// a slot can be written when its sequence equals the write index
+// and can be read when its sequence equals read index + 1.
+// there is only one reader, and never more loads than slots, so writers never wait
+
+#define LOADER_MASK ( LOADER_MAX_LOADS - 1 )
+static_assert( ( LOADER_MAX_LOADS & LOADER_MASK ) == 0, "Loader capacity must be a power of two!" );
+
+static void LoaderPublish( Core::Loader* loader, Core::LoadRequest* request ) {
+    i32 position = Platform::AtomicIncrement( &loader->writeIndex ) - 1;
+    i32 slot = position & LOADER_MASK;
+    loader->finished[slot] = request;
+    // publish, sequence becomes position + 1
+    Platform::AtomicIncrement( &loader->sequences[slot] );
+}
+
+/// @brief Load mesh in the format its extension names, anything else is loaded as .obj
+static bool LoaderLoadMesh( const char* filePath, const Core::OBJParseOptions* options, Core::MeshUploadData* result ) {
+    usize subStrPos = 0;
+    if( subStringPos( filePath, ".ply", &subStrPos ) ) {
+        return Core::LoadPLYFile( filePath, options, result );
+    }
+    if( subStringPos( filePath, ".stl", &subStrPos ) ) {
+        return Core::LoadSTLFile( filePath, options, result );
+    }
+    if( subStringPos( filePath, ".glb", &subStrPos ) ) {
+        return Core::LoadGLBFile( filePath, options, result );
+    }
+    return Core::LoadOBJFile( filePath, options, result );
+}
+
+static Core::TextureCache* LoaderTextureCache( Core::Loader* loader ) {
+    return loader->textureCacheValid ? &loader->textureCache : nullptr;
+}
+
+static void LoaderJob( void* params ) {
+    Core::LoadRequest* request = (Core::LoadRequest*)params;
+
+    if( request->type == Core::LoadType::MESH ) {
+        request->success = LoaderLoadMesh( request->filePath, request->meshOptions, &request->mesh );
+        // NOTE(alicia): mesh is still usable if its materials fail to load
+        if( request->success && request->mesh.materialNames.materialCount > 0 ) {
+            Core::LoadMaterials(
+                request->filePath,
+                &request->mesh.materialNames,
+                request->loader->textureQuality,
+                LoaderTextureCache( request->loader ),
+                request->meshOptions->jobQueue,
+                &request->materials
+            );
+        }
+    } else if( request->type == Core::LoadType::COMPRESSION_BENCHMARK ) {
+        Platform::File file = {};
+        if( Platform::LoadFile( request->filePath, &file ) ) {
+            request->success = Core::ReadImage( file.size, file.data, &request->image );
+            Platform::FreeFile( &file );
+        }
+        if( request->success ) {
+            Core::BenchmarkBlockCompression( &request->image, request->loader->jobQueue );
+        }
+    } else {
+        Core::ImageContent content = Core::ImageContent::LINEAR;
+        if( request->type == Core::LoadType::ALBEDO_TEXTURE ) {
+            content = Core::ImageContent::SRGB;
+        } else if( request->type == Core::LoadType::NORMAL_TEXTURE ) {
+            content = Core::ImageContent::NORMAL;
+        }
+        Platform::File file = {};
+        if( Platform::LoadFile( request->filePath, &file ) ) {
+            request->success = Core::LoadTextures(
+                1, &file, &content,
+                request->loader->textureQuality,
+                LoaderTextureCache( request->loader ),
+                request->loader->jobQueue,
+                &request->texture
+            ) == 1;
+            Platform::FreeFile( &file );
+        }
+    }
+    if( !request->success ) {
+        LOG_WARN( "Loader > Failed to load \"%s\"!", request->filePath );
+    }
+
+    LoaderPublish( request->loader, request );
+}
+
+void Core::CreateLoader( JobQueue* jobQueue, const OBJParseOptions* meshOptions, Loader* result ) {
+    *result = {};
+    result->jobQueue = jobQueue;
+    if( meshOptions ) {
+        result->meshOptions = *meshOptions;
+    }
+    result->meshOptions.jobQueue = jobQueue;
+    result->textureQuality       = BlockQuality::NORMAL;
+    result->textureCacheValid    = CreateTextureCache( LOADER_TEXTURE_CACHE_SIZE, &result->textureCache );
+    if( !result->textureCacheValid ) {
+        LOG_WARN( "Loader > Failed to open texture cache, textures will be decoded every load!" );
+    }
+    ucycles( LOADER_MAX_LOADS ) {
+        result->sequences[i] = (i32)i;
+    }
+}
+
+void Core::DestroyLoader( Loader* loader ) {
+    WaitForJobs( loader->jobQueue, &loader->counter );
+    while( LoadRequest* request = NextFinishedLoad( loader ) ) {
+        FreeLoadRequest( request );
+    }
+    if( loader->textureCacheValid ) {
+        DestroyTextureCache( &loader->textureCache );
+        loader->textureCacheValid = false;
+    }
+}
+
+bool Core::RequestLoad( Loader* loader, LoadType type, const char* filePath ) {
+    if( loader->loadCount >= LOADER_MAX_LOADS ) {
+        LOG_WARN( "Loader > Too many loads in flight!" );
+        return false;
+    }
+    usize filePathLen = stringLen( filePath ) + 1;
+    if( filePathLen > USER_FILE_PATH_MAX_LEN ) {
+        LOG_WARN( "Loader > File path is too long!" );
+        return false;
+    }
+
+    LoadRequest* request = (LoadRequest*)Platform::Alloc( sizeof(LoadRequest) );
+    if( !request ) {
+        LOG_ERROR( "Loader > Failed to allocate load request!" );
+        return false;
+    }
+    request->type        = type;
+    request->meshOptions = &loader->meshOptions;
+    request->loader      = loader;
+    stringCopy( filePath, USER_FILE_PATH_MAX_LEN, request->filePath );
+
+    loader->loadCount++;
+    PushJob( loader->jobQueue, LoaderJob, request, &loader->counter );
+    return true;
+}
+
+Core::LoadRequest* Core::NextFinishedLoad( Loader* loader ) {
+    i32 position = loader->readIndex;
+    i32 slot = position & LOADER_MASK;
+    if( loader->sequences[slot] != position + 1 ) {
+        return nullptr;
+    }
+    LoadRequest* request = loader->finished[slot];
+    loader->readIndex = position + 1;
+    // release slot for writing, sequence becomes position + capacity
+    Platform::AtomicAdd( &loader->sequences[slot], LOADER_MAX_LOADS - 1 );
+    loader->loadCount--;
+    return request;
+}
+
+void Core::FreeLoadRequest( LoadRequest* request ) {
+    FreeMeshUploadData( &request->mesh );
+    FreeTextureUploadData( &request->texture );
+    FreeImage( &request->image );
+    FreeMaterialSet( &request->materials );
+    Platform::Free( request );
+}
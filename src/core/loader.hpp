@@ -0,0 +1,102 @@
+/**
+ * Description:  Asynchronous asset loading
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "pch.hpp"
+#include "core/image.hpp"
+#include "core/mesh.hpp"
+#include "core/material.hpp"
+#include "core/texture.hpp"
+#include "core/cache.hpp"
+#include "core/obj.hpp"
+#include "core/jobs.hpp"
+
+namespace Core {
+
+// forward declaration
+struct Loader;
+
+/// @brief Maximum number of loads that are queued, running or waiting for upload, must be a power of two
+#define LOADER_MAX_LOADS 16
+/// @brief Time the main thread may spend on uploads every frame, in milliseconds.
+/// At least one finished load is uploaded every frame
+#define LOADER_UPLOAD_BUDGET_MS 4.0
+/// @brief Size the texture cache is kept under, least recently used textures are evicted first
+#define LOADER_TEXTURE_CACHE_SIZE GIGABYTES(1)
+
+enum class LoadType : u32 {
+    MESH,
+    ALBEDO_TEXTURE,
+    SPECULAR_TEXTURE,
+    NORMAL_TEXTURE,
+    /// @brief Image is block compressed to every format and timed, nothing is uploaded
+    COMPRESSION_BENCHMARK,
+};
+
+/// @brief Load that runs on a worker thread.
+/// Everything but the GPU upload is done off the main thread
+struct LoadRequest {
+    LoadType type;
+    bool success;
+    char filePath[USER_FILE_PATH_MAX_LEN];
+    /// @brief Mesh ready for upload, if type is MESH
+    MeshUploadData mesh;
+    /// @brief Decoded materials of mesh, empty if mesh has none or they failed to load
+    MaterialSet materials;
+    /// @brief Texture ready for upload, if type is a texture
+    TextureUploadData texture;
+    /// @brief Decoded image, if type is COMPRESSION_BENCHMARK
+    Image image;
+
+    // NOTE(alicia): loader owned
+    const OBJParseOptions* meshOptions;
+    Loader* loader;
+};
+
+/// @brief Loads in flight and a multi-producer single-consumer queue of finished loads.
+/// Workers publish finished loads, the main thread takes them in order of completion
+struct Loader {
+    JobQueue* jobQueue;
+    OBJParseOptions meshOptions;
+    /// @brief Quality textures are block compressed with, NORMAL by default
+    BlockQuality textureQuality;
+    /// @brief Textures in their upload format, shared by every load
+    TextureCache textureCache;
+    bool textureCacheValid;
+
+    LoadRequest* finished[LOADER_MAX_LOADS];
+    volatile i32 sequences[LOADER_MAX_LOADS];
+    volatile i32 writeIndex;
+    i32 readIndex;
+
+    /// @brief Loads requested but not yet taken by the main thread, only touched by main thread
+    u32 loadCount;
+    JobCounter counter;
+};
+
+/// @brief Initialize loader, loader works without texture cache if it fails to open
+/// @param jobQueue job queue loads run on, should have at least one worker thread
+/// @param meshOptions options every mesh is loaded with, job queue is set to loader's job queue
+/// @param result [out] loader
+void CreateLoader( JobQueue* jobQueue, const OBJParseOptions* meshOptions, Loader* result );
+/// @brief Wait for every load in flight, free loads that were never taken and close texture cache
+void DestroyLoader( Loader* loader );
+/// @brief Start loading file on job queue, must be called from the main thread
+/// @param loader loader
+/// @param type what file is loaded as
+/// @param filePath path to file, copied
+/// @return false if too many loads are in flight or path is too long
+bool RequestLoad( Loader* loader, LoadType type, const char* filePath );
+/// @brief Take next finished load, must be called from the main thread
+/// @return finished load, free with FreeLoadRequest, nullptr if no load is finished
+LoadRequest* NextFinishedLoad( Loader* loader );
+/// @brief Free load and everything it still owns
+void FreeLoadRequest( LoadRequest* request );
+/// @brief Number of loads requested but not yet taken with NextFinishedLoad
+inline u32 PendingLoadCount( const Loader* loader ) {
+    return loader->loadCount;
+}
+
+} // namespace Core
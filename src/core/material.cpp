@@ -0,0 +1,403 @@
+/**
+ * Description:  .mtl material loading
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "core/material.hpp"
+#include "core/jobs.hpp"
+#include "core/mesh.hpp"
+#include "platform/io.hpp"
+#include "util.hpp"
+
+/// @brief Texture file, loaded on its own job
+struct MTLTexture {
+    char path[USER_FILE_PATH_MAX_LEN];
+    Platform::File* file;
+};
+
+/// @brief State shared by every library of a mesh
+struct MTLState {
+    const char* directory;
+    usize directoryLength;
+    /// @brief Material names of mesh, in material index order
+    const char** materialNames;
+    /// @brief Material was defined by an earlier newmtl, first definition wins
+    bool* defined;
+    usize definedCount;
+    Core::MaterialSet* result;
+    /// @brief Unique resolved texture paths, one past capacity is room to resolve the next path in
+    MTLTexture* textures;
+    usize textureCount;
+    usize textureCapacity;
+};
+
+static inline bool MTLIsSpace( char c ) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+static inline const char* MTLSkipSpace( const char* at, const char* end ) {
+    while( at < end && MTLIsSpace( *at ) ) {
+        at++;
+    }
+    return at;
+}
+
+static inline const char* MTLSkipToken( const char* at, const char* end ) {
+    while( at < end && !MTLIsSpace( *at ) ) {
+        at++;
+    }
+    return at;
+}
+
+static inline char MTLLower( char c ) {
+    return c >= 'A' && c <= 'Z' ? (char)( c - 'A' + 'a' ) : c;
+}
+
+/// @brief Match case-insensitive keyword followed by whitespace, advances at past the keyword
+static bool MTLKeyword( const char*& at, const char* lineEnd, const char* keyword ) {
+    usize length = stringLen( keyword );
+    if( (usize)( lineEnd - at ) <= length || !MTLIsSpace( at[length] ) ) {
+        return false;
+    }
+    ucycles( length ) {
+        if( MTLLower( at[i] ) != keyword[i] ) {
+            return false;
+        }
+    }
+    at += length;
+    return true;
+}
+
+/// @brief Rest of the line without surrounding whitespace
+static usize MTLParseName( const char*& at, const char* lineEnd ) {
+    at = MTLSkipSpace( at, lineEnd );
+    while( lineEnd > at && MTLIsSpace( *( lineEnd - 1 ) ) ) {
+        lineEnd--;
+    }
+    return (usize)( lineEnd - at );
+}
+
+/// @brief Token is a number argument of a map option
+static inline bool MTLIsNumber( const char* at, const char* end ) {
+    if( at < end && ( *at == '-' || *at == '+' ) ) {
+        at++;
+    }
+    if( at < end && *at == '.' ) {
+        at++;
+    }
+    return at < end && (u8)( *at - '0' ) < 10;
+}
+
+/// @brief Skip texture map options, at is left at the file name
+static const char* MTLSkipMapOptions( const char* at, const char* lineEnd ) {
+    // on/off switches and channel take a single word, every other option takes up to three numbers
+    const char* WORD_OPTIONS[] = { "-blendu", "-blendv", "-cc", "-clamp", "-imfchan" };
+    for( ;; ) {
+        at = MTLSkipSpace( at, lineEnd );
+        if( at >= lineEnd || *at != '-' ) {
+            return at;
+        }
+        const char* option = at;
+        at = MTLSkipToken( at, lineEnd );
+        usize optionLength = (usize)( at - option );
+
+        bool word = false;
+        ucycles( sizeof(WORD_OPTIONS) / sizeof(WORD_OPTIONS[0]) ) {
+            if( stringCmp( optionLength, option, stringLen( WORD_OPTIONS[i] ), WORD_OPTIONS[i] ) ) {
+                word = true;
+                break;
+            }
+        }
+        if( word ) {
+            at = MTLSkipToken( MTLSkipSpace( at, lineEnd ), lineEnd );
+            continue;
+        }
+        for( ;; ) {
+            const char* argument = MTLSkipSpace( at, lineEnd );
+            if( !MTLIsNumber( argument, lineEnd ) ) {
+                break;
+            }
+            at = MTLSkipToken( argument, lineEnd );
+        }
+    }
+}
+
+/// @brief Join mesh directory and a relative path, absolute paths are kept as they are
+/// @return false if path is too long
+static bool MTLResolvePath( const MTLState* state, usize nameLength, const char* name, char* dst ) {
+    bool absolute =
+        ( nameLength > 0 && ( name[0] == '/' || name[0] == '\\' ) ) ||
+        ( nameLength > 1 && name[1] == ':' );
+    usize prefixLength = absolute ? 0 : state->directoryLength;
+    if( prefixLength + nameLength + 1 > USER_FILE_PATH_MAX_LEN ) {
+        return false;
+    }
+    Platform::MemCopy( prefixLength, state->directory, dst );
+    Platform::MemCopy( nameLength, name, dst + prefixLength );
+    dst[prefixLength + nameLength] = 0;
+    return true;
+}
+
+/// @brief Get image index of path, path is added if it wasn't used before
+/// @return image index, -1 if path is too long or there are too many images
+static i32 MTLImage( MTLState* state, usize nameLength, const char* name ) {
+    MTLTexture* texture = &state->textures[state->textureCount];
+    if( !MTLResolvePath( state, nameLength, name, texture->path ) ) {
+        LOG_WARN( "LoadMaterials > Texture path is too long!" );
+        return -1;
+    }
+    ucycles( state->textureCount ) {
+        if( stringCmp( state->textures[i].path, texture->path ) ) {
+            return (i32)i;
+        }
+    }
+    if( state->textureCount == state->textureCapacity ) {
+        LOG_WARN( "LoadMaterials > Too many textures!" );
+        return -1;
+    }
+    return (i32)state->textureCount++;
+}
+
+/// @brief Parse library, maps of materials mesh uses are added to state
+static void MTLParseLibrary( MTLState* state, const Platform::File* file ) {
+    Core::MaterialSet* result = state->result;
+    const char* at  = (const char*)file->data;
+    const char* end = at + file->size;
+    i32 material = -1;
+    while( at < end ) {
+        const char* lineEnd = at;
+        while( lineEnd < end && *lineEnd != '\n' ) {
+            lineEnd++;
+        }
+        at = MTLSkipSpace( at, lineEnd );
+
+        Core::MaterialMap map = Core::MaterialMap::COUNT;
+        if( MTLKeyword( at, lineEnd, "newmtl" ) ) {
+            usize nameLength = MTLParseName( at, lineEnd );
+            material = -1;
+            ucycles( result->materialCount ) {
+                const char* name = state->materialNames[i];
+                if( stringCmp( nameLength, at, stringLen( name ), name ) ) {
+                    material = state->defined[i] ? -1 : (i32)i;
+                    break;
+                }
+            }
+            if( material >= 0 ) {
+                state->defined[material] = true;
+                state->definedCount++;
+            }
+        } else if( MTLKeyword( at, lineEnd, "map_kd" ) ) {
+            map = Core::MaterialMap::ALBEDO;
+        } else if( MTLKeyword( at, lineEnd, "map_ks" ) ) {
+            map = Core::MaterialMap::SPECULAR;
+        } else if(
+            MTLKeyword( at, lineEnd, "map_bump" ) ||
+            MTLKeyword( at, lineEnd, "bump" ) ||
+            MTLKeyword( at, lineEnd, "norm" )
+        ) {
+            map = Core::MaterialMap::NORMAL;
+        }
+
+        if( map != Core::MaterialMap::COUNT && material >= 0 ) {
+            at = MTLSkipMapOptions( at, lineEnd );
+            usize nameLength = MTLParseName( at, lineEnd );
+            if( nameLength > 0 ) {
+                result->materials[material].images[(usize)map] = MTLImage( state, nameLength, at );
+            }
+        }
+        at = lineEnd + 1;
+    }
+}
+
+/// @brief Load and parse library.
+/// mtllib may list several files, the whole statement is tried first so file names can have spaces
+static void MTLLoadLibrary( MTLState* state, const char* library ) {
+    char path[USER_FILE_PATH_MAX_LEN];
+    Platform::File file = {};
+    usize libraryLength = stringLen( library );
+    if( MTLResolvePath( state, libraryLength, library, path ) && Platform::LoadFile( path, &file ) ) {
+        MTLParseLibrary( state, &file );
+        Platform::FreeFile( &file );
+        return;
+    }
+
+    const char* at  = library;
+    const char* end = library + libraryLength;
+    bool split = false;
+    while( ( at = MTLSkipSpace( at, end ) ) < end ) {
+        const char* token = at;
+        at = MTLSkipToken( at, end );
+        if( token == library && at == end ) {
+            break;
+        }
+        split = true;
+        file = {};
+        if( MTLResolvePath( state, (usize)( at - token ), token, path ) && Platform::LoadFile( path, &file ) ) {
+            MTLParseLibrary( state, &file );
+            Platform::FreeFile( &file );
+        } else {
+            LOG_WARN( "LoadMaterials > Failed to load material library \"%s\"!", path );
+        }
+    }
+    if( !split ) {
+        LOG_WARN( "LoadMaterials > Failed to load material library \"%s\"!", path );
+    }
+}
+
+static void MTLLoadTextureJob( void* params ) {
+    MTLTexture* texture = (MTLTexture*)params;
+    if( !Platform::LoadFile( texture->path, texture->file ) ) {
+        LOG_WARN( "LoadMaterials > Failed to load texture \"%s\"!", texture->path );
+        *texture->file = {};
+    }
+}
+
+bool Core::LoadMaterials(
+    const char* meshPath,
+    const MeshMaterialNames* names,
+    BlockQuality quality,
+    TextureCache* cache,
+    JobQueue* queue,
+    MaterialSet* result
+) {
+    u64 startTime = Platform::GetPerformanceCounter();
+
+    *result = {};
+    if( names->libraryCount == 0 || names->materialCount == 0 ) {
+        return false;
+    }
+
+    MTLState state = {};
+    state.directory = meshPath;
+    for( usize i = 0; meshPath[i]; ++i ) {
+        if( meshPath[i] == '/' || meshPath[i] == '\\' ) {
+            state.directoryLength = i + 1;
+        }
+    }
+    state.result = result;
+
+    state.textureCapacity = (usize)names->materialCount * MATERIAL_MAP_COUNT;
+    result->materialCount = names->materialCount;
+    result->materials     = (Material*)Platform::Alloc( result->materialCount * sizeof(Material) );
+    state.materialNames   = (const char**)Platform::Alloc( result->materialCount * sizeof(const char*) );
+    state.defined         = (bool*)Platform::Alloc( result->materialCount * sizeof(bool) );
+    state.textures        = (MTLTexture*)Platform::Alloc( ( state.textureCapacity + 1 ) * sizeof(MTLTexture) );
+    if( !result->materials || !state.materialNames || !state.defined || !state.textures ) {
+        LOG_ERROR( "LoadMaterials > Failed to allocate materials!" );
+    } else {
+        const char* name = GetMeshMaterialName( names, names->libraryCount );
+        ucycles( result->materialCount ) {
+            state.materialNames[i] = name;
+            name += stringLen( name ) + 1;
+            ucyclesi( MATERIAL_MAP_COUNT, map ) {
+                result->materials[i].images[map] = -1;
+            }
+        }
+        ucycles( names->libraryCount ) {
+            MTLLoadLibrary( &state, GetMeshMaterialName( names, i ) );
+        }
+    }
+
+    // NOTE(alicia): an image is filtered as color if any albedo map uses it
+    ImageContent* contents = nullptr;
+    if( result->materials && state.textureCount > 0 ) {
+        contents = (ImageContent*)Platform::Alloc( state.textureCount * sizeof(ImageContent) );
+        if( contents ) {
+            ucycles( state.textureCount ) {
+                contents[i] = ImageContent::LINEAR;
+            }
+            ucycles( result->materialCount ) {
+                i32 albedo = result->materials[i].images[(usize)MaterialMap::ALBEDO];
+                i32 normal = result->materials[i].images[(usize)MaterialMap::NORMAL];
+                if( albedo >= 0 ) {
+                    contents[albedo] = ImageContent::SRGB;
+                }
+                if( normal >= 0 && contents[normal] == ImageContent::LINEAR ) {
+                    contents[normal] = ImageContent::NORMAL;
+                }
+            }
+        }
+    }
+
+    // NOTE(alicia): every file is read on its own job, then textures that aren't cached are decoded in parallel
+    usize loadedImageCount = 0;
+    Platform::File* files = nullptr;
+    if( contents ) {
+        files            = (Platform::File*)Platform::Alloc( state.textureCount * sizeof(Platform::File) );
+        result->textures = (TextureUploadData*)Platform::Alloc( state.textureCount * sizeof(TextureUploadData) );
+        if( files && result->textures ) {
+            result->textureCount = state.textureCount;
+            JobCounter counter = {};
+            ucycles( state.textureCount ) {
+                state.textures[i].file = &files[i];
+                PushJob( queue, MTLLoadTextureJob, &state.textures[i], &counter );
+            }
+            WaitForJobs( queue, &counter );
+            loadedImageCount = LoadTextures(
+                state.textureCount, files, contents, quality, cache, queue, result->textures );
+            ucycles( state.textureCount ) {
+                if( files[i].data ) {
+                    Platform::FreeFile( &files[i] );
+                }
+            }
+        }
+        if( files ) {
+            Platform::Free( files );
+        }
+        Platform::Free( contents );
+    }
+
+    // maps of textures that failed to load are dropped
+    if( result->materials ) {
+        ucycles( result->materialCount ) {
+            ucyclesi( MATERIAL_MAP_COUNT, map ) {
+                i32 texture = result->materials[i].images[map];
+                if( texture >= 0 &&
+                    ( (usize)texture >= result->textureCount || !result->textures[texture].levelCount )
+                ) {
+                    result->materials[i].images[map] = -1;
+                }
+            }
+        }
+    }
+
+    usize definedCount = state.definedCount;
+    if( state.materialNames ) {
+        Platform::Free( state.materialNames );
+    }
+    if( state.defined ) {
+        Platform::Free( state.defined );
+    }
+    if( state.textures ) {
+        Platform::Free( state.textures );
+    }
+    if( definedCount == 0 ) {
+        LOG_WARN( "LoadMaterials > None of %llu materials were found!", (usize)names->materialCount );
+        FreeMaterialSet( result );
+        return false;
+    }
+
+    f64 elapsedSeconds = (f64)( Platform::GetPerformanceCounter() - startTime ) /
+        (f64)Platform::GetPerformanceFrequency();
+    LOG_INFO( "LoadMaterials > Loaded %llu of %llu materials, %llu of %llu textures in %.3fs",
+        definedCount,
+        result->materialCount,
+        loadedImageCount,
+        result->textureCount,
+        elapsedSeconds
+    );
+    return true;
+}
+
+void Core::FreeMaterialSet( MaterialSet* set ) {
+    if( set->materials ) {
+        Platform::Free( set->materials );
+    }
+    if( set->textures ) {
+        ucycles( set->textureCount ) {
+            FreeTextureUploadData( &set->textures[i] );
+        }
+        Platform::Free( set->textures );
+    }
+    *set = {};
+}
@@ -0,0 +1,68 @@
+/**
+ * Description:  .mtl material loading
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "pch.hpp"
+#include "core/texture.hpp"
+
+namespace Core {
+
+// forward declaration
+struct JobQueue;
+struct TextureCache;
+struct MeshMaterialNames;
+
+/// @brief Texture maps a material can have
+enum class MaterialMap : u32 {
+    ALBEDO,
+    SPECULAR,
+    NORMAL,
+
+    COUNT
+};
+#define MATERIAL_MAP_COUNT ((usize)Core::MaterialMap::COUNT)
+
+/// @brief Texture maps of a single material
+struct Material {
+    /// @brief Index into MaterialSet textures per MaterialMap, -1 if material doesn't have map
+    i32 images[MATERIAL_MAP_COUNT];
+};
+
+/// @brief Materials of a mesh and every texture they use, loaded once each
+struct MaterialSet {
+    /// @brief Materials in order of sub-mesh material index
+    usize materialCount;
+    Material* materials;
+    /// @brief Textures ready for upload, empty if texture failed to load
+    usize textureCount;
+    TextureUploadData* textures;
+};
+
+/// @brief Load materials a mesh refers to from its .mtl libraries, safe to call from any thread.
+/// Libraries and texture maps are resolved relative to the mesh directory.
+/// map_Kd is the albedo map, map_Ks the specular map and map_Bump, bump or norm the normal map.
+/// Every image is loaded once no matter how many maps refer to it,
+/// images are loaded in parallel on job queue with LoadTextures.
+/// Every image gets a Kaiser filtered mip chain, in linear space if an albedo map uses it
+/// and renormalized if only a normal map does, then block compressed to the format ChooseBlockFormat picks
+/// @param meshPath path to mesh file
+/// @param names material libraries and names of mesh
+/// @param quality quality images are block compressed with
+/// @param cache texture cache, can be nullptr
+/// @param queue job queue images are decoded on, can be nullptr
+/// @param result [out] materials, free with FreeMaterialSet
+/// @return false if mesh has no materials or none of them were found
+bool LoadMaterials(
+    const char* meshPath,
+    const MeshMaterialNames* names,
+    BlockQuality quality,
+    TextureCache* cache,
+    JobQueue* queue,
+    MaterialSet* result
+);
+/// @brief Free materials and their textures
+void FreeMaterialSet( MaterialSet* set );
+
+} // namespace Core
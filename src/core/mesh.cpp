@@ -0,0 +1,793 @@
+/**
+ * Description:  Indexed meshes
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "core/mesh.hpp"
+#include "core/meshlet.hpp"
+#include "core/obj.hpp"
+#include "core/renderex.hpp"
+#include "platform/io.hpp"
+#include "platform/renderer.hpp"
+#include "util.hpp"
+
+#define MESH_WELD_EMPTY_SLOT U32::MAX
+
+static inline u32 MeshHashCorner( const Core::OBJCorner& corner ) {
+    u32 hash = (u32)corner.position * 0x9E3779B1u;
+    hash ^= (u32)corner.uv     * 0x85EBCA77u;
+    hash ^= (u32)corner.normal * 0xC2B2AE3Du;
+    hash ^= hash >> 15;
+    hash *= 0x2C1B3C6Du;
+    hash ^= hash >> 13;
+    return hash;
+}
+
+static inline bool MeshCornerCmp( const Core::OBJCorner& a, const Core::OBJCorner& b ) {
+    return a.position == b.position && a.uv == b.uv && a.normal == b.normal;
+}
+
+/// @brief Insert key into open addressing table
+/// @return vertex index stored in table for key
+static inline u32 MeshWeldInsert(
+    u32* table, usize tableMask,
+    const Core::OBJCorner* keys, const Core::OBJCorner& key, u32 newVertexIndex
+) {
+    usize slot = MeshHashCorner( key ) & tableMask;
+    for( ;; ) {
+        u32 vertexIndex = table[slot];
+        if( vertexIndex == MESH_WELD_EMPTY_SLOT ) {
+            table[slot] = newVertexIndex;
+            return newVertexIndex;
+        }
+        if( MeshCornerCmp( keys[vertexIndex], key ) ) {
+            return vertexIndex;
+        }
+        slot = ( slot + 1 ) & tableMask;
+    }
+}
+
+/// @brief Make sure weld table can hold capacity entries and mark them empty.
+/// Table is only reallocated when it grows
+/// @return false if allocation failed
+static bool MeshResetWeldTable( u32** table, usize* allocated, usize capacity ) {
+    if( capacity > *allocated ) {
+        if( *table ) {
+            Platform::Free( *table );
+        }
+        *table = (u32*)Platform::Alloc( capacity * sizeof(u32) );
+        *allocated = *table ? capacity : 0;
+        if( !*table ) {
+            return false;
+        }
+    }
+    ucycles( capacity ) {
+        (*table)[i] = MESH_WELD_EMPTY_SLOT;
+    }
+    return true;
+}
+
+/// @brief Weld corners of a single group
+/// @param cornerCount number of corners in group
+/// @param corners corners of group
+/// @param positionCount number of positions in file
+/// @param keys [out] unique corners of group
+/// @param indices [out] indices relative to first unique corner
+/// @param table weld table, reused between groups
+/// @param tableAllocated size of weld table
+/// @return number of unique corners or U32::MAX if allocation failed
+static u32 MeshWeldGroup(
+    usize cornerCount, const Core::OBJCorner* corners, usize positionCount,
+    Core::OBJCorner* keys, u32* indices,
+    u32** table, usize* tableAllocated
+) {
+    // NOTE(alicia): table starts out sized for roughly one vertex per position
+    // and doubles whenever it becomes half full
+    usize expectedVertexCount = cornerCount < positionCount ? cornerCount : positionCount;
+    usize tableCapacity = 64;
+    while( tableCapacity < expectedVertexCount * 2 ) {
+        tableCapacity *= 2;
+    }
+    if( !MeshResetWeldTable( table, tableAllocated, tableCapacity ) ) {
+        return U32::MAX;
+    }
+
+    usize vertexCount = 0;
+    ucycles( cornerCount ) {
+        if( ( vertexCount + 1 ) * 2 > tableCapacity ) {
+            tableCapacity *= 2;
+            if( !MeshResetWeldTable( table, tableAllocated, tableCapacity ) ) {
+                return U32::MAX;
+            }
+            ucyclesi( vertexCount, vertexIndex ) {
+                MeshWeldInsert( *table, tableCapacity - 1, keys, keys[vertexIndex], (u32)vertexIndex );
+            }
+        }
+
+        const Core::OBJCorner& corner = corners[i];
+        keys[vertexCount] = corner;
+        u32 vertexIndex = MeshWeldInsert( *table, tableCapacity - 1, keys, corner, (u32)vertexCount );
+        if( vertexIndex == vertexCount ) {
+            vertexCount++;
+        }
+        indices[i] = vertexIndex;
+    }
+    return (u32)vertexCount;
+}
+
+bool Core::BuildMesh( const Core::OBJData* data, JobQueue* queue, Mesh* result ) {
+    if( data->cornerCount > (usize)U32::MAX ) {
+        LOG_ERROR( "BuildMesh > Mesh has too many corners! %llu", data->cornerCount );
+        return false;
+    }
+
+    *result = {};
+    result->indexCount   = data->cornerCount;
+    result->indices      = (u32*)Platform::Alloc( data->cornerCount * sizeof(u32) );
+    result->subMeshCount = data->groupCount;
+    result->subMeshes    = (SubMesh*)Platform::Alloc( data->groupCount * sizeof(SubMesh) );
+    // unique corners of every group in order of first appearance
+    Core::OBJCorner* keys = (Core::OBJCorner*)Platform::Alloc( data->cornerCount * sizeof(Core::OBJCorner) );
+
+    u32* table = nullptr;
+    usize tableAllocated = 0;
+    bool success = result->indices && result->subMeshes && keys;
+
+    usize vertexCount = 0;
+    for( usize i = 0; success && i < data->groupCount; ++i ) {
+        const Core::OBJGroup& group = data->groups[i];
+        u32 groupVertexCount = MeshWeldGroup(
+            group.cornerCount, data->corners + group.firstCorner, data->positionCount,
+            keys + vertexCount, result->indices + group.firstCorner,
+            &table, &tableAllocated
+        );
+        if( groupVertexCount == U32::MAX ) {
+            success = false;
+            break;
+        }
+
+        SubMesh* subMesh = &result->subMeshes[i];
+        subMesh->firstIndex  = (u32)group.firstCorner;
+        subMesh->indexCount  = (u32)group.cornerCount;
+        subMesh->baseVertex  = (u32)vertexCount;
+        subMesh->vertexCount = groupVertexCount;
+        subMesh->material    = group.material;
+        vertexCount += groupVertexCount;
+    }
+    if( table ) {
+        Platform::Free( table );
+    }
+    if( !success ) {
+        LOG_ERROR( "BuildMesh > Failed to allocate weld buffers!" );
+        if( keys ) {
+            Platform::Free( keys );
+        }
+        FreeMesh( result );
+        return false;
+    }
+
+    result->vertexCount = vertexCount;
+    result->vertices    = (Core::vertex*)Platform::Alloc( vertexCount * sizeof(Core::vertex) );
+    ucycles( vertexCount ) {
+        const Core::OBJCorner& key = keys[i];
+        Core::vertex* vertex = &result->vertices[i];
+
+        vertex->position = data->positions[key.position];
+
+        if( key.uv >= 0 ) {
+            vertex->uv = data->uvs[key.uv];
+        } else {
+            vertex->uv.x = vertex->position.x;
+            vertex->uv.y = vertex->position.y;
+            smath::normalize( vertex->uv );
+        }
+
+        if( key.normal >= 0 ) {
+            vertex->normal = data->normals[key.normal];
+        } else {
+            vertex->normal = smath::normalize(vertex->position);
+        }
+    }
+    Platform::Free( keys );
+
+    CalculateMeshBounds( result );
+    ucycles( result->subMeshCount ) {
+        const SubMesh& subMesh = result->subMeshes[i];
+        Core::calculateTangentBasis(
+            subMesh.indexCount, result->indices + subMesh.firstIndex,
+            subMesh.vertexCount, result->vertices + subMesh.baseVertex,
+            queue
+        );
+    }
+
+    LOG_INFO( "BuildMesh > Welded %llu corners into %llu vertices, %llu sub-meshes",
+        result->indexCount, result->vertexCount, result->subMeshCount
+    );
+
+    return true;
+}
+
+void Core::FreeMesh( Mesh* mesh ) {
+    if( mesh->vertices ) {
+        Platform::Free( mesh->vertices );
+    }
+    if( mesh->indices ) {
+        Platform::Free( mesh->indices );
+    }
+    if( mesh->subMeshes ) {
+        Platform::Free( mesh->subMeshes );
+    }
+    if( mesh->meshlets ) {
+        Platform::Free( mesh->meshlets );
+    }
+    *mesh = {};
+}
+
+void Core::CalculateMeshBounds( Mesh* mesh ) {
+    if( mesh->vertexCount == 0 ) {
+        mesh->boundsMin = smath::vec3();
+        mesh->boundsMax = smath::vec3();
+        return;
+    }
+    smath::vec3 boundsMin = mesh->vertices[0].position;
+    smath::vec3 boundsMax = mesh->vertices[0].position;
+    ucycles( mesh->vertexCount ) {
+        const smath::vec3& position = mesh->vertices[i].position;
+        ucyclesi( 3, axis ) {
+            if( position[axis] < boundsMin[axis] ) {
+                boundsMin[axis] = position[axis];
+            }
+            if( position[axis] > boundsMax[axis] ) {
+                boundsMax[axis] = position[axis];
+            }
+        }
+    }
+    mesh->boundsMin = boundsMin;
+    mesh->boundsMax = boundsMax;
+}
+
+void* Core::CreateMeshVertexData( const Mesh* mesh, bool packed, Platform::VertexBufferLayout* layout, usize* size ) {
+    if( !packed ) {
+        *layout = Core::vertexLayout();
+        *size   = mesh->vertexCount * sizeof(Core::vertex);
+        return mesh->vertices;
+    }
+    *layout = Core::packedVertexLayout();
+    *size   = mesh->vertexCount * sizeof(Core::packedVertex);
+    Core::packedVertex* vertices = (Core::packedVertex*)Platform::Alloc( *size );
+    Core::packVertices(
+        mesh->vertexCount, mesh->vertices,
+        mesh->boundsMin, mesh->boundsMax,
+        vertices
+    );
+    return vertices;
+}
+
+void Core::FreeMeshVertexData( const Mesh* mesh, void* vertexData ) {
+    if( vertexData != mesh->vertices ) {
+        Platform::Free( vertexData );
+    }
+}
+
+void* Core::CreateMeshIndexData( const Mesh* mesh, Platform::DataType* dataType ) {
+    ucycles( mesh->subMeshCount ) {
+        if( mesh->subMeshes[i].vertexCount > (u32)U16::MAX + 1 ) {
+            *dataType = Platform::DataType::UNSIGNED_INT;
+            return mesh->indices;
+        }
+    }
+    *dataType = Platform::DataType::UNSIGNED_SHORT;
+    u16* indices16 = (u16*)Platform::Alloc( mesh->indexCount * sizeof(u16) );
+    ucycles( mesh->indexCount ) {
+        indices16[i] = (u16)mesh->indices[i];
+    }
+    return indices16;
+}
+
+void Core::FreeMeshIndexData( const Mesh* mesh, void* indexData ) {
+    if( indexData != mesh->indices ) {
+        Platform::Free( indexData );
+    }
+}
+
+bool Core::CreateMeshUploadData( Mesh* mesh, bool packed, MeshUploadData* result ) {
+    *result = {};
+    result->mesh = *mesh;
+    *mesh = {};
+    mesh = &result->mesh;
+
+    result->vertexData = CreateMeshVertexData( mesh, packed, &result->layout, &result->vertexDataSize );
+    result->indexCount = mesh->indexCount;
+    result->indexData  = CreateMeshIndexData( mesh, &result->indexDataType );
+
+    MeshInfo* info = &result->info;
+    info->boundsMin = mesh->boundsMin;
+    info->boundsMax = mesh->boundsMax;
+    info->packed    = packed;
+    info->subMeshes = (SubMesh*)Platform::Alloc( mesh->subMeshCount * sizeof(SubMesh) );
+    if( info->subMeshes ) {
+        info->subMeshCount = mesh->subMeshCount;
+        Platform::MemCopy( mesh->subMeshCount * sizeof(SubMesh), mesh->subMeshes, info->subMeshes );
+    }
+    info->meshlets = (Meshlet*)Platform::Alloc( mesh->meshletCount * sizeof(Meshlet) );
+    if( info->meshlets ) {
+        info->meshletCount = mesh->meshletCount;
+        Platform::MemCopy( mesh->meshletCount * sizeof(Meshlet), mesh->meshlets, info->meshlets );
+    }
+
+    if(
+        ( !result->vertexData && mesh->vertexCount ) ||
+        ( !result->indexData && mesh->indexCount ) ||
+        ( !info->subMeshes && mesh->subMeshCount ) ||
+        ( !info->meshlets && mesh->meshletCount ) ||
+        !CreateMeshDrawList( info )
+    ) {
+        LOG_ERROR( "CreateMeshUploadData > Failed to allocate upload data!" );
+        FreeMeshUploadData( result );
+        return false;
+    }
+    return true;
+}
+
+void Core::UploadMeshData(
+    MeshUploadData* data,
+    Platform::VertexArray* result, MeshInfo* info,
+    Platform::RendererAPI* api
+) {
+    *result = api->CreateVertexArray();
+    api->UseVertexArray( result );
+
+    // NOTE(alicia): vertex buffer takes ownership of layout
+    auto vbuffer = api->CreateVertexBuffer(
+        data->vertexDataSize,
+        data->vertexData,
+        data->layout
+    );
+    data->layout = {};
+    api->VertexArrayBindVertexBuffer( result, vbuffer );
+
+    auto ibuffer = api->CreateIndexBuffer(
+        data->indexCount,
+        data->indexData,
+        data->indexDataType
+    );
+    api->VertexArrayBindIndexBuffer( result, ibuffer );
+
+    *info = data->info;
+    data->info = {};
+}
+
+void Core::FreeMeshUploadData( MeshUploadData* data ) {
+    if( data->layout.elements ) {
+        Platform::FreeVertexBufferLayout( &data->layout );
+    }
+    if( data->cacheFile.data ) {
+        Platform::UnmapFile( &data->cacheFile );
+    } else {
+        if( data->vertexData ) {
+            FreeMeshVertexData( &data->mesh, data->vertexData );
+        }
+        if( data->indexData ) {
+            FreeMeshIndexData( &data->mesh, data->indexData );
+        }
+        FreeMesh( &data->mesh );
+    }
+    FreeMeshInfo( &data->info );
+    FreeMeshMaterialNames( &data->materialNames );
+    *data = {};
+}
+
+const char* Core::GetMeshMaterialName( const MeshMaterialNames* names, usize index ) {
+    if( index >= (usize)names->libraryCount + names->materialCount ) {
+        return nullptr;
+    }
+    const char* at = names->text;
+    ucycles( index ) {
+        at += stringLen( at ) + 1;
+    }
+    return at;
+}
+
+void Core::FreeMeshMaterialNames( MeshMaterialNames* names ) {
+    if( names->text ) {
+        Platform::Free( names->text );
+    }
+    *names = {};
+}
+
+bool Core::CreateMeshDrawList( MeshInfo* info ) {
+    // NOTE(alicia): worst case every meshlet and every sub-mesh is its own range
+    usize capacity = info->meshletCount + info->subMeshCount;
+    u32* ranges = (u32*)Platform::Alloc( capacity * 3 * sizeof(u32) );
+    if( !ranges ) {
+        info->drawList = {};
+        return false;
+    }
+    info->drawList.capacity     = capacity;
+    info->drawList.count        = 0;
+    info->drawList.firstIndices = ranges;
+    info->drawList.indexCounts  = ranges + capacity;
+    info->drawList.baseVertices = ranges + capacity * 2;
+    return true;
+}
+
+void Core::FreeMeshInfo( MeshInfo* info ) {
+    if( info->subMeshes ) {
+        Platform::Free( info->subMeshes );
+    }
+    if( info->meshlets ) {
+        Platform::Free( info->meshlets );
+    }
+    if( info->drawList.firstIndices ) {
+        Platform::Free( info->drawList.firstIndices );
+    }
+    *info = {};
+}
+
+void Core::CreateMeshView(
+    const MeshInfo* info,
+    const smath::mat4& transform,
+    const Core::camera* camera,
+    f32 viewportHeight,
+    MeshView* result
+) {
+    // NOTE(alicia): frustum planes are sums and differences of
+    // the rows of model-view-projection matrix, so they come out in mesh space
+    smath::mat4 clip = camera->projectionMat * camera->viewMat * transform;
+    ucycles( 6 ) {
+        usize row  = i / 2;
+        f32   sign = i % 2 == 0 ? 1.0f : -1.0f;
+        smath::vec4 plane;
+        plane.x = clip[ 3] + sign * clip[ 0 + row];
+        plane.y = clip[ 7] + sign * clip[ 4 + row];
+        plane.z = clip[11] + sign * clip[ 8 + row];
+        plane.w = clip[15] + sign * clip[12 + row];
+        f32 length = smath::mag( smath::vec3( plane.x, plane.y, plane.z ) );
+        result->frustumPlanes[i] = length > 0.0f ? plane / length : plane;
+    }
+
+    smath::mat4 inverseTransform = smath::mat4::identity();
+    smath::inverse( transform, inverseTransform );
+    result->cameraPosition = inverseTransform * camera->position;
+
+    // NOTE(alicia): conservative, measured at the point of mesh bounds closest to camera
+    smath::vec3 center = ( info->boundsMin + info->boundsMax ) * 0.5f;
+    f32 radius   = smath::mag( info->boundsMax - info->boundsMin ) * 0.5f;
+    f32 distance = smath::mag( result->cameraPosition - center ) - radius;
+    result->distance = distance > 0.0f ? distance : 0.0f;
+    if( distance <= camera->clippingPlanes.x ) {
+        result->pixelsPerUnit = F32::MAX;
+        return;
+    }
+    f32 viewHeight = 2.0f * distance * smath::tan( camera->fovRad * 0.5f );
+    result->pixelsPerUnit = viewportHeight / viewHeight;
+}
+
+u32 Core::SelectSubMeshLOD( const SubMesh* subMesh, f32 pixelsPerUnit, u32* firstIndex, u32* indexCount ) {
+    for( u32 level = subMesh->lodCount; level > 0; --level ) {
+        const SubMeshLOD& lod = subMesh->lods[level - 1];
+        if( lod.error * pixelsPerUnit <= MESH_LOD_PIXEL_ERROR ) {
+            *firstIndex = lod.firstIndex;
+            *indexCount = lod.indexCount;
+            return level;
+        }
+    }
+    *firstIndex = subMesh->firstIndex;
+    *indexCount = subMesh->indexCount;
+    return 0;
+}
+
+/// @brief Draw sub-meshes with given material, or every sub-mesh if allMaterials is set
+static void MeshDrawSubMeshes(
+    Platform::VertexArray* vertexArray,
+    Core::MeshInfo* info,
+    const Core::MeshView* view,
+    i32 material, bool allMaterials,
+    Platform::RendererAPI* api
+) {
+    if( info->subMeshCount == 0 ) {
+        if( allMaterials || material < 0 ) {
+            api->DrawVertexArray( vertexArray );
+        }
+        return;
+    }
+    Core::MeshDrawList* drawList = &info->drawList;
+    drawList->count = 0;
+    ucycles( info->subMeshCount ) {
+        const Core::SubMesh& subMesh = info->subMeshes[i];
+        if( !allMaterials && subMesh.material != material ) {
+            continue;
+        }
+        u32 firstIndex = 0, indexCount = 0;
+        u32 level = Core::SelectSubMeshLOD( &subMesh, view->pixelsPerUnit, &firstIndex, &indexCount );
+        if( !drawList->capacity ) {
+            api->DrawVertexArrayRange( vertexArray, firstIndex, indexCount, subMesh.baseVertex );
+            continue;
+        }
+        if( level == 0 && subMesh.meshletCount > 0 ) {
+            Core::CullMeshlets( &subMesh, info->meshlets, view, drawList );
+            continue;
+        }
+        drawList->firstIndices[drawList->count] = firstIndex;
+        drawList->indexCounts[drawList->count]  = indexCount;
+        drawList->baseVertices[drawList->count] = subMesh.baseVertex;
+        drawList->count++;
+    }
+    if( drawList->count ) {
+        api->DrawVertexArrayRanges(
+            vertexArray, drawList->count,
+            drawList->firstIndices, drawList->indexCounts, drawList->baseVertices
+        );
+    }
+}
+
+void Core::DrawSubMeshes(
+    Platform::VertexArray* vertexArray,
+    MeshInfo* info,
+    const MeshView* view,
+    Platform::RendererAPI* api
+) {
+    MeshDrawSubMeshes( vertexArray, info, view, -1, true, api );
+}
+
+void Core::DrawMaterialSubMeshes(
+    Platform::VertexArray* vertexArray,
+    MeshInfo* info,
+    const MeshView* view,
+    i32 material,
+    Platform::RendererAPI* api
+) {
+    MeshDrawSubMeshes( vertexArray, info, view, material, false, api );
+}
+
+void Core::MeasureVertexCache(
+    usize indexCount, const u32* indices,
+    usize vertexCount, usize cacheSize,
+    f32* acmr, f32* atvr
+) {
+    // NOTE(alicia): FIFO cache simulated with timestamps,
+    // a vertex is in cache if fewer than cacheSize vertices were transformed since it was
+    usize* timestamps = (usize*)Platform::Alloc( vertexCount * sizeof(usize) );
+    usize time   = cacheSize + 1;
+    usize misses = 0;
+    ucycles( indexCount ) {
+        u32 vertexIndex = indices[i];
+        if( time - timestamps[vertexIndex] > cacheSize ) {
+            timestamps[vertexIndex] = time++;
+            misses++;
+        }
+    }
+    Platform::Free( timestamps );
+
+    usize triangleCount = indexCount / 3;
+    *acmr = triangleCount ? (f32)misses / (f32)triangleCount : 0.0f;
+    *atvr = vertexCount ? (f32)misses / (f32)vertexCount : 0.0f;
+}
+
+/// @brief Pick next fanning vertex
+/// @return next vertex or -1 if every triangle is emitted
+static i64 MeshTipsifyNextVertex(
+    usize cacheSize,
+    usize candidateCount, const u32* candidates,
+    const u32* liveTriangles, const usize* timestamps, usize time,
+    u32* deadEnd, usize* deadEndCount,
+    usize vertexCount, usize* cursor
+) {
+    // best candidate is the one that stays in cache longest after its fan is emitted
+    i64 bestVertex   = -1;
+    i64 bestPriority = -1;
+    ucycles( candidateCount ) {
+        u32 candidate = candidates[i];
+        if( liveTriangles[candidate] == 0 ) {
+            continue;
+        }
+        i64 priority = 0;
+        if( time - timestamps[candidate] + 2 * liveTriangles[candidate] <= cacheSize ) {
+            priority = (i64)( time - timestamps[candidate] );
+        }
+        if( priority > bestPriority ) {
+            bestPriority = priority;
+            bestVertex   = candidate;
+        }
+    }
+    if( bestVertex >= 0 ) {
+        return bestVertex;
+    }
+
+    // dead end, try recently used vertices first
+    while( *deadEndCount > 0 ) {
+        u32 vertex = deadEnd[--(*deadEndCount)];
+        if( liveTriangles[vertex] > 0 ) {
+            return vertex;
+        }
+    }
+    // then continue in input order
+    while( *cursor < vertexCount ) {
+        if( liveTriangles[*cursor] > 0 ) {
+            return (i64)(*cursor);
+        }
+        (*cursor)++;
+    }
+    return -1;
+}
+
+/// @brief Reorder triangles of a single sub-mesh
+/// @param indexCount number of indices
+/// @param indices indices relative to first vertex of sub-mesh
+/// @param vertexCount number of vertices in sub-mesh
+static void MeshTipsify( usize indexCount, u32* indices, usize vertexCount ) {
+    usize triangleCount = indexCount / 3;
+    if( triangleCount == 0 ) {
+        return;
+    }
+
+    // vertex -> triangle adjacency
+    u32* liveTriangles     = (u32*)Platform::Alloc( vertexCount * sizeof(u32) );
+    u32* adjacencyOffsets  = (u32*)Platform::Alloc( ( vertexCount + 1 ) * sizeof(u32) );
+    u32* adjacency         = (u32*)Platform::Alloc( triangleCount * 3 * sizeof(u32) );
+    ucycles( triangleCount * 3 ) {
+        liveTriangles[indices[i]]++;
+    }
+    u32 maxValence = 0;
+    ucycles( vertexCount ) {
+        adjacencyOffsets[i + 1] = adjacencyOffsets[i] + liveTriangles[i];
+        if( liveTriangles[i] > maxValence ) {
+            maxValence = liveTriangles[i];
+        }
+    }
+    {
+        u32* fill = (u32*)Platform::Alloc( vertexCount * sizeof(u32) );
+        ucycles( triangleCount * 3 ) {
+            u32 vertex = indices[i];
+            adjacency[adjacencyOffsets[vertex] + fill[vertex]++] = (u32)( i / 3 );
+        }
+        Platform::Free( fill );
+    }
+
+    usize* timestamps   = (usize*)Platform::Alloc( vertexCount * sizeof(usize) );
+    bool*  emitted      = (bool*)Platform::Alloc( triangleCount * sizeof(bool) );
+    u32*   deadEnd      = (u32*)Platform::Alloc( triangleCount * 3 * sizeof(u32) );
+    u32*   candidates   = (u32*)Platform::Alloc( (usize)maxValence * 3 * sizeof(u32) );
+    u32*   result       = (u32*)Platform::Alloc( triangleCount * 3 * sizeof(u32) );
+    usize deadEndCount  = 0;
+    usize resultCount   = 0;
+    usize cursor        = 1;
+    usize cacheSize     = MESH_VERTEX_CACHE_SIZE;
+    usize time          = cacheSize + 1;
+
+    i64 fanVertex = 0;
+    while( fanVertex >= 0 ) {
+        usize candidateCount = 0;
+        for( u32 a = adjacencyOffsets[fanVertex]; a < adjacencyOffsets[fanVertex + 1]; ++a ) {
+            u32 triangle = adjacency[a];
+            if( emitted[triangle] ) {
+                continue;
+            }
+            emitted[triangle] = true;
+            ucyclesi( 3, corner ) {
+                u32 vertex = indices[triangle * 3 + corner];
+                result[resultCount++]       = vertex;
+                deadEnd[deadEndCount++]     = vertex;
+                candidates[candidateCount++] = vertex;
+                liveTriangles[vertex]--;
+                if( time - timestamps[vertex] > cacheSize ) {
+                    timestamps[vertex] = time++;
+                }
+            }
+        }
+        fanVertex = MeshTipsifyNextVertex(
+            cacheSize,
+            candidateCount, candidates,
+            liveTriangles, timestamps, time,
+            deadEnd, &deadEndCount,
+            vertexCount, &cursor
+        );
+    }
+
+    Platform::MemCopy( resultCount * sizeof(u32), result, indices );
+
+    Platform::Free( result );
+    Platform::Free( candidates );
+    Platform::Free( deadEnd );
+    Platform::Free( emitted );
+    Platform::Free( timestamps );
+    Platform::Free( adjacency );
+    Platform::Free( adjacencyOffsets );
+    Platform::Free( liveTriangles );
+}
+
+void Core::OptimizeVertexCache( Mesh* mesh ) {
+    ucycles( mesh->subMeshCount ) {
+        const SubMesh& subMesh = mesh->subMeshes[i];
+        MeshTipsify( subMesh.indexCount, mesh->indices + subMesh.firstIndex, subMesh.vertexCount );
+        ucyclesi( subMesh.lodCount, level ) {
+            const SubMeshLOD& lod = subMesh.lods[level];
+            MeshTipsify( lod.indexCount, mesh->indices + lod.firstIndex, subMesh.vertexCount );
+        }
+    }
+}
+
+void Core::OptimizeVertexFetch( Mesh* mesh ) {
+    if( mesh->vertexCount == 0 ) {
+        return;
+    }
+
+    u32* remap = (u32*)Platform::Alloc( mesh->vertexCount * sizeof(u32) );
+    ucycles( mesh->vertexCount ) {
+        remap[i] = U32::MAX;
+    }
+
+    Core::vertex* vertices = (Core::vertex*)Platform::Alloc( mesh->vertexCount * sizeof(Core::vertex) );
+    u32 nextVertex = 0;
+    ucyclesi( mesh->subMeshCount, subMeshIndex ) {
+        SubMesh* subMesh = &mesh->subMeshes[subMeshIndex];
+        u32* indices   = mesh->indices + subMesh->firstIndex;
+        u32  baseVertex = nextVertex;
+        ucycles( subMesh->indexCount ) {
+            u32 vertex = subMesh->baseVertex + indices[i];
+            if( remap[vertex] == U32::MAX ) {
+                remap[vertex] = nextVertex - baseVertex;
+                vertices[nextVertex] = mesh->vertices[vertex];
+                nextVertex++;
+            }
+            indices[i] = remap[vertex];
+        }
+        // NOTE(alicia): levels only reference vertices of full detail range
+        ucyclesi( subMesh->lodCount, level ) {
+            const SubMeshLOD& lod = subMesh->lods[level];
+            u32* lodIndices = mesh->indices + lod.firstIndex;
+            ucycles( lod.indexCount ) {
+                lodIndices[i] = remap[subMesh->baseVertex + lodIndices[i]];
+            }
+        }
+        subMesh->baseVertex  = baseVertex;
+        subMesh->vertexCount = nextVertex - baseVertex;
+    }
+
+    // NOTE(alicia): vertices that no triangle references are dropped
+    Platform::Free( mesh->vertices );
+    Platform::Free( remap );
+    mesh->vertices    = vertices;
+    mesh->vertexCount = nextVertex;
+}
+
+/// @brief Measure vertex cache of every sub-mesh
+static void MeshMeasureVertexCache( const Core::Mesh* mesh, f32* acmr, f32* atvr ) {
+    // NOTE(alicia): mesh indices also hold LOD ranges, only full detail sub-meshes are measured
+    f64 misses = 0.0;
+    usize triangleCount = 0;
+    ucycles( mesh->subMeshCount ) {
+        const Core::SubMesh& subMesh = mesh->subMeshes[i];
+        f32 subMeshACMR = 0.0f, subMeshATVR = 0.0f;
+        Core::MeasureVertexCache(
+            subMesh.indexCount, mesh->indices + subMesh.firstIndex,
+            subMesh.vertexCount, MESH_VERTEX_CACHE_SIZE,
+            &subMeshACMR, &subMeshATVR
+        );
+        misses += (f64)subMeshACMR * (f64)( subMesh.indexCount / 3 );
+        triangleCount += subMesh.indexCount / 3;
+    }
+    *acmr = triangleCount ? (f32)( misses / (f64)triangleCount ) : 0.0f;
+    *atvr = mesh->vertexCount ? (f32)( misses / (f64)mesh->vertexCount ) : 0.0f;
+}
+
+void Core::OptimizeMesh( Mesh* mesh ) {
+    u64 startTime = Platform::GetPerformanceCounter();
+
+    f32 acmrBefore = 0.0f, atvrBefore = 0.0f;
+    MeshMeasureVertexCache( mesh, &acmrBefore, &atvrBefore );
+
+    OptimizeVertexCache( mesh );
+    OptimizeVertexFetch( mesh );
+
+    f32 acmrAfter = 0.0f, atvrAfter = 0.0f;
+    MeshMeasureVertexCache( mesh, &acmrAfter, &atvrAfter );
+
+    f64 elapsedSeconds = (f64)( Platform::GetPerformanceCounter() - startTime ) /
+        (f64)Platform::GetPerformanceFrequency();
+    LOG_INFO( "OptimizeMesh > ACMR %.3f -> %.3f ATVR %.3f -> %.3f in %.3fs",
+        acmrBefore, acmrAfter,
+        atvrBefore, atvrAfter,
+        elapsedSeconds
+    );
+}
@@ -0,0 +1,264 @@
+/**
+ * Description:  Indexed meshes
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "pch.hpp"
+#include "platform/renderer.hpp"
+#include "platform/io.hpp"
+
+namespace Core {
+
+// forward declaration
+struct vertex;
+struct camera;
+struct JobQueue;
+struct Meshlet;
+struct OBJData;
+
+/// @brief Maximum number of simplified levels per sub-mesh
+#define MESH_MAX_LOD_COUNT 4
+
+/// @brief Simplified index range of a sub-mesh
+struct SubMeshLOD {
+    u32 firstIndex;
+    u32 indexCount;
+    /// @brief Largest distance from full detail surface, in mesh units
+    f32 error;
+};
+
+/// @brief Range of a mesh drawn with a single draw call.
+/// Indices are relative to baseVertex and only reference vertices in range
+struct SubMesh {
+    u32 firstIndex;
+    u32 indexCount;
+    u32 baseVertex;
+    u32 vertexCount;
+    /// @brief Material index, -1 if sub-mesh has no material
+    i32 material;
+    /// @brief Simplified levels, least detailed last.
+    /// Levels share vertices with the full detail range
+    u32 lodCount;
+    SubMeshLOD lods[MESH_MAX_LOD_COUNT];
+    /// @brief Meshlets of full detail range
+    u32 firstMeshlet;
+    u32 meshletCount;
+};
+
+/// @brief Indexed triangle mesh in CPU memory
+struct Mesh {
+    usize vertexCount;
+    Core::vertex* vertices;
+    usize indexCount;
+    u32* indices;
+    usize subMeshCount;
+    SubMesh* subMeshes;
+    usize meshletCount;
+    Meshlet* meshlets;
+    smath::vec3 boundsMin;
+    smath::vec3 boundsMax;
+};
+
+/// @brief Index ranges drawn in a single multi-draw call
+struct MeshDrawList {
+    usize capacity;
+    usize count;
+    u32* firstIndices;
+    u32* indexCounts;
+    u32* baseVertices;
+};
+
+/// @brief Everything needed to draw a mesh that was uploaded to a single vertex array
+struct MeshInfo {
+    usize subMeshCount;
+    SubMesh* subMeshes;
+    usize meshletCount;
+    Meshlet* meshlets;
+    smath::vec3 boundsMin;
+    smath::vec3 boundsMax;
+    /// @brief Vertices are Core::packedVertex, positions are relative to bounds
+    bool packed;
+    /// @brief uvs start at the top of the image, as in glTF, v is flipped when drawn
+    bool uvOriginTop;
+    /// @brief Ranges drawn this frame, reused between frames
+    MeshDrawList drawList;
+};
+
+/// @brief Material libraries and material names a mesh was built with, kept in its mesh cache.
+/// Names are null-terminated and packed back to back in text,
+/// libraries first, then materials in order of sub-mesh material index
+struct MeshMaterialNames {
+    u32 libraryCount;
+    u32 materialCount;
+    usize textSize;
+    char* text;
+};
+
+/// @brief Mesh data in the format it is uploaded in.
+/// Can be prepared on any thread, only UploadMeshData has to run on the main thread
+struct MeshUploadData {
+    Platform::VertexBufferLayout layout;
+    usize vertexDataSize;
+    void* vertexData;
+    usize indexCount;
+    Platform::DataType indexDataType;
+    void* indexData;
+    /// @brief Draw info, moved out by UploadMeshData
+    MeshInfo info;
+    /// @brief Names sub-mesh materials refer to, empty if mesh format has no material libraries
+    MeshMaterialNames materialNames;
+    /// @brief Mesh that vertex and index data come from, empty if they point into cache file
+    Mesh mesh;
+    /// @brief Cache file, or source file uploaded as is, that vertex and index data point into.
+    /// Empty if they come from mesh
+    Platform::MappedFile cacheFile;
+};
+
+/// @brief Camera as seen from mesh space, used to pick levels and cull meshlets
+struct MeshView {
+    /// @brief Left, right, bottom, top, near and far planes.
+    /// xyz is normalized plane normal pointing inside, w is distance
+    smath::vec4 frustumPlanes[6];
+    smath::vec3 cameraPosition;
+    /// @brief Size of a mesh unit on screen, F32::MAX if camera is inside mesh bounds
+    f32 pixelsPerUnit;
+    /// @brief Distance from camera to mesh bounds, 0 if camera is inside them
+    f32 distance;
+};
+
+/// @brief Build indexed mesh from obj data.
+/// Every obj group becomes a sub-mesh, face corners of a group that
+/// share position, uv and normal are welded into a single vertex
+/// @param data parsed obj data
+/// @param queue job queue tangents are calculated on, can be nullptr
+/// @param result [out] mesh, free with FreeMesh
+/// @return true if successful
+bool BuildMesh( const Core::OBJData* data, JobQueue* queue, Mesh* result );
+/// @brief Free mesh memory
+void FreeMesh( Mesh* mesh );
+
+/// @brief Cache size the vertex cache optimizer targets
+#define MESH_VERTEX_CACHE_SIZE 16
+
+/// @brief Simulate a FIFO post-transform vertex cache
+/// @param indexCount number of indices
+/// @param indices triangle indices
+/// @param vertexCount number of vertices
+/// @param cacheSize number of entries in simulated cache
+/// @param acmr [out] average cache miss ratio, transformed vertices per triangle
+/// @param atvr [out] average transformed vertex ratio, transformed vertices per vertex
+void MeasureVertexCache(
+    usize indexCount, const u32* indices,
+    usize vertexCount, usize cacheSize,
+    f32* acmr, f32* atvr
+);
+/// @brief Reorder triangles of every sub-mesh and level for post-transform vertex cache locality (Tipsify)
+void OptimizeVertexCache( Mesh* mesh );
+/// @brief Reorder vertices of every sub-mesh in order of first use for vertex fetch locality.
+/// Levels are remapped to the new vertex order. Run after OptimizeVertexCache
+void OptimizeVertexFetch( Mesh* mesh );
+/// @brief Run every mesh optimization pass and log results
+void OptimizeMesh( Mesh* mesh );
+/// @brief Calculate mesh bounds from vertex positions
+void CalculateMeshBounds( Mesh* mesh );
+/// @brief Get mesh vertices in the format they are uploaded in
+/// @param mesh mesh
+/// @param packed pack vertices into Core::packedVertex
+/// @param layout [out] vertex layout, free with FreeVertexBufferLayout
+/// @param size [out] size of vertex data in bytes
+/// @return vertex data, free with FreeMeshVertexData
+void* CreateMeshVertexData( const Mesh* mesh, bool packed, Platform::VertexBufferLayout* layout, usize* size );
+/// @brief Free vertex data created by CreateMeshVertexData
+void FreeMeshVertexData( const Mesh* mesh, void* vertexData );
+/// @brief Get mesh indices in the format they are uploaded in.
+/// Indices are 16-bit when every vertex of every sub-mesh is addressable with them
+/// @param mesh mesh
+/// @param dataType [out] index data type
+/// @return index data, free with FreeMeshIndexData
+void* CreateMeshIndexData( const Mesh* mesh, Platform::DataType* dataType );
+/// @brief Free index data created by CreateMeshIndexData
+void FreeMeshIndexData( const Mesh* mesh, void* indexData );
+/// @brief Prepare mesh for upload, doesn't touch the GPU
+/// @param mesh [in/out] mesh to upload, moved into result
+/// @param packed pack vertices into Core::packedVertex
+/// @param result [out] upload data, free with FreeMeshUploadData
+/// @return false if allocation failed, mesh is freed
+bool CreateMeshUploadData( Mesh* mesh, bool packed, MeshUploadData* result );
+/// @brief Upload prepared mesh to GPU, must run on the main thread.
+/// Every sub-mesh shares the same vertex and index buffer
+/// @param data upload data, still has to be freed with FreeMeshUploadData
+/// @param result [out] vertex array
+/// @param info [out] draw info, free with FreeMeshInfo
+/// @param api renderer api
+void UploadMeshData(
+    MeshUploadData* data,
+    Platform::VertexArray* result, MeshInfo* info,
+    Platform::RendererAPI* api
+);
+/// @brief Free upload data and everything it still owns
+void FreeMeshUploadData( MeshUploadData* data );
+/// @brief Get name from packed material names
+/// @param names material names
+/// @param index index of name, libraries come first
+/// @return null-terminated name, nullptr if index is out of range
+const char* GetMeshMaterialName( const MeshMaterialNames* names, usize index );
+/// @brief Free material names
+void FreeMeshMaterialNames( MeshMaterialNames* names );
+/// @brief Allocate draw list with room for every meshlet and sub-mesh of mesh info
+/// @return false if allocation failed
+bool CreateMeshDrawList( MeshInfo* info );
+/// @brief Free mesh info and its draw list
+void FreeMeshInfo( MeshInfo* info );
+/// @brief Transform camera into mesh space
+/// @param info mesh info
+/// @param transform model transform, rotation and translation only
+/// @param camera camera
+/// @param viewportHeight height of viewport in pixels
+/// @param result [out] mesh view
+void CreateMeshView(
+    const MeshInfo* info,
+    const smath::mat4& transform,
+    const Core::camera* camera,
+    f32 viewportHeight,
+    MeshView* result
+);
+/// @brief Largest on screen error a level is allowed to have, in pixels
+#define MESH_LOD_PIXEL_ERROR 1.0f
+/// @brief Pick least detailed level of sub-mesh that stays under MESH_LOD_PIXEL_ERROR
+/// @param subMesh sub-mesh
+/// @param pixelsPerUnit size of a mesh unit on screen, F32::MAX picks full detail
+/// @param firstIndex [out] first index of level
+/// @param indexCount [out] number of indices in level
+/// @return level, 0 is full detail
+u32 SelectSubMeshLOD( const SubMesh* subMesh, f32 pixelsPerUnit, u32* firstIndex, u32* indexCount );
+/// @brief Draw every sub-mesh of vertex array.
+/// Full detail sub-meshes are culled per meshlet and
+/// every visible range is drawn with a single multi-draw call.
+/// Draws whole vertex array if there are no sub-meshes
+/// @param vertexArray vertex array, must be in use
+/// @param info mesh info
+/// @param view mesh view, used to pick levels and cull meshlets
+/// @param api renderer api
+void DrawSubMeshes(
+    Platform::VertexArray* vertexArray,
+    MeshInfo* info,
+    const MeshView* view,
+    Platform::RendererAPI* api
+);
+/// @brief Draw sub-meshes of vertex array that use given material, the same way DrawSubMeshes does.
+/// Whole vertex array counts as material -1 if there are no sub-meshes
+/// @param vertexArray vertex array, must be in use
+/// @param info mesh info
+/// @param view mesh view, used to pick levels and cull meshlets
+/// @param material material index, -1 draws sub-meshes without material
+/// @param api renderer api
+void DrawMaterialSubMeshes(
+    Platform::VertexArray* vertexArray,
+    MeshInfo* info,
+    const MeshView* view,
+    i32 material,
+    Platform::RendererAPI* api
+);
+
+} // namespace Core
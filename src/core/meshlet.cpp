@@ -0,0 +1,244 @@
+/**
+ * Description:  Meshlet building and culling
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "core/meshlet.hpp"
+#include "core/mesh.hpp"
+#include "core/renderex.hpp"
+#include "platform/io.hpp"
+
+/// @brief Split triangles of a single sub-mesh into meshlets
+/// @param meshlets [out] meshlets, nullptr only counts them
+/// @param vertexMeshlet last meshlet every vertex of sub-mesh was added to, plus one
+/// @return number of meshlets
+static usize MeshletScan(
+    const Core::SubMesh* subMesh, const u32* indices,
+    Core::Meshlet* meshlets, u32* vertexMeshlet
+) {
+    ucycles( subMesh->vertexCount ) {
+        vertexMeshlet[i] = 0;
+    }
+
+    usize meshletCount  = 0;
+    u32   firstIndex    = subMesh->firstIndex;
+    u32   vertexCount   = 0;
+    u32   triangleCount = 0;
+    for( u32 triangle = 0; triangle < subMesh->indexCount / 3; ++triangle ) {
+        const u32* corners = indices + subMesh->firstIndex + triangle * 3;
+        u32 newVertexCount = 0;
+        ucycles( 3 ) {
+            if( vertexMeshlet[corners[i]] != meshletCount + 1 ) {
+                newVertexCount++;
+            }
+        }
+        // NOTE(alicia): a repeated corner of a degenerate triangle is counted twice, which is fine
+        if(
+            triangleCount == MESHLET_MAX_TRIANGLES ||
+            vertexCount + newVertexCount > MESHLET_MAX_VERTICES
+        ) {
+            if( meshlets ) {
+                meshlets[meshletCount].firstIndex = firstIndex;
+                meshlets[meshletCount].indexCount = triangleCount * 3;
+            }
+            meshletCount++;
+            firstIndex   += triangleCount * 3;
+            vertexCount   = 0;
+            triangleCount = 0;
+        }
+        ucycles( 3 ) {
+            if( vertexMeshlet[corners[i]] != meshletCount + 1 ) {
+                vertexMeshlet[corners[i]] = (u32)meshletCount + 1;
+                vertexCount++;
+            }
+        }
+        triangleCount++;
+    }
+    if( triangleCount ) {
+        if( meshlets ) {
+            meshlets[meshletCount].firstIndex = firstIndex;
+            meshlets[meshletCount].indexCount = triangleCount * 3;
+        }
+        meshletCount++;
+    }
+    return meshletCount;
+}
+
+/// @brief Calculate bounds and normal cone of meshlet
+static void MeshletBounds(
+    Core::Meshlet* meshlet, const u32* indices,
+    const Core::vertex* vertices
+) {
+    const u32* meshletIndices = indices + meshlet->firstIndex;
+
+    smath::vec3 boundsMin = vertices[meshletIndices[0]].position;
+    smath::vec3 boundsMax = boundsMin;
+    smath::vec3 normalSum = smath::vec3( 0.0f );
+    ucycles( meshlet->indexCount ) {
+        const smath::vec3& position = vertices[meshletIndices[i]].position;
+        ucyclesi( 3, axis ) {
+            boundsMin[axis] = position[axis] < boundsMin[axis] ? position[axis] : boundsMin[axis];
+            boundsMax[axis] = position[axis] > boundsMax[axis] ? position[axis] : boundsMax[axis];
+        }
+    }
+
+    // NOTE(alicia): triangle normals are normalized so every triangle counts the same
+    smath::vec3 normals[MESHLET_MAX_TRIANGLES];
+    u32 normalCount = 0;
+    for( u32 i = 0; i < meshlet->indexCount; i += 3 ) {
+        const smath::vec3& p0 = vertices[meshletIndices[i + 0]].position;
+        const smath::vec3& p1 = vertices[meshletIndices[i + 1]].position;
+        const smath::vec3& p2 = vertices[meshletIndices[i + 2]].position;
+        smath::vec3 normal = smath::cross( p1 - p0, p2 - p0 );
+        f32 length = smath::mag( normal );
+        if( length <= F32::EPSILON ) {
+            continue;
+        }
+        normals[normalCount] = normal / length;
+        normalSum = normalSum + normals[normalCount];
+        normalCount++;
+    }
+
+    meshlet->boundsMin = boundsMin;
+    meshlet->boundsMax = boundsMax;
+    meshlet->center    = ( boundsMin + boundsMax ) * 0.5f;
+    f32 radiusSqr = 0.0f;
+    ucycles( meshlet->indexCount ) {
+        f32 distanceSqr = smath::sqrMag( vertices[meshletIndices[i]].position - meshlet->center );
+        radiusSqr = distanceSqr > radiusSqr ? distanceSqr : radiusSqr;
+    }
+    meshlet->radius = smath::sqrt( radiusSqr );
+
+    meshlet->coneAxis   = smath::vec3( 0.0f );
+    meshlet->coneCutoff = 1.0f;
+    f32 normalSumLength = smath::mag( normalSum );
+    if( normalCount == 0 || normalSumLength <= F32::EPSILON ) {
+        return;
+    }
+    meshlet->coneAxis = normalSum / normalSumLength;
+    f32 minDot = 1.0f;
+    ucycles( normalCount ) {
+        f32 dot = smath::dot( meshlet->coneAxis, normals[i] );
+        minDot = dot < minDot ? dot : minDot;
+    }
+    if( minDot >= MESHLET_MIN_CONE_DOT ) {
+        meshlet->coneCutoff = smath::sqrt( 1.0f - minDot * minDot );
+    }
+}
+
+bool Core::BuildMeshlets( Mesh* mesh ) {
+    u32 maxVertexCount = 0;
+    ucycles( mesh->subMeshCount ) {
+        u32 vertexCount = mesh->subMeshes[i].vertexCount;
+        maxVertexCount = vertexCount > maxVertexCount ? vertexCount : maxVertexCount;
+    }
+    u32* vertexMeshlet = (u32*)Platform::Alloc( ( maxVertexCount ? maxVertexCount : 1 ) * sizeof(u32) );
+    if( !vertexMeshlet ) {
+        LOG_ERROR( "BuildMeshlets > Failed to allocate scan buffer!" );
+        return false;
+    }
+
+    usize meshletCount = 0;
+    ucycles( mesh->subMeshCount ) {
+        meshletCount += MeshletScan( &mesh->subMeshes[i], mesh->indices, nullptr, vertexMeshlet );
+    }
+    Meshlet* meshlets = (Meshlet*)Platform::Alloc( meshletCount * sizeof(Meshlet) );
+    if( !meshlets && meshletCount ) {
+        LOG_ERROR( "BuildMeshlets > Failed to allocate meshlets!" );
+        Platform::Free( vertexMeshlet );
+        return false;
+    }
+
+    usize firstMeshlet = 0;
+    usize triangleCount = 0;
+    ucyclesi( mesh->subMeshCount, subMeshIndex ) {
+        SubMesh* subMesh = &mesh->subMeshes[subMeshIndex];
+        subMesh->firstMeshlet = (u32)firstMeshlet;
+        subMesh->meshletCount = (u32)MeshletScan(
+            subMesh, mesh->indices,
+            meshlets + firstMeshlet, vertexMeshlet
+        );
+        ucycles( subMesh->meshletCount ) {
+            MeshletBounds(
+                &meshlets[firstMeshlet + i], mesh->indices,
+                mesh->vertices + subMesh->baseVertex
+            );
+        }
+        firstMeshlet  += subMesh->meshletCount;
+        triangleCount += subMesh->indexCount / 3;
+    }
+    Platform::Free( vertexMeshlet );
+
+    if( mesh->meshlets ) {
+        Platform::Free( mesh->meshlets );
+    }
+    mesh->meshletCount = meshletCount;
+    mesh->meshlets     = meshlets;
+
+    LOG_INFO( "BuildMeshlets > %llu meshlets, %.1f triangles per meshlet",
+        meshletCount,
+        meshletCount ? (f64)triangleCount / (f64)meshletCount : 0.0
+    );
+    return true;
+}
+
+/// @brief Check meshlet against frustum planes, sphere first then box
+static inline bool MeshletInFrustum( const Core::Meshlet& meshlet, const Core::MeshView* view ) {
+    ucycles( 6 ) {
+        const smath::vec4& plane = view->frustumPlanes[i];
+        f32 distance =
+            plane.x * meshlet.center.x +
+            plane.y * meshlet.center.y +
+            plane.z * meshlet.center.z + plane.w;
+        if( distance < -meshlet.radius ) {
+            return false;
+        }
+        // NOTE(alicia): corner of box furthest along plane normal
+        f32 furthest =
+            plane.x * ( plane.x >= 0.0f ? meshlet.boundsMax.x : meshlet.boundsMin.x ) +
+            plane.y * ( plane.y >= 0.0f ? meshlet.boundsMax.y : meshlet.boundsMin.y ) +
+            plane.z * ( plane.z >= 0.0f ? meshlet.boundsMax.z : meshlet.boundsMin.z ) + plane.w;
+        if( furthest < 0.0f ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief Check if every triangle of meshlet faces away from camera
+static inline bool MeshletBackfacing( const Core::Meshlet& meshlet, const Core::MeshView* view ) {
+    smath::vec3 toCenter = meshlet.center - view->cameraPosition;
+    return smath::dot( toCenter, meshlet.coneAxis ) >=
+        meshlet.coneCutoff * smath::mag( toCenter ) + meshlet.radius;
+}
+
+usize Core::CullMeshlets(
+    const SubMesh* subMesh, const Meshlet* meshlets,
+    const MeshView* view, MeshDrawList* drawList
+) {
+    usize visibleCount = 0;
+    // NOTE(alicia): meshlets of a sub-mesh are contiguous in index buffer,
+    // so a visible meshlet right after another extends its range
+    bool extendRange = false;
+    ucycles( subMesh->meshletCount ) {
+        const Meshlet& meshlet = meshlets[subMesh->firstMeshlet + i];
+        if( !MeshletInFrustum( meshlet, view ) || MeshletBackfacing( meshlet, view ) ) {
+            extendRange = false;
+            continue;
+        }
+        visibleCount++;
+        if( extendRange ) {
+            drawList->indexCounts[drawList->count - 1] += meshlet.indexCount;
+            continue;
+        }
+        DEBUG_ASSERT_LOG( drawList->count < drawList->capacity,
+            "CullMeshlets > Draw list is full! %llu", drawList->capacity
+        );
+        drawList->firstIndices[drawList->count] = meshlet.firstIndex;
+        drawList->indexCounts[drawList->count]  = meshlet.indexCount;
+        drawList->baseVertices[drawList->count] = subMesh->baseVertex;
+        drawList->count++;
+        extendRange = true;
+    }
+    return visibleCount;
+}
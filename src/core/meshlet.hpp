@@ -0,0 +1,60 @@
+/**
+ * Description:  Meshlet building and culling
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "pch.hpp"
+
+namespace Core {
+
+// forward declaration
+struct Mesh;
+struct MeshView;
+struct MeshDrawList;
+struct SubMesh;
+
+/// @brief Maximum number of unique vertices in a meshlet
+#define MESHLET_MAX_VERTICES  64
+/// @brief Maximum number of triangles in a meshlet
+#define MESHLET_MAX_TRIANGLES 124
+/// @brief Smallest cosine between cone axis and a triangle normal that still allows backface culling
+#define MESHLET_MIN_CONE_DOT  0.1f
+
+/// @brief Contiguous range of a sub-mesh's triangles with culling data.
+/// Bounds are in mesh space
+struct Meshlet {
+    u32 firstIndex;
+    u32 indexCount;
+    /// @brief Bounding sphere
+    smath::vec3 center;
+    f32 radius;
+    smath::vec3 boundsMin;
+    smath::vec3 boundsMax;
+    /// @brief Average triangle normal
+    smath::vec3 coneAxis;
+    /// @brief Sine of widest angle between cone axis and a triangle normal,
+    /// 1 if meshlet can't be backface culled
+    f32 coneCutoff;
+};
+
+/// @brief Split full detail range of every sub-mesh into meshlets.
+/// Triangles keep their order so every meshlet is a contiguous index range,
+/// run after OptimizeMesh so meshlets follow vertex cache order
+/// @param mesh mesh
+/// @return false if allocation failed
+bool BuildMeshlets( Mesh* mesh );
+
+/// @brief Append ranges of sub-mesh meshlets that are inside view frustum and not facing away.
+/// Ranges of neighbouring visible meshlets are merged
+/// @param subMesh sub-mesh
+/// @param meshlets meshlets of mesh
+/// @param view mesh view
+/// @param drawList [out] draw list to append to, must have room for every meshlet of sub-mesh
+/// @return number of visible meshlets
+usize CullMeshlets(
+    const SubMesh* subMesh, const Meshlet* meshlets,
+    const MeshView* view, MeshDrawList* drawList
+);
+
+} // namespace Core
@@ -0,0 +1,672 @@
+/**
+ * Description:  Out-of-core mesh building
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "core/meshstream.hpp"
+#include "core/stream.hpp"
+#include "core/cache.hpp"
+#include "core/mesh.hpp"
+#include "core/obj.hpp"
+#include "core/renderex.hpp"
+#include "platform/io.hpp"
+
+// NOTE(alicia): a join looks attributes up by index, so records are sorted by that index
+// and read alongside the attribute file, which is then read exactly once from start to end
+
+/// @brief Position of a corner or normal contribution to a position
+struct StreamVec3Record {
+    u64 key;
+    smath::vec3 value;
+    /// @brief Position index, for corner records
+    u32 position;
+};
+
+/// @brief Corner keyed by the position it references
+struct StreamPositionRecord {
+    u64 position;
+    u64 corner;
+};
+
+/// @brief Corner keyed by group and position, corners with the same key and attributes are welded
+struct StreamWeldRecord {
+    u64 key;
+    i32 uv;
+    i32 normal;
+    u64 corner;
+};
+
+/// @brief Vertex of a corner, relative to sub-mesh base vertex
+struct StreamIndexRecord {
+    u64 corner;
+    u32 index;
+    u32 padding;
+};
+
+/// @brief Welded vertex keyed by the index of the attribute looked up next
+struct StreamVertexRecord {
+    u64 key;
+    u32 vertex;
+    i32 position;
+    i32 uv;
+    i32 normal;
+    Core::vertex value;
+};
+
+static_assert( sizeof(StreamVec3Record)     % sizeof(u64) == 0, "Stream records must be sortable!" );
+static_assert( sizeof(StreamPositionRecord) % sizeof(u64) == 0, "Stream records must be sortable!" );
+static_assert( sizeof(StreamWeldRecord)     % sizeof(u64) == 0, "Stream records must be sortable!" );
+static_assert( sizeof(StreamIndexRecord)    % sizeof(u64) == 0, "Stream records must be sortable!" );
+static_assert( sizeof(StreamVertexRecord)   % sizeof(u64) == 0, "Stream records must be sortable!" );
+
+/// @brief Temporary files of a streamed build
+struct StreamPaths {
+    char scratch[CACHE_PATH_MAX_LEN];
+    char records[CACHE_PATH_MAX_LEN];
+    char vertices[CACHE_PATH_MAX_LEN];
+    char indices[CACHE_PATH_MAX_LEN];
+    char generatedNormals[CACHE_PATH_MAX_LEN];
+};
+
+/// @brief Attribute file read in order of ascending index
+struct StreamLookup {
+    Core::RecordReader reader;
+    usize index;
+    const void* current;
+};
+
+static bool StreamOpenLookup( const char* filePath, usize recordSize, usize bufferSize, StreamLookup* result ) {
+    *result = {};
+    if( !Core::OpenRecordReader( filePath, recordSize, bufferSize, &result->reader ) ) {
+        return false;
+    }
+    result->current = Core::NextRecord( &result->reader );
+    return true;
+}
+
+/// @brief Get record at index, indices must not decrease between calls
+/// @return record, nullptr if index is past the end of file
+static const void* StreamLookupAt( StreamLookup* lookup, usize index ) {
+    while( lookup->current && lookup->index < index ) {
+        lookup->current = Core::NextRecord( &lookup->reader );
+        lookup->index++;
+    }
+    return lookup->index == index ? lookup->current : nullptr;
+}
+
+/// @brief Angle between two edges leaving a corner
+static inline f32 StreamCornerAngle( const smath::vec3& a, const smath::vec3& b ) {
+    f32 cosine = smath::dot( smath::normalize( a ), smath::normalize( b ) );
+    return smath::acos( smath::clamp( cosine, -1.0f, 1.0f ) );
+}
+
+/// @brief Tangent orthogonal to normal, same as the fallback of calculateTangentBasis
+static inline smath::vec4 StreamTangent( const smath::vec3& normal ) {
+    smath::vec3 axis = smath::abs( normal.x ) < 0.9f ? smath::vec3( 1.0f, 0.0f, 0.0f ) : smath::vec3( 0.0f, 1.0f, 0.0f );
+    smath::vec3 tangent = smath::cross( normal, axis );
+    if( smath::sqrMag( tangent ) <= F32::EPSILON * F32::EPSILON ) {
+        tangent = axis;
+    }
+    tangent = smath::normalize( tangent );
+    return smath::vec4( tangent.x, tangent.y, tangent.z, 1.0f );
+}
+
+/// @brief Generate a smooth normal for every position, see GenerateOBJNormals.
+/// Face normals are weighted by corner angle and summed per position,
+/// positions without faces get a zero normal
+/// @return true if generated normals file was written
+static bool StreamGenerateNormals( const Core::OBJStreamData* data, const StreamPaths* paths, usize memoryBudget ) {
+    usize bufferSize = memoryBudget / 4;
+
+    // corners by position
+    Core::RecordReader corners = {};
+    Core::RecordWriter writer  = {};
+    if( !Core::OpenRecordReader( data->cornerPath, sizeof(Core::OBJCorner), bufferSize, &corners ) ) {
+        return false;
+    }
+    if( !Core::CreateRecordWriter( paths->records, sizeof(StreamPositionRecord), bufferSize, &writer ) ) {
+        Core::CloseRecordReader( &corners );
+        return false;
+    }
+    usize cornerIndex = 0;
+    while( const Core::OBJCorner* corner = (const Core::OBJCorner*)Core::NextRecord( &corners ) ) {
+        StreamPositionRecord* record = (StreamPositionRecord*)Core::PushRecord( &writer );
+        record->position = (u64)corner->position;
+        record->corner   = cornerIndex++;
+    }
+    Core::CloseRecordReader( &corners );
+    if(
+        !Core::CloseRecordWriter( &writer ) ||
+        !Core::SortRecords( paths->records, paths->scratch, sizeof(StreamPositionRecord), memoryBudget )
+    ) {
+        return false;
+    }
+
+    // position of every corner, back in corner order
+    Core::RecordReader references = {};
+    StreamLookup positions = {};
+    bool success =
+        Core::OpenRecordReader( paths->records, sizeof(StreamPositionRecord), bufferSize, &references ) &&
+        StreamOpenLookup( data->positionPath, sizeof(smath::vec3), bufferSize, &positions ) &&
+        Core::CreateRecordWriter( paths->vertices, sizeof(StreamVec3Record), bufferSize, &writer );
+    while( success ) {
+        const StreamPositionRecord* reference = (const StreamPositionRecord*)Core::NextRecord( &references );
+        if( !reference ) {
+            break;
+        }
+        const smath::vec3* position = (const smath::vec3*)StreamLookupAt( &positions, reference->position );
+        StreamVec3Record* record = (StreamVec3Record*)Core::PushRecord( &writer );
+        record->key      = reference->corner;
+        record->value    = position ? *position : smath::vec3();
+        record->position = (u32)reference->position;
+    }
+    Core::CloseRecordReader( &references );
+    Core::CloseRecordReader( &positions.reader );
+    if(
+        !Core::CloseRecordWriter( &writer ) || !success ||
+        !Core::SortRecords( paths->vertices, paths->scratch, sizeof(StreamVec3Record), memoryBudget )
+    ) {
+        return false;
+    }
+
+    // angle-weighted face normal of every corner, by position
+    Core::RecordReader cornerPositions = {};
+    success =
+        Core::OpenRecordReader( paths->vertices, sizeof(StreamVec3Record), bufferSize, &cornerPositions ) &&
+        Core::CreateRecordWriter( paths->records, sizeof(StreamVec3Record), bufferSize, &writer );
+    while( success ) {
+        StreamVec3Record triangle[3];
+        usize cornerCount = 0;
+        while( cornerCount < 3 ) {
+            const StreamVec3Record* record = (const StreamVec3Record*)Core::NextRecord( &cornerPositions );
+            if( !record ) {
+                break;
+            }
+            triangle[cornerCount++] = *record;
+        }
+        if( cornerCount < 3 ) {
+            break;
+        }
+
+        const smath::vec3& a = triangle[0].value;
+        const smath::vec3& b = triangle[1].value;
+        const smath::vec3& c = triangle[2].value;
+        smath::vec3 faceNormal = smath::normalize( smath::cross( b - a, c - a ) );
+        f32 angles[3] = {
+            StreamCornerAngle( b - a, c - a ),
+            StreamCornerAngle( c - b, a - b ),
+            StreamCornerAngle( a - c, b - c )
+        };
+        ucycles( 3 ) {
+            StreamVec3Record* contribution = (StreamVec3Record*)Core::PushRecord( &writer );
+            contribution->key      = triangle[i].position;
+            contribution->value    = faceNormal * angles[i];
+            contribution->position = triangle[i].position;
+        }
+    }
+    Core::CloseRecordReader( &cornerPositions );
+    if(
+        !Core::CloseRecordWriter( &writer ) || !success ||
+        !Core::SortRecords( paths->records, paths->scratch, sizeof(StreamVec3Record), memoryBudget )
+    ) {
+        return false;
+    }
+
+    // sum contributions of every position
+    Core::RecordReader contributions = {};
+    success =
+        Core::OpenRecordReader( paths->records, sizeof(StreamVec3Record), bufferSize, &contributions ) &&
+        Core::CreateRecordWriter( paths->generatedNormals, sizeof(smath::vec3), bufferSize, &writer );
+    usize position = 0;
+    smath::vec3 sum;
+    while( success ) {
+        const StreamVec3Record* contribution = (const StreamVec3Record*)Core::NextRecord( &contributions );
+        usize key = contribution ? contribution->key : data->positionCount;
+        while( position < key ) {
+            *(smath::vec3*)Core::PushRecord( &writer ) = smath::normalize( sum );
+            sum = smath::vec3();
+            position++;
+        }
+        if( !contribution ) {
+            break;
+        }
+        sum = sum + contribution->value;
+    }
+    Core::CloseRecordReader( &contributions );
+    return Core::CloseRecordWriter( &writer ) && success;
+}
+
+/// @brief Weld corners of every group into vertices.
+/// Writes a vertex record for every vertex and an index record for every corner
+/// @param subMeshes [in/out] sub-meshes with index ranges, vertex ranges are filled in
+/// @param vertexCount [out] total number of vertices
+/// @return true if successful
+static bool StreamWeld(
+    const Core::OBJStreamData* data, const StreamPaths* paths,
+    bool generatedNormals, usize memoryBudget,
+    Core::SubMesh* subMeshes, usize* vertexCount
+) {
+    usize bufferSize = memoryBudget / 4;
+
+    Core::RecordReader corners = {};
+    Core::RecordWriter writer  = {};
+    if( !Core::OpenRecordReader( data->cornerPath, sizeof(Core::OBJCorner), bufferSize, &corners ) ) {
+        return false;
+    }
+    if( !Core::CreateRecordWriter( paths->records, sizeof(StreamWeldRecord), bufferSize, &writer ) ) {
+        Core::CloseRecordReader( &corners );
+        return false;
+    }
+    usize cornerIndex = 0;
+    usize group = 0;
+    while( const Core::OBJCorner* corner = (const Core::OBJCorner*)Core::NextRecord( &corners ) ) {
+        while( cornerIndex >= data->groups[group].firstCorner + data->groups[group].cornerCount ) {
+            group++;
+        }
+        // NOTE(alicia): indices past the end of their stream are treated as missing
+        StreamWeldRecord* record = (StreamWeldRecord*)Core::PushRecord( &writer );
+        record->key    = ( (u64)group << 32 ) | (u64)(u32)corner->position;
+        record->uv     = (usize)corner->uv < data->uvCount ? corner->uv : -1;
+        record->normal = (usize)corner->normal < data->normalCount ? corner->normal : -1;
+        if( record->normal < 0 && generatedNormals ) {
+            record->normal = (i32)( data->normalCount + (usize)corner->position );
+        }
+        record->corner = cornerIndex++;
+    }
+    Core::CloseRecordReader( &corners );
+    if(
+        !Core::CloseRecordWriter( &writer ) ||
+        !Core::SortRecords( paths->records, paths->scratch, sizeof(StreamWeldRecord), memoryBudget )
+    ) {
+        return false;
+    }
+
+    // corners of the same group and position are next to each other
+    Core::RecordReader welds = {};
+    Core::RecordWriter vertices = {};
+    bool success =
+        Core::OpenRecordReader( paths->records, sizeof(StreamWeldRecord), bufferSize, &welds ) &&
+        Core::CreateRecordWriter( paths->vertices, sizeof(StreamVertexRecord), bufferSize, &vertices ) &&
+        Core::CreateRecordWriter( paths->indices, sizeof(StreamIndexRecord), bufferSize, &writer );
+
+    struct {
+        i32 uv;
+        i32 normal;
+        u32 index;
+    } positionVertices[MESH_STREAM_MAX_POSITION_VERTICES];
+    usize positionVertexCount = 0;
+    u64 currentKey   = U64::MAX;
+    usize currentGroup = U32::MAX;
+    usize baseVertex = 0;
+    u32 groupVertexCount = 0;
+    while( success ) {
+        const StreamWeldRecord* weld = (const StreamWeldRecord*)Core::NextRecord( &welds );
+        usize weldGroup = weld ? (usize)( weld->key >> 32 ) : data->groupCount;
+        if( weldGroup != currentGroup ) {
+            if( currentGroup != U32::MAX ) {
+                subMeshes[currentGroup].vertexCount = groupVertexCount;
+                baseVertex += groupVertexCount;
+            }
+            if( !weld ) {
+                break;
+            }
+            subMeshes[weldGroup].baseVertex = (u32)baseVertex;
+            currentGroup     = weldGroup;
+            groupVertexCount = 0;
+        }
+        if( weld->key != currentKey ) {
+            currentKey = weld->key;
+            positionVertexCount = 0;
+        }
+
+        u32 index = U32::MAX;
+        ucycles( positionVertexCount ) {
+            if( positionVertices[i].uv == weld->uv && positionVertices[i].normal == weld->normal ) {
+                index = positionVertices[i].index;
+                break;
+            }
+        }
+        if( index == U32::MAX ) {
+            index = groupVertexCount++;
+            if( positionVertexCount < MESH_STREAM_MAX_POSITION_VERTICES ) {
+                positionVertices[positionVertexCount].uv     = weld->uv;
+                positionVertices[positionVertexCount].normal = weld->normal;
+                positionVertices[positionVertexCount].index  = index;
+                positionVertexCount++;
+            }
+            StreamVertexRecord* vertex = (StreamVertexRecord*)Core::PushRecord( &vertices );
+            *vertex = {};
+            vertex->position = (i32)( weld->key & U32::MAX );
+            vertex->key      = (u64)vertex->position;
+            vertex->vertex   = (u32)( baseVertex + index );
+            vertex->uv       = weld->uv;
+            vertex->normal   = weld->normal;
+        }
+
+        StreamIndexRecord* record = (StreamIndexRecord*)Core::PushRecord( &writer );
+        record->corner  = weld->corner;
+        record->index   = index;
+        record->padding = 0;
+    }
+    Core::CloseRecordReader( &welds );
+    bool verticesClosed = Core::CloseRecordWriter( &vertices );
+    bool indicesClosed  = Core::CloseRecordWriter( &writer );
+    *vertexCount = baseVertex;
+    return success && verticesClosed && indicesClosed;
+}
+
+enum class StreamAttribute {
+    POSITION,
+    UV,
+    NORMAL,
+};
+
+/// @brief Look up one attribute of every vertex, then key vertices by the index of the next one.
+/// Positions are followed by uvs, uvs by normals and normals by the vertex index
+/// @param boundsMin,boundsMax [out] bounds of vertex positions, only for positions
+/// @return true if successful
+static bool StreamResolveAttribute(
+    const Core::OBJStreamData* data, const StreamPaths* paths,
+    const char* sourcePath, const char* destinationPath,
+    StreamAttribute attribute, usize memoryBudget,
+    smath::vec3* boundsMin, smath::vec3* boundsMax
+) {
+    if( !Core::SortRecords( sourcePath, paths->scratch, sizeof(StreamVertexRecord), memoryBudget ) ) {
+        return false;
+    }
+
+    usize bufferSize = memoryBudget / 4;
+    Core::RecordReader vertices = {};
+    Core::RecordWriter writer   = {};
+    StreamLookup lookup    = {};
+    StreamLookup generated = {};
+    bool success =
+        Core::OpenRecordReader( sourcePath, sizeof(StreamVertexRecord), bufferSize, &vertices ) &&
+        Core::CreateRecordWriter( destinationPath, sizeof(StreamVertexRecord), bufferSize, &writer );
+    switch( attribute ) {
+        case StreamAttribute::POSITION: {
+            success = success && StreamOpenLookup( data->positionPath, sizeof(smath::vec3), bufferSize, &lookup );
+        } break;
+        case StreamAttribute::UV: {
+            success = success && StreamOpenLookup( data->uvPath, sizeof(smath::vec2), bufferSize, &lookup );
+        } break;
+        case StreamAttribute::NORMAL: {
+            // NOTE(alicia): generated normals are indexed after the normals of the file
+            success = success && StreamOpenLookup( data->normalPath, sizeof(smath::vec3), bufferSize / 2, &lookup );
+            if( success && data->missingNormalCount > 0 ) {
+                success = StreamOpenLookup( paths->generatedNormals, sizeof(smath::vec3), bufferSize / 2, &generated );
+            }
+        } break;
+    }
+
+    bool firstPosition = true;
+    while( success ) {
+        const StreamVertexRecord* source = (const StreamVertexRecord*)Core::NextRecord( &vertices );
+        if( !source ) {
+            break;
+        }
+        StreamVertexRecord* vertex = (StreamVertexRecord*)Core::PushRecord( &writer );
+        *vertex = *source;
+        switch( attribute ) {
+            case StreamAttribute::POSITION: {
+                const smath::vec3* position = (const smath::vec3*)StreamLookupAt( &lookup, (usize)vertex->position );
+                vertex->value.position = position ? *position : smath::vec3();
+                if( firstPosition ) {
+                    *boundsMin = vertex->value.position;
+                    *boundsMax = vertex->value.position;
+                    firstPosition = false;
+                }
+                ucyclesi( 3, axis ) {
+                    if( vertex->value.position[axis] < (*boundsMin)[axis] ) {
+                        (*boundsMin)[axis] = vertex->value.position[axis];
+                    }
+                    if( vertex->value.position[axis] > (*boundsMax)[axis] ) {
+                        (*boundsMax)[axis] = vertex->value.position[axis];
+                    }
+                }
+                vertex->key = vertex->uv >= 0 ? (u64)vertex->uv : U64::MAX;
+            } break;
+            case StreamAttribute::UV: {
+                const smath::vec2* uv = nullptr;
+                if( vertex->uv >= 0 ) {
+                    uv = (const smath::vec2*)StreamLookupAt( &lookup, (usize)vertex->uv );
+                }
+                if( uv ) {
+                    vertex->value.uv = *uv;
+                } else {
+                    vertex->value.uv.x = vertex->value.position.x;
+                    vertex->value.uv.y = vertex->value.position.y;
+                }
+                vertex->key = vertex->normal >= 0 ? (u64)vertex->normal : U64::MAX;
+            } break;
+            case StreamAttribute::NORMAL: {
+                const smath::vec3* normal = nullptr;
+                if( vertex->normal >= 0 && (usize)vertex->normal < data->normalCount ) {
+                    normal = (const smath::vec3*)StreamLookupAt( &lookup, (usize)vertex->normal );
+                } else if( vertex->normal >= 0 && generated.reader.buffer ) {
+                    normal = (const smath::vec3*)StreamLookupAt( &generated, (usize)vertex->normal - data->normalCount );
+                }
+                vertex->value.normal = normal ? *normal : smath::normalize( vertex->value.position );
+                vertex->key = vertex->vertex;
+            } break;
+        }
+    }
+
+    Core::CloseRecordReader( &vertices );
+    Core::CloseRecordReader( &lookup.reader );
+    Core::CloseRecordReader( &generated.reader );
+    return Core::CloseRecordWriter( &writer ) && success;
+}
+
+/// @brief Write vertices, indices, sub-meshes, material names and header to mesh cache file.
+/// Header is written last so a partially written file is never valid
+/// @return true if successful
+static bool StreamWriteCache(
+    const StreamPaths* paths, const char* verticesPath,
+    u64 sourceHash, usize sourceSize, u32 flags,
+    usize subMeshCount, const Core::SubMesh* subMeshes,
+    const Core::MeshMaterialNames* materialNames,
+    usize vertexCount, usize indexCount,
+    const smath::vec3& boundsMin, const smath::vec3& boundsMax,
+    usize memoryBudget
+) {
+    bool packed = ( flags & MESH_CACHE_FLAG_PACKED ) != 0;
+    Platform::VertexBufferLayout layout = packed ? Core::packedVertexLayout() : Core::vertexLayout();
+    Platform::DataType indexDataType = Platform::DataType::UNSIGNED_SHORT;
+    ucycles( subMeshCount ) {
+        if( subMeshes[i].vertexCount > (u32)U16::MAX + 1 ) {
+            indexDataType = Platform::DataType::UNSIGNED_INT;
+        }
+    }
+    Core::MeshCacheHeader header;
+    Core::CreateMeshCacheHeader(
+        sourceHash, sourceSize, flags,
+        &layout, vertexCount,
+        indexDataType, indexCount,
+        subMeshCount, 0,
+        materialNames,
+        boundsMin, boundsMax,
+        &header
+    );
+    Platform::FreeVertexBufferLayout( &layout );
+
+    char path[CACHE_PATH_MAX_LEN];
+    Core::CachePath( sourceHash, ".mvmesh", CACHE_PATH_MAX_LEN, path );
+    if(
+        !Core::SortRecords( verticesPath, paths->scratch, sizeof(StreamVertexRecord), memoryBudget ) ||
+        !Core::SortRecords( paths->indices, paths->scratch, sizeof(StreamIndexRecord), memoryBudget )
+    ) {
+        return false;
+    }
+
+    usize bufferSize = memoryBudget / 4;
+    usize chunkCapacity = bufferSize / sizeof(Core::vertex);
+    Core::vertex* chunk = (Core::vertex*)Platform::Alloc( chunkCapacity * sizeof(Core::vertex) );
+    Core::packedVertex* packedChunk = nullptr;
+    if( packed ) {
+        packedChunk = (Core::packedVertex*)Platform::Alloc( chunkCapacity * sizeof(Core::packedVertex) );
+    }
+    if( !chunk || ( packed && !packedChunk ) ) {
+        LOG_ERROR( "WriteStreamedMeshCache > Failed to allocate write buffers!" );
+        if( chunk ) {
+            Platform::Free( chunk );
+        }
+        if( packedChunk ) {
+            Platform::Free( packedChunk );
+        }
+        return false;
+    }
+
+    Platform::FileStream file = {};
+    bool success = Platform::OpenFileStream( path, Platform::FileStreamMode::WRITE, &file );
+
+    // vertices in vertex order
+    Core::RecordReader reader = {};
+    success = success && Core::OpenRecordReader( verticesPath, sizeof(StreamVertexRecord), bufferSize, &reader );
+    usize offset = header.vertexOffset;
+    usize chunkCount = 0;
+    while( success ) {
+        const StreamVertexRecord* vertex = (const StreamVertexRecord*)Core::NextRecord( &reader );
+        if( vertex ) {
+            chunk[chunkCount] = vertex->value;
+            chunk[chunkCount].tangent = StreamTangent( vertex->value.normal );
+            chunkCount++;
+        }
+        if( chunkCount == chunkCapacity || ( !vertex && chunkCount > 0 ) ) {
+            if( packed ) {
+                Core::packVertices( chunkCount, chunk, boundsMin, boundsMax, packedChunk );
+                success = Platform::WriteFileStream( &file, offset, chunkCount * sizeof(Core::packedVertex), packedChunk );
+                offset += chunkCount * sizeof(Core::packedVertex);
+            } else {
+                success = Platform::WriteFileStream( &file, offset, chunkCount * sizeof(Core::vertex), chunk );
+                offset += chunkCount * sizeof(Core::vertex);
+            }
+            chunkCount = 0;
+        }
+        if( !vertex ) {
+            break;
+        }
+    }
+    Core::CloseRecordReader( &reader );
+    success = success && offset == header.vertexOffset + header.vertexSize;
+
+    // indices in corner order, vertex chunk is reused as index buffer
+    success = success && Core::OpenRecordReader( paths->indices, sizeof(StreamIndexRecord), bufferSize, &reader );
+    usize indexSize     = Platform::DataTypeSize( indexDataType );
+    usize indexCapacity = ( chunkCapacity * sizeof(Core::vertex) ) / indexSize;
+    u8* indexChunk = (u8*)chunk;
+    offset = header.indexOffset;
+    chunkCount = 0;
+    while( success ) {
+        const StreamIndexRecord* index = (const StreamIndexRecord*)Core::NextRecord( &reader );
+        if( index ) {
+            if( indexDataType == Platform::DataType::UNSIGNED_SHORT ) {
+                ((u16*)indexChunk)[chunkCount] = (u16)index->index;
+            } else {
+                ((u32*)indexChunk)[chunkCount] = index->index;
+            }
+            chunkCount++;
+        }
+        if( chunkCount == indexCapacity || ( !index && chunkCount > 0 ) ) {
+            success = Platform::WriteFileStream( &file, offset, chunkCount * indexSize, indexChunk );
+            offset += chunkCount * indexSize;
+            chunkCount = 0;
+        }
+        if( !index ) {
+            break;
+        }
+    }
+    Core::CloseRecordReader( &reader );
+    success = success && offset == header.indexOffset + header.indexSize;
+
+    success =
+        success &&
+        Platform::WriteFileStream( &file, header.subMeshOffset, header.subMeshSize, subMeshes ) &&
+        Platform::WriteFileStream( &file, header.materialNameOffset, header.materialNameSize, materialNames->text ) &&
+        Platform::WriteFileStream( &file, 0, sizeof(Core::MeshCacheHeader), &header );
+
+    Platform::CloseFileStream( &file );
+    Platform::Free( chunk );
+    if( packedChunk ) {
+        Platform::Free( packedChunk );
+    }
+    if( success ) {
+        LOG_INFO( "MeshCache > Wrote \"%s\"", path );
+    } else {
+        LOG_WARN( "MeshCache > Failed to write \"%s\"", path );
+        Platform::RemoveFile( path );
+    }
+    return success;
+}
+
+bool Core::WriteStreamedMeshCache(
+    const OBJStreamData* data,
+    u64 sourceHash, usize sourceSize, u32 flags,
+    usize memoryBudget
+) {
+    u64 startTime = Platform::GetPerformanceCounter();
+
+    if( data->cornerCount > (usize)U32::MAX ) {
+        LOG_ERROR( "WriteStreamedMeshCache > Mesh has too many corners! %llu", data->cornerCount );
+        return false;
+    }
+
+    SubMesh* subMeshes = (SubMesh*)Platform::Alloc( data->groupCount * sizeof(SubMesh) );
+    if( !subMeshes ) {
+        LOG_ERROR( "WriteStreamedMeshCache > Failed to allocate sub-meshes!" );
+        return false;
+    }
+    ucycles( data->groupCount ) {
+        subMeshes[i].firstIndex = (u32)data->groups[i].firstCorner;
+        subMeshes[i].indexCount = (u32)data->groups[i].cornerCount;
+        subMeshes[i].material   = data->groups[i].material;
+    }
+
+    StreamPaths paths;
+    CachePath( sourceHash, ".scratch.tmp",   CACHE_PATH_MAX_LEN, paths.scratch );
+    CachePath( sourceHash, ".records.tmp",   CACHE_PATH_MAX_LEN, paths.records );
+    CachePath( sourceHash, ".vertices.tmp",  CACHE_PATH_MAX_LEN, paths.vertices );
+    CachePath( sourceHash, ".indices.tmp",   CACHE_PATH_MAX_LEN, paths.indices );
+    CachePath( sourceHash, ".generated.tmp", CACHE_PATH_MAX_LEN, paths.generatedNormals );
+
+    bool generatedNormals = data->missingNormalCount > 0;
+    usize vertexCount = 0;
+    smath::vec3 boundsMin, boundsMax;
+    // NOTE(alicia): vertex records move between vertices and records files with every lookup
+    bool success =
+        ( !generatedNormals || StreamGenerateNormals( data, &paths, memoryBudget ) ) &&
+        StreamWeld( data, &paths, generatedNormals, memoryBudget, subMeshes, &vertexCount ) &&
+        StreamResolveAttribute( data, &paths, paths.vertices, paths.records, StreamAttribute::POSITION, memoryBudget, &boundsMin, &boundsMax ) &&
+        StreamResolveAttribute( data, &paths, paths.records, paths.vertices, StreamAttribute::UV, memoryBudget, &boundsMin, &boundsMax ) &&
+        StreamResolveAttribute( data, &paths, paths.vertices, paths.records, StreamAttribute::NORMAL, memoryBudget, &boundsMin, &boundsMax ) &&
+        StreamWriteCache(
+            &paths, paths.records,
+            sourceHash, sourceSize, flags,
+            data->groupCount, subMeshes,
+            &data->materialNames,
+            vertexCount, data->cornerCount,
+            boundsMin, boundsMax,
+            memoryBudget
+        );
+
+    const char* temporaryPaths[] = { paths.scratch, paths.records, paths.vertices, paths.indices, paths.generatedNormals };
+    ucycles( 5 ) {
+        Platform::RemoveFile( temporaryPaths[i] );
+    }
+    Platform::Free( subMeshes );
+    if( !success ) {
+        LOG_ERROR( "WriteStreamedMeshCache > Failed to build mesh!" );
+        return false;
+    }
+
+    f64 elapsedSeconds = (f64)( Platform::GetPerformanceCounter() - startTime ) /
+        (f64)Platform::GetPerformanceFrequency();
+    LOG_INFO( "WriteStreamedMeshCache > Built %llu vertices %llu triangles %llu sub-meshes out-of-core in %.3fs with a %.1fMB budget",
+        vertexCount,
+        data->cornerCount / 3,
+        data->groupCount,
+        elapsedSeconds,
+        (f64)memoryBudget / (f64)MEGABYTES(1)
+    );
+    return true;
+}
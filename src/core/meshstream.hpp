@@ -0,0 +1,36 @@
+/**
+ * Description:  Out-of-core mesh building
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "pch.hpp"
+
+namespace Core {
+
+// forward declaration
+struct OBJStreamData;
+
+/// @brief Distinct uv and normal pairs remembered per position while welding,
+/// corners past this many get their own vertex
+#define MESH_STREAM_MAX_POSITION_VERTICES 64
+
+/// @brief Build indexed mesh from spilled obj streams straight into a mesh cache file.
+/// Missing normals are generated from angle-weighted face normals, corners of a group that
+/// share position, uv and normal are welded, then attributes are looked up one stream at a time.
+/// Every step is a sequential pass over record files joined with external sorts,
+/// so memory use doesn't depend on mesh size.
+/// Mesh isn't optimized and has no levels or meshlets, tangents are only orthogonal to normals
+/// @param data spilled obj streams
+/// @param sourceHash content hash of source file
+/// @param sourceSize size of source file
+/// @param flags mesh cache flags, only MESH_CACHE_FLAG_PACKED is used
+/// @param memoryBudget maximum number of bytes held in memory by any pass
+/// @return true if cache file was written
+bool WriteStreamedMeshCache(
+    const OBJStreamData* data,
+    u64 sourceHash, usize sourceSize, u32 flags,
+    usize memoryBudget
+);
+
+} // namespace Core
@@ -0,0 +1,450 @@
+/**
+ * Description:  Smooth normal generation
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "core/normals.hpp"
+#include "core/obj.hpp"
+#include "core/mesh.hpp"
+#include "core/renderex.hpp"
+#include "core/jobs.hpp"
+#include "platform/io.hpp"
+
+/// @brief Triangle range of face normal pass
+struct NormalFaceChunk {
+    const Core::OBJCorner* corners;
+    const smath::vec3* positions;
+    usize firstTriangle;
+    usize triangleCount;
+    /// @brief [out] unit normal of every triangle, zero if triangle has no area
+    smath::vec3* faceNormals;
+    /// @brief [out] angle of every corner
+    f32* cornerAngles;
+};
+
+/// @brief Position range of group and resolve passes
+struct NormalPositionChunk {
+    Core::OBJCorner* corners;
+    /// @brief Corners without normal sorted by position,
+    /// corners of position p are in range positionOffsets[p] to positionOffsets[p + 1]
+    const u32* positionCorners;
+    const u32* positionOffsets;
+    usize firstPosition;
+    usize positionCount;
+    const smath::vec3* faceNormals;
+    const f32* cornerAngles;
+    bool crease;
+    f32 creaseCosine;
+    /// @brief Seed normal of every group, room for largest number of corners at a position
+    smath::vec3* seeds;
+    /// @brief Group pass writes number of groups of every position,
+    /// resolve pass reads first generated normal of every position
+    u32* normalOffsets;
+    smath::vec3* normals;
+    u32 firstNormal;
+};
+
+static void NormalFaceJob( void* params ) {
+    NormalFaceChunk* chunk = (NormalFaceChunk*)params;
+    const smath::vec3* positions = chunk->positions;
+
+    for( usize first = 0; first < chunk->triangleCount; first += 4 ) {
+        usize laneCount = chunk->triangleCount - first < 4 ? chunk->triangleCount - first : 4;
+
+        // NOTE(alicia): missing lanes repeat the last triangle and are never stored
+        i32 corners[3][4];
+        ucycles( 4 ) {
+            usize lane = i < laneCount ? i : laneCount - 1;
+            const Core::OBJCorner* triangle = chunk->corners + ( chunk->firstTriangle + first + lane ) * 3;
+            corners[0][i] = triangle[0].position;
+            corners[1][i] = triangle[1].position;
+            corners[2][i] = triangle[2].position;
+        }
+
+        #define NORMAL_LOAD( corner, component ) _mm_setr_ps(\
+            positions[corners[corner][0]].component, positions[corners[corner][1]].component,\
+            positions[corners[corner][2]].component, positions[corners[corner][3]].component )
+
+        __m128 px[3], py[3], pz[3];
+        ucycles( 3 ) {
+            px[i] = NORMAL_LOAD( i, x );
+            py[i] = NORMAL_LOAD( i, y );
+            pz[i] = NORMAL_LOAD( i, z );
+        }
+
+        #undef NORMAL_LOAD
+
+        // NOTE(alicia): SSE
+        __m128 e1x = _mm_sub_ps( px[1], px[0] ), e1y = _mm_sub_ps( py[1], py[0] ), e1z = _mm_sub_ps( pz[1], pz[0] );
+        __m128 e2x = _mm_sub_ps( px[2], px[0] ), e2y = _mm_sub_ps( py[2], py[0] ), e2z = _mm_sub_ps( pz[2], pz[0] );
+        __m128 nx = _mm_sub_ps( _mm_mul_ps( e1y, e2z ), _mm_mul_ps( e1z, e2y ) );
+        __m128 ny = _mm_sub_ps( _mm_mul_ps( e1z, e2x ), _mm_mul_ps( e1x, e2z ) );
+        __m128 nz = _mm_sub_ps( _mm_mul_ps( e1x, e2y ), _mm_mul_ps( e1y, e2x ) );
+        __m128 lengthSqr = _mm_add_ps( _mm_add_ps( _mm_mul_ps( nx, nx ), _mm_mul_ps( ny, ny ) ), _mm_mul_ps( nz, nz ) );
+        // NOTE(alicia): triangles without area would divide by zero, their normal is zero
+        __m128 hasArea = _mm_cmpgt_ps( lengthSqr, _mm_setzero_ps() );
+        __m128 inverseLength = _mm_and_ps( hasArea, _mm_div_ps( _mm_set1_ps( 1.0f ), _mm_sqrt_ps( lengthSqr ) ) );
+        nx = _mm_mul_ps( nx, inverseLength );
+        ny = _mm_mul_ps( ny, inverseLength );
+        nz = _mm_mul_ps( nz, inverseLength );
+
+        f32 angles[3][4];
+        ucyclesi( 3, corner ) {
+            usize next     = ( corner + 1 ) % 3;
+            usize previous = ( corner + 2 ) % 3;
+            __m128 ax = _mm_sub_ps( px[next], px[corner] ), ay = _mm_sub_ps( py[next], py[corner] ), az = _mm_sub_ps( pz[next], pz[corner] );
+            __m128 cx = _mm_sub_ps( px[previous], px[corner] ), cy = _mm_sub_ps( py[previous], py[corner] ), cz = _mm_sub_ps( pz[previous], pz[corner] );
+            __m128 dot = _mm_add_ps( _mm_add_ps( _mm_mul_ps( ax, cx ), _mm_mul_ps( ay, cy ) ), _mm_mul_ps( az, cz ) );
+            __m128 edgeLengthSqr = _mm_mul_ps(
+                _mm_add_ps( _mm_add_ps( _mm_mul_ps( ax, ax ), _mm_mul_ps( ay, ay ) ), _mm_mul_ps( az, az ) ),
+                _mm_add_ps( _mm_add_ps( _mm_mul_ps( cx, cx ), _mm_mul_ps( cy, cy ) ), _mm_mul_ps( cz, cz ) )
+            );
+            __m128 hasAngle = _mm_and_ps( hasArea, _mm_cmpgt_ps( edgeLengthSqr, _mm_setzero_ps() ) );
+            __m128 cosine = _mm_and_ps( hasAngle, _mm_div_ps( dot, _mm_sqrt_ps( edgeLengthSqr ) ) );
+            _mm_storeu_ps( angles[corner], _mm_and_ps( hasAngle, smath::acos4( cosine ) ) );
+        }
+
+        f32 normals[3][4];
+        _mm_storeu_ps( normals[0], nx );
+        _mm_storeu_ps( normals[1], ny );
+        _mm_storeu_ps( normals[2], nz );
+        ucyclesi( laneCount, lane ) {
+            usize triangle = chunk->firstTriangle + first + lane;
+            chunk->faceNormals[triangle] = smath::vec3( normals[0][lane], normals[1][lane], normals[2][lane] );
+            ucyclesi( 3, corner ) {
+                chunk->cornerAngles[triangle * 3 + corner] = angles[corner][lane];
+            }
+        }
+    }
+}
+
+/// @brief Split faces around every position into groups,
+/// local group index is written to corner normal index
+static void NormalGroupJob( void* params ) {
+    NormalPositionChunk* chunk = (NormalPositionChunk*)params;
+
+    ucyclesi( chunk->positionCount, positionIndex ) {
+        usize position = chunk->firstPosition + positionIndex;
+        u32 first = chunk->positionOffsets[position];
+        u32 last  = chunk->positionOffsets[position + 1];
+        if( first == last ) {
+            chunk->normalOffsets[position] = 0;
+            continue;
+        }
+        if( !chunk->crease ) {
+            for( u32 i = first; i < last; ++i ) {
+                chunk->corners[chunk->positionCorners[i]].normal = 0;
+            }
+            chunk->normalOffsets[position] = 1;
+            continue;
+        }
+
+        u32 groupCount = 0;
+        bool hasDegenerate = false;
+        for( u32 i = first; i < last; ++i ) {
+            u32 corner = chunk->positionCorners[i];
+            const smath::vec3& faceNormal = chunk->faceNormals[corner / 3];
+            if( faceNormal.x == 0.0f && faceNormal.y == 0.0f && faceNormal.z == 0.0f ) {
+                hasDegenerate = true;
+                continue;
+            }
+            u32 group = 0;
+            while( group < groupCount && smath::dot( chunk->seeds[group], faceNormal ) < chunk->creaseCosine ) {
+                group++;
+            }
+            if( group == groupCount ) {
+                chunk->seeds[groupCount++] = faceNormal;
+            }
+            chunk->corners[corner].normal = (i32)group;
+        }
+        // NOTE(alicia): faces without area have no direction, they join the first group
+        if( hasDegenerate ) {
+            for( u32 i = first; i < last; ++i ) {
+                u32 corner = chunk->positionCorners[i];
+                const smath::vec3& faceNormal = chunk->faceNormals[corner / 3];
+                if( faceNormal.x == 0.0f && faceNormal.y == 0.0f && faceNormal.z == 0.0f ) {
+                    chunk->corners[corner].normal = 0;
+                }
+            }
+            if( groupCount == 0 ) {
+                groupCount = 1;
+            }
+        }
+        chunk->normalOffsets[position] = groupCount;
+    }
+}
+
+/// @brief Sum angle weighted face normals of every group and point corners at them
+static void NormalResolveJob( void* params ) {
+    NormalPositionChunk* chunk = (NormalPositionChunk*)params;
+
+    ucyclesi( chunk->positionCount, positionIndex ) {
+        usize position = chunk->firstPosition + positionIndex;
+        u32 first = chunk->positionOffsets[position];
+        u32 last  = chunk->positionOffsets[position + 1];
+        u32 firstNormal = chunk->normalOffsets[position];
+        u32 lastNormal  = chunk->normalOffsets[position + 1];
+
+        for( u32 i = firstNormal; i < lastNormal; ++i ) {
+            chunk->normals[i] = smath::vec3( 0.0f );
+        }
+        for( u32 i = first; i < last; ++i ) {
+            u32 corner = chunk->positionCorners[i];
+            u32 normal = firstNormal + (u32)chunk->corners[corner].normal;
+            chunk->normals[normal] = chunk->normals[normal] +
+                chunk->faceNormals[corner / 3] * chunk->cornerAngles[corner];
+            chunk->corners[corner].normal = (i32)( chunk->firstNormal + normal );
+        }
+        for( u32 i = firstNormal; i < lastNormal; ++i ) {
+            f32 length = smath::mag( chunk->normals[i] );
+            chunk->normals[i] = length > F32::EPSILON ?
+                chunk->normals[i] / length : smath::vec3::up();
+        }
+    }
+}
+
+/// @brief Find first position whose corners start at or after given corner
+static usize NormalFindPosition( usize positionCount, const u32* positionOffsets, u32 corner ) {
+    usize low  = 0;
+    usize high = positionCount;
+    while( low < high ) {
+        usize middle = ( low + high ) / 2;
+        if( positionOffsets[middle] < corner ) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+/// @brief Run job for every chunk and wait for them
+static void NormalRunJobs(
+    Core::JobQueue* queue, Core::JobFN job,
+    usize chunkCount, usize chunkSize, void* chunks
+) {
+    if( chunkCount == 1 ) {
+        job( chunks );
+        return;
+    }
+    Core::JobCounter counter = {};
+    ucycles( chunkCount ) {
+        Core::PushJob( queue, job, (u8*)chunks + i * chunkSize, &counter );
+    }
+    Core::WaitForJobs( queue, &counter );
+}
+
+bool Core::GenerateOBJNormals( OBJData* data, f32 creaseAngle, JobQueue* queue ) {
+    if( data->cornerCount > (usize)U32::MAX ) {
+        LOG_ERROR( "GenerateOBJNormals > Mesh has too many corners! %llu", data->cornerCount );
+        return false;
+    }
+    usize missingCount = 0;
+    ucycles( data->cornerCount ) {
+        missingCount += data->corners[i].normal < 0;
+    }
+    if( missingCount == 0 ) {
+        return true;
+    }
+
+    usize triangleCount = data->cornerCount / 3;
+    usize chunkCount = queue ? JobQueueThreadCount( queue ) : 1;
+    if( chunkCount > NORMAL_MAX_JOBS ) {
+        chunkCount = NORMAL_MAX_JOBS;
+    }
+    if( chunkCount > triangleCount / NORMAL_MIN_JOB_TRIANGLES ) {
+        chunkCount = triangleCount / NORMAL_MIN_JOB_TRIANGLES;
+    }
+    if( chunkCount == 0 ) {
+        chunkCount = 1;
+    }
+
+    smath::vec3* faceNormals = (smath::vec3*)Platform::Alloc( triangleCount * sizeof(smath::vec3) );
+    f32* cornerAngles        = (f32*)Platform::Alloc( data->cornerCount * sizeof(f32) );
+    u32* positionOffsets     = (u32*)Platform::Alloc( ( data->positionCount + 1 ) * sizeof(u32) );
+    u32* positionCorners     = (u32*)Platform::Alloc( missingCount * sizeof(u32) );
+    u32* normalOffsets       = (u32*)Platform::Alloc( ( data->positionCount + 1 ) * sizeof(u32) );
+    bool success = faceNormals && cornerAngles && positionOffsets && positionCorners && normalOffsets;
+
+    // NOTE(alicia): bucket corners without normal by position,
+    // a single pass over corners that is bound by memory bandwidth
+    u32 maxValence = 0;
+    if( success ) {
+        ucycles( data->cornerCount ) {
+            const OBJCorner& corner = data->corners[i];
+            if( corner.normal < 0 ) {
+                positionOffsets[corner.position + 1]++;
+            }
+        }
+        ucycles( data->positionCount ) {
+            u32 valence = positionOffsets[i + 1];
+            maxValence = valence > maxValence ? valence : maxValence;
+            positionOffsets[i + 1] += positionOffsets[i];
+        }
+        // NOTE(alicia): offsets are advanced while filling and shifted back after
+        ucycles( data->cornerCount ) {
+            const OBJCorner& corner = data->corners[i];
+            if( corner.normal < 0 ) {
+                positionCorners[positionOffsets[corner.position]++] = (u32)i;
+            }
+        }
+        for( usize i = data->positionCount; i > 0; --i ) {
+            positionOffsets[i] = positionOffsets[i - 1];
+        }
+        positionOffsets[0] = 0;
+    }
+
+    bool crease = creaseAngle > 0.0f;
+    smath::vec3* seeds = nullptr;
+    if( success && crease ) {
+        seeds = (smath::vec3*)Platform::Alloc( chunkCount * maxValence * sizeof(smath::vec3) );
+        success = seeds != nullptr;
+    }
+    if( !success ) {
+        LOG_ERROR( "GenerateOBJNormals > Failed to allocate buffers!" );
+    }
+
+    NormalFaceChunk faceChunks[NORMAL_MAX_JOBS];
+    NormalPositionChunk positionChunks[NORMAL_MAX_JOBS];
+    if( success ) {
+        usize trianglesPerChunk = ( triangleCount + chunkCount - 1 ) / chunkCount;
+        ucycles( chunkCount ) {
+            NormalFaceChunk* chunk = &faceChunks[i];
+            chunk->corners       = data->corners;
+            chunk->positions     = data->positions;
+            chunk->firstTriangle = i * trianglesPerChunk < triangleCount ? i * trianglesPerChunk : triangleCount;
+            chunk->triangleCount = triangleCount - chunk->firstTriangle < trianglesPerChunk ?
+                triangleCount - chunk->firstTriangle : trianglesPerChunk;
+            chunk->faceNormals   = faceNormals;
+            chunk->cornerAngles  = cornerAngles;
+        }
+
+        // NOTE(alicia): position ranges are split so every chunk gets about the same number of corners
+        usize firstPosition = 0;
+        ucycles( chunkCount ) {
+            usize lastPosition = i + 1 == chunkCount ? data->positionCount : NormalFindPosition(
+                data->positionCount, positionOffsets, (u32)( missingCount * ( i + 1 ) / chunkCount )
+            );
+            NormalPositionChunk* chunk = &positionChunks[i];
+            *chunk = {};
+            chunk->corners         = data->corners;
+            chunk->positionCorners = positionCorners;
+            chunk->positionOffsets = positionOffsets;
+            chunk->firstPosition   = firstPosition;
+            chunk->positionCount   = lastPosition - firstPosition;
+            chunk->faceNormals     = faceNormals;
+            chunk->cornerAngles    = cornerAngles;
+            chunk->crease          = crease;
+            chunk->creaseCosine    = crease ? smath::cos( creaseAngle ) : -1.0f;
+            chunk->seeds           = seeds ? seeds + i * maxValence : nullptr;
+            chunk->normalOffsets   = normalOffsets;
+            chunk->firstNormal     = (u32)data->normalCount;
+            firstPosition = lastPosition;
+        }
+
+        NormalRunJobs( queue, NormalFaceJob, chunkCount, sizeof(NormalFaceChunk), faceChunks );
+        NormalRunJobs( queue, NormalGroupJob, chunkCount, sizeof(NormalPositionChunk), positionChunks );
+    }
+
+    smath::vec3* normals = nullptr;
+    usize generatedCount = 0;
+    if( success ) {
+        u32 offset = 0;
+        ucycles( data->positionCount ) {
+            u32 groupCount = normalOffsets[i];
+            normalOffsets[i] = offset;
+            offset += groupCount;
+        }
+        normalOffsets[data->positionCount] = offset;
+        generatedCount = offset;
+
+        normals = (smath::vec3*)Platform::Alloc( ( data->normalCount + generatedCount ) * sizeof(smath::vec3) );
+        if( !normals ) {
+            LOG_ERROR( "GenerateOBJNormals > Failed to allocate normals!" );
+            ucycles( missingCount ) {
+                data->corners[positionCorners[i]].normal = -1;
+            }
+            success = false;
+        }
+    }
+
+    if( success ) {
+        if( data->normals ) {
+            Platform::MemCopy( data->normalCount * sizeof(smath::vec3), data->normals, normals );
+            Platform::Free( data->normals );
+        }
+        ucycles( chunkCount ) {
+            positionChunks[i].normals = normals + data->normalCount;
+        }
+        NormalRunJobs( queue, NormalResolveJob, chunkCount, sizeof(NormalPositionChunk), positionChunks );
+        data->normals      = normals;
+        data->normalCount += generatedCount;
+
+        LOG_INFO( "GenerateOBJNormals > Generated %llu normals for %llu corners",
+            generatedCount, missingCount
+        );
+    }
+
+    if( faceNormals ) {
+        Platform::Free( faceNormals );
+    }
+    if( cornerAngles ) {
+        Platform::Free( cornerAngles );
+    }
+    if( positionOffsets ) {
+        Platform::Free( positionOffsets );
+    }
+    if( positionCorners ) {
+        Platform::Free( positionCorners );
+    }
+    if( normalOffsets ) {
+        Platform::Free( normalOffsets );
+    }
+    if( seeds ) {
+        Platform::Free( seeds );
+    }
+    return success;
+}
+
+bool Core::GenerateMeshNormals( Mesh* mesh, JobQueue* queue ) {
+    // NOTE(alicia): mesh is viewed as obj data where every vertex is a position
+    // and no corner has a normal, without crease angle every used position gets exactly one normal
+    OBJData data = {};
+    data.positionCount = mesh->vertexCount;
+    data.positions     = (smath::vec3*)Platform::Alloc( mesh->vertexCount * sizeof(smath::vec3) );
+    data.cornerCount   = mesh->indexCount;
+    data.corners       = (OBJCorner*)Platform::Alloc( mesh->indexCount * sizeof(OBJCorner) );
+    if( !data.positions || !data.corners ) {
+        LOG_ERROR( "GenerateMeshNormals > Failed to allocate buffers!" );
+        FreeOBJData( &data );
+        return false;
+    }
+
+    ucycles( mesh->vertexCount ) {
+        data.positions[i] = mesh->vertices[i].position;
+    }
+    ucycles( mesh->subMeshCount ) {
+        const SubMesh& subMesh = mesh->subMeshes[i];
+        ucyclesi( subMesh.indexCount, index ) {
+            OBJCorner* corner = &data.corners[subMesh.firstIndex + index];
+            corner->position = (i32)( subMesh.baseVertex + mesh->indices[subMesh.firstIndex + index] );
+            corner->uv       = -1;
+            corner->normal   = -1;
+        }
+    }
+
+    if( !GenerateOBJNormals( &data, 0.0f, queue ) ) {
+        FreeOBJData( &data );
+        return false;
+    }
+
+    ucycles( mesh->vertexCount ) {
+        mesh->vertices[i].normal = smath::vec3::up();
+    }
+    ucycles( data.cornerCount ) {
+        const OBJCorner& corner = data.corners[i];
+        mesh->vertices[corner.position].normal = data.normals[corner.normal];
+    }
+    FreeOBJData( &data );
+    return true;
+}
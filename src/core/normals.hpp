@@ -0,0 +1,41 @@
+/**
+ * Description:  Smooth normal generation
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "pch.hpp"
+
+namespace Core {
+
+// forward declaration
+struct JobQueue;
+struct OBJData;
+struct Mesh;
+
+/// @brief Smallest number of triangles worth generating normals for on its own job
+#define NORMAL_MIN_JOB_TRIANGLES 65536
+#define NORMAL_MAX_JOBS 64
+
+/// @brief Generate normals for every corner that doesn't have one.
+/// Face normals are weighted by the angle of each corner and summed over
+/// every face that shares a position, so uv seams don't split normals.
+/// With a crease angle, faces around a position are grouped with the first
+/// face whose normal is within crease angle and every group gets its own normal.
+/// Faces and positions are processed in parallel on job queue,
+/// result doesn't depend on thread count
+/// @param data obj data, generated normals are appended to data normals
+/// @param creaseAngle crease angle in radians, 0 smooths every face that shares a position
+/// @param queue job queue, can be nullptr
+/// @return false if allocation failed, data is unchanged
+bool GenerateOBJNormals( OBJData* data, f32 creaseAngle, JobQueue* queue );
+/// @brief Generate smooth normals for every vertex of an indexed mesh.
+/// Vertices are already shared between faces, so every vertex gets the
+/// angle weighted normal of the faces that use it, weighted like GenerateOBJNormals.
+/// Vertices that no face uses point up
+/// @param mesh mesh, vertex normals are overwritten
+/// @param queue job queue, can be nullptr
+/// @return false if allocation failed, mesh is unchanged
+bool GenerateMeshNormals( Mesh* mesh, JobQueue* queue );
+
+} // namespace Core
@@ -8,91 +8,1252 @@
 #include "core/renderex.hpp"
 #include "platform/io.hpp"
 #include "platform/renderer.hpp"
+#include "core/jobs.hpp"
+#include "core/mesh.hpp"
+#include "core/cache.hpp"
+#include "core/simplify.hpp"
+#include "core/meshlet.hpp"
+#include "core/normals.hpp"
+#include "core/stream.hpp"
+#include "core/meshstream.hpp"
 
-#define TINYOBJLOADER_IMPLEMENTATION 1
-#include "tiny_obj_loader.h"
+/// @brief Exact powers of ten representable in f64
+static const f64 POWERS_OF_TEN[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+    1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
 
-bool Core::ParseOBJ( Platform::File* sourceFile, Platform::VertexArray* result, Platform::RendererAPI* api ) {
-    usize subStrPos = 0;
-    if( !subStringPos( sourceFile->filePath, ".obj", &subStrPos ) ) {
-        LOG_WARN("ParseOBJ > Attempted to parse a file that is not an obj!");
+/// @brief Find the end of the current line
+/// @return pointer to '\n' or end
+static const char* OBJFindLineEnd( const char* at, const char* end ) {
+    // NOTE(alicia): SSE
+    // scan 16 bytes at a time for a newline
+    __m128i newline = _mm_set1_epi8( '\n' );
+    while( end - at >= 16 ) {
+        __m128i chunk = _mm_loadu_si128( (const __m128i*)at );
+        i32 mask      = _mm_movemask_epi8( _mm_cmpeq_epi8( chunk, newline ) );
+        if( mask != 0 ) {
+            return at + __builtin_ctz( (u32)mask );
+        }
+        at += 16;
+    }
+    while( at < end && *at != '\n' ) {
+        at++;
+    }
+    return at;
+}
+
+static inline bool OBJIsSpace( char c ) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+static inline bool OBJIsDigit( char c ) {
+    return (u8)(c - '0') < 10;
+}
+
+static inline const char* OBJSkipSpace( const char* at, const char* end ) {
+    while( at < end && OBJIsSpace( *at ) ) {
+        at++;
+    }
+    return at;
+}
+
+/// @brief Parse floating-point number, advances at past the number
+static f32 OBJParseFloat( const char*& at, const char* end ) {
+    at = OBJSkipSpace( at, end );
+
+    bool negative = false;
+    if( at < end && ( *at == '-' || *at == '+' ) ) {
+        negative = *at == '-';
+        at++;
+    }
+
+    // NOTE(alicia): only the first 19 significant digits fit in the mantissa,
+    // any digits past that only move the decimal exponent
+    u64 mantissa     = 0;
+    i32 digitCount   = 0;
+    i32 exponent     = 0;
+    while( at < end && OBJIsDigit( *at ) ) {
+        if( digitCount < 19 ) {
+            mantissa = mantissa * 10 + (u64)(*at - '0');
+            if( mantissa != 0 ) {
+                digitCount++;
+            }
+        } else {
+            exponent++;
+        }
+        at++;
+    }
+    if( at < end && *at == '.' ) {
+        at++;
+        while( at < end && OBJIsDigit( *at ) ) {
+            if( digitCount < 19 ) {
+                mantissa = mantissa * 10 + (u64)(*at - '0');
+                if( mantissa != 0 ) {
+                    digitCount++;
+                }
+                exponent--;
+            }
+            at++;
+        }
+    }
+    if( at < end && ( *at == 'e' || *at == 'E' ) ) {
+        at++;
+        bool negativeExponent = false;
+        if( at < end && ( *at == '-' || *at == '+' ) ) {
+            negativeExponent = *at == '-';
+            at++;
+        }
+        i32 explicitExponent = 0;
+        while( at < end && OBJIsDigit( *at ) ) {
+            if( explicitExponent < 10000 ) {
+                explicitExponent = explicitExponent * 10 + (*at - '0');
+            }
+            at++;
+        }
+        exponent += negativeExponent ? -explicitExponent : explicitExponent;
+    }
+
+    f64 value = (f64)mantissa;
+    if( mantissa != 0 ) {
+        while( exponent > 22 ) {
+            value    *= POWERS_OF_TEN[22];
+            exponent -= 22;
+        }
+        while( exponent < -22 ) {
+            value    /= POWERS_OF_TEN[22];
+            exponent += 22;
+        }
+        if( exponent >= 0 ) {
+            value *= POWERS_OF_TEN[exponent];
+        } else {
+            value /= POWERS_OF_TEN[-exponent];
+        }
+    }
+
+    return (f32)( negative ? -value : value );
+}
+
+/// @brief Parse signed integer, advances at past the number
+/// @return 0 if no number present
+static i64 OBJParseInt( const char*& at, const char* end ) {
+    bool negative = false;
+    if( at < end && ( *at == '-' || *at == '+' ) ) {
+        negative = *at == '-';
+        at++;
+    }
+    i64 value = 0;
+    while( at < end && OBJIsDigit( *at ) ) {
+        value = value * 10 + (i64)(*at - '0');
+        at++;
+    }
+    return negative ? -value : value;
+}
+
+/// @brief Resolve one-based/relative obj index to a zero-based index
+/// @param index index as written in file
+/// @param parsedCount number of elements parsed so far
+/// @param totalCount total number of elements in file
+/// @return resolved index or -1 if index is invalid
+static inline i32 OBJResolveIndex( i64 index, usize parsedCount, usize totalCount ) {
+    i64 resolved = -1;
+    if( index > 0 ) {
+        resolved = index - 1;
+    } else if( index < 0 ) {
+        resolved = (i64)parsedCount + index;
+    }
+    if( resolved < 0 || resolved >= (i64)totalCount ) {
+        return -1;
+    }
+    return (i32)resolved;
+}
+
+enum class OBJLineType {
+    UNKNOWN,
+    POSITION,
+    UV,
+    NORMAL,
+    FACE,
+    OBJECT,
+    GROUP,
+    MATERIAL,
+    MATERIAL_LIBRARY
+};
+
+/// @brief Identify line type, advances at past the line keyword
+static inline OBJLineType OBJClassifyLine( const char*& at, const char* lineEnd ) {
+    at = OBJSkipSpace( at, lineEnd );
+    usize remaining = (usize)(lineEnd - at);
+    if( remaining < 2 ) {
+        return OBJLineType::UNKNOWN;
+    }
+    if( at[0] == 'v' ) {
+        if( OBJIsSpace( at[1] ) ) {
+            at += 2;
+            return OBJLineType::POSITION;
+        }
+        if( remaining >= 3 && OBJIsSpace( at[2] ) ) {
+            if( at[1] == 't' ) {
+                at += 3;
+                return OBJLineType::UV;
+            }
+            if( at[1] == 'n' ) {
+                at += 3;
+                return OBJLineType::NORMAL;
+            }
+        }
+    } else if( OBJIsSpace( at[1] ) ) {
+        switch( at[0] ) {
+            case 'f': at += 2; return OBJLineType::FACE;
+            case 'o': at += 2; return OBJLineType::OBJECT;
+            case 'g': at += 2; return OBJLineType::GROUP;
+            default: break;
+        }
+    } else if(
+        remaining >= 7 && at[0] == 'u' && at[1] == 's' && at[2] == 'e' &&
+        at[3] == 'm' && at[4] == 't' && at[5] == 'l' && OBJIsSpace( at[6] )
+    ) {
+        at += 7;
+        return OBJLineType::MATERIAL;
+    } else if(
+        remaining >= 7 && at[0] == 'm' && at[1] == 't' && at[2] == 'l' &&
+        at[3] == 'l' && at[4] == 'i' && at[5] == 'b' && OBJIsSpace( at[6] )
+    ) {
+        at += 7;
+        return OBJLineType::MATERIAL_LIBRARY;
+    }
+    return OBJLineType::UNKNOWN;
+}
+
+/// @brief Read the rest of the line as a name, without surrounding whitespace
+static Core::OBJName OBJParseName( const char* at, const char* lineEnd ) {
+    at = OBJSkipSpace( at, lineEnd );
+    while( lineEnd > at && OBJIsSpace( *(lineEnd - 1) ) ) {
+        lineEnd--;
+    }
+    Core::OBJName result = {};
+    result.text   = at;
+    result.length = (usize)(lineEnd - at);
+    return result;
+}
+
+static inline bool OBJNameCmp( const Core::OBJName& a, const Core::OBJName& b ) {
+    if( a.length != b.length ) {
         return false;
     }
+    ucycles( a.length ) {
+        if( a.text[i] != b.text[i] ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief Count corners of face, stops at comments
+static usize OBJCountFaceCorners( const char* at, const char* lineEnd ) {
+    usize count = 0;
+    bool inToken = false;
+    while( at < lineEnd && *at != '#' ) {
+        bool space = OBJIsSpace( *at );
+        if( !space && !inToken ) {
+            count++;
+        }
+        inToken = !space;
+        at++;
+    }
+    return count;
+}
+
+/// @brief Parse next corner of a face statement, advances at past the corner
+/// @param corner [out] resolved corner, position is -1 if it is invalid
+/// @return false at end of statement
+static bool OBJParseFaceCorner(
+    const char*& at, const char* lineEnd,
+    usize positionsParsed, usize positionCount,
+    usize uvsParsed, usize uvCount,
+    usize normalsParsed, usize normalCount,
+    Core::OBJCorner* corner
+) {
+    at = OBJSkipSpace( at, lineEnd );
+    if( at >= lineEnd || *at == '#' ) {
+        return false;
+    }
+    corner->position = OBJResolveIndex( OBJParseInt( at, lineEnd ), positionsParsed, positionCount );
+    corner->uv       = -1;
+    corner->normal   = -1;
+    if( at < lineEnd && *at == '/' ) {
+        at++;
+        if( at < lineEnd && *at != '/' ) {
+            corner->uv = OBJResolveIndex( OBJParseInt( at, lineEnd ), uvsParsed, uvCount );
+        }
+        if( at < lineEnd && *at == '/' ) {
+            at++;
+            corner->normal = OBJResolveIndex( OBJParseInt( at, lineEnd ), normalsParsed, normalCount );
+        }
+    }
+    // skip anything left in a malformed token
+    while( at < lineEnd && !OBJIsSpace( *at ) ) {
+        at++;
+    }
+    return true;
+}
+
+/// @brief o, g or usemtl statement, position in corner stream where a new group starts
+struct OBJBoundary {
+    usize corner;
+    Core::OBJName material;
+    bool changesMaterial;
+};
+
+/// @brief Region of the file parsed by a single job
+struct OBJChunk {
+    const char* begin;
+    const char* end;
+
+    // counted in count pass
+    usize positionCount;
+    usize uvCount;
+    usize normalCount;
+    usize cornerCount;
+    usize boundaryCount;
+    usize libraryCount;
+
+    // offsets into result arrays, calculated from counts of previous chunks
+    usize positionOffset;
+    usize uvOffset;
+    usize normalOffset;
+    usize cornerOffset;
+    usize boundaryOffset;
+    usize libraryOffset;
+
+    Core::OBJData* result;
+    OBJBoundary* boundaries;
+    Core::OBJName* libraries;
+    bool failed;
+};
+
+/// @brief Count attributes and triangulated corners in chunk
+static void OBJCountChunk( void* params ) {
+    OBJChunk* chunk = (OBJChunk*)params;
+    const char* at  = chunk->begin;
+    const char* end = chunk->end;
+    while( at < end ) {
+        const char* lineEnd = OBJFindLineEnd( at, end );
+        switch( OBJClassifyLine( at, lineEnd ) ) {
+            case OBJLineType::POSITION: chunk->positionCount++; break;
+            case OBJLineType::UV:       chunk->uvCount++;       break;
+            case OBJLineType::NORMAL:   chunk->normalCount++;   break;
+            case OBJLineType::FACE: {
+                usize faceCorners = OBJCountFaceCorners( at, lineEnd );
+                if( faceCorners >= 3 ) {
+                    chunk->cornerCount += ( faceCorners - 2 ) * 3;
+                }
+            } break;
+            case OBJLineType::OBJECT:
+            case OBJLineType::GROUP:
+            case OBJLineType::MATERIAL: chunk->boundaryCount++; break;
+            case OBJLineType::MATERIAL_LIBRARY: chunk->libraryCount++; break;
+            default: break;
+        }
+        at = lineEnd + 1;
+    }
+}
 
-    tinyobj::ObjReaderConfig config;
-    config.triangulate          = true;
-    // config.triangulation_method = "earcut";
-    tinyobj::ObjReader reader;
+/// @brief Parse chunk into result arrays at chunk offsets
+static void OBJParseChunk( void* params ) {
+    OBJChunk* chunk        = (OBJChunk*)params;
+    Core::OBJData* result  = chunk->result;
+    // NOTE(alicia): relative indices are resolved against the number of elements
+    // parsed so far in the whole file, so parsing starts from chunk offsets
+    usize positionsParsed = chunk->positionOffset;
+    usize uvsParsed       = chunk->uvOffset;
+    usize normalsParsed   = chunk->normalOffset;
+    usize cornersParsed   = chunk->cornerOffset;
+    usize boundariesParsed = chunk->boundaryOffset;
+    usize librariesParsed  = chunk->libraryOffset;
+    const char* at  = chunk->begin;
+    const char* end = chunk->end;
+    while( at < end ) {
+        const char* lineEnd = OBJFindLineEnd( at, end );
+        OBJLineType lineType = OBJClassifyLine( at, lineEnd );
+        switch( lineType ) {
+            case OBJLineType::POSITION: {
+                smath::vec3* position = &result->positions[positionsParsed++];
+                position->x = OBJParseFloat( at, lineEnd );
+                position->y = OBJParseFloat( at, lineEnd );
+                position->z = OBJParseFloat( at, lineEnd );
+            } break;
+            case OBJLineType::UV: {
+                smath::vec2* uv = &result->uvs[uvsParsed++];
+                uv->x = OBJParseFloat( at, lineEnd );
+                uv->y = OBJParseFloat( at, lineEnd );
+            } break;
+            case OBJLineType::NORMAL: {
+                smath::vec3* normal = &result->normals[normalsParsed++];
+                normal->x = OBJParseFloat( at, lineEnd );
+                normal->y = OBJParseFloat( at, lineEnd );
+                normal->z = OBJParseFloat( at, lineEnd );
+            } break;
+            case OBJLineType::FACE: {
+                if( OBJCountFaceCorners( at, lineEnd ) < 3 ) {
+                    break;
+                }
+                // NOTE(alicia): faces are triangulated as a fan around the first corner
+                Core::OBJCorner first    = {};
+                Core::OBJCorner previous = {};
+                Core::OBJCorner corner   = {};
+                usize faceCorner = 0;
+                while( OBJParseFaceCorner(
+                    at, lineEnd,
+                    positionsParsed, result->positionCount,
+                    uvsParsed, result->uvCount,
+                    normalsParsed, result->normalCount,
+                    &corner
+                ) ) {
+                    if( corner.position < 0 ) {
+                        chunk->failed = true;
+                        return;
+                    }
 
-    std::string srcString = std::string( (char*)sourceFile->data, sourceFile->size );
+                    if( faceCorner == 0 ) {
+                        first = corner;
+                    } else if( faceCorner >= 2 ) {
+                        result->corners[cornersParsed++] = first;
+                        result->corners[cornersParsed++] = previous;
+                        result->corners[cornersParsed++] = corner;
+                    }
+                    previous = corner;
+                    faceCorner++;
+                }
+            } break;
+            case OBJLineType::OBJECT:
+            case OBJLineType::GROUP:
+            case OBJLineType::MATERIAL: {
+                OBJBoundary* boundary = &chunk->boundaries[boundariesParsed++];
+                boundary->corner = cornersParsed;
+                boundary->changesMaterial = false;
+                if( lineType == OBJLineType::MATERIAL ) {
+                    boundary->material        = OBJParseName( at, lineEnd );
+                    boundary->changesMaterial = true;
+                }
+            } break;
+            case OBJLineType::MATERIAL_LIBRARY: {
+                chunk->libraries[librariesParsed++] = OBJParseName( at, lineEnd );
+            } break;
+            default: break;
+        }
+        at = lineEnd + 1;
+    }
+}
 
-    if( !reader.ParseFromString( srcString, "", config ) ) {
-        LOG_ERROR( "ParseOBJ > tinyobjloader > %s", reader.Error().c_str() );
+/// @brief Split corner stream into groups at boundaries and collect unique materials
+/// @return true if successful
+static bool OBJBuildGroups( usize boundaryCount, const OBJBoundary* boundaries, Core::OBJData* result ) {
+    // NOTE(alicia): worst case is a group for every boundary plus the one before the first
+    result->groups = (Core::OBJGroup*)Platform::Alloc( ( boundaryCount + 1 ) * sizeof(Core::OBJGroup) );
+    if( !result->groups ) {
         return false;
     }
+    usize materialBoundaryCount = 0;
+    ucycles( boundaryCount ) {
+        if( boundaries[i].changesMaterial ) {
+            materialBoundaryCount++;
+        }
+    }
+    if( materialBoundaryCount > 0 ) {
+        result->materials = (Core::OBJName*)Platform::Alloc( materialBoundaryCount * sizeof(Core::OBJName) );
+        if( !result->materials ) {
+            return false;
+        }
+    }
+
+    Core::OBJGroup current = {};
+    current.material = -1;
+    ucycles( boundaryCount + 1 ) {
+        usize corner = i < boundaryCount ? boundaries[i].corner : result->cornerCount;
+        // groups without triangles are dropped
+        if( corner > current.firstCorner ) {
+            current.cornerCount = corner - current.firstCorner;
+            result->groups[result->groupCount++] = current;
+            current.firstCorner = corner;
+        }
+        if( i == boundaryCount || !boundaries[i].changesMaterial ) {
+            continue;
+        }
+
+        const Core::OBJName& material = boundaries[i].material;
+        i32 materialIndex = -1;
+        ucyclesi( result->materialCount, m ) {
+            if( OBJNameCmp( result->materials[m], material ) ) {
+                materialIndex = (i32)m;
+                break;
+            }
+        }
+        if( materialIndex < 0 ) {
+            materialIndex = (i32)result->materialCount;
+            result->materials[result->materialCount++] = material;
+        }
+        current.material = materialIndex;
+    }
+    return true;
+}
+
+/// @brief Keep first of every repeated library name, in place
+static void OBJUniqueLibraries( usize libraryCount, Core::OBJName* libraries, Core::OBJData* result ) {
+    result->materialLibraries = libraries;
+    ucycles( libraryCount ) {
+        bool repeated = libraries[i].length == 0;
+        ucyclesi( result->materialLibraryCount, l ) {
+            if( OBJNameCmp( result->materialLibraries[l], libraries[i] ) ) {
+                repeated = true;
+                break;
+            }
+        }
+        if( !repeated ) {
+            result->materialLibraries[result->materialLibraryCount++] = libraries[i];
+        }
+    }
+}
+
+/// @brief Run job for every chunk, on job queue if there is more than one chunk
+static void OBJRunChunks( Core::JobQueue* queue, usize chunkCount, OBJChunk* chunks, Core::JobFN job ) {
+    if( chunkCount == 1 ) {
+        job( &chunks[0] );
+        return;
+    }
+    Core::JobCounter counter = {};
+    ucycles( chunkCount ) {
+        Core::PushJob( queue, job, &chunks[i], &counter );
+    }
+    Core::WaitForJobs( queue, &counter );
+}
+
+bool Core::ParseOBJData( const Platform::File* sourceFile, const OBJParseOptions* options, OBJData* result ) {
+    u64 startTime = Platform::GetPerformanceCounter();
+
+    const char* begin = (const char*)sourceFile->data;
+    const char* end   = begin + sourceFile->size;
+
+    Core::JobQueue* queue = options ? options->jobQueue : nullptr;
+    usize chunkCount = 1;
+    if( queue ) {
+        chunkCount = options->threadCount ? options->threadCount : JobQueueThreadCount( queue );
+    }
+    // NOTE(alicia): small chunks aren't worth the scheduling overhead
+    usize maxChunkCount = sourceFile->size / OBJ_MIN_CHUNK_SIZE;
+    if( chunkCount > maxChunkCount ) {
+        chunkCount = maxChunkCount;
+    }
+    if( chunkCount > OBJ_MAX_CHUNK_COUNT ) {
+        chunkCount = OBJ_MAX_CHUNK_COUNT;
+    }
+    if( chunkCount < 1 ) {
+        chunkCount = 1;
+    }
 
-    if( !reader.Warning().empty() ) {
-        LOG_WARN( "ParseOBJ > tinyobjloader > %s", reader.Warning().c_str() );
+    // split file on line boundaries
+    OBJChunk chunks[OBJ_MAX_CHUNK_COUNT] = {};
+    const char* chunkBegin = begin;
+    ucycles( chunkCount ) {
+        const char* chunkEnd = end;
+        if( i + 1 < chunkCount ) {
+            chunkEnd = begin + ( sourceFile->size / chunkCount ) * ( i + 1 );
+            if( chunkEnd < chunkBegin ) {
+                chunkEnd = chunkBegin;
+            }
+            chunkEnd = OBJFindLineEnd( chunkEnd, end );
+            if( chunkEnd < end ) {
+                chunkEnd++;
+            }
+        }
+        chunks[i].begin  = chunkBegin;
+        chunks[i].end    = chunkEnd;
+        chunks[i].result = result;
+        chunkBegin = chunkEnd;
     }
 
-    auto& attrib = reader.GetAttrib();
-    auto& shape  = reader.GetShapes()[0];
+    // count pass: size every array up front so that parsing never allocates
+    OBJRunChunks( queue, chunkCount, chunks, OBJCountChunk );
 
-    usize vertexCount = 0;
-    ucycles( shape.mesh.num_face_vertices.size() ) {
-        vertexCount += shape.mesh.num_face_vertices[i];
+    *result = {};
+    usize boundaryCount = 0;
+    usize libraryCount  = 0;
+    ucycles( chunkCount ) {
+        OBJChunk* chunk = &chunks[i];
+        chunk->positionOffset = result->positionCount;
+        chunk->uvOffset       = result->uvCount;
+        chunk->normalOffset   = result->normalCount;
+        chunk->cornerOffset   = result->cornerCount;
+        chunk->boundaryOffset = boundaryCount;
+        chunk->libraryOffset  = libraryCount;
+        result->positionCount += chunk->positionCount;
+        result->uvCount       += chunk->uvCount;
+        result->normalCount   += chunk->normalCount;
+        result->cornerCount   += chunk->cornerCount;
+        boundaryCount         += chunk->boundaryCount;
+        libraryCount          += chunk->libraryCount;
     }
 
-    Core::vertex* vertices = (Core::vertex*)Platform::Alloc( vertexCount * sizeof( Core::vertex ) );
-    usize idxOffset = 0;
-    usize vertexCounter = 0;
-    bool uvsPresent = false;
-    bool normalsPresent = false;
-    ucyclesi( shape.mesh.num_face_vertices.size(), f ) {
-        usize fv = (usize)(shape.mesh.num_face_vertices[f]);
-        ucyclesi( fv, v ) {
-            auto idx = shape.mesh.indices[idxOffset + v];
-            Core::vertex* vertex = &vertices[vertexCounter];
-            vertexCounter++;
+    if( result->positionCount == 0 || result->cornerCount == 0 ) {
+        LOG_ERROR( "ParseOBJ > File contains no faces!" );
+        *result = {};
+        return false;
+    }
 
-            vertex->position.x = attrib.vertices[ 3 * idx.vertex_index + 0 ];
-            vertex->position.y = attrib.vertices[ 3 * idx.vertex_index + 1 ];
-            vertex->position.z = attrib.vertices[ 3 * idx.vertex_index + 2 ];
+    result->positions = (smath::vec3*)Platform::Alloc( result->positionCount * sizeof( smath::vec3 ) );
+    result->corners   = (OBJCorner*)Platform::Alloc( result->cornerCount * sizeof( OBJCorner ) );
+    if( result->uvCount > 0 ) {
+        result->uvs = (smath::vec2*)Platform::Alloc( result->uvCount * sizeof( smath::vec2 ) );
+    }
+    if( result->normalCount > 0 ) {
+        result->normals = (smath::vec3*)Platform::Alloc( result->normalCount * sizeof( smath::vec3 ) );
+    }
+    OBJBoundary* boundaries = nullptr;
+    if( boundaryCount > 0 ) {
+        boundaries = (OBJBoundary*)Platform::Alloc( boundaryCount * sizeof( OBJBoundary ) );
+        ucycles( chunkCount ) {
+            chunks[i].boundaries = boundaries;
+        }
+    }
+    Core::OBJName* libraries = nullptr;
+    if( libraryCount > 0 ) {
+        libraries = (Core::OBJName*)Platform::Alloc( libraryCount * sizeof( Core::OBJName ) );
+        ucycles( chunkCount ) {
+            chunks[i].libraries = libraries;
+        }
+    }
+
+    // parse pass
+    OBJRunChunks( queue, chunkCount, chunks, OBJParseChunk );
 
-            if( idx.texcoord_index >= 0 ) {
-                vertex->uv.x = attrib.texcoords[ 2 * idx.texcoord_index + 0 ];
-                vertex->uv.y = attrib.texcoords[ 2 * idx.texcoord_index + 1 ];
-            } else {
-                vertex->uv.x = vertex->position.x;
-                vertex->uv.y = vertex->position.y;
-                smath::normalize( vertex->uv );
+    ucycles( chunkCount ) {
+        if( chunks[i].failed ) {
+            LOG_ERROR( "ParseOBJ > Face references an invalid position!" );
+            if( boundaries ) {
+                Platform::Free( boundaries );
             }
+            if( libraries ) {
+                Platform::Free( libraries );
+            }
+            FreeOBJData( result );
+            return false;
+        }
+    }
+    // NOTE(alicia): result owns libraries from here on
+    OBJUniqueLibraries( libraryCount, libraries, result );
+
+    bool groupsBuilt = OBJBuildGroups( boundaryCount, boundaries, result );
+    if( boundaries ) {
+        Platform::Free( boundaries );
+    }
+    if( !groupsBuilt ) {
+        LOG_ERROR( "ParseOBJ > Failed to allocate groups!" );
+        FreeOBJData( result );
+        return false;
+    }
+
+    f64 elapsedSeconds = (f64)( Platform::GetPerformanceCounter() - startTime ) /
+        (f64)Platform::GetPerformanceFrequency();
+    f64 megabytes = (f64)sourceFile->size / (f64)MEGABYTES(1);
+    LOG_INFO( "ParseOBJ > Parsed %.2fMB in %.3fs ( %.1fMB/s ) on %llu threads, %llu positions %llu triangles %llu groups %llu materials",
+        megabytes,
+        elapsedSeconds,
+        elapsedSeconds > 0.0 ? megabytes / elapsedSeconds : 0.0,
+        chunkCount,
+        result->positionCount,
+        result->cornerCount / 3,
+        result->groupCount,
+        result->materialCount
+    );
+
+    return true;
+}
 
-            if( idx.normal_index >= 0 ) {
-                vertex->normal.x = attrib.normals[ 3 * idx.normal_index + 0 ];
-                vertex->normal.y = attrib.normals[ 3 * idx.normal_index + 1 ];
-                vertex->normal.z = attrib.normals[ 3 * idx.normal_index + 2 ];
-            } else {
-                vertex->normal = smath::normalize(vertex->position);
+void Core::FreeOBJData( OBJData* data ) {
+    if( data->positions ) {
+        Platform::Free( data->positions );
+    }
+    if( data->uvs ) {
+        Platform::Free( data->uvs );
+    }
+    if( data->normals ) {
+        Platform::Free( data->normals );
+    }
+    if( data->corners ) {
+        Platform::Free( data->corners );
+    }
+    if( data->groups ) {
+        Platform::Free( data->groups );
+    }
+    if( data->materials ) {
+        Platform::Free( data->materials );
+    }
+    if( data->materialLibraries ) {
+        Platform::Free( data->materialLibraries );
+    }
+    *data = {};
+}
+
+bool Core::CreateOBJMaterialNames( const OBJData* data, MeshMaterialNames* result ) {
+    *result = {};
+    if( data->materialLibraryCount == 0 && data->materialCount == 0 ) {
+        return true;
+    }
+    const OBJName* lists[2]  = { data->materialLibraries, data->materials };
+    usize listCounts[2]      = { data->materialLibraryCount, data->materialCount };
+    usize textSize = 0;
+    ucycles( 2 ) {
+        ucyclesi( listCounts[i], n ) {
+            textSize += lists[i][n].length + 1;
+        }
+    }
+    result->text = (char*)Platform::Alloc( textSize );
+    if( !result->text ) {
+        return false;
+    }
+    result->libraryCount  = (u32)data->materialLibraryCount;
+    result->materialCount = (u32)data->materialCount;
+    result->textSize      = textSize;
+    char* at = result->text;
+    ucycles( 2 ) {
+        ucyclesi( listCounts[i], n ) {
+            Platform::MemCopy( lists[i][n].length, lists[i][n].text, at );
+            at += lists[i][n].length + 1;
+        }
+    }
+    return true;
+}
+
+/// @brief State of a streamed parse, kept between windows
+struct OBJStreamState {
+    Core::OBJStreamData* result;
+    Core::RecordWriter positions;
+    Core::RecordWriter uvs;
+    Core::RecordWriter normals;
+    Core::RecordWriter corners;
+    usize groupCapacity;
+    /// @brief Hashes of unique material names, checked before comparing materialText
+    u64* materialHashes;
+    usize materialCapacity;
+    /// @brief Copies of unique material and library names, packed like Core::MeshMaterialNames
+    char* materialText;
+    usize materialTextSize;
+    usize materialTextCapacity;
+    char* libraryText;
+    usize libraryTextSize;
+    usize libraryTextCapacity;
+    u32 libraryCount;
+    /// @brief Next triangle starts a new group
+    bool groupPending;
+    i32 material;
+    /// @brief Largest position index referenced, positions may be referenced before they are parsed
+    i32 maxPosition;
+    bool failed;
+};
+
+/// @brief Append null-terminated copy of name to packed text
+/// @return false if allocation failed
+static bool OBJStreamAppendName( char** text, usize* size, usize* capacity, const Core::OBJName& name ) {
+    if( !growArray( (void**)text, 1, capacity, *size + name.length + 1 ) ) {
+        return false;
+    }
+    Platform::MemCopy( name.length, name.text, *text + *size );
+    (*text)[*size + name.length] = 0;
+    *size += name.length + 1;
+    return true;
+}
+
+/// @brief Remember library name if it wasn't named before
+/// @return false if allocation failed
+static bool OBJStreamLibrary( OBJStreamState* state, const Core::OBJName& name ) {
+    if( name.length == 0 ) {
+        return true;
+    }
+    const char* at = state->libraryText;
+    ucycles( state->libraryCount ) {
+        Core::OBJName library = {};
+        library.text   = at;
+        library.length = stringLen( at );
+        if( OBJNameCmp( library, name ) ) {
+            return true;
+        }
+        at += library.length + 1;
+    }
+    if( !OBJStreamAppendName( &state->libraryText, &state->libraryTextSize, &state->libraryTextCapacity, name ) ) {
+        return false;
+    }
+    state->libraryCount++;
+    return true;
+}
+
+/// @brief Get index of material, name is added if it wasn't used before
+/// @return material index, -1 if allocation failed
+static i32 OBJStreamMaterial( OBJStreamState* state, const Core::OBJName& name ) {
+    u64 hash = hashBytes( name.length, name.text, 0 );
+    Core::OBJStreamData* result = state->result;
+    const char* at = state->materialText;
+    ucycles( result->materialCount ) {
+        Core::OBJName material = {};
+        material.text   = at;
+        material.length = stringLen( at );
+        // NOTE(alicia): hash only rules names out, colliding names stay separate materials
+        if( state->materialHashes[i] == hash && OBJNameCmp( material, name ) ) {
+            return (i32)i;
+        }
+        at += material.length + 1;
+    }
+    if(
+        !growArray( (void**)&state->materialHashes, sizeof(u64), &state->materialCapacity, result->materialCount + 1 ) ||
+        !OBJStreamAppendName( &state->materialText, &state->materialTextSize, &state->materialTextCapacity, name )
+    ) {
+        return -1;
+    }
+    state->materialHashes[result->materialCount] = hash;
+    return (i32)result->materialCount++;
+}
+
+/// @brief Parse complete lines of a window
+static void OBJStreamLines( OBJStreamState* state, const char* at, const char* end ) {
+    Core::OBJStreamData* result = state->result;
+    while( at < end && !state->failed ) {
+        const char* lineEnd = OBJFindLineEnd( at, end );
+        OBJLineType lineType = OBJClassifyLine( at, lineEnd );
+        switch( lineType ) {
+            case OBJLineType::POSITION: {
+                smath::vec3* position = (smath::vec3*)Core::PushRecord( &state->positions );
+                position->x = OBJParseFloat( at, lineEnd );
+                position->y = OBJParseFloat( at, lineEnd );
+                position->z = OBJParseFloat( at, lineEnd );
+                result->positionCount++;
+            } break;
+            case OBJLineType::UV: {
+                smath::vec2* uv = (smath::vec2*)Core::PushRecord( &state->uvs );
+                uv->x = OBJParseFloat( at, lineEnd );
+                uv->y = OBJParseFloat( at, lineEnd );
+                result->uvCount++;
+            } break;
+            case OBJLineType::NORMAL: {
+                smath::vec3* normal = (smath::vec3*)Core::PushRecord( &state->normals );
+                normal->x = OBJParseFloat( at, lineEnd );
+                normal->y = OBJParseFloat( at, lineEnd );
+                normal->z = OBJParseFloat( at, lineEnd );
+                result->normalCount++;
+            } break;
+            case OBJLineType::FACE: {
+                if( OBJCountFaceCorners( at, lineEnd ) < 3 ) {
+                    break;
+                }
+                if( state->groupPending ) {
+                    if( !growArray( (void**)&result->groups, sizeof(Core::OBJGroup), &state->groupCapacity, result->groupCount + 1 ) ) {
+                        LOG_ERROR( "ParseOBJStream > Failed to allocate groups!" );
+                        state->failed = true;
+                        return;
+                    }
+                    Core::OBJGroup* group = &result->groups[result->groupCount++];
+                    group->firstCorner = result->cornerCount;
+                    group->cornerCount = 0;
+                    group->material    = state->material;
+                    state->groupPending = false;
+                }
+                Core::OBJGroup* group = &result->groups[result->groupCount - 1];
+
+                // NOTE(alicia): total counts aren't known yet, positive indices are checked once the file is parsed.
+                // uvs and normals past the end are treated as missing when they are looked up
+                Core::OBJCorner first    = {};
+                Core::OBJCorner previous = {};
+                Core::OBJCorner corner   = {};
+                usize faceCorner = 0;
+                while( OBJParseFaceCorner(
+                    at, lineEnd,
+                    result->positionCount, (usize)I32::MAX,
+                    result->uvCount, (usize)I32::MAX,
+                    result->normalCount, (usize)I32::MAX,
+                    &corner
+                ) ) {
+                    if( corner.position < 0 ) {
+                        LOG_ERROR( "ParseOBJStream > Face references an invalid position!" );
+                        state->failed = true;
+                        return;
+                    }
+                    if( corner.position > state->maxPosition ) {
+                        state->maxPosition = corner.position;
+                    }
+
+                    if( faceCorner == 0 ) {
+                        first = corner;
+                    } else if( faceCorner >= 2 ) {
+                        const Core::OBJCorner* triangle[3] = { &first, &previous, &corner };
+                        ucycles( 3 ) {
+                            *(Core::OBJCorner*)Core::PushRecord( &state->corners ) = *triangle[i];
+                            if( triangle[i]->normal < 0 ) {
+                                result->missingNormalCount++;
+                            }
+                        }
+                        result->cornerCount += 3;
+                        group->cornerCount  += 3;
+                    }
+                    previous = corner;
+                    faceCorner++;
+                }
+            } break;
+            case OBJLineType::OBJECT:
+            case OBJLineType::GROUP:
+            case OBJLineType::MATERIAL: {
+                state->groupPending = true;
+                if( lineType == OBJLineType::MATERIAL ) {
+                    state->material = OBJStreamMaterial( state, OBJParseName( at, lineEnd ) );
+                    if( state->material < 0 ) {
+                        LOG_ERROR( "ParseOBJStream > Failed to allocate materials!" );
+                        state->failed = true;
+                        return;
+                    }
+                }
+            } break;
+            case OBJLineType::MATERIAL_LIBRARY: {
+                if( !OBJStreamLibrary( state, OBJParseName( at, lineEnd ) ) ) {
+                    LOG_ERROR( "ParseOBJStream > Failed to allocate material libraries!" );
+                    state->failed = true;
+                    return;
+                }
+            } break;
+            default: break;
+        }
+        at = lineEnd + 1;
+    }
+}
+
+bool Core::ParseOBJStream( const char* filePath, u64 sourceHash, usize memoryBudget, OBJStreamData* result ) {
+    u64 startTime = Platform::GetPerformanceCounter();
+
+    *result = {};
+    if( !Platform::MakeDirectory( CACHE_DIRECTORY ) ) {
+        LOG_ERROR( "ParseOBJStream > Failed to create cache directory!" );
+        return false;
+    }
+    CachePath( sourceHash, ".positions.tmp", CACHE_PATH_MAX_LEN, result->positionPath );
+    CachePath( sourceHash, ".uvs.tmp",       CACHE_PATH_MAX_LEN, result->uvPath );
+    CachePath( sourceHash, ".normals.tmp",   CACHE_PATH_MAX_LEN, result->normalPath );
+    CachePath( sourceHash, ".corners.tmp",   CACHE_PATH_MAX_LEN, result->cornerPath );
+
+    Platform::FileStream file = {};
+    if( !Platform::OpenFileStream( filePath, Platform::FileStreamMode::READ, &file ) ) {
+        LOG_ERROR( "ParseOBJStream > Failed to open \"%s\"!", filePath );
+        return false;
+    }
+    usize fileSize = file.size;
+
+    // NOTE(alicia): half of budget is the window, the rest buffers spilled attributes
+    usize windowSize = memoryBudget / 2;
+    usize bufferSize = memoryBudget / 8;
+    char* window = (char*)Platform::Alloc( windowSize );
+
+    OBJStreamState state = {};
+    state.result       = result;
+    state.groupPending = true;
+    state.material     = -1;
+    state.maxPosition  = -1;
+    bool success =
+        window &&
+        CreateRecordWriter( result->positionPath, sizeof(smath::vec3), bufferSize, &state.positions ) &&
+        CreateRecordWriter( result->uvPath,       sizeof(smath::vec2), bufferSize, &state.uvs ) &&
+        CreateRecordWriter( result->normalPath,   sizeof(smath::vec3), bufferSize, &state.normals ) &&
+        CreateRecordWriter( result->cornerPath,   sizeof(OBJCorner),   bufferSize, &state.corners );
+
+    // window holds the unfinished line of the previous window followed by newly read bytes
+    usize fileOffset   = 0;
+    usize carriedCount = 0;
+    while( success ) {
+        usize bytesRead = Platform::ReadFileStream( &file, fileOffset, windowSize - carriedCount, window + carriedCount );
+        fileOffset += bytesRead;
+        bool lastWindow = fileOffset >= fileSize || bytesRead == 0;
+
+        const char* end      = window + carriedCount + bytesRead;
+        const char* parseEnd = end;
+        if( !lastWindow ) {
+            while( parseEnd > window && *( parseEnd - 1 ) != '\n' ) {
+                parseEnd--;
+            }
+            if( parseEnd == window ) {
+                LOG_ERROR( "ParseOBJStream > Line is longer than the parse window!" );
+                success = false;
+                break;
             }
         }
-        idxOffset += fv;
+
+        OBJStreamLines( &state, window, parseEnd );
+        if( state.failed ) {
+            success = false;
+            break;
+        }
+        if( lastWindow ) {
+            break;
+        }
+
+        carriedCount = (usize)( end - parseEnd );
+        ucycles( carriedCount ) {
+            window[i] = parseEnd[i];
+        }
     }
 
-    Core::calculateTangentBasis( vertexCount, vertices );
+    Platform::CloseFileStream( &file );
+    if( window ) {
+        Platform::Free( window );
+    }
+    if( state.materialHashes ) {
+        Platform::Free( state.materialHashes );
+    }
+    // NOTE(alicia): libraries come first in packed names
+    usize nameSize = state.libraryTextSize + state.materialTextSize;
+    if( success && nameSize > 0 ) {
+        MeshMaterialNames* names = &result->materialNames;
+        names->text = (char*)Platform::Alloc( nameSize );
+        if( names->text ) {
+            names->libraryCount  = state.libraryCount;
+            names->materialCount = (u32)result->materialCount;
+            names->textSize      = nameSize;
+            Platform::MemCopy( state.libraryTextSize, state.libraryText, names->text );
+            Platform::MemCopy( state.materialTextSize, state.materialText, names->text + state.libraryTextSize );
+        } else {
+            LOG_ERROR( "ParseOBJStream > Failed to allocate material names!" );
+            success = false;
+        }
+    }
+    if( state.materialText ) {
+        Platform::Free( state.materialText );
+    }
+    if( state.libraryText ) {
+        Platform::Free( state.libraryText );
+    }
+    // NOTE(alicia): writers that were never created fail to close
+    bool positionsClosed = CloseRecordWriter( &state.positions );
+    bool uvsClosed       = CloseRecordWriter( &state.uvs );
+    bool normalsClosed   = CloseRecordWriter( &state.normals );
+    bool cornersClosed   = CloseRecordWriter( &state.corners );
+    if( success && !( positionsClosed && uvsClosed && normalsClosed && cornersClosed ) ) {
+        LOG_ERROR( "ParseOBJStream > Failed to write attributes!" );
+        success = false;
+    }
+    if( success && ( result->positionCount == 0 || result->cornerCount == 0 ) ) {
+        LOG_ERROR( "ParseOBJStream > File contains no faces!" );
+        success = false;
+    }
+    if( success && (usize)state.maxPosition >= result->positionCount ) {
+        LOG_ERROR( "ParseOBJStream > Face references an invalid position!" );
+        success = false;
+    }
+    if( !success ) {
+        FreeOBJStreamData( result );
+        return false;
+    }
 
-    *result = api->CreateVertexArray();
-    api->UseVertexArray( result );
-    
-    auto vbuffer = api->CreateVertexBuffer(
-        sizeof( Core::vertex ) * vertexCount,
-        &vertices[0],
-        Core::vertexLayout()
+    f64 elapsedSeconds = (f64)( Platform::GetPerformanceCounter() - startTime ) /
+        (f64)Platform::GetPerformanceFrequency();
+    f64 megabytes = (f64)fileSize / (f64)MEGABYTES(1);
+    LOG_INFO( "ParseOBJStream > Streamed %.2fMB in %.3fs ( %.1fMB/s ) through a %.1fMB window, %llu positions %llu triangles %llu groups %llu materials",
+        megabytes,
+        elapsedSeconds,
+        elapsedSeconds > 0.0 ? megabytes / elapsedSeconds : 0.0,
+        (f64)windowSize / (f64)MEGABYTES(1),
+        result->positionCount,
+        result->cornerCount / 3,
+        result->groupCount,
+        result->materialCount
     );
+    return true;
+}
+
+void Core::FreeOBJStreamData( OBJStreamData* data ) {
+    const char* paths[] = { data->positionPath, data->uvPath, data->normalPath, data->cornerPath };
+    ucycles( 4 ) {
+        if( paths[i][0] ) {
+            Platform::RemoveFile( paths[i] );
+        }
+    }
+    if( data->groups ) {
+        Platform::Free( data->groups );
+    }
+    FreeMeshMaterialNames( &data->materialNames );
+    *data = {};
+}
+
+bool Core::LoadOBJ(
+    const Platform::File* sourceFile,
+    const OBJParseOptions* options,
+    MeshUploadData* result
+) {
+    usize subStrPos = 0;
+    if( !subStringPos( sourceFile->filePath, ".obj", &subStrPos ) ) {
+        LOG_WARN("LoadOBJ > Attempted to parse a file that is not an obj!");
+        return false;
+    }
+
+    bool useCache = !options || !options->skipCache;
+    u32 cacheFlags = MeshCacheFlags( options );
+
+    f32 creaseAngle = options ? options->creaseAngle : 0.0f;
+
+    u64 sourceHash = 0;
+    if( useCache ) {
+        sourceHash = Core::HashContents(
+            sourceFile->size,
+            sourceFile->data,
+            options ? options->jobQueue : nullptr
+        );
+        // NOTE(alicia): generated normals depend on crease angle
+        if( creaseAngle > 0.0f ) {
+            sourceHash = hashBytes( sizeof(f32), &creaseAngle, sourceHash );
+        }
+        if( Core::LoadMeshCacheData( sourceHash, sourceFile->size, cacheFlags, result ) ) {
+            return true;
+        }
+    }
+
+    OBJData data = {};
+    if( !ParseOBJData( sourceFile, options, &data ) ) {
+        return false;
+    }
+    if( !GenerateOBJNormals( &data, creaseAngle, options ? options->jobQueue : nullptr ) ) {
+        FreeOBJData( &data );
+        return false;
+    }
+
+    Core::MeshMaterialNames materialNames = {};
+    Core::Mesh mesh = {};
+    bool meshBuilt =
+        CreateOBJMaterialNames( &data, &materialNames ) &&
+        BuildMesh( &data, options ? options->jobQueue : nullptr, &mesh );
+    FreeOBJData( &data );
+    if( !meshBuilt ) {
+        FreeMeshMaterialNames( &materialNames );
+        return false;
+    }
+
+    return FinishMeshLoad( &mesh, &materialNames, sourceHash, sourceFile->size, options, result );
+}
+
+u32 Core::MeshCacheFlags( const OBJParseOptions* options ) {
+    u32 cacheFlags = 0;
+    if( !options || !options->skipOptimization ) {
+        cacheFlags |= MESH_CACHE_FLAG_OPTIMIZED;
+    }
+    if( options && options->packVertices ) {
+        cacheFlags |= MESH_CACHE_FLAG_PACKED;
+    }
+    if( !options || !options->skipLODs ) {
+        cacheFlags |= MESH_CACHE_FLAG_LODS;
+    }
+    return cacheFlags;
+}
+
+bool Core::FinishMeshLoad(
+    Mesh* mesh, MeshMaterialNames* materialNames,
+    u64 sourceHash, usize sourceSize,
+    const OBJParseOptions* options,
+    MeshUploadData* result
+) {
+    u32 cacheFlags = MeshCacheFlags( options );
+    if( cacheFlags & MESH_CACHE_FLAG_LODS ) {
+        Core::GenerateMeshLODs( mesh, options ? options->jobQueue : nullptr );
+    }
+    if( cacheFlags & MESH_CACHE_FLAG_OPTIMIZED ) {
+        Core::OptimizeMesh( mesh );
+    }
+    Core::BuildMeshlets( mesh );
+
+    if( !options || !options->skipCache ) {
+        Core::WriteMeshCache( sourceHash, sourceSize, cacheFlags, mesh, materialNames );
+    }
+
+    if( !Core::CreateMeshUploadData( mesh, ( cacheFlags & MESH_CACHE_FLAG_PACKED ) != 0, result ) ) {
+        if( materialNames ) {
+            Core::FreeMeshMaterialNames( materialNames );
+        }
+        return false;
+    }
+    if( materialNames ) {
+        result->materialNames = *materialNames;
+        *materialNames = {};
+    }
+    return true;
+}
 
-    Platform::Free( vertices );
+/// @brief Stream file and build it out-of-core into the mesh cache, then map it from there
+static bool OBJLoadStreamed( const char* filePath, const Core::OBJParseOptions* options, Core::MeshUploadData* result ) {
+    usize memoryBudget = options->memoryBudget;
+    if( memoryBudget < (usize)OBJ_STREAM_MIN_MEMORY_BUDGET ) {
+        memoryBudget = OBJ_STREAM_MIN_MEMORY_BUDGET;
+    }
 
-    api->VertexArrayBindVertexBuffer( result, vbuffer );
+    u64 sourceHash = 0;
+    usize sourceSize = 0;
+    if( !Core::HashFileContents( filePath, &sourceHash, &sourceSize ) ) {
+        LOG_ERROR( "LoadOBJFile > Failed to read \"%s\"!", filePath );
+        return false;
+    }
+    // NOTE(alicia): cache file is where the mesh is built, so it is used even if options skip the cache.
+    // streamed meshes are never optimized and have no levels
+    u32 cacheFlags = options->packVertices ? MESH_CACHE_FLAG_PACKED : 0;
+    if( Core::LoadMeshCacheData( sourceHash, sourceSize, cacheFlags, result ) ) {
+        return true;
+    }
 
+    Core::OBJStreamData data = {};
+    if( !Core::ParseOBJStream( filePath, sourceHash, memoryBudget, &data ) ) {
+        return false;
+    }
+    bool built = Core::WriteStreamedMeshCache( &data, sourceHash, sourceSize, cacheFlags, memoryBudget );
+    Core::FreeOBJStreamData( &data );
+    if( !built ) {
+        return false;
+    }
+    return Core::LoadMeshCacheData( sourceHash, sourceSize, cacheFlags, result );
+}
+
+bool Core::LoadOBJFile(
+    const char* filePath,
+    const OBJParseOptions* options,
+    MeshUploadData* result
+) {
+    usize subStrPos = 0;
+    if( !subStringPos( filePath, ".obj", &subStrPos ) ) {
+        LOG_WARN("LoadOBJFile > Attempted to parse a file that is not an obj!");
+        return false;
+    }
+
+    if( options && options->memoryBudget > 0 ) {
+        Platform::FileStream file = {};
+        if( !Platform::OpenFileStream( filePath, Platform::FileStreamMode::READ, &file ) ) {
+            return false;
+        }
+        usize fileSize = file.size;
+        Platform::CloseFileStream( &file );
+        if( fileSize > options->memoryBudget / OBJ_IN_MEMORY_FACTOR ) {
+            return OBJLoadStreamed( filePath, options, result );
+        }
+    }
+
+    Platform::File file = {};
+    if( !Platform::LoadFile( filePath, &file ) ) {
+        return false;
+    }
+    bool success = LoadOBJ( &file, options, result );
+    Platform::FreeFile( &file );
+    return success;
+}
+
+bool Core::ParseOBJ(
+    Platform::File* sourceFile,
+    const OBJParseOptions* options,
+    Platform::VertexArray* result,
+    MeshInfo* info,
+    Platform::RendererAPI* api
+) {
+    MeshUploadData uploadData = {};
+    if( !LoadOBJ( sourceFile, options, &uploadData ) ) {
+        return false;
+    }
+    Core::UploadMeshData( &uploadData, result, info, api );
+    Core::FreeMeshUploadData( &uploadData );
     return true;
 }
@@ -4,6 +4,9 @@
  * File Created: November 23, 2022 
 */
 #pragma once
+#include "pch.hpp"
+#include "core/cache.hpp"
+#include "core/mesh.hpp"
 
 // forward declaration
 namespace Platform {
@@ -13,10 +16,203 @@ namespace Platform {
 };
 
 namespace Core {
-    /// @brief Parse OBJ model from file
+    // forward declaration
+    struct JobQueue;
+    struct Mesh;
+    struct MeshInfo;
+    struct MeshUploadData;
+
+    /// @brief Smallest part of a file that is worth parsing on its own thread
+    #define OBJ_MIN_CHUNK_SIZE MEGABYTES(1)
+    #define OBJ_MAX_CHUNK_COUNT 64
+
+    /// @brief Loading a file in memory peaks at about this many times its size
+    #define OBJ_IN_MEMORY_FACTOR 6
+    /// @brief Smallest memory budget a file is streamed with
+    #define OBJ_STREAM_MIN_MEMORY_BUDGET MEGABYTES(32)
+
+    struct OBJParseOptions {
+        /// @brief Job queue to parse on, nullptr parses on calling thread only
+        JobQueue* jobQueue;
+        /// @brief Number of chunks to split file into, 0 uses every thread of job queue
+        u32 threadCount;
+        /// @brief Skip vertex cache/fetch optimization, for faster loads
+        bool skipOptimization;
+        /// @brief Don't read from or write to the mesh cache
+        bool skipCache;
+        /// @brief Upload quantized Core::packedVertex instead of Core::vertex
+        bool packVertices;
+        /// @brief Don't generate simplified levels of detail
+        bool skipLODs;
+        /// @brief Faces meeting at a sharper angle, in radians, get separate generated normals.
+        /// 0 smooths every face, only used when file is missing normals
+        f32 creaseAngle;
+        /// @brief Peak memory a load may use, in bytes.
+        /// Files that don't fit loaded in memory are streamed through a fixed-size window
+        /// and built out-of-core, without optimization, levels or meshlets.
+        /// 0 always loads in memory
+        usize memoryBudget;
+    };
+
+    /// @brief Attribute indices of a single face corner.
+    /// Indices are zero-based and already resolved, -1 if attribute is not present
+    struct OBJCorner {
+        i32 position;
+        i32 uv;
+        i32 normal;
+    };
+
+    /// @brief Name written in an .obj statement.
+    /// Points into source file memory, not null-terminated
+    struct OBJName {
+        const char* text;
+        usize length;
+    };
+
+    /// @brief Run of triangles that belong to the same object, group and material
+    struct OBJGroup {
+        usize firstCorner;
+        usize cornerCount;
+        /// @brief Index into OBJData materials, -1 if group has no material
+        i32 material;
+    };
+
+    /// @brief Raw attribute streams of an .obj file
+    struct OBJData {
+        usize positionCount;
+        smath::vec3* positions;
+        usize uvCount;
+        smath::vec2* uvs;
+        usize normalCount;
+        smath::vec3* normals;
+        /// @brief Triangulated face corners, three corners per triangle
+        usize cornerCount;
+        OBJCorner* corners;
+        /// @brief Groups in file order, every corner belongs to exactly one group.
+        /// A new group starts at every o, g and usemtl statement
+        usize groupCount;
+        OBJGroup* groups;
+        /// @brief Unique material names in order of first use
+        usize materialCount;
+        OBJName* materials;
+        /// @brief Unique mtllib names in file order, whole rest of the statement is a single name
+        usize materialLibraryCount;
+        OBJName* materialLibraries;
+    };
+
+    /// @brief Parse OBJ attributes from file.
+    /// Parses directly from file memory, all attribute arrays are allocated once up front.
+    /// Result is identical no matter how many threads are used.
+    /// @param sourceFile file to parse, must outlive result
+    /// @param options parse options, nullptr for defaults
+    /// @param result [out] parsed data, free with FreeOBJData
+    /// @return true if successful
+    bool ParseOBJData( const Platform::File* sourceFile, const OBJParseOptions* options, OBJData* result );
+    /// @brief Free OBJ data
+    void FreeOBJData( OBJData* data );
+    /// @brief Copy material library and material names out of file memory
+    /// @param data parsed data
+    /// @param result [out] names, empty if file has neither, free with FreeMeshMaterialNames
+    /// @return false if allocation failed
+    bool CreateOBJMaterialNames( const OBJData* data, MeshMaterialNames* result );
+
+    /// @brief Attribute streams of an .obj file spilled to temporary files.
+    /// Positions, uvs and normals are written as smath::vec3, smath::vec2 and smath::vec3
+    /// records in file order, triangulated corners as OBJCorner records
+    struct OBJStreamData {
+        usize positionCount;
+        usize uvCount;
+        usize normalCount;
+        usize cornerCount;
+        /// @brief Number of corners without normal
+        usize missingNormalCount;
+        /// @brief Groups in file order, see OBJData
+        usize groupCount;
+        OBJGroup* groups;
+        /// @brief Number of unique material names
+        usize materialCount;
+        /// @brief Copies of unique mtllib and material names, see OBJData
+        MeshMaterialNames materialNames;
+
+        char positionPath[CACHE_PATH_MAX_LEN];
+        char uvPath[CACHE_PATH_MAX_LEN];
+        char normalPath[CACHE_PATH_MAX_LEN];
+        char cornerPath[CACHE_PATH_MAX_LEN];
+    };
+
+    /// @brief Parse OBJ attributes from file through a fixed-size window.
+    /// Attributes are spilled to temporary files in the cache directory as they are parsed,
+    /// memory use doesn't depend on file size
+    /// @param filePath path to file
+    /// @param sourceHash content hash of file, names temporary files
+    /// @param memoryBudget maximum number of bytes held in memory
+    /// @param result [out] spilled streams, free with FreeOBJStreamData
+    /// @return true if successful
+    bool ParseOBJStream( const char* filePath, u64 sourceHash, usize memoryBudget, OBJStreamData* result );
+    /// @brief Delete temporary files, free groups and names
+    void FreeOBJStreamData( OBJStreamData* data );
+
+    /// @brief Load OBJ model from file without touching the GPU, safe to call from any thread.
+    /// Mesh is read from the mesh cache if possible, otherwise it is built and written to the cache
+    /// @param sourceFile file to parse
+    /// @param options parse options, nullptr for defaults
+    /// @param result [out] upload data, free with FreeMeshUploadData
+    /// @return true if successful
+    bool LoadOBJ(
+        const Platform::File* sourceFile,
+        const OBJParseOptions* options,
+        MeshUploadData* result
+    );
+
+    /// @brief Load OBJ model from path without touching the GPU, safe to call from any thread.
+    /// Files too large for options memory budget are streamed, built out-of-core
+    /// straight into the mesh cache and mapped from there, otherwise file is loaded with LoadOBJ
+    /// @param filePath path to file
+    /// @param options parse options, nullptr for defaults
+    /// @param result [out] upload data, free with FreeMeshUploadData
+    /// @return true if successful
+    bool LoadOBJFile(
+        const char* filePath,
+        const OBJParseOptions* options,
+        MeshUploadData* result
+    );
+
+    /// @brief Mesh cache flags of a mesh loaded with options
+    /// @param options parse options, nullptr for defaults
+    /// @return mesh cache flags
+    u32 MeshCacheFlags( const OBJParseOptions* options );
+
+    /// @brief Finish built mesh the way LoadOBJ does, shared by every mesh format.
+    /// Levels are generated, mesh is optimized and split into meshlets as options ask,
+    /// then it is written to the mesh cache and prepared for upload
+    /// @param mesh [in/out] built mesh, moved into result
+    /// @param materialNames [in/out] names sub-mesh materials refer to, moved into result, can be nullptr
+    /// @param sourceHash content hash of source file
+    /// @param sourceSize size of source file
+    /// @param options parse options, nullptr for defaults
+    /// @param result [out] upload data, free with FreeMeshUploadData
+    /// @return false if allocation failed, mesh and names are freed
+    bool FinishMeshLoad(
+        Mesh* mesh, MeshMaterialNames* materialNames,
+        u64 sourceHash, usize sourceSize,
+        const OBJParseOptions* options,
+        MeshUploadData* result
+    );
+
+    /// @brief Parse OBJ model from file and upload it.
+    /// Every object, group and material is packed into a single vertex array
     /// @param sourceFile file to parse
-    /// @param result result
+    /// @param options parse options, nullptr for defaults
+    /// @param result [out] vertex array
+    /// @param info [out] draw info, free with FreeMeshInfo
+    /// @param api renderer api
     /// @return true if successful
-    bool ParseOBJ( Platform::File* sourceFile, Platform::VertexArray* result, Platform::RendererAPI* api );
+    bool ParseOBJ(
+        Platform::File* sourceFile,
+        const OBJParseOptions* options,
+        Platform::VertexArray* result,
+        MeshInfo* info,
+        Platform::RendererAPI* api
+    );
 } // namespace Core
 
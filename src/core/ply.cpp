@@ -0,0 +1,936 @@
+/**
+ * Description:  Binary .ply loading
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "core/ply.hpp"
+#include "core/obj.hpp"
+#include "core/mesh.hpp"
+#include "core/normals.hpp"
+#include "core/renderex.hpp"
+#include "core/cache.hpp"
+#include "core/jobs.hpp"
+#include "platform/io.hpp"
+#include "util.hpp"
+
+static_assert( sizeof(Core::vertex) == 12 * sizeof(f32), "Vertex conversion writes three vectors per vertex!" );
+
+enum class PLYType : u8 {
+    INVALID,
+    I8,
+    U8,
+    I16,
+    U16,
+    I32,
+    U32,
+    F32,
+    F64,
+};
+
+static const usize PLY_TYPE_SIZES[] = { 0, 1, 1, 2, 2, 4, 4, 4, 8 };
+static const char* PLY_TYPE_NAMES[][2] = {
+    { "",       ""        },
+    { "char",   "int8"    },
+    { "uchar",  "uint8"   },
+    { "short",  "int16"   },
+    { "ushort", "uint16"  },
+    { "int",    "int32"   },
+    { "uint",   "uint32"  },
+    { "float",  "float32" },
+    { "double", "float64" },
+};
+
+/// @brief Word of a header line, points into file memory
+struct PLYToken {
+    const char* text;
+    usize length;
+};
+
+struct PLYProperty {
+    PLYToken name;
+    /// @brief Type of value, type of list items if property is a list
+    PLYType type;
+    /// @brief Type of list length, INVALID if property isn't a list
+    PLYType countType;
+    /// @brief Offset in record, only valid up to the first list property
+    usize offset;
+};
+
+struct PLYElement {
+    PLYToken name;
+    usize count;
+    u32 propertyCount;
+    PLYProperty properties[PLY_MAX_PROPERTIES];
+    /// @brief Size of scalar properties in bytes, record size if element has no lists
+    usize stride;
+    bool hasList;
+};
+
+struct PLYHeader {
+    bool bigEndian;
+    /// @brief Offset of first record from start of file
+    usize dataOffset;
+    u32 elementCount;
+    PLYElement elements[PLY_MAX_ELEMENTS];
+};
+
+enum PLYVertexProperty : u32 {
+    PLY_X,
+    PLY_Y,
+    PLY_Z,
+    PLY_NX,
+    PLY_NY,
+    PLY_NZ,
+    PLY_U,
+    PLY_V,
+    PLY_VERTEX_PROPERTY_COUNT
+};
+
+/// @brief Where vertex attributes are in a vertex record
+struct PLYVertexLayout {
+    usize stride;
+    usize offsets[PLY_VERTEX_PROPERTY_COUNT];
+    /// @brief INVALID if property is missing
+    PLYType types[PLY_VERTEX_PROPERTY_COUNT];
+    bool hasNormals;
+    bool hasUVs;
+    bool bigEndian;
+    /// @brief Positions, normals and uvs are consecutive little-endian floats, converted with SSE
+    bool packed;
+    /// @brief Bytes read from start of a record by a single SSE conversion
+    usize packedReadSize;
+};
+
+/// @brief Vertex record range converted by a single job
+struct PLYVertexChunk {
+    const PLYVertexLayout* layout;
+    const u8* records;
+    usize count;
+    /// @brief Records that can be converted with SSE without reading past end of file
+    usize packedCount;
+    Core::vertex* vertices;
+    /// @brief [out] bounds of converted positions
+    smath::vec3 boundsMin;
+    smath::vec3 boundsMax;
+};
+
+/// @brief Triangle record range converted by a single job
+struct PLYFaceChunk {
+    const u8* records;
+    usize count;
+    usize stride;
+    /// @brief Offset of index list in record
+    usize listOffset;
+    PLYType countType;
+    PLYType indexType;
+    bool bigEndian;
+    /// @brief Records whose index list can be loaded 16 bytes at a time without reading past end of file
+    usize packedCount;
+    u32 vertexCount;
+    u32* indices;
+    /// @brief [out] a face isn't a triangle, records after it aren't where chunk expects them
+    bool notTriangles;
+    /// @brief [out] a face references a vertex that doesn't exist
+    bool invalidIndex;
+};
+
+static inline bool PLYIsSpace( char c ) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+/// @brief Read next word of line
+/// @return false if line has no words left
+static bool PLYNextToken( const char*& at, const char* lineEnd, PLYToken* result ) {
+    while( at < lineEnd && PLYIsSpace( *at ) ) {
+        at++;
+    }
+    if( at == lineEnd ) {
+        return false;
+    }
+    result->text = at;
+    while( at < lineEnd && !PLYIsSpace( *at ) ) {
+        at++;
+    }
+    result->length = (usize)( at - result->text );
+    return true;
+}
+
+static inline bool PLYTokenCmp( const PLYToken& token, const char* text ) {
+    return stringCmp( token.length, token.text, stringLen( text ), text );
+}
+
+static PLYType PLYParseType( const PLYToken& token ) {
+    for( u32 type = (u32)PLYType::I8; type < ARRAY_COUNT( PLY_TYPE_NAMES ); ++type ) {
+        if( PLYTokenCmp( token, PLY_TYPE_NAMES[type][0] ) || PLYTokenCmp( token, PLY_TYPE_NAMES[type][1] ) ) {
+            return (PLYType)type;
+        }
+    }
+    return PLYType::INVALID;
+}
+
+static inline usize PLYTypeSize( PLYType type ) {
+    return PLY_TYPE_SIZES[(u32)type];
+}
+
+static inline bool PLYIsInteger( PLYType type ) {
+    return type != PLYType::INVALID && type != PLYType::F32 && type != PLYType::F64;
+}
+
+static bool PLYParseCount( const PLYToken& token, usize* result ) {
+    usize count = 0;
+    ucycles( token.length ) {
+        char c = token.text[i];
+        if( c < '0' || c > '9' || count > ( (usize)U64::MAX - 9 ) / 10 ) {
+            return false;
+        }
+        count = count * 10 + (usize)( c - '0' );
+    }
+    *result = count;
+    return token.length > 0;
+}
+
+/// @brief Read scalar of any type
+static f64 PLYReadScalar( const u8* at, PLYType type, bool bigEndian ) {
+    alignas(8) u8 bytes[8];
+    usize size = PLYTypeSize( type );
+    ucycles( size ) {
+        bytes[i] = bigEndian ? at[size - 1 - i] : at[i];
+    }
+    switch( type ) {
+        case PLYType::I8:  return (f64)*(i8*)bytes;
+        case PLYType::U8:  return (f64)*(u8*)bytes;
+        case PLYType::I16: return (f64)*(i16*)bytes;
+        case PLYType::U16: return (f64)*(u16*)bytes;
+        case PLYType::I32: return (f64)*(i32*)bytes;
+        case PLYType::U32: return (f64)*(u32*)bytes;
+        case PLYType::F32: return (f64)*(f32*)bytes;
+        case PLYType::F64: return *(f64*)bytes;
+        default: return 0.0;
+    }
+}
+
+static bool PLYParseHeader( usize size, const char* text, PLYHeader* result ) {
+    *result = {};
+    const char* end = text + size;
+    const char* at  = text;
+    bool firstLine = true;
+    bool hasFormat = false;
+    while( at < end ) {
+        const char* lineEnd = at;
+        while( lineEnd < end && *lineEnd != '\n' ) {
+            lineEnd++;
+        }
+        if( lineEnd == end ) {
+            break;
+        }
+        const char* lineAt = at;
+        at = lineEnd + 1;
+
+        PLYToken keyword = {};
+        bool isEmpty = !PLYNextToken( lineAt, lineEnd, &keyword );
+        if( firstLine ) {
+            if( isEmpty || !PLYTokenCmp( keyword, "ply" ) ) {
+                LOG_ERROR( "PLY > File is not a ply!" );
+                return false;
+            }
+            firstLine = false;
+            continue;
+        }
+        if( isEmpty ) {
+            continue;
+        }
+
+        if( PLYTokenCmp( keyword, "end_header" ) ) {
+            if( !hasFormat ) {
+                LOG_ERROR( "PLY > Header has no format!" );
+                return false;
+            }
+            result->dataOffset = (usize)( at - text );
+            return true;
+        } else if( PLYTokenCmp( keyword, "format" ) ) {
+            PLYToken format = {};
+            PLYNextToken( lineAt, lineEnd, &format );
+            if( PLYTokenCmp( format, "binary_little_endian" ) ) {
+                result->bigEndian = false;
+            } else if( PLYTokenCmp( format, "binary_big_endian" ) ) {
+                result->bigEndian = true;
+            } else {
+                LOG_ERROR( "PLY > Only binary ply files are supported!" );
+                return false;
+            }
+            hasFormat = true;
+        } else if( PLYTokenCmp( keyword, "element" ) ) {
+            if( result->elementCount == PLY_MAX_ELEMENTS ) {
+                LOG_ERROR( "PLY > File has too many elements!" );
+                return false;
+            }
+            PLYElement* element = &result->elements[result->elementCount++];
+            PLYToken count = {};
+            if(
+                !PLYNextToken( lineAt, lineEnd, &element->name ) ||
+                !PLYNextToken( lineAt, lineEnd, &count ) ||
+                !PLYParseCount( count, &element->count )
+            ) {
+                LOG_ERROR( "PLY > Invalid element!" );
+                return false;
+            }
+        } else if( PLYTokenCmp( keyword, "property" ) ) {
+            if( result->elementCount == 0 ) {
+                LOG_ERROR( "PLY > Property doesn't belong to an element!" );
+                return false;
+            }
+            PLYElement* element = &result->elements[result->elementCount - 1];
+            if( element->propertyCount == PLY_MAX_PROPERTIES ) {
+                LOG_ERROR( "PLY > Element has too many properties!" );
+                return false;
+            }
+            PLYProperty* property = &element->properties[element->propertyCount++];
+            PLYToken type = {};
+            PLYNextToken( lineAt, lineEnd, &type );
+            if( PLYTokenCmp( type, "list" ) ) {
+                PLYToken countType = {};
+                PLYNextToken( lineAt, lineEnd, &countType );
+                PLYNextToken( lineAt, lineEnd, &type );
+                property->countType = PLYParseType( countType );
+                if( !PLYIsInteger( property->countType ) ) {
+                    LOG_ERROR( "PLY > List length must be an integer!" );
+                    return false;
+                }
+                element->hasList = true;
+            } else {
+                property->offset = element->stride;
+                element->stride += PLYTypeSize( PLYParseType( type ) );
+            }
+            property->type = PLYParseType( type );
+            if( property->type == PLYType::INVALID || !PLYNextToken( lineAt, lineEnd, &property->name ) ) {
+                LOG_ERROR( "PLY > Invalid property!" );
+                return false;
+            }
+        }
+        // NOTE(alicia): comment, obj_info and unknown lines are skipped
+    }
+    LOG_ERROR( "PLY > Header doesn't end!" );
+    return false;
+}
+
+/// @brief Skip every record of element
+/// @return first byte after element, nullptr if file ends before element does
+static const u8* PLYSkipRecords( const PLYElement* element, const u8* at, const u8* end, bool bigEndian ) {
+    if( !element->hasList ) {
+        if( element->stride && element->count > (usize)( end - at ) / element->stride ) {
+            return nullptr;
+        }
+        return at + element->count * element->stride;
+    }
+    ucycles( element->count ) {
+        ucyclesi( element->propertyCount, p ) {
+            const PLYProperty& property = element->properties[p];
+            if( property.countType == PLYType::INVALID ) {
+                usize size = PLYTypeSize( property.type );
+                if( (usize)( end - at ) < size ) {
+                    return nullptr;
+                }
+                at += size;
+                continue;
+            }
+            usize countSize = PLYTypeSize( property.countType );
+            if( (usize)( end - at ) < countSize ) {
+                return nullptr;
+            }
+            f64 count = PLYReadScalar( at, property.countType, bigEndian );
+            at += countSize;
+            usize listSize = (usize)( count > 0.0 ? count : 0.0 ) * PLYTypeSize( property.type );
+            if( (usize)( end - at ) < listSize ) {
+                return nullptr;
+            }
+            at += listSize;
+        }
+    }
+    return at;
+}
+
+static bool PLYFindVertexLayout( const PLYElement* element, bool bigEndian, PLYVertexLayout* result ) {
+    static const char* NAMES[PLY_VERTEX_PROPERTY_COUNT][4] = {
+        { "x",  "",         "",          ""          },
+        { "y",  "",         "",          ""          },
+        { "z",  "",         "",          ""          },
+        { "nx", "normal_x", "",          ""          },
+        { "ny", "normal_y", "",          ""          },
+        { "nz", "normal_z", "",          ""          },
+        { "u",  "s",        "texture_u", "texture_s" },
+        { "v",  "t",        "texture_v", "texture_t" },
+    };
+
+    *result = {};
+    result->stride    = element->stride;
+    result->bigEndian = bigEndian;
+    ucycles( element->propertyCount ) {
+        const PLYProperty& property = element->properties[i];
+        ucyclesi( PLY_VERTEX_PROPERTY_COUNT, attribute ) {
+            if( result->types[attribute] != PLYType::INVALID ) {
+                continue;
+            }
+            ucyclesi( 4, name ) {
+                if( NAMES[attribute][name][0] && PLYTokenCmp( property.name, NAMES[attribute][name] ) ) {
+                    result->types[attribute]   = property.type;
+                    result->offsets[attribute] = property.offset;
+                }
+            }
+        }
+    }
+    if(
+        result->types[PLY_X] == PLYType::INVALID ||
+        result->types[PLY_Y] == PLYType::INVALID ||
+        result->types[PLY_Z] == PLYType::INVALID
+    ) {
+        return false;
+    }
+    result->hasNormals =
+        result->types[PLY_NX] != PLYType::INVALID &&
+        result->types[PLY_NY] != PLYType::INVALID &&
+        result->types[PLY_NZ] != PLYType::INVALID;
+    result->hasUVs =
+        result->types[PLY_U] != PLYType::INVALID &&
+        result->types[PLY_V] != PLYType::INVALID;
+
+    auto consecutiveFloats = [result]( u32 first, u32 count ) {
+        ucycles( count ) {
+            if(
+                result->types[first + i] != PLYType::F32 ||
+                result->offsets[first + i] != result->offsets[first] + i * sizeof(f32)
+            ) {
+                return false;
+            }
+        }
+        return true;
+    };
+    result->packed =
+        !bigEndian &&
+        consecutiveFloats( PLY_X, 3 ) &&
+        ( !result->hasNormals || consecutiveFloats( PLY_NX, 3 ) ) &&
+        ( !result->hasUVs || consecutiveFloats( PLY_U, 2 ) );
+
+    // NOTE(alicia): positions and normals are loaded as four floats, uvs as two
+    result->packedReadSize = result->offsets[PLY_X] + 4 * sizeof(f32);
+    if( result->hasNormals && result->offsets[PLY_NX] + 4 * sizeof(f32) > result->packedReadSize ) {
+        result->packedReadSize = result->offsets[PLY_NX] + 4 * sizeof(f32);
+    }
+    if( result->hasUVs && result->offsets[PLY_U] + 2 * sizeof(f32) > result->packedReadSize ) {
+        result->packedReadSize = result->offsets[PLY_U] + 2 * sizeof(f32);
+    }
+    return true;
+}
+
+static inline f32 PLYReadAttribute( const u8* record, const PLYVertexLayout* layout, u32 attribute ) {
+    return (f32)PLYReadScalar( record + layout->offsets[attribute], layout->types[attribute], layout->bigEndian );
+}
+
+static void PLYVertexJob( void* params ) {
+    PLYVertexChunk* chunk = (PLYVertexChunk*)params;
+    const PLYVertexLayout* layout = chunk->layout;
+
+    __m128 boundsMin = _mm_set1_ps( F32::MAX );
+    __m128 boundsMax = _mm_set1_ps( -F32::MAX );
+
+    usize first = 0;
+    if( layout->packed ) {
+        const u8* record = chunk->records;
+        f32* out = (f32*)chunk->vertices;
+        for( ; first < chunk->packedCount; ++first, record += layout->stride, out += 12 ) {
+            // NOTE(alicia): SSE, w of position and normal is whatever follows them in the record
+            __m128 position = _mm_loadu_ps( (const f32*)( record + layout->offsets[PLY_X] ) );
+            __m128 normal = layout->hasNormals ?
+                _mm_loadu_ps( (const f32*)( record + layout->offsets[PLY_NX] ) ) : _mm_setzero_ps();
+            __m128 uv = layout->hasUVs ?
+                _mm_castpd_ps( _mm_load_sd( (const f64*)( record + layout->offsets[PLY_U] ) ) ) : position;
+
+            // vertex is position, uv, normal and tangent, written as three vectors
+            __m128 zzuu = _mm_shuffle_ps( position, uv, _MM_SHUFFLE( 0, 0, 2, 2 ) );
+            __m128 vvnn = _mm_shuffle_ps( uv, normal, _MM_SHUFFLE( 0, 0, 1, 1 ) );
+            _mm_storeu_ps( out + 0, _mm_shuffle_ps( position, zzuu, _MM_SHUFFLE( 2, 0, 1, 0 ) ) );
+            _mm_storeu_ps( out + 4, _mm_shuffle_ps( vvnn, normal, _MM_SHUFFLE( 2, 1, 2, 0 ) ) );
+            _mm_storeu_ps( out + 8, _mm_setzero_ps() );
+
+            boundsMin = _mm_min_ps( boundsMin, position );
+            boundsMax = _mm_max_ps( boundsMax, position );
+        }
+    }
+    for( ; first < chunk->count; ++first ) {
+        const u8* record = chunk->records + first * layout->stride;
+        Core::vertex* vertex = &chunk->vertices[first];
+        vertex->position.x = PLYReadAttribute( record, layout, PLY_X );
+        vertex->position.y = PLYReadAttribute( record, layout, PLY_Y );
+        vertex->position.z = PLYReadAttribute( record, layout, PLY_Z );
+        if( layout->hasNormals ) {
+            vertex->normal.x = PLYReadAttribute( record, layout, PLY_NX );
+            vertex->normal.y = PLYReadAttribute( record, layout, PLY_NY );
+            vertex->normal.z = PLYReadAttribute( record, layout, PLY_NZ );
+        }
+        if( layout->hasUVs ) {
+            vertex->uv.x = PLYReadAttribute( record, layout, PLY_U );
+            vertex->uv.y = PLYReadAttribute( record, layout, PLY_V );
+        } else {
+            vertex->uv.x = vertex->position.x;
+            vertex->uv.y = vertex->position.y;
+        }
+
+        __m128 position = _mm_setr_ps( vertex->position.x, vertex->position.y, vertex->position.z, 0.0f );
+        boundsMin = _mm_min_ps( boundsMin, position );
+        boundsMax = _mm_max_ps( boundsMax, position );
+    }
+
+    f32 bounds[2][4];
+    _mm_storeu_ps( bounds[0], boundsMin );
+    _mm_storeu_ps( bounds[1], boundsMax );
+    chunk->boundsMin = smath::vec3( bounds[0][0], bounds[0][1], bounds[0][2] );
+    chunk->boundsMax = smath::vec3( bounds[1][0], bounds[1][1], bounds[1][2] );
+}
+
+static void PLYFaceJob( void* params ) {
+    PLYFaceChunk* chunk = (PLYFaceChunk*)params;
+
+    usize first = 0;
+    if( chunk->packedCount ) {
+        // NOTE(alicia): SSE, u8 length followed by three 32-bit indices.
+        // indices are compared unsigned by flipping their sign bit
+        const __m128i signBit     = _mm_set1_epi32( I32::MIN );
+        const __m128i vertexCount = _mm_xor_si128( _mm_set1_epi32( (i32)chunk->vertexCount ), signBit );
+        const u8* list = chunk->records + chunk->listOffset;
+        u32* out = chunk->indices;
+        for( ; first < chunk->packedCount; ++first, list += chunk->stride, out += 3 ) {
+            __m128i bytes   = _mm_loadu_si128( (const __m128i*)list );
+            __m128i indices = _mm_srli_si128( bytes, 1 );
+            __m128i inRange = _mm_cmplt_epi32( _mm_xor_si128( indices, signBit ), vertexCount );
+            if( ( _mm_cvtsi128_si32( bytes ) & 0xFF ) != 3 ) {
+                chunk->notTriangles = true;
+                return;
+            }
+            if( ( _mm_movemask_ps( _mm_castsi128_ps( inRange ) ) & 0x7 ) != 0x7 ) {
+                chunk->invalidIndex = true;
+                return;
+            }
+            _mm_storel_epi64( (__m128i*)out, indices );
+            out[2] = (u32)_mm_cvtsi128_si32( _mm_srli_si128( indices, 8 ) );
+        }
+    }
+
+    usize countSize = PLYTypeSize( chunk->countType );
+    usize indexSize = PLYTypeSize( chunk->indexType );
+    for( ; first < chunk->count; ++first ) {
+        const u8* list = chunk->records + first * chunk->stride + chunk->listOffset;
+        if( PLYReadScalar( list, chunk->countType, chunk->bigEndian ) != 3.0 ) {
+            chunk->notTriangles = true;
+            return;
+        }
+        ucycles( 3 ) {
+            f64 index = PLYReadScalar( list + countSize + i * indexSize, chunk->indexType, chunk->bigEndian );
+            if( index < 0.0 || index >= (f64)chunk->vertexCount ) {
+                chunk->invalidIndex = true;
+                return;
+            }
+            chunk->indices[first * 3 + i] = (u32)index;
+        }
+    }
+}
+
+/// @brief Read faces of any size on a single thread, polygons are fanned into triangles
+/// @return false if file is truncated, a face references a vertex that doesn't exist or allocation failed
+static bool PLYReadPolygons(
+    const PLYElement* element, u32 listProperty,
+    const u8* records, const u8* end, bool bigEndian,
+    usize vertexCount, usize* indexCount, u32** indices
+) {
+    // first pass counts triangles, second pass writes them
+    usize triangleCount = 0;
+    *indices = nullptr;
+    ucyclesi( 2, pass ) {
+        if( pass == 1 ) {
+            if( triangleCount * 3 > (usize)U32::MAX ) {
+                LOG_ERROR( "BuildPLYMesh > Mesh has too many triangles! %llu", triangleCount );
+                return false;
+            }
+            *indices = (u32*)Platform::Alloc( triangleCount * 3 * sizeof(u32) );
+            if( !*indices ) {
+                LOG_ERROR( "BuildPLYMesh > Failed to allocate indices!" );
+                return false;
+            }
+        }
+
+        const u8* at = records;
+        usize written = 0;
+        ucycles( element->count ) {
+            ucyclesi( element->propertyCount, p ) {
+                const PLYProperty& property = element->properties[p];
+                if( property.countType == PLYType::INVALID ) {
+                    usize size = PLYTypeSize( property.type );
+                    if( (usize)( end - at ) < size ) {
+                        LOG_ERROR( "BuildPLYMesh > File is truncated!" );
+                        return false;
+                    }
+                    at += size;
+                    continue;
+                }
+                usize countSize = PLYTypeSize( property.countType );
+                usize itemSize  = PLYTypeSize( property.type );
+                if( (usize)( end - at ) < countSize ) {
+                    LOG_ERROR( "BuildPLYMesh > File is truncated!" );
+                    return false;
+                }
+                f64 countValue = PLYReadScalar( at, property.countType, bigEndian );
+                usize count = (usize)( countValue > 0.0 ? countValue : 0.0 );
+                at += countSize;
+                if( (usize)( end - at ) < count * itemSize ) {
+                    LOG_ERROR( "BuildPLYMesh > File is truncated!" );
+                    return false;
+                }
+
+                if( p == listProperty && count >= 3 ) {
+                    if( pass == 0 ) {
+                        triangleCount += count - 2;
+                    } else {
+                        u32 first    = 0;
+                        u32 previous = 0;
+                        ucyclesi( count, corner ) {
+                            f64 index = PLYReadScalar( at + corner * itemSize, property.type, bigEndian );
+                            if( index < 0.0 || index >= (f64)vertexCount ) {
+                                LOG_ERROR( "BuildPLYMesh > Face references an invalid vertex!" );
+                                return false;
+                            }
+                            if( corner == 0 ) {
+                                first = (u32)index;
+                            } else if( corner >= 2 ) {
+                                (*indices)[written++] = first;
+                                (*indices)[written++] = previous;
+                                (*indices)[written++] = (u32)index;
+                            }
+                            previous = (u32)index;
+                        }
+                    }
+                }
+                at += count * itemSize;
+            }
+        }
+    }
+    *indexCount = triangleCount * 3;
+    return true;
+}
+
+/// @brief Number of jobs records are split into
+static usize PLYChunkCount( Core::JobQueue* queue, usize recordCount ) {
+    usize chunkCount = queue ? JobQueueThreadCount( queue ) : 1;
+    if( chunkCount > PLY_MAX_JOBS ) {
+        chunkCount = PLY_MAX_JOBS;
+    }
+    if( chunkCount > recordCount / PLY_MIN_JOB_RECORDS ) {
+        chunkCount = recordCount / PLY_MIN_JOB_RECORDS;
+    }
+    return chunkCount ? chunkCount : 1;
+}
+
+/// @brief Run job for every chunk and wait for them
+static void PLYRunJobs(
+    Core::JobQueue* queue, Core::JobFN job,
+    usize chunkCount, usize chunkSize, void* chunks
+) {
+    if( chunkCount == 1 ) {
+        job( chunks );
+        return;
+    }
+    Core::JobCounter counter = {};
+    ucycles( chunkCount ) {
+        Core::PushJob( queue, job, (u8*)chunks + i * chunkSize, &counter );
+    }
+    Core::WaitForJobs( queue, &counter );
+}
+
+/// @brief Read faces in parallel if every face is a triangle
+/// @return false if faces aren't all triangles or fast path doesn't apply, indices are left empty
+static bool PLYReadTriangles(
+    const PLYElement* element, u32 listProperty,
+    const u8* records, const u8* end, bool bigEndian,
+    usize vertexCount, Core::JobQueue* queue,
+    bool* invalidIndex, usize* indexCount, u32** indices
+) {
+    *invalidIndex = false;
+    // NOTE(alicia): list can't be found without reading every record before it if there is more than one
+    usize listOffset = 0;
+    ucycles( element->propertyCount ) {
+        const PLYProperty& property = element->properties[i];
+        if( i != listProperty && property.countType != PLYType::INVALID ) {
+            return false;
+        }
+        if( i < listProperty ) {
+            listOffset += PLYTypeSize( property.type );
+        }
+    }
+
+    const PLYProperty& list = element->properties[listProperty];
+    usize stride = element->stride + PLYTypeSize( list.countType ) + 3 * PLYTypeSize( list.type );
+    if( element->count > (usize)( end - records ) / stride || element->count * 3 > (usize)U32::MAX ) {
+        return false;
+    }
+
+    u32* triangles = (u32*)Platform::Alloc( element->count * 3 * sizeof(u32) );
+    if( !triangles ) {
+        return false;
+    }
+
+    bool packed =
+        !bigEndian &&
+        list.countType == PLYType::U8 &&
+        ( list.type == PLYType::I32 || list.type == PLYType::U32 ) &&
+        vertexCount <= (usize)I32::MAX;
+    // records whose 16 byte list load stays inside the file
+    usize packedLimit = 0;
+    usize available = (usize)( end - records );
+    if( packed && available >= listOffset + 16 ) {
+        packedLimit = ( available - listOffset - 16 ) / stride + 1;
+    }
+
+    usize chunkCount = PLYChunkCount( queue, element->count );
+    usize recordsPerChunk = ( element->count + chunkCount - 1 ) / chunkCount;
+    PLYFaceChunk chunks[PLY_MAX_JOBS];
+    ucycles( chunkCount ) {
+        PLYFaceChunk* chunk = &chunks[i];
+        *chunk = {};
+        usize firstRecord = i * recordsPerChunk < element->count ? i * recordsPerChunk : element->count;
+        chunk->count       = element->count - firstRecord < recordsPerChunk ? element->count - firstRecord : recordsPerChunk;
+        chunk->records     = records + firstRecord * stride;
+        chunk->stride      = stride;
+        chunk->listOffset  = listOffset;
+        chunk->countType   = list.countType;
+        chunk->indexType   = list.type;
+        chunk->bigEndian   = bigEndian;
+        chunk->packedCount = packedLimit > firstRecord ?
+            ( packedLimit - firstRecord < chunk->count ? packedLimit - firstRecord : chunk->count ) : 0;
+        chunk->vertexCount = (u32)vertexCount;
+        chunk->indices     = triangles + firstRecord * 3;
+    }
+    PLYRunJobs( queue, PLYFaceJob, chunkCount, sizeof(PLYFaceChunk), chunks );
+
+    bool notTriangles = false;
+    ucycles( chunkCount ) {
+        notTriangles  |= chunks[i].notTriangles;
+        *invalidIndex |= chunks[i].invalidIndex;
+    }
+    if( notTriangles || *invalidIndex ) {
+        Platform::Free( triangles );
+        // NOTE(alicia): chunks after a polygon read garbage, an invalid index there means nothing
+        if( notTriangles ) {
+            *invalidIndex = false;
+        }
+        return false;
+    }
+    *indexCount = element->count * 3;
+    *indices    = triangles;
+    return true;
+}
+
+bool Core::BuildPLYMesh( usize size, const void* data, JobQueue* queue, Mesh* result ) {
+    u64 startTime = Platform::GetPerformanceCounter();
+
+    *result = {};
+    PLYHeader header;
+    if( !PLYParseHeader( size, (const char*)data, &header ) ) {
+        return false;
+    }
+    const u8* begin = (const u8*)data;
+    const u8* end   = begin + size;
+
+    // NOTE(alicia): elements other than vertex and face are skipped,
+    // elements after both of them are never touched
+    const PLYElement* vertexElement = nullptr;
+    const PLYElement* faceElement   = nullptr;
+    const u8* vertexRecords = nullptr;
+    const u8* faceRecords   = nullptr;
+    const u8* at = begin + header.dataOffset;
+    ucycles( header.elementCount ) {
+        const PLYElement* element = &header.elements[i];
+        if( !vertexElement && PLYTokenCmp( element->name, "vertex" ) ) {
+            vertexElement = element;
+            vertexRecords = at;
+        } else if( !faceElement && PLYTokenCmp( element->name, "face" ) ) {
+            faceElement = element;
+            faceRecords = at;
+        }
+        if( vertexElement && faceElement ) {
+            break;
+        }
+        at = PLYSkipRecords( element, at, end, header.bigEndian );
+        if( !at ) {
+            LOG_ERROR( "BuildPLYMesh > File is truncated!" );
+            return false;
+        }
+    }
+    if( !vertexElement || !faceElement ) {
+        LOG_ERROR( "BuildPLYMesh > File has no vertices or no faces!" );
+        return false;
+    }
+    if( vertexElement->hasList || !PLYSkipRecords( vertexElement, vertexRecords, end, header.bigEndian ) ) {
+        LOG_ERROR( "BuildPLYMesh > Vertices are truncated or have list properties!" );
+        return false;
+    }
+    if( vertexElement->count > (usize)U32::MAX ) {
+        LOG_ERROR( "BuildPLYMesh > Mesh has too many vertices! %llu", vertexElement->count );
+        return false;
+    }
+
+    PLYVertexLayout layout = {};
+    if( !PLYFindVertexLayout( vertexElement, header.bigEndian, &layout ) ) {
+        LOG_ERROR( "BuildPLYMesh > Vertices have no position!" );
+        return false;
+    }
+    u32 listProperty = U32::MAX;
+    ucycles( faceElement->propertyCount ) {
+        const PLYProperty& property = faceElement->properties[i];
+        if(
+            property.countType != PLYType::INVALID && PLYIsInteger( property.type ) &&
+            ( PLYTokenCmp( property.name, "vertex_indices" ) || PLYTokenCmp( property.name, "vertex_index" ) )
+        ) {
+            listProperty = (u32)i;
+            break;
+        }
+    }
+    if( listProperty == U32::MAX ) {
+        LOG_ERROR( "BuildPLYMesh > Faces have no vertex indices!" );
+        return false;
+    }
+
+    usize vertexCount = vertexElement->count;
+    result->vertices  = (Core::vertex*)Platform::Alloc( vertexCount * sizeof(Core::vertex) );
+    if( !result->vertices && vertexCount ) {
+        LOG_ERROR( "BuildPLYMesh > Failed to allocate vertices!" );
+        return false;
+    }
+    result->vertexCount = vertexCount;
+
+    // records whose SSE loads stay inside the file
+    usize packedLimit = 0;
+    usize available = (usize)( end - vertexRecords );
+    if( layout.packed && available >= layout.packedReadSize ) {
+        packedLimit = ( available - layout.packedReadSize ) / layout.stride + 1;
+    }
+
+    usize chunkCount = PLYChunkCount( queue, vertexCount );
+    usize recordsPerChunk = ( vertexCount + chunkCount - 1 ) / chunkCount;
+    PLYVertexChunk vertexChunks[PLY_MAX_JOBS];
+    ucycles( chunkCount ) {
+        PLYVertexChunk* chunk = &vertexChunks[i];
+        *chunk = {};
+        usize firstRecord = i * recordsPerChunk < vertexCount ? i * recordsPerChunk : vertexCount;
+        chunk->layout      = &layout;
+        chunk->count       = vertexCount - firstRecord < recordsPerChunk ? vertexCount - firstRecord : recordsPerChunk;
+        chunk->records     = vertexRecords + firstRecord * layout.stride;
+        chunk->packedCount = packedLimit > firstRecord ?
+            ( packedLimit - firstRecord < chunk->count ? packedLimit - firstRecord : chunk->count ) : 0;
+        chunk->vertices    = result->vertices + firstRecord;
+    }
+    PLYRunJobs( queue, PLYVertexJob, chunkCount, sizeof(PLYVertexChunk), vertexChunks );
+
+    bool invalidIndex = false;
+    if( !PLYReadTriangles(
+        faceElement, listProperty, faceRecords, end, header.bigEndian,
+        vertexCount, queue, &invalidIndex, &result->indexCount, &result->indices
+    ) ) {
+        if( invalidIndex ) {
+            LOG_ERROR( "BuildPLYMesh > Face references an invalid vertex!" );
+            FreeMesh( result );
+            return false;
+        }
+        if( !PLYReadPolygons(
+            faceElement, listProperty, faceRecords, end, header.bigEndian,
+            vertexCount, &result->indexCount, &result->indices
+        ) ) {
+            FreeMesh( result );
+            return false;
+        }
+    }
+    if( result->indexCount == 0 ) {
+        LOG_ERROR( "BuildPLYMesh > File has no triangles!" );
+        FreeMesh( result );
+        return false;
+    }
+
+    result->subMeshCount = 1;
+    result->subMeshes    = (SubMesh*)Platform::Alloc( sizeof(SubMesh) );
+    if( !result->subMeshes ) {
+        LOG_ERROR( "BuildPLYMesh > Failed to allocate sub-mesh!" );
+        FreeMesh( result );
+        return false;
+    }
+    result->subMeshes[0].indexCount  = (u32)result->indexCount;
+    result->subMeshes[0].vertexCount = (u32)vertexCount;
+    result->subMeshes[0].material    = -1;
+
+    result->boundsMin = vertexChunks[0].boundsMin;
+    result->boundsMax = vertexChunks[0].boundsMax;
+    for( usize i = 1; i < chunkCount; ++i ) {
+        if( vertexChunks[i].count == 0 ) {
+            continue;
+        }
+        ucyclesi( 3, axis ) {
+            if( vertexChunks[i].boundsMin[axis] < result->boundsMin[axis] ) {
+                result->boundsMin[axis] = vertexChunks[i].boundsMin[axis];
+            }
+            if( vertexChunks[i].boundsMax[axis] > result->boundsMax[axis] ) {
+                result->boundsMax[axis] = vertexChunks[i].boundsMax[axis];
+            }
+        }
+    }
+
+    f64 elapsedSeconds = (f64)( Platform::GetPerformanceCounter() - startTime ) /
+        (f64)Platform::GetPerformanceFrequency();
+    f64 megabytes = (f64)size / (f64)MEGABYTES(1);
+    LOG_INFO( "BuildPLYMesh > Converted %.2fMB in %.3fs ( %.1fMB/s ) on %llu threads, %llu vertices %llu triangles",
+        megabytes,
+        elapsedSeconds,
+        elapsedSeconds > 0.0 ? megabytes / elapsedSeconds : 0.0,
+        chunkCount,
+        result->vertexCount,
+        result->indexCount / 3
+    );
+
+    if( !layout.hasNormals && !GenerateMeshNormals( result, queue ) ) {
+        FreeMesh( result );
+        return false;
+    }
+    Core::calculateTangentBasis(
+        result->indexCount, result->indices,
+        result->vertexCount, result->vertices,
+        queue
+    );
+    return true;
+}
+
+bool Core::LoadPLYFile( const char* filePath, const OBJParseOptions* options, MeshUploadData* result ) {
+    usize subStrPos = 0;
+    if( !subStringPos( filePath, ".ply", &subStrPos ) ) {
+        LOG_WARN("LoadPLYFile > Attempted to parse a file that is not a ply!");
+        return false;
+    }
+
+    Platform::MappedFile file = {};
+    if( !Platform::MapFile( filePath, &file ) ) {
+        LOG_ERROR( "LoadPLYFile > Failed to map \"%s\"!", filePath );
+        return false;
+    }
+    Core::JobQueue* queue = options ? options->jobQueue : nullptr;
+    usize sourceSize = file.size;
+
+    u64 sourceHash = 0;
+    if( !options || !options->skipCache ) {
+        sourceHash = Core::HashContents( file.size, file.data, queue );
+        if( Core::LoadMeshCacheData( sourceHash, sourceSize, MeshCacheFlags( options ), result ) ) {
+            Platform::UnmapFile( &file );
+            return true;
+        }
+    }
+
+    Core::Mesh mesh = {};
+    bool built = BuildPLYMesh( file.size, file.data, queue, &mesh );
+    Platform::UnmapFile( &file );
+    if( !built ) {
+        return false;
+    }
+    return FinishMeshLoad( &mesh, nullptr, sourceHash, sourceSize, options, result );
+}
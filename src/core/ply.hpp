@@ -0,0 +1,46 @@
+/**
+ * Description:  Binary .ply loading
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "pch.hpp"
+
+namespace Core {
+
+// forward declaration
+struct JobQueue;
+struct Mesh;
+struct MeshUploadData;
+struct OBJParseOptions;
+
+/// @brief Smallest number of records worth converting on its own job
+#define PLY_MIN_JOB_RECORDS 65536
+#define PLY_MAX_JOBS 64
+/// @brief Maximum number of elements in a file and properties of an element
+#define PLY_MAX_ELEMENTS 16
+#define PLY_MAX_PROPERTIES 32
+
+/// @brief Build mesh from binary .ply file in memory.
+/// Vertex records are fixed-size, so they are converted straight from file memory into
+/// mesh vertices in parallel record ranges, little-endian float positions, uvs and normals with SSE.
+/// Faces are read the same way while every face is a triangle, other polygons are fanned on a single thread.
+/// Vertices without normals get angle-weighted smooth normals, vertices without uvs use position xy.
+/// Mesh has a single sub-mesh without material
+/// @param size size of file in bytes
+/// @param data file memory, usually a mapped file
+/// @param queue job queue records are converted on, can be nullptr
+/// @param result [out] mesh, free with FreeMesh
+/// @return true if successful
+bool BuildPLYMesh( usize size, const void* data, JobQueue* queue, Mesh* result );
+
+/// @brief Load binary .ply model from path without touching the GPU, safe to call from any thread.
+/// File is mapped, read from the mesh cache if possible, otherwise built with BuildPLYMesh
+/// and finished like an .obj model. Crease angle and memory budget options are not used
+/// @param filePath path to file
+/// @param options parse options, nullptr for defaults
+/// @param result [out] upload data, free with FreeMeshUploadData
+/// @return true if successful
+bool LoadPLYFile( const char* filePath, const OBJParseOptions* options, MeshUploadData* result );
+
+} // namespace Core
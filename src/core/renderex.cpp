@@ -4,47 +4,459 @@
  * File Created: November 21, 2022 
 */
 #include "renderex.hpp"
+#include "core/jobs.hpp"
 #include "platform/renderer.hpp"
+#include "platform/io.hpp"
 
 Platform::VertexBufferLayout Core::vertexLayout() {
-    const usize ELEMENT_COUNT = 5;
+    const usize ELEMENT_COUNT = 4;
     Platform::VertexBufferElement elements[ELEMENT_COUNT] = {
         { Platform::DataStructure::VEC3, Platform::DataType::FLOAT, false },
         { Platform::DataStructure::VEC2, Platform::DataType::FLOAT, false },
         { Platform::DataStructure::VEC3, Platform::DataType::FLOAT, false },
-        { Platform::DataStructure::VEC3, Platform::DataType::FLOAT, false },
-        { Platform::DataStructure::VEC3, Platform::DataType::FLOAT, false },
+        { Platform::DataStructure::VEC4, Platform::DataType::FLOAT, false },
     };
 
     return Platform::CreateVertexBufferLayout( ELEMENT_COUNT, elements );
 }
 
-void Core::calculateTangentBasis( usize verticesCount, vertex* vertices ) {
-    for( usize i = 0; i < verticesCount; i += 3 ) {
-        smath::vec3& p0 = vertices[0 + i].position;
-        smath::vec3& p1 = vertices[1 + i].position;
-        smath::vec3& p2 = vertices[2 + i].position;
+Platform::VertexBufferLayout Core::packedVertexLayout() {
+    const usize ELEMENT_COUNT = 4;
+    Platform::VertexBufferElement elements[ELEMENT_COUNT] = {
+        { Platform::DataStructure::VEC4, Platform::DataType::UNSIGNED_SHORT, true },
+        { Platform::DataStructure::VEC2, Platform::DataType::HALF_FLOAT, false },
+        { Platform::DataStructure::VEC2, Platform::DataType::SHORT, true },
+        { Platform::DataStructure::VEC4, Platform::DataType::INT_2_10_10_10_REV, true },
+    };
+
+    return Platform::CreateVertexBufferLayout( ELEMENT_COUNT, elements );
+}
+
+// NOTE(alicia): SSE
+// every packing function works on four vertices at a time, one vertex per lane
+
+static inline __m128 PackClamp( __m128 value, f32 min, f32 max ) {
+    return _mm_min_ps( _mm_max_ps( value, _mm_set1_ps( min ) ), _mm_set1_ps( max ) );
+}
+
+/// @brief Convert floats to half floats, rounds to nearest even
+/// @return half float in low 16 bits of every lane, sign extended so lanes can be packed with _mm_packs_epi32
+static inline __m128i PackHalf( __m128 value ) {
+    const __m128i F16_MAX        = _mm_set1_epi32( ( 127 + 16 ) << 23 );
+    const __m128i F16_MIN_NORMAL = _mm_set1_epi32( ( 127 - 14 ) << 23 );
+    const __m128i SUBNORMAL_MAGIC = _mm_set1_epi32( ( ( 127 - 15 ) + ( 23 - 10 ) + 1 ) << 23 );
+    const __m128i NORMAL_BIAS    = _mm_set1_epi32( 0xFFF - ( ( 127 - 15 ) << 23 ) );
+    const __m128i INFINITY_BITS  = _mm_set1_epi32( 0x7C00 );
+    const __m128i NAN_BIT        = _mm_set1_epi32( 0x200 );
+
+    __m128  sign     = _mm_and_ps( value, _mm_set1_ps( -0.0f ) );
+    __m128  absolute = _mm_xor_ps( value, sign );
+    __m128i bits     = _mm_castps_si128( absolute );
+
+    __m128i isNaN       = _mm_castps_si128( _mm_cmpunord_ps( absolute, absolute ) );
+    __m128i isRegular   = _mm_cmpgt_epi32( F16_MAX, bits );
+    __m128i isSubnormal = _mm_cmpgt_epi32( F16_MIN_NORMAL, bits );
+    __m128i infOrNaN    = _mm_or_si128( _mm_and_si128( isNaN, NAN_BIT ), INFINITY_BITS );
+
+    // subnormal results, let float addition do the rounding
+    __m128i subnormal = _mm_sub_epi32(
+        _mm_castps_si128( _mm_add_ps( absolute, _mm_castsi128_ps( SUBNORMAL_MAGIC ) ) ),
+        SUBNORMAL_MAGIC
+    );
+    // normal results, rebias exponent and round mantissa to nearest even
+    __m128i mantissaOdd = _mm_srai_epi32( _mm_slli_epi32( bits, 31 - 13 ), 31 );
+    __m128i normal = _mm_srli_epi32(
+        _mm_sub_epi32( _mm_add_epi32( bits, NORMAL_BIAS ), mantissaOdd ),
+        13
+    );
+
+    __m128i finite = _mm_or_si128(
+        _mm_and_si128( isSubnormal, subnormal ),
+        _mm_andnot_si128( isSubnormal, normal )
+    );
+    __m128i result = _mm_or_si128(
+        _mm_and_si128( isRegular, finite ),
+        _mm_andnot_si128( isRegular, infOrNaN )
+    );
+    return _mm_or_si128( result, _mm_srai_epi32( _mm_castps_si128( sign ), 16 ) );
+}
+
+/// @brief Quantize 0.0-1.0 floats to unorm16
+/// @return unorm16 in low 16 bits of every lane, biased so lanes can be packed with _mm_packs_epi32
+static inline __m128i PackUNorm16( __m128 value ) {
+    __m128i quantized = _mm_cvtps_epi32( _mm_mul_ps( PackClamp( value, 0.0f, 1.0f ), _mm_set1_ps( 65535.0f ) ) );
+    // NOTE(alicia): SSE2 can only pack with signed saturation, bias is removed after packing
+    return _mm_sub_epi32( quantized, _mm_set1_epi32( 32768 ) );
+}
+
+/// @brief Encode unit vectors with octahedral mapping
+/// @param u,v [out] -1.0-1.0 octahedral coordinates
+static inline void PackOctahedral( __m128 x, __m128 y, __m128 z, __m128* u, __m128* v ) {
+    __m128 signMask = _mm_set1_ps( -0.0f );
+    __m128 one      = _mm_set1_ps( 1.0f );
+    __m128 absX = _mm_andnot_ps( signMask, x );
+    __m128 absY = _mm_andnot_ps( signMask, y );
+    __m128 absZ = _mm_andnot_ps( signMask, z );
+
+    // project on to octahedron
+    __m128 manhattan = _mm_max_ps( _mm_add_ps( _mm_add_ps( absX, absY ), absZ ), _mm_set1_ps( F32::EPSILON ) );
+    __m128 projectedX = _mm_div_ps( x, manhattan );
+    __m128 projectedY = _mm_div_ps( y, manhattan );
+
+    // fold lower hemisphere over the diagonals
+    __m128 foldedX = _mm_or_ps(
+        _mm_sub_ps( one, _mm_andnot_ps( signMask, projectedY ) ),
+        _mm_and_ps( signMask, projectedX )
+    );
+    __m128 foldedY = _mm_or_ps(
+        _mm_sub_ps( one, _mm_andnot_ps( signMask, projectedX ) ),
+        _mm_and_ps( signMask, projectedY )
+    );
+    __m128 lowerHemisphere = _mm_cmplt_ps( z, _mm_setzero_ps() );
+    *u = _mm_or_ps( _mm_and_ps( lowerHemisphere, foldedX ), _mm_andnot_ps( lowerHemisphere, projectedX ) );
+    *v = _mm_or_ps( _mm_and_ps( lowerHemisphere, foldedY ), _mm_andnot_ps( lowerHemisphere, projectedY ) );
+}
 
-        smath::vec2& uv0 = vertices[0 + i].uv;
-        smath::vec2& uv1 = vertices[1 + i].uv;
-        smath::vec2& uv2 = vertices[2 + i].uv;
+/// @brief Pack exactly four vertices
+static void PackVertices4(
+    const Core::vertex* vertices,
+    __m128 boundsMin, __m128 boundsScale,
+    Core::packedVertex* result
+) {
+    #define PACK_LOAD( member, component ) _mm_setr_ps(\
+        vertices[0].member.component, vertices[1].member.component,\
+        vertices[2].member.component, vertices[3].member.component )
 
-        smath::vec3 deltaPos1 = p1 - p0;
-        smath::vec3 deltaPos2 = p2 - p0;
+    __m128 px = PACK_LOAD( position, x ), py = PACK_LOAD( position, y ), pz = PACK_LOAD( position, z );
+    __m128 uvx = PACK_LOAD( uv, x ), uvy = PACK_LOAD( uv, y );
+    __m128 nx = PACK_LOAD( normal, x ), ny = PACK_LOAD( normal, y ), nz = PACK_LOAD( normal, z );
+    __m128 tx = PACK_LOAD( tangent, x ), ty = PACK_LOAD( tangent, y ), tz = PACK_LOAD( tangent, z );
+    __m128 tw = PACK_LOAD( tangent, w );
 
-        smath::vec2 deltaUV1 = uv1 - uv0;
-        smath::vec2 deltaUV2 = uv2 - uv0;
+    #undef PACK_LOAD
 
-        f32 r = 1.0f / ( deltaUV1.x * deltaUV2.y - deltaUV1.y * deltaUV2.x );
-        smath::vec3 t = ( deltaPos1 * deltaUV2.y - deltaPos2 * deltaUV1.y ) * r;
-        smath::vec3 b = ( deltaPos2 * deltaUV1.x - deltaPos1 * deltaUV2.x ) * r;
+    // position: x y z 0 per vertex
+    __m128i bias = _mm_set1_epi16( (i16)0x8000 );
+    __m128i qx = PackUNorm16( _mm_mul_ps( _mm_sub_ps( px, _mm_shuffle_ps( boundsMin, boundsMin, 0x00 ) ), _mm_shuffle_ps( boundsScale, boundsScale, 0x00 ) ) );
+    __m128i qy = PackUNorm16( _mm_mul_ps( _mm_sub_ps( py, _mm_shuffle_ps( boundsMin, boundsMin, 0x55 ) ), _mm_shuffle_ps( boundsScale, boundsScale, 0x55 ) ) );
+    __m128i qz = PackUNorm16( _mm_mul_ps( _mm_sub_ps( pz, _mm_shuffle_ps( boundsMin, boundsMin, 0xAA ) ), _mm_shuffle_ps( boundsScale, boundsScale, 0xAA ) ) );
+    __m128i xy = _mm_xor_si128( _mm_packs_epi32( qx, qy ), bias );
+    __m128i zw = _mm_xor_si128( _mm_packs_epi32( qz, _mm_set1_epi32( -32768 ) ), bias );
+    __m128i xyInterleaved = _mm_unpacklo_epi16( xy, _mm_unpackhi_epi64( xy, xy ) );
+    __m128i zwInterleaved = _mm_unpacklo_epi16( zw, _mm_unpackhi_epi64( zw, zw ) );
+    __m128i positions[2];
+    positions[0] = _mm_unpacklo_epi32( xyInterleaved, zwInterleaved );
+    positions[1] = _mm_unpackhi_epi32( xyInterleaved, zwInterleaved );
 
-        vertices[0 + i].tangent = t;
-        vertices[1 + i].tangent = t;
-        vertices[2 + i].tangent = t;
+    // uv: u v per vertex
+    __m128i halfUV = _mm_packs_epi32( PackHalf( uvx ), PackHalf( uvy ) );
+    __m128i uvs    = _mm_unpacklo_epi16( halfUV, _mm_unpackhi_epi64( halfUV, halfUV ) );
 
-        vertices[0 + i].bitangent = b;
-        vertices[1 + i].bitangent = b;
-        vertices[2 + i].bitangent = b;
+    // normal: octahedral u v per vertex
+    __m128 octU, octV;
+    PackOctahedral( nx, ny, nz, &octU, &octV );
+    __m128 snorm16 = _mm_set1_ps( 32767.0f );
+    __m128i octUV = _mm_packs_epi32(
+        _mm_cvtps_epi32( _mm_mul_ps( PackClamp( octU, -1.0f, 1.0f ), snorm16 ) ),
+        _mm_cvtps_epi32( _mm_mul_ps( PackClamp( octV, -1.0f, 1.0f ), snorm16 ) )
+    );
+    __m128i normals = _mm_unpacklo_epi16( octUV, _mm_unpackhi_epi64( octUV, octUV ) );
+
+    // tangent: 10 bits per axis, bitangent sign in top 2 bits
+    __m128 snorm10 = _mm_set1_ps( 511.0f );
+    __m128i mask10 = _mm_set1_epi32( 0x3FF );
+    __m128i tangents = _mm_or_si128(
+        _mm_or_si128(
+            _mm_and_si128( _mm_cvtps_epi32( _mm_mul_ps( PackClamp( tx, -1.0f, 1.0f ), snorm10 ) ), mask10 ),
+            _mm_slli_epi32( _mm_and_si128( _mm_cvtps_epi32( _mm_mul_ps( PackClamp( ty, -1.0f, 1.0f ), snorm10 ) ), mask10 ), 10 )
+        ),
+        _mm_slli_epi32( _mm_and_si128( _mm_cvtps_epi32( _mm_mul_ps( PackClamp( tz, -1.0f, 1.0f ), snorm10 ) ), mask10 ), 20 )
+    );
+    __m128i negative = _mm_castps_si128( _mm_cmplt_ps( tw, _mm_setzero_ps() ) );
+    __m128i sign = _mm_or_si128(
+        _mm_and_si128( negative, _mm_set1_epi32( (i32)0xC0000000 ) ),
+        _mm_andnot_si128( negative, _mm_set1_epi32( 0x40000000 ) )
+    );
+    tangents = _mm_or_si128( tangents, sign );
+
+    u64 positionLanes[4];
+    u32 uvLanes[4];
+    u32 normalLanes[4];
+    u32 tangentLanes[4];
+    _mm_storeu_si128( (__m128i*)&positionLanes[0], positions[0] );
+    _mm_storeu_si128( (__m128i*)&positionLanes[2], positions[1] );
+    _mm_storeu_si128( (__m128i*)uvLanes,      uvs );
+    _mm_storeu_si128( (__m128i*)normalLanes,  normals );
+    _mm_storeu_si128( (__m128i*)tangentLanes, tangents );
+    ucycles( 4 ) {
+        Platform::MemCopy( sizeof(u64), &positionLanes[i], result[i].position );
+        Platform::MemCopy( sizeof(u32), &uvLanes[i],       result[i].uv );
+        Platform::MemCopy( sizeof(u32), &normalLanes[i],   result[i].normal );
+        result[i].tangent = tangentLanes[i];
     }
 }
+
+void Core::packVertices(
+    usize count, const vertex* vertices,
+    const smath::vec3& boundsMin, const smath::vec3& boundsMax,
+    packedVertex* result
+) {
+    smath::vec3 scale = {};
+    ucycles( 3 ) {
+        f32 extent = boundsMax[i] - boundsMin[i];
+        scale[i] = extent > 0.0f ? 1.0f / extent : 0.0f;
+    }
+    __m128 simdBoundsMin = _mm_setr_ps( boundsMin.x, boundsMin.y, boundsMin.z, 0.0f );
+    __m128 simdScale     = _mm_setr_ps( scale.x, scale.y, scale.z, 0.0f );
+
+    usize i = 0;
+    for( ; i + 4 <= count; i += 4 ) {
+        PackVertices4( vertices + i, simdBoundsMin, simdScale, result + i );
+    }
+    if( i < count ) {
+        vertex       tail[4] = {};
+        packedVertex tailResult[4];
+        Platform::MemCopy( ( count - i ) * sizeof(vertex), vertices + i, tail );
+        PackVertices4( tail, simdBoundsMin, simdScale, tailResult );
+        Platform::MemCopy( ( count - i ) * sizeof(packedVertex), tailResult, result + i );
+    }
+}
+
+/// @brief Project vector onto plane of normal and normalize it, zero if it vanishes
+static inline void TangentProject(
+    __m128 nx, __m128 ny, __m128 nz,
+    __m128* x, __m128* y, __m128* z
+) {
+    // NOTE(alicia): SSE
+    __m128 d = _mm_add_ps( _mm_add_ps( _mm_mul_ps( nx, *x ), _mm_mul_ps( ny, *y ) ), _mm_mul_ps( nz, *z ) );
+    __m128 px = _mm_sub_ps( *x, _mm_mul_ps( nx, d ) );
+    __m128 py = _mm_sub_ps( *y, _mm_mul_ps( ny, d ) );
+    __m128 pz = _mm_sub_ps( *z, _mm_mul_ps( nz, d ) );
+    __m128 lengthSqr = _mm_add_ps( _mm_add_ps( _mm_mul_ps( px, px ), _mm_mul_ps( py, py ) ), _mm_mul_ps( pz, pz ) );
+    __m128 valid = _mm_cmpgt_ps( lengthSqr, _mm_set1_ps( F32::EPSILON * F32::EPSILON ) );
+    __m128 inverseLength = _mm_and_ps( valid, _mm_div_ps( _mm_set1_ps( 1.0f ), _mm_sqrt_ps( lengthSqr ) ) );
+    *x = _mm_mul_ps( px, inverseLength );
+    *y = _mm_mul_ps( py, inverseLength );
+    *z = _mm_mul_ps( pz, inverseLength );
+}
+
+/// @brief Tangent and bitangent sums of a vertex
+struct TangentAccumulator {
+    f32 tangent[3];
+    f32 bitangent[3];
+};
+
+struct TangentChunk {
+    const u32* indices;
+    const Core::vertex* vertices;
+    usize firstTriangle;
+    usize triangleCount;
+    /// @brief Accumulators of this chunk, one per vertex
+    TangentAccumulator* accumulators;
+
+    Core::vertex* resultVertices;
+    usize firstVertex;
+    usize vertexCount;
+    usize chunkCount;
+    usize totalVertexCount;
+    /// @brief Accumulators of every chunk
+    const TangentAccumulator* chunkAccumulators;
+};
+
+/// @brief Accumulate tangents of four triangles at a time
+static void TangentAccumulateJob( void* params ) {
+    TangentChunk* chunk = (TangentChunk*)params;
+    const Core::vertex* vertices = chunk->vertices;
+    TangentAccumulator* accumulators = chunk->accumulators;
+
+    for( usize first = 0; first < chunk->triangleCount; first += 4 ) {
+        usize laneCount = chunk->triangleCount - first < 4 ? chunk->triangleCount - first : 4;
+
+        // NOTE(alicia): missing lanes repeat the last triangle and are masked out
+        u32 corners[3][4];
+        ucycles( 4 ) {
+            usize lane = i < laneCount ? i : laneCount - 1;
+            const u32* triangle = chunk->indices + ( chunk->firstTriangle + first + lane ) * 3;
+            corners[0][i] = triangle[0];
+            corners[1][i] = triangle[1];
+            corners[2][i] = triangle[2];
+        }
+        __m128 laneValid = _mm_castsi128_ps( _mm_cmplt_epi32(
+            _mm_setr_epi32( 0, 1, 2, 3 ), _mm_set1_epi32( (i32)laneCount )
+        ) );
+
+        #define TANGENT_LOAD( corner, member, component ) _mm_setr_ps(\
+            vertices[corners[corner][0]].member.component, vertices[corners[corner][1]].member.component,\
+            vertices[corners[corner][2]].member.component, vertices[corners[corner][3]].member.component )
+
+        __m128 px[3], py[3], pz[3];
+        ucycles( 3 ) {
+            px[i] = TANGENT_LOAD( i, position, x );
+            py[i] = TANGENT_LOAD( i, position, y );
+            pz[i] = TANGENT_LOAD( i, position, z );
+        }
+        __m128 u0 = TANGENT_LOAD( 0, uv, x ), v0 = TANGENT_LOAD( 0, uv, y );
+        __m128 du1 = _mm_sub_ps( TANGENT_LOAD( 1, uv, x ), u0 ), dv1 = _mm_sub_ps( TANGENT_LOAD( 1, uv, y ), v0 );
+        __m128 du2 = _mm_sub_ps( TANGENT_LOAD( 2, uv, x ), u0 ), dv2 = _mm_sub_ps( TANGENT_LOAD( 2, uv, y ), v0 );
+
+        __m128 e1x = _mm_sub_ps( px[1], px[0] ), e1y = _mm_sub_ps( py[1], py[0] ), e1z = _mm_sub_ps( pz[1], pz[0] );
+        __m128 e2x = _mm_sub_ps( px[2], px[0] ), e2y = _mm_sub_ps( py[2], py[0] ), e2z = _mm_sub_ps( pz[2], pz[0] );
+
+        // NOTE(alicia): triangles without uv area would divide by zero, they are masked out
+        __m128 determinant = _mm_sub_ps( _mm_mul_ps( du1, dv2 ), _mm_mul_ps( dv1, du2 ) );
+        __m128 absDeterminant = _mm_andnot_ps( _mm_set1_ps( -0.0f ), determinant );
+        __m128 valid = _mm_and_ps( laneValid, _mm_cmpgt_ps( absDeterminant, _mm_set1_ps( F32::EPSILON ) ) );
+        __m128 r = _mm_and_ps( valid, _mm_div_ps( _mm_set1_ps( 1.0f ), determinant ) );
+
+        __m128 tx = _mm_mul_ps( _mm_sub_ps( _mm_mul_ps( e1x, dv2 ), _mm_mul_ps( e2x, dv1 ) ), r );
+        __m128 ty = _mm_mul_ps( _mm_sub_ps( _mm_mul_ps( e1y, dv2 ), _mm_mul_ps( e2y, dv1 ) ), r );
+        __m128 tz = _mm_mul_ps( _mm_sub_ps( _mm_mul_ps( e1z, dv2 ), _mm_mul_ps( e2z, dv1 ) ), r );
+        __m128 bx = _mm_mul_ps( _mm_sub_ps( _mm_mul_ps( e2x, du1 ), _mm_mul_ps( e1x, du2 ) ), r );
+        __m128 by = _mm_mul_ps( _mm_sub_ps( _mm_mul_ps( e2y, du1 ), _mm_mul_ps( e1y, du2 ) ), r );
+        __m128 bz = _mm_mul_ps( _mm_sub_ps( _mm_mul_ps( e2z, du1 ), _mm_mul_ps( e1z, du2 ) ), r );
+
+        ucyclesi( 3, corner ) {
+            usize next     = ( corner + 1 ) % 3;
+            usize previous = ( corner + 2 ) % 3;
+            __m128 ax = _mm_sub_ps( px[next], px[corner] ), ay = _mm_sub_ps( py[next], py[corner] ), az = _mm_sub_ps( pz[next], pz[corner] );
+            __m128 cx = _mm_sub_ps( px[previous], px[corner] ), cy = _mm_sub_ps( py[previous], py[corner] ), cz = _mm_sub_ps( pz[previous], pz[corner] );
+            __m128 dot = _mm_add_ps( _mm_add_ps( _mm_mul_ps( ax, cx ), _mm_mul_ps( ay, cy ) ), _mm_mul_ps( az, cz ) );
+            __m128 lengthSqr = _mm_mul_ps(
+                _mm_add_ps( _mm_add_ps( _mm_mul_ps( ax, ax ), _mm_mul_ps( ay, ay ) ), _mm_mul_ps( az, az ) ),
+                _mm_add_ps( _mm_add_ps( _mm_mul_ps( cx, cx ), _mm_mul_ps( cy, cy ) ), _mm_mul_ps( cz, cz ) )
+            );
+            __m128 hasAngle = _mm_cmpgt_ps( lengthSqr, _mm_setzero_ps() );
+            __m128 cosine = _mm_and_ps( hasAngle, _mm_div_ps( dot, _mm_sqrt_ps( lengthSqr ) ) );
+            __m128 angle  = _mm_and_ps( _mm_and_ps( valid, hasAngle ), smath::acos4( cosine ) );
+
+            __m128 nx = TANGENT_LOAD( corner, normal, x );
+            __m128 ny = TANGENT_LOAD( corner, normal, y );
+            __m128 nz = TANGENT_LOAD( corner, normal, z );
+
+            __m128 ctx = tx, cty = ty, ctz = tz;
+            __m128 cbx = bx, cby = by, cbz = bz;
+            TangentProject( nx, ny, nz, &ctx, &cty, &ctz );
+            TangentProject( nx, ny, nz, &cbx, &cby, &cbz );
+
+            f32 lanes[6][4];
+            _mm_storeu_ps( lanes[0], _mm_mul_ps( ctx, angle ) );
+            _mm_storeu_ps( lanes[1], _mm_mul_ps( cty, angle ) );
+            _mm_storeu_ps( lanes[2], _mm_mul_ps( ctz, angle ) );
+            _mm_storeu_ps( lanes[3], _mm_mul_ps( cbx, angle ) );
+            _mm_storeu_ps( lanes[4], _mm_mul_ps( cby, angle ) );
+            _mm_storeu_ps( lanes[5], _mm_mul_ps( cbz, angle ) );
+            ucyclesi( laneCount, lane ) {
+                TangentAccumulator* accumulator = &accumulators[corners[corner][lane]];
+                accumulator->tangent[0]   += lanes[0][lane];
+                accumulator->tangent[1]   += lanes[1][lane];
+                accumulator->tangent[2]   += lanes[2][lane];
+                accumulator->bitangent[0] += lanes[3][lane];
+                accumulator->bitangent[1] += lanes[4][lane];
+                accumulator->bitangent[2] += lanes[5][lane];
+            }
+        }
+
+        #undef TANGENT_LOAD
+    }
+}
+
+/// @brief Sum accumulators of every chunk and orthogonalize
+static void TangentResolveJob( void* params ) {
+    TangentChunk* chunk = (TangentChunk*)params;
+    for( usize v = chunk->firstVertex; v < chunk->firstVertex + chunk->vertexCount; ++v ) {
+        smath::vec3 tangent, bitangent;
+        ucycles( chunk->chunkCount ) {
+            const TangentAccumulator& accumulator = chunk->chunkAccumulators[i * chunk->totalVertexCount + v];
+            tangent   = tangent   + smath::vec3( accumulator.tangent[0], accumulator.tangent[1], accumulator.tangent[2] );
+            bitangent = bitangent + smath::vec3( accumulator.bitangent[0], accumulator.bitangent[1], accumulator.bitangent[2] );
+        }
+
+        Core::vertex* vertex = &chunk->resultVertices[v];
+        const smath::vec3& normal = vertex->normal;
+        // Gram-Schmidt
+        tangent = tangent - normal * smath::dot( normal, tangent );
+        if( smath::sqrMag( tangent ) <= F32::EPSILON * F32::EPSILON ) {
+            // NOTE(alicia): vertex without uv area still needs a valid basis
+            smath::vec3 axis = smath::abs( normal.x ) < 0.9f ? smath::vec3( 1.0f, 0.0f, 0.0f ) : smath::vec3( 0.0f, 1.0f, 0.0f );
+            tangent = smath::cross( normal, axis );
+            if( smath::sqrMag( tangent ) <= F32::EPSILON * F32::EPSILON ) {
+                tangent = axis;
+            }
+        }
+        tangent = smath::normalize( tangent );
+        f32 sign = smath::dot( smath::cross( normal, tangent ), bitangent ) < 0.0f ? -1.0f : 1.0f;
+        vertex->tangent = smath::vec4( tangent.x, tangent.y, tangent.z, sign );
+    }
+}
+
+void Core::calculateTangentBasis(
+    usize indexCount, const u32* indices,
+    usize verticesCount, vertex* vertices,
+    JobQueue* queue
+) {
+    usize triangleCount = indexCount / 3;
+    usize chunkCount = queue ? JobQueueThreadCount( queue ) : 1;
+    if( chunkCount > TANGENT_MAX_JOBS ) {
+        chunkCount = TANGENT_MAX_JOBS;
+    }
+    if( chunkCount > triangleCount / TANGENT_MIN_JOB_TRIANGLES ) {
+        chunkCount = triangleCount / TANGENT_MIN_JOB_TRIANGLES;
+    }
+    if( chunkCount == 0 ) {
+        chunkCount = 1;
+    }
+
+    // NOTE(alicia): every chunk accumulates into its own buffer so no atomics are needed
+    TangentAccumulator* accumulators = (TangentAccumulator*)Platform::Alloc(
+        chunkCount * verticesCount * sizeof(TangentAccumulator)
+    );
+    TangentChunk* chunks = (TangentChunk*)Platform::Alloc( chunkCount * sizeof(TangentChunk) );
+    if( !accumulators || !chunks ) {
+        if( accumulators ) {
+            Platform::Free( accumulators );
+        }
+        if( chunks ) {
+            Platform::Free( chunks );
+        }
+        LOG_ERROR( "calculateTangentBasis > Failed to allocate accumulators!" );
+        return;
+    }
+
+    usize trianglesPerChunk = ( triangleCount + chunkCount - 1 ) / chunkCount;
+    usize verticesPerChunk  = ( verticesCount + chunkCount - 1 ) / chunkCount;
+    ucycles( chunkCount ) {
+        TangentChunk* chunk = &chunks[i];
+        chunk->indices       = indices;
+        chunk->vertices      = vertices;
+        chunk->firstTriangle = i * trianglesPerChunk < triangleCount ? i * trianglesPerChunk : triangleCount;
+        chunk->triangleCount = triangleCount - chunk->firstTriangle < trianglesPerChunk ?
+            triangleCount - chunk->firstTriangle : trianglesPerChunk;
+        chunk->accumulators  = accumulators + i * verticesCount;
+
+        chunk->resultVertices    = vertices;
+        chunk->firstVertex       = i * verticesPerChunk < verticesCount ? i * verticesPerChunk : verticesCount;
+        chunk->vertexCount       = verticesCount - chunk->firstVertex < verticesPerChunk ?
+            verticesCount - chunk->firstVertex : verticesPerChunk;
+        chunk->chunkCount        = chunkCount;
+        chunk->totalVertexCount  = verticesCount;
+        chunk->chunkAccumulators = accumulators;
+    }
+
+    if( chunkCount == 1 ) {
+        TangentAccumulateJob( &chunks[0] );
+        TangentResolveJob( &chunks[0] );
+    } else {
+        Core::JobCounter counter = {};
+        ucycles( chunkCount ) {
+            Core::PushJob( queue, TangentAccumulateJob, &chunks[i], &counter );
+        }
+        Core::WaitForJobs( queue, &counter );
+        ucycles( chunkCount ) {
+            Core::PushJob( queue, TangentResolveJob, &chunks[i], &counter );
+        }
+        Core::WaitForJobs( queue, &counter );
+    }
+
+    Platform::Free( chunks );
+    Platform::Free( accumulators );
+}
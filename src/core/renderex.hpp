@@ -13,6 +13,9 @@ namespace Platform {
 
 namespace Core {
 
+// forward declaration
+struct JobQueue;
+
 struct camera {
     smath::mat4 viewMat       = smath::mat4::lookAt( position, position + forward, up );
     smath::mat4 projectionMat = smath::mat4::perspective( fovRad, aspectRatio, clippingPlanes.x, clippingPlanes.y );
@@ -48,11 +51,52 @@ struct vertex {
     smath::vec3 position;
     smath::vec2 uv;
     smath::vec3 normal;
-    smath::vec3 tangent;
-    smath::vec3 bitangent;
+    /// @brief w is bitangent sign, bitangent = cross( normal, tangent ) * w
+    smath::vec4 tangent;
 };
 Platform::VertexBufferLayout vertexLayout();
-void calculateTangentBasis( usize verticesCount, vertex* vertices );
+
+/// @brief Quantized vertex, 20 bytes
+struct packedVertex {
+    /// @brief xyz unorm16 relative to mesh bounds, w is padding
+    u16 position[4];
+    /// @brief half float
+    u16 uv[2];
+    /// @brief octahedral encoded, snorm16
+    i16 normal[2];
+    /// @brief xyz snorm10, w snorm2 bitangent sign
+    u32 tangent;
+};
+Platform::VertexBufferLayout packedVertexLayout();
+/// @brief Pack vertices.
+/// Bitangent is not stored, it is reconstructed from normal, tangent and bitangent sign
+/// @param count number of vertices
+/// @param vertices vertices to pack
+/// @param boundsMin,boundsMax bounds positions are quantized to
+/// @param result [out] packed vertices
+void packVertices(
+    usize count, const vertex* vertices,
+    const smath::vec3& boundsMin, const smath::vec3& boundsMax,
+    packedVertex* result
+);
+/// @brief Triangles per job below which tangents are calculated on calling thread only
+#define TANGENT_MIN_JOB_TRIANGLES 16384
+/// @brief Maximum number of jobs tangents are split into
+#define TANGENT_MAX_JOBS 8
+/// @brief Calculate smooth tangent basis of indexed triangles (MikkTSpace style).
+/// Triangle tangents are projected onto the vertex normal's plane, weighted by corner angle
+/// and accumulated per vertex, then orthogonalized against vertex normal.
+/// Triangles without uv area don't contribute
+/// @param indexCount number of indices
+/// @param indices triangle indices
+/// @param verticesCount number of vertices
+/// @param vertices vertices, tangent is written
+/// @param queue job queue, can be nullptr
+void calculateTangentBasis(
+    usize indexCount, const u32* indices,
+    usize verticesCount, vertex* vertices,
+    JobQueue* queue
+);
 
 struct ambientLight {
     smath::vec4 color;
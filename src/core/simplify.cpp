@@ -0,0 +1,573 @@
+/**
+ * Description:  Quadric mesh simplification
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "core/simplify.hpp"
+#include "core/jobs.hpp"
+#include "core/mesh.hpp"
+#include "core/renderex.hpp"
+#include "platform/io.hpp"
+#include "util.hpp"
+
+#define SIMPLIFY_EMPTY_SLOT U32::MAX
+#define SIMPLIFY_EMPTY_EDGE U64::MAX
+/// @brief Edges are bucket sorted by the upper 15 bits of their non-negative f32 cost
+#define SIMPLIFY_SORT_BUCKET_COUNT 32768
+/// @brief Smallest cosine between a triangle normal before and after a collapse
+#define SIMPLIFY_MAX_NORMAL_CHANGE 0.25f
+
+/// @brief Symmetric 4x4 quadric, sum of area weighted squared distances to planes
+struct SimplifyQuadric {
+    f32 a00, a11, a22;
+    f32 a01, a02, a12;
+    f32 b0, b1, b2;
+    f32 c;
+    f32 weight;
+};
+
+/// @brief Collapse of edge into its "to" vertex
+struct SimplifyEdge {
+    u32 from;
+    u32 to;
+    f32 cost;
+    /// @brief Geometric part of cost
+    f32 error;
+};
+
+static inline void SimplifyQuadricAdd( SimplifyQuadric* dst, const SimplifyQuadric& src ) {
+    dst->a00 += src.a00; dst->a11 += src.a11; dst->a22 += src.a22;
+    dst->a01 += src.a01; dst->a02 += src.a02; dst->a12 += src.a12;
+    dst->b0  += src.b0;  dst->b1  += src.b1;  dst->b2  += src.b2;
+    dst->c   += src.c;
+    dst->weight += src.weight;
+}
+
+/// @brief Quadric of triangle's plane, weighted by triangle area
+static inline SimplifyQuadric SimplifyPlaneQuadric(
+    const smath::vec3& p0, const smath::vec3& p1, const smath::vec3& p2
+) {
+    SimplifyQuadric result = {};
+    smath::vec3 normal = smath::cross( p1 - p0, p2 - p0 );
+    f32 length = smath::mag( normal );
+    if( length <= F32::EPSILON ) {
+        return result;
+    }
+    normal = normal / length;
+    f32 area     = length * 0.5f;
+    f32 distance = -smath::dot( normal, p0 );
+
+    result.a00 = area * normal.x * normal.x;
+    result.a11 = area * normal.y * normal.y;
+    result.a22 = area * normal.z * normal.z;
+    result.a01 = area * normal.x * normal.y;
+    result.a02 = area * normal.x * normal.z;
+    result.a12 = area * normal.y * normal.z;
+    result.b0  = area * normal.x * distance;
+    result.b1  = area * normal.y * distance;
+    result.b2  = area * normal.z * distance;
+    result.c   = area * distance * distance;
+    result.weight = area;
+    return result;
+}
+
+/// @brief Mean squared distance of point to quadric's planes
+static inline f32 SimplifyQuadricError( const SimplifyQuadric& q, const smath::vec3& p ) {
+    f32 error =
+        q.a00 * p.x * p.x + q.a11 * p.y * p.y + q.a22 * p.z * p.z +
+        2.0f * ( q.a01 * p.x * p.y + q.a02 * p.x * p.z + q.a12 * p.y * p.z ) +
+        2.0f * ( q.b0 * p.x + q.b1 * p.y + q.b2 * p.z ) +
+        q.c;
+    // NOTE(alicia): error can be slightly negative due to rounding
+    error = error > 0.0f ? error : 0.0f;
+    return q.weight > 0.0f ? error / q.weight : 0.0f;
+}
+
+static inline bool SimplifyPositionCmp( const smath::vec3& a, const smath::vec3& b ) {
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+static inline u32 SimplifyHashEdge( u64 key ) {
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDull;
+    key ^= key >> 33;
+    return (u32)key;
+}
+
+/// @brief Insert half-edge into open addressing table
+/// @return true if half-edge was already in table
+static inline bool SimplifyEdgeInsert( u64* table, usize tableMask, u64 key ) {
+    usize slot = SimplifyHashEdge( key ) & tableMask;
+    for( ;; ) {
+        if( table[slot] == SIMPLIFY_EMPTY_EDGE ) {
+            table[slot] = key;
+            return false;
+        }
+        if( table[slot] == key ) {
+            return true;
+        }
+        slot = ( slot + 1 ) & tableMask;
+    }
+}
+
+static inline bool SimplifyEdgeFind( const u64* table, usize tableMask, u64 key ) {
+    usize slot = SimplifyHashEdge( key ) & tableMask;
+    for( ;; ) {
+        if( table[slot] == SIMPLIFY_EMPTY_EDGE ) {
+            return false;
+        }
+        if( table[slot] == key ) {
+            return true;
+        }
+        slot = ( slot + 1 ) & tableMask;
+    }
+}
+
+/// @brief Lock vertices that share a position with another vertex or lie on an open border
+/// @param positionIds [out] index of first vertex with the same position
+/// @param table scratch table, tableMask + 1 entries
+static void SimplifyLockVertices(
+    usize indexCount, const u32* indices,
+    usize vertexCount, const Core::vertex* vertices,
+    u64* table, usize tableMask,
+    u32* positionIds, bool* locked
+) {
+    // NOTE(alicia): edge table is reused as position table first
+    u32* positionTable = (u32*)table;
+    usize positionTableMask = tableMask;
+    ucycles( positionTableMask + 1 ) {
+        positionTable[i] = SIMPLIFY_EMPTY_SLOT;
+    }
+    ucycles( vertexCount ) {
+        const smath::vec3& position = vertices[i].position;
+        usize slot = (usize)hashBytes( sizeof(smath::vec3), &position, 0 ) & positionTableMask;
+        for( ;; ) {
+            u32 other = positionTable[slot];
+            if( other == SIMPLIFY_EMPTY_SLOT ) {
+                positionTable[slot] = (u32)i;
+                positionIds[i] = (u32)i;
+                break;
+            }
+            if( SimplifyPositionCmp( vertices[other].position, position ) ) {
+                positionIds[i]  = other;
+                locked[i]       = true;
+                locked[other]   = true;
+                break;
+            }
+            slot = ( slot + 1 ) & positionTableMask;
+        }
+    }
+
+    // an edge is on a border if no triangle walks it in the opposite direction
+    ucycles( tableMask + 1 ) {
+        table[i] = SIMPLIFY_EMPTY_EDGE;
+    }
+    ucycles( indexCount ) {
+        u32 a = positionIds[indices[i]];
+        u32 b = positionIds[indices[i % 3 == 2 ? i - 2 : i + 1]];
+        SimplifyEdgeInsert( table, tableMask, ( (u64)a << 32 ) | b );
+    }
+    ucycles( indexCount ) {
+        u32 a = indices[i];
+        u32 b = indices[i % 3 == 2 ? i - 2 : i + 1];
+        u64 reverse = ( (u64)positionIds[b] << 32 ) | positionIds[a];
+        if( !SimplifyEdgeFind( table, tableMask, reverse ) ) {
+            locked[a] = true;
+            locked[b] = true;
+        }
+    }
+}
+
+/// @brief Check that moving vertex "from" onto "to" doesn't flip or collapse any triangle around it
+static bool SimplifyCollapseValid(
+    u32 from, u32 to,
+    const u32* indices, const u32* adjacencyOffsets, const u32* adjacency,
+    const smath::vec3* positions
+) {
+    const smath::vec3& target = positions[to];
+    for( u32 a = adjacencyOffsets[from]; a < adjacencyOffsets[from + 1]; ++a ) {
+        const u32* triangle = indices + adjacency[a] * 3;
+        if( triangle[0] == to || triangle[1] == to || triangle[2] == to ) {
+            // NOTE(alicia): triangles on the collapsed edge disappear
+            continue;
+        }
+        u32 corner = triangle[0] == from ? 0 : ( triangle[1] == from ? 1 : 2 );
+        const smath::vec3& p1 = positions[triangle[( corner + 1 ) % 3]];
+        const smath::vec3& p2 = positions[triangle[( corner + 2 ) % 3]];
+
+        smath::vec3 before = smath::cross( p1 - positions[from], p2 - positions[from] );
+        smath::vec3 after  = smath::cross( p1 - target, p2 - target );
+        f32 dot = smath::dot( before, after );
+        if( dot <= SIMPLIFY_MAX_NORMAL_CHANGE * smath::mag( before ) * smath::mag( after ) ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief Cost of collapsing vertex "from" onto "to"
+static inline void SimplifyCollapseCost(
+    u32 from, u32 to,
+    const Core::vertex* vertices, const smath::vec3* positions,
+    const SimplifyQuadric* quadrics,
+    SimplifyEdge* edge
+) {
+    SimplifyQuadric quadric = quadrics[from];
+    SimplifyQuadricAdd( &quadric, quadrics[to] );
+    f32 error = SimplifyQuadricError( quadric, positions[to] );
+
+    // NOTE(alicia): attribute change is spread over the edge,
+    // scaling it by squared edge length keeps it in the same units as geometric error
+    const Core::vertex& a = vertices[from];
+    const Core::vertex& b = vertices[to];
+    f32 attributeError =
+        smath::sqrMag( a.uv - b.uv ) +
+        smath::sqrMag( a.normal - b.normal );
+    f32 edgeLengthSqr = smath::sqrMag( positions[from] - positions[to] );
+
+    edge->from  = from;
+    edge->to    = to;
+    edge->error = error;
+    edge->cost  = error + SIMPLIFY_ATTRIBUTE_WEIGHT * attributeError * edgeLengthSqr;
+}
+
+static inline u32 SimplifySortKey( f32 cost ) {
+    union { f32 f; u32 u; } bits;
+    bits.f = cost;
+    // NOTE(alicia): bits of non-negative floats sort like the floats
+    return ( bits.u >> 16 ) & ( SIMPLIFY_SORT_BUCKET_COUNT - 1 );
+}
+
+usize Core::SimplifyMesh(
+    usize indexCount, const u32* indices,
+    usize vertexCount, const Core::vertex* vertices,
+    usize targetIndexCount,
+    u32* result, f32* resultError
+) {
+    *resultError = 0.0f;
+    Platform::MemCopy( indexCount * sizeof(u32), indices, result );
+    if( indexCount <= targetIndexCount || vertexCount == 0 ) {
+        return indexCount;
+    }
+
+    // NOTE(alicia): table holds vertex positions and later half-edges
+    usize tableCount    = indexCount > vertexCount ? indexCount : vertexCount;
+    usize tableCapacity = 64;
+    while( tableCapacity < tableCount * 2 ) {
+        tableCapacity *= 2;
+    }
+
+    // NOTE(alicia): every buffer is carved out of a single allocation,
+    // passes don't allocate
+    usize scratchSize =
+        tableCapacity * sizeof(u64) +
+        vertexCount * sizeof(SimplifyQuadric) +
+        vertexCount * sizeof(smath::vec3) +
+        indexCount * sizeof(SimplifyEdge) +
+        indexCount * sizeof(u32) +                  // sorted edges
+        indexCount * sizeof(u32) +                  // adjacency
+        SIMPLIFY_SORT_BUCKET_COUNT * sizeof(u32) +
+        ( vertexCount + 1 ) * sizeof(u32) +         // adjacency offsets
+        vertexCount * sizeof(u32) * 2 +             // position ids, remap
+        vertexCount * sizeof(bool) * 2;             // locked, touched
+    u8* scratch = (u8*)Platform::Alloc( scratchSize );
+    if( !scratch ) {
+        LOG_WARN( "SimplifyMesh > Failed to allocate scratch memory!" );
+        return indexCount;
+    }
+    u8* cursor = scratch;
+    auto take = [&cursor]( usize size ) {
+        u8* block = cursor;
+        cursor += size;
+        return (void*)block;
+    };
+    u64*             table            = (u64*)take( tableCapacity * sizeof(u64) );
+    SimplifyQuadric* quadrics         = (SimplifyQuadric*)take( vertexCount * sizeof(SimplifyQuadric) );
+    smath::vec3*     positions        = (smath::vec3*)take( vertexCount * sizeof(smath::vec3) );
+    SimplifyEdge*    edges            = (SimplifyEdge*)take( indexCount * sizeof(SimplifyEdge) );
+    u32*             sortedEdges      = (u32*)take( indexCount * sizeof(u32) );
+    u32*             adjacency        = (u32*)take( indexCount * sizeof(u32) );
+    u32*             buckets          = (u32*)take( SIMPLIFY_SORT_BUCKET_COUNT * sizeof(u32) );
+    u32*             adjacencyOffsets = (u32*)take( ( vertexCount + 1 ) * sizeof(u32) );
+    u32*             positionIds      = (u32*)take( vertexCount * sizeof(u32) );
+    u32*             remap            = (u32*)take( vertexCount * sizeof(u32) );
+    bool*            locked           = (bool*)take( vertexCount * sizeof(bool) );
+    bool*            touched          = (bool*)take( vertexCount * sizeof(bool) );
+
+    // NOTE(alicia): positions are normalized to a unit cube so
+    // errors and float precision don't depend on mesh scale
+    smath::vec3 boundsMin = vertices[0].position;
+    smath::vec3 boundsMax = vertices[0].position;
+    ucycles( vertexCount ) {
+        ucyclesi( 3, axis ) {
+            f32 value = vertices[i].position[axis];
+            boundsMin[axis] = value < boundsMin[axis] ? value : boundsMin[axis];
+            boundsMax[axis] = value > boundsMax[axis] ? value : boundsMax[axis];
+        }
+    }
+    f32 extent = boundsMax.x - boundsMin.x;
+    extent = boundsMax.y - boundsMin.y > extent ? boundsMax.y - boundsMin.y : extent;
+    extent = boundsMax.z - boundsMin.z > extent ? boundsMax.z - boundsMin.z : extent;
+    f32 scale = extent > 0.0f ? 1.0f / extent : 0.0f;
+    ucycles( vertexCount ) {
+        positions[i] = ( vertices[i].position - boundsMin ) * scale;
+        remap[i] = (u32)i;
+    }
+
+    SimplifyLockVertices(
+        indexCount, indices, vertexCount, vertices,
+        table, tableCapacity - 1,
+        positionIds, locked
+    );
+
+    ucycles( indexCount / 3 ) {
+        const u32* triangle = indices + i * 3;
+        SimplifyQuadric quadric = SimplifyPlaneQuadric(
+            positions[triangle[0]], positions[triangle[1]], positions[triangle[2]]
+        );
+        ucyclesi( 3, corner ) {
+            SimplifyQuadricAdd( &quadrics[triangle[corner]], quadric );
+        }
+    }
+
+    f32 maxError = 0.0f;
+    usize resultCount = indexCount;
+    for( usize pass = 0; pass < SIMPLIFY_MAX_PASSES && resultCount > targetIndexCount; ++pass ) {
+        usize triangleCount = resultCount / 3;
+
+        // vertex -> triangle adjacency, vertices are reused as fill counters
+        ucycles( vertexCount + 1 ) {
+            adjacencyOffsets[i] = 0;
+        }
+        ucycles( resultCount ) {
+            adjacencyOffsets[result[i] + 1]++;
+        }
+        ucycles( vertexCount ) {
+            adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+        }
+        ucycles( resultCount ) {
+            u32 vertex = result[i];
+            adjacency[adjacencyOffsets[vertex]++] = (u32)( i / 3 );
+        }
+        for( usize i = vertexCount; i > 0; --i ) {
+            adjacencyOffsets[i] = adjacencyOffsets[i - 1];
+        }
+        adjacencyOffsets[0] = 0;
+
+        // every interior edge is walked twice, only keep one direction
+        usize edgeCount = 0;
+        ucycles( resultCount ) {
+            u32 a = result[i];
+            u32 b = result[i % 3 == 2 ? i - 2 : i + 1];
+            if( a > b || ( locked[a] && locked[b] ) ) {
+                continue;
+            }
+            SimplifyEdge* edge = &edges[edgeCount];
+            if( locked[a] ) {
+                SimplifyCollapseCost( b, a, vertices, positions, quadrics, edge );
+            } else if( locked[b] ) {
+                SimplifyCollapseCost( a, b, vertices, positions, quadrics, edge );
+            } else {
+                SimplifyEdge reverse;
+                SimplifyCollapseCost( a, b, vertices, positions, quadrics, edge );
+                SimplifyCollapseCost( b, a, vertices, positions, quadrics, &reverse );
+                if( reverse.cost < edge->cost ) {
+                    *edge = reverse;
+                }
+            }
+            edgeCount++;
+        }
+        if( edgeCount == 0 ) {
+            break;
+        }
+
+        // counting sort, cheapest collapses first
+        ucycles( SIMPLIFY_SORT_BUCKET_COUNT ) {
+            buckets[i] = 0;
+        }
+        ucycles( edgeCount ) {
+            buckets[SimplifySortKey( edges[i].cost )]++;
+        }
+        u32 offset = 0;
+        ucycles( SIMPLIFY_SORT_BUCKET_COUNT ) {
+            u32 count = buckets[i];
+            buckets[i] = offset;
+            offset += count;
+        }
+        ucycles( edgeCount ) {
+            sortedEdges[buckets[SimplifySortKey( edges[i].cost )]++] = (u32)i;
+        }
+
+        // NOTE(alicia): each collapse removes about two triangles,
+        // vertices around a collapse are not touched again until adjacency is rebuilt
+        usize collapseGoal  = ( triangleCount - targetIndexCount / 3 ) / 2 + 1;
+        usize collapseCount = 0;
+        ucycles( vertexCount ) {
+            touched[i] = false;
+        }
+        for( usize e = 0; e < edgeCount && collapseCount < collapseGoal; ++e ) {
+            const SimplifyEdge& edge = edges[sortedEdges[e]];
+            if( touched[edge.from] || touched[edge.to] ) {
+                continue;
+            }
+            if( !SimplifyCollapseValid( edge.from, edge.to, result, adjacencyOffsets, adjacency, positions ) ) {
+                continue;
+            }
+
+            remap[edge.from] = edge.to;
+            SimplifyQuadricAdd( &quadrics[edge.to], quadrics[edge.from] );
+            maxError = edge.error > maxError ? edge.error : maxError;
+
+            for( u32 a = adjacencyOffsets[edge.from]; a < adjacencyOffsets[edge.from + 1]; ++a ) {
+                const u32* triangle = result + adjacency[a] * 3;
+                touched[triangle[0]] = true;
+                touched[triangle[1]] = true;
+                touched[triangle[2]] = true;
+            }
+            collapseCount++;
+        }
+        if( collapseCount == 0 ) {
+            break;
+        }
+
+        // apply collapses and drop triangles that became degenerate
+        usize writeCount = 0;
+        ucycles( triangleCount ) {
+            u32 a = remap[result[i * 3 + 0]];
+            u32 b = remap[result[i * 3 + 1]];
+            u32 c = remap[result[i * 3 + 2]];
+            if( a == b || b == c || c == a ) {
+                continue;
+            }
+            result[writeCount++] = a;
+            result[writeCount++] = b;
+            result[writeCount++] = c;
+        }
+        resultCount = writeCount;
+    }
+
+    Platform::Free( scratch );
+
+    *resultError = smath::sqrt( maxError ) * extent;
+    return resultCount;
+}
+
+struct SimplifyLODParams {
+    const Core::Mesh* mesh;
+    const Core::SubMesh* subMesh;
+    usize targetIndexCount;
+    u32* indices;
+    usize indexCount;
+    f32 error;
+    /// @brief Destination of indices in mesh, U32::MAX if level is dropped
+    u32 firstIndex;
+};
+
+static void SimplifyLODJob( void* params ) {
+    SimplifyLODParams* lod = (SimplifyLODParams*)params;
+    const Core::SubMesh& subMesh = *lod->subMesh;
+    lod->indices = (u32*)Platform::Alloc( subMesh.indexCount * sizeof(u32) );
+    if( !lod->indices ) {
+        return;
+    }
+    lod->indexCount = Core::SimplifyMesh(
+        subMesh.indexCount, lod->mesh->indices + subMesh.firstIndex,
+        subMesh.vertexCount, lod->mesh->vertices + subMesh.baseVertex,
+        lod->targetIndexCount,
+        lod->indices, &lod->error
+    );
+}
+
+void Core::GenerateMeshLODs( Mesh* mesh, JobQueue* queue ) {
+    u64 startTime = Platform::GetPerformanceCounter();
+
+    // NOTE(alicia): every level is simplified from full detail so levels run in parallel
+    usize lodCount = mesh->subMeshCount * MESH_MAX_LOD_COUNT;
+    SimplifyLODParams* lods = (SimplifyLODParams*)Platform::Alloc( lodCount * sizeof(SimplifyLODParams) );
+    if( !lods ) {
+        LOG_WARN( "GenerateMeshLODs > Failed to allocate levels!" );
+        return;
+    }
+
+    Core::JobCounter counter = {};
+    ucyclesi( mesh->subMeshCount, subMeshIndex ) {
+        const SubMesh* subMesh = &mesh->subMeshes[subMeshIndex];
+        if( subMesh->indexCount / 3 < SIMPLIFY_MIN_TRIANGLE_COUNT ) {
+            continue;
+        }
+        ucycles( MESH_MAX_LOD_COUNT ) {
+            SimplifyLODParams* lod = &lods[subMeshIndex * MESH_MAX_LOD_COUNT + i];
+            lod->mesh             = mesh;
+            lod->subMesh          = subMesh;
+            lod->targetIndexCount = ( subMesh->indexCount / 3 >> ( i + 1 ) ) * 3;
+            Core::PushJob( queue, SimplifyLODJob, lod, &counter );
+        }
+    }
+    Core::WaitForJobs( queue, &counter );
+
+    // keep levels that actually reduce triangle count
+    usize indexCount = mesh->indexCount;
+    ucyclesi( mesh->subMeshCount, subMeshIndex ) {
+        SubMesh* subMesh = &mesh->subMeshes[subMeshIndex];
+        usize previousCount = subMesh->indexCount;
+        f32   previousError = 0.0f;
+        subMesh->lodCount = 0;
+        ucycles( MESH_MAX_LOD_COUNT ) {
+            SimplifyLODParams* lod = &lods[subMeshIndex * MESH_MAX_LOD_COUNT + i];
+            lod->firstIndex = U32::MAX;
+            if(
+                !lod->indices || lod->indexCount == 0 ||
+                (f32)lod->indexCount > (f32)previousCount * SIMPLIFY_MIN_REDUCTION ||
+                indexCount + lod->indexCount > (usize)U32::MAX
+            ) {
+                continue;
+            }
+            lod->firstIndex = (u32)indexCount;
+
+            SubMeshLOD* level = &subMesh->lods[subMesh->lodCount++];
+            level->firstIndex = (u32)indexCount;
+            level->indexCount = (u32)lod->indexCount;
+            // NOTE(alicia): selection expects error to grow with each level
+            level->error = lod->error > previousError ? lod->error : previousError;
+
+            previousCount = lod->indexCount;
+            previousError = level->error;
+            indexCount   += lod->indexCount;
+        }
+    }
+
+    usize fullIndexCount = mesh->indexCount;
+    u32* indices = (u32*)Platform::Alloc( indexCount * sizeof(u32) );
+    if( indices ) {
+        Platform::MemCopy( mesh->indexCount * sizeof(u32), mesh->indices, indices );
+        ucycles( lodCount ) {
+            if( lods[i].indices && lods[i].firstIndex != U32::MAX ) {
+                Platform::MemCopy(
+                    lods[i].indexCount * sizeof(u32), lods[i].indices,
+                    indices + lods[i].firstIndex
+                );
+            }
+        }
+        Platform::Free( mesh->indices );
+        mesh->indices    = indices;
+        mesh->indexCount = indexCount;
+    } else {
+        LOG_WARN( "GenerateMeshLODs > Failed to allocate level indices!" );
+        ucycles( mesh->subMeshCount ) {
+            mesh->subMeshes[i].lodCount = 0;
+        }
+    }
+
+    ucycles( lodCount ) {
+        if( lods[i].indices ) {
+            Platform::Free( lods[i].indices );
+        }
+    }
+    Platform::Free( lods );
+
+    f64 elapsedSeconds = (f64)( Platform::GetPerformanceCounter() - startTime ) /
+        (f64)Platform::GetPerformanceFrequency();
+    LOG_INFO( "GenerateMeshLODs > %llu full detail indices, %llu level indices in %.3fs",
+        fullIndexCount, mesh->indexCount - fullIndexCount, elapsedSeconds
+    );
+}
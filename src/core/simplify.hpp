@@ -0,0 +1,53 @@
+/**
+ * Description:  Quadric mesh simplification
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "pch.hpp"
+
+namespace Core {
+
+// forward declaration
+struct vertex;
+struct Mesh;
+struct JobQueue;
+
+/// @brief Sub-meshes with fewer triangles than this don't get simplified levels
+#define SIMPLIFY_MIN_TRIANGLE_COUNT 256
+/// @brief A level is kept only if it has at most this fraction of the previous level's indices
+#define SIMPLIFY_MIN_REDUCTION 0.85f
+/// @brief Weight of uv and normal differences relative to geometric error
+#define SIMPLIFY_ATTRIBUTE_WEIGHT 1.0f
+/// @brief Maximum number of collapse passes per level
+#define SIMPLIFY_MAX_PASSES 64
+
+/// @brief Simplify indexed triangle list with quadric error metrics.
+/// Edges are collapsed into one of their vertices so result references input vertices.
+/// Vertices on open borders and vertices that share a position
+/// with another vertex (uv and normal seams) never move.
+/// Scratch memory is allocated once per call
+/// @param indexCount number of indices
+/// @param indices triangle indices
+/// @param vertexCount number of vertices
+/// @param vertices vertices
+/// @param targetIndexCount number of indices to simplify down to
+/// @param result [out] simplified indices, must hold indexCount indices
+/// @param resultError [out] largest distance from input surface, in mesh units
+/// @return number of indices in result
+usize SimplifyMesh(
+    usize indexCount, const u32* indices,
+    usize vertexCount, const Core::vertex* vertices,
+    usize targetIndexCount,
+    u32* result, f32* resultError
+);
+
+/// @brief Generate simplified levels for every sub-mesh.
+/// Each level aims for half of the previous level's triangles,
+/// levels are appended to mesh indices and reference sub-mesh vertices.
+/// Levels of every sub-mesh are simplified in parallel on job queue
+/// @param mesh mesh, run before OptimizeMesh
+/// @param queue job queue, can be nullptr
+void GenerateMeshLODs( Mesh* mesh, JobQueue* queue );
+
+} // namespace Core
@@ -0,0 +1,274 @@
+/**
+ * Description:  Binary .stl loading
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "core/stl.hpp"
+#include "core/obj.hpp"
+#include "core/mesh.hpp"
+#include "core/renderex.hpp"
+#include "core/cache.hpp"
+#include "core/jobs.hpp"
+#include "platform/io.hpp"
+#include "util.hpp"
+
+static_assert( sizeof(Core::vertex) == 12 * sizeof(f32), "Vertex conversion writes three vectors per vertex!" );
+
+/// @brief Triangle record range converted by a single job
+struct STLChunk {
+    const u8* records;
+    usize count;
+    /// @brief Records that can be loaded 16 bytes at a time without reading past end of file
+    usize packedCount;
+    u32 firstVertex;
+    Core::vertex* vertices;
+    u32* indices;
+    /// @brief [out] bounds of converted positions
+    smath::vec3 boundsMin;
+    smath::vec3 boundsMax;
+};
+
+/// @brief Load three floats without reading past them, w is zero
+static inline __m128 STLLoadVec3( const u8* at ) {
+    f32 values[3];
+    Platform::MemCopy( sizeof(values), at, values );
+    return _mm_setr_ps( values[0], values[1], values[2], 0.0f );
+}
+
+/// @brief Sum of x, y and z in every lane, w must be zero
+static inline __m128 STLLengthSqr( __m128 v ) {
+    __m128 square = _mm_mul_ps( v, v );
+    __m128 sum = _mm_add_ps( square, _mm_shuffle_ps( square, square, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+    return _mm_add_ps( sum, _mm_shuffle_ps( sum, sum, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+}
+
+/// @brief Write the three vertices of a facet, w of positions is ignored
+static inline void STLWriteTriangle(
+    __m128 normal, const __m128 positions[3],
+    f32* out, __m128* boundsMin, __m128* boundsMax
+) {
+    // NOTE(alicia): SSE
+    const __m128 xyzMask = _mm_castsi128_ps( _mm_setr_epi32( -1, -1, -1, 0 ) );
+    normal = _mm_and_ps( normal, xyzMask );
+    __m128 lengthSqr = STLLengthSqr( normal );
+    if( _mm_cvtss_f32( lengthSqr ) <= 0.0f ) {
+        // facet has no stored normal, counter-clockwise winding faces out
+        __m128 e1 = _mm_and_ps( _mm_sub_ps( positions[1], positions[0] ), xyzMask );
+        __m128 e2 = _mm_and_ps( _mm_sub_ps( positions[2], positions[0] ), xyzMask );
+        normal = _mm_sub_ps(
+            _mm_mul_ps( _mm_shuffle_ps( e1, e1, _MM_SHUFFLE( 3, 0, 2, 1 ) ), _mm_shuffle_ps( e2, e2, _MM_SHUFFLE( 3, 1, 0, 2 ) ) ),
+            _mm_mul_ps( _mm_shuffle_ps( e1, e1, _MM_SHUFFLE( 3, 1, 0, 2 ) ), _mm_shuffle_ps( e2, e2, _MM_SHUFFLE( 3, 0, 2, 1 ) ) )
+        );
+        lengthSqr = STLLengthSqr( normal );
+    }
+    // NOTE(alicia): triangles without area would divide by zero, their normal is zero
+    __m128 hasLength = _mm_cmpgt_ps( lengthSqr, _mm_setzero_ps() );
+    normal = _mm_mul_ps( normal, _mm_and_ps( hasLength, _mm_div_ps( _mm_set1_ps( 1.0f ), _mm_sqrt_ps( lengthSqr ) ) ) );
+
+    // vertex is position, uv and normal and tangent, written as three vectors.
+    // uv is position xy
+    ucycles( 3 ) {
+        __m128 position = positions[i];
+        __m128 yynn = _mm_shuffle_ps( position, normal, _MM_SHUFFLE( 0, 0, 1, 1 ) );
+        _mm_storeu_ps( out + 0, _mm_shuffle_ps( position, position, _MM_SHUFFLE( 0, 2, 1, 0 ) ) );
+        _mm_storeu_ps( out + 4, _mm_shuffle_ps( yynn, normal, _MM_SHUFFLE( 2, 1, 2, 0 ) ) );
+        _mm_storeu_ps( out + 8, _mm_setzero_ps() );
+        out += 12;
+
+        *boundsMin = _mm_min_ps( *boundsMin, position );
+        *boundsMax = _mm_max_ps( *boundsMax, position );
+    }
+}
+
+static void STLJob( void* params ) {
+    STLChunk* chunk = (STLChunk*)params;
+
+    __m128 boundsMin = _mm_set1_ps( F32::MAX );
+    __m128 boundsMax = _mm_set1_ps( -F32::MAX );
+
+    const u8* record = chunk->records;
+    f32* out = (f32*)chunk->vertices;
+    ucycles( chunk->count ) {
+        __m128 normal;
+        __m128 positions[3];
+        if( i < chunk->packedCount ) {
+            // NOTE(alicia): w of every load is the first float of the next vector
+            normal = _mm_loadu_ps( (const f32*)( record ) );
+            ucyclesi( 3, corner ) {
+                positions[corner] = _mm_loadu_ps( (const f32*)( record + 12 + corner * 12 ) );
+            }
+        } else {
+            normal = STLLoadVec3( record );
+            ucyclesi( 3, corner ) {
+                positions[corner] = STLLoadVec3( record + 12 + corner * 12 );
+            }
+        }
+        STLWriteTriangle( normal, positions, out, &boundsMin, &boundsMax );
+
+        u32 firstVertex = chunk->firstVertex + (u32)i * 3;
+        chunk->indices[i * 3 + 0] = firstVertex + 0;
+        chunk->indices[i * 3 + 1] = firstVertex + 1;
+        chunk->indices[i * 3 + 2] = firstVertex + 2;
+
+        record += STL_RECORD_SIZE;
+        out    += 36;
+    }
+
+    f32 bounds[2][4];
+    _mm_storeu_ps( bounds[0], boundsMin );
+    _mm_storeu_ps( bounds[1], boundsMax );
+    chunk->boundsMin = smath::vec3( bounds[0][0], bounds[0][1], bounds[0][2] );
+    chunk->boundsMax = smath::vec3( bounds[1][0], bounds[1][1], bounds[1][2] );
+}
+
+bool Core::BuildSTLMesh( usize size, const void* data, JobQueue* queue, Mesh* result ) {
+    u64 startTime = Platform::GetPerformanceCounter();
+
+    *result = {};
+    const u8* begin = (const u8*)data;
+    if( size < STL_HEADER_SIZE + sizeof(u32) ) {
+        LOG_ERROR( "BuildSTLMesh > File is too small to be a binary stl!" );
+        return false;
+    }
+    u32 triangleCount = 0;
+    Platform::MemCopy( sizeof(u32), begin + STL_HEADER_SIZE, &triangleCount );
+    const u8* records = begin + STL_HEADER_SIZE + sizeof(u32);
+    usize available = size - STL_HEADER_SIZE - sizeof(u32);
+    if( triangleCount > available / STL_RECORD_SIZE ) {
+        // NOTE(alicia): some binary files start with "solid" too, so it is only checked once size doesn't match
+        if( stringCmp( 5, (const char*)begin, 5, "solid" ) ) {
+            LOG_ERROR( "BuildSTLMesh > ASCII stl files are not supported!" );
+        } else {
+            LOG_ERROR( "BuildSTLMesh > File is truncated!" );
+        }
+        return false;
+    }
+    if( triangleCount == 0 ) {
+        LOG_ERROR( "BuildSTLMesh > File has no triangles!" );
+        return false;
+    }
+    if( (usize)triangleCount * 3 > (usize)U32::MAX ) {
+        LOG_ERROR( "BuildSTLMesh > Mesh has too many triangles! %u", triangleCount );
+        return false;
+    }
+
+    usize vertexCount = (usize)triangleCount * 3;
+    result->vertexCount  = vertexCount;
+    result->vertices     = (Core::vertex*)Platform::Alloc( vertexCount * sizeof(Core::vertex) );
+    result->indexCount   = vertexCount;
+    result->indices      = (u32*)Platform::Alloc( vertexCount * sizeof(u32) );
+    result->subMeshCount = 1;
+    result->subMeshes    = (SubMesh*)Platform::Alloc( sizeof(SubMesh) );
+    if( !result->vertices || !result->indices || !result->subMeshes ) {
+        LOG_ERROR( "BuildSTLMesh > Failed to allocate mesh!" );
+        FreeMesh( result );
+        return false;
+    }
+    result->subMeshes[0].indexCount  = (u32)vertexCount;
+    result->subMeshes[0].vertexCount = (u32)vertexCount;
+    result->subMeshes[0].material    = -1;
+
+    // records whose last 16 byte load, at 36 bytes in, stays inside the file
+    usize packedLimit = available >= 52 ? ( available - 52 ) / STL_RECORD_SIZE + 1 : 0;
+
+    usize chunkCount = queue ? JobQueueThreadCount( queue ) : 1;
+    if( chunkCount > STL_MAX_JOBS ) {
+        chunkCount = STL_MAX_JOBS;
+    }
+    if( chunkCount > triangleCount / STL_MIN_JOB_TRIANGLES ) {
+        chunkCount = triangleCount / STL_MIN_JOB_TRIANGLES;
+    }
+    if( chunkCount == 0 ) {
+        chunkCount = 1;
+    }
+    usize trianglesPerChunk = ( triangleCount + chunkCount - 1 ) / chunkCount;
+    STLChunk chunks[STL_MAX_JOBS];
+    ucycles( chunkCount ) {
+        STLChunk* chunk = &chunks[i];
+        *chunk = {};
+        usize firstTriangle = i * trianglesPerChunk < triangleCount ? i * trianglesPerChunk : triangleCount;
+        chunk->count       = triangleCount - firstTriangle < trianglesPerChunk ? triangleCount - firstTriangle : trianglesPerChunk;
+        chunk->records     = records + firstTriangle * STL_RECORD_SIZE;
+        chunk->packedCount = packedLimit > firstTriangle ?
+            ( packedLimit - firstTriangle < chunk->count ? packedLimit - firstTriangle : chunk->count ) : 0;
+        chunk->firstVertex = (u32)( firstTriangle * 3 );
+        chunk->vertices    = result->vertices + firstTriangle * 3;
+        chunk->indices     = result->indices + firstTriangle * 3;
+    }
+    if( chunkCount == 1 ) {
+        STLJob( &chunks[0] );
+    } else {
+        Core::JobCounter counter = {};
+        ucycles( chunkCount ) {
+            Core::PushJob( queue, STLJob, &chunks[i], &counter );
+        }
+        Core::WaitForJobs( queue, &counter );
+    }
+
+    result->boundsMin = chunks[0].boundsMin;
+    result->boundsMax = chunks[0].boundsMax;
+    for( usize i = 1; i < chunkCount; ++i ) {
+        if( chunks[i].count == 0 ) {
+            continue;
+        }
+        ucyclesi( 3, axis ) {
+            if( chunks[i].boundsMin[axis] < result->boundsMin[axis] ) {
+                result->boundsMin[axis] = chunks[i].boundsMin[axis];
+            }
+            if( chunks[i].boundsMax[axis] > result->boundsMax[axis] ) {
+                result->boundsMax[axis] = chunks[i].boundsMax[axis];
+            }
+        }
+    }
+
+    f64 elapsedSeconds = (f64)( Platform::GetPerformanceCounter() - startTime ) /
+        (f64)Platform::GetPerformanceFrequency();
+    f64 megabytes = (f64)size / (f64)MEGABYTES(1);
+    LOG_INFO( "BuildSTLMesh > Converted %.2fMB in %.3fs ( %.1fMB/s ) on %llu threads, %u triangles",
+        megabytes,
+        elapsedSeconds,
+        elapsedSeconds > 0.0 ? megabytes / elapsedSeconds : 0.0,
+        chunkCount,
+        triangleCount
+    );
+
+    Core::calculateTangentBasis(
+        result->indexCount, result->indices,
+        result->vertexCount, result->vertices,
+        queue
+    );
+    return true;
+}
+
+bool Core::LoadSTLFile( const char* filePath, const OBJParseOptions* options, MeshUploadData* result ) {
+    usize subStrPos = 0;
+    if( !subStringPos( filePath, ".stl", &subStrPos ) ) {
+        LOG_WARN("LoadSTLFile > Attempted to parse a file that is not an stl!");
+        return false;
+    }
+
+    Platform::MappedFile file = {};
+    if( !Platform::MapFile( filePath, &file ) ) {
+        LOG_ERROR( "LoadSTLFile > Failed to map \"%s\"!", filePath );
+        return false;
+    }
+    Core::JobQueue* queue = options ? options->jobQueue : nullptr;
+    usize sourceSize = file.size;
+
+    u64 sourceHash = 0;
+    if( !options || !options->skipCache ) {
+        sourceHash = Core::HashContents( file.size, file.data, queue );
+        if( Core::LoadMeshCacheData( sourceHash, sourceSize, MeshCacheFlags( options ), result ) ) {
+            Platform::UnmapFile( &file );
+            return true;
+        }
+    }
+
+    Core::Mesh mesh = {};
+    bool built = BuildSTLMesh( file.size, file.data, queue, &mesh );
+    Platform::UnmapFile( &file );
+    if( !built ) {
+        return false;
+    }
+    return FinishMeshLoad( &mesh, nullptr, sourceHash, sourceSize, options, result );
+}
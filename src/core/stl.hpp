@@ -0,0 +1,47 @@
+/**
+ * Description:  Binary .stl loading
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "pch.hpp"
+
+namespace Core {
+
+// forward declaration
+struct JobQueue;
+struct Mesh;
+struct MeshUploadData;
+struct OBJParseOptions;
+
+/// @brief Size of header before triangle count
+#define STL_HEADER_SIZE 80
+/// @brief Size of a triangle record: normal, three positions and attribute byte count
+#define STL_RECORD_SIZE 50
+/// @brief Smallest number of triangles worth converting on its own job
+#define STL_MIN_JOB_TRIANGLES 65536
+#define STL_MAX_JOBS 64
+
+/// @brief Build mesh from binary .stl file in memory.
+/// Triangle records are converted straight from file memory into mesh vertices
+/// with SSE, in parallel record ranges.
+/// STL stores a normal per facet, so triangles don't share vertices and are flat shaded.
+/// Facets without a stored normal get one from their winding, uvs are position xy.
+/// Mesh has a single sub-mesh without material
+/// @param size size of file in bytes
+/// @param data file memory, usually a mapped file
+/// @param queue job queue records are converted on, can be nullptr
+/// @param result [out] mesh, free with FreeMesh
+/// @return true if successful
+bool BuildSTLMesh( usize size, const void* data, JobQueue* queue, Mesh* result );
+
+/// @brief Load binary .stl model from path without touching the GPU, safe to call from any thread.
+/// File is mapped, read from the mesh cache if possible, otherwise built with BuildSTLMesh
+/// and finished like an .obj model. Crease angle and memory budget options are not used
+/// @param filePath path to file
+/// @param options parse options, nullptr for defaults
+/// @param result [out] upload data, free with FreeMeshUploadData
+/// @return true if successful
+bool LoadSTLFile( const char* filePath, const OBJParseOptions* options, MeshUploadData* result );
+
+} // namespace Core
@@ -0,0 +1,379 @@
+/**
+ * Description:  Out-of-core record streams and external sorting
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "core/stream.hpp"
+
+static inline u64 StreamKey( const void* record ) {
+    return *(const u64*)record;
+}
+
+bool Core::CreateRecordWriter( const char* filePath, usize recordSize, usize bufferSize, RecordWriter* result ) {
+    *result = {};
+    if( !Platform::OpenFileStream( filePath, Platform::FileStreamMode::WRITE, &result->file ) ) {
+        LOG_ERROR( "Stream > Failed to create \"%s\"!", filePath );
+        return false;
+    }
+    result->recordSize     = recordSize;
+    result->bufferCapacity = bufferSize / recordSize;
+    if( result->bufferCapacity < 1 ) {
+        result->bufferCapacity = 1;
+    }
+    result->buffer = (u8*)Platform::Alloc( result->bufferCapacity * recordSize );
+    if( !result->buffer ) {
+        LOG_ERROR( "Stream > Failed to allocate write buffer!" );
+        Platform::CloseFileStream( &result->file );
+        *result = {};
+        return false;
+    }
+    return true;
+}
+
+static void StreamFlush( Core::RecordWriter* writer ) {
+    usize size = writer->bufferedCount * writer->recordSize;
+    if( size > 0 && !writer->failed ) {
+        writer->failed = !Platform::WriteFileStream( &writer->file, writer->offset, size, writer->buffer );
+    }
+    writer->offset       += size;
+    writer->bufferedCount = 0;
+}
+
+void* Core::PushRecord( RecordWriter* writer ) {
+    if( writer->bufferedCount == writer->bufferCapacity ) {
+        StreamFlush( writer );
+    }
+    writer->recordCount++;
+    return writer->buffer + writer->bufferedCount++ * writer->recordSize;
+}
+
+bool Core::CloseRecordWriter( RecordWriter* writer ) {
+    if( !writer->buffer ) {
+        return false;
+    }
+    StreamFlush( writer );
+    bool success = !writer->failed;
+    Platform::Free( writer->buffer );
+    Platform::CloseFileStream( &writer->file );
+    *writer = {};
+    return success;
+}
+
+/// @brief Read records in byte range of file
+/// @return false if allocation failed
+static bool StreamInitReader(
+    const Platform::FileStream* file, bool ownsFile,
+    usize recordSize, usize begin, usize end, usize bufferSize,
+    Core::RecordReader* result
+) {
+    *result = {};
+    result->file       = *file;
+    result->ownsFile   = ownsFile;
+    result->recordSize = recordSize;
+    result->offset     = begin;
+    result->end        = end;
+    result->bufferCapacity = bufferSize / recordSize;
+    if( result->bufferCapacity < 1 ) {
+        result->bufferCapacity = 1;
+    }
+    result->buffer = (u8*)Platform::Alloc( result->bufferCapacity * recordSize );
+    return result->buffer != nullptr;
+}
+
+bool Core::OpenRecordReader( const char* filePath, usize recordSize, usize bufferSize, RecordReader* result ) {
+    *result = {};
+    Platform::FileStream file = {};
+    if( !Platform::OpenFileStream( filePath, Platform::FileStreamMode::READ, &file ) ) {
+        LOG_ERROR( "Stream > Failed to open \"%s\"!", filePath );
+        return false;
+    }
+    // NOTE(alicia): a partial record at the end of the file is never read
+    usize end = file.size - file.size % recordSize;
+    if( !StreamInitReader( &file, true, recordSize, 0, end, bufferSize, result ) ) {
+        LOG_ERROR( "Stream > Failed to allocate read buffer!" );
+        CloseRecordReader( result );
+        return false;
+    }
+    return true;
+}
+
+const void* Core::NextRecord( RecordReader* reader ) {
+    if( reader->bufferPosition == reader->bufferedCount ) {
+        if( reader->offset >= reader->end ) {
+            return nullptr;
+        }
+        usize size = reader->end - reader->offset;
+        if( size > reader->bufferCapacity * reader->recordSize ) {
+            size = reader->bufferCapacity * reader->recordSize;
+        }
+        usize bytesRead = Platform::ReadFileStream( &reader->file, reader->offset, size, reader->buffer );
+        bytesRead -= bytesRead % reader->recordSize;
+        if( bytesRead == 0 ) {
+            LOG_ERROR( "Stream > Failed to read records!" );
+            reader->offset = reader->end;
+            return nullptr;
+        }
+        reader->offset        += bytesRead;
+        reader->bufferedCount  = bytesRead / reader->recordSize;
+        reader->bufferPosition = 0;
+    }
+    return reader->buffer + reader->bufferPosition++ * reader->recordSize;
+}
+
+void Core::CloseRecordReader( RecordReader* reader ) {
+    if( reader->buffer ) {
+        Platform::Free( reader->buffer );
+    }
+    if( reader->ownsFile ) {
+        Platform::CloseFileStream( &reader->file );
+    }
+    *reader = {};
+}
+
+/// @brief LSD radix sort records by key, a byte at a time
+/// @return buffer that holds sorted records, either records or scratch
+static u8* StreamRadixSort( usize count, usize recordSize, u8* records, u8* scratch ) {
+    usize histograms[sizeof(u64)][256] = {};
+    ucycles( count ) {
+        u64 key = StreamKey( records + i * recordSize );
+        ucyclesi( sizeof(u64), digit ) {
+            histograms[digit][( key >> ( digit * 8 ) ) & 0xFF]++;
+        }
+    }
+
+    u8* source      = records;
+    u8* destination = scratch;
+    ucyclesi( sizeof(u64), digit ) {
+        usize* histogram = histograms[digit];
+        // NOTE(alicia): digits every key shares don't change the order
+        bool shared = false;
+        ucycles( 256 ) {
+            if( histogram[i] == count ) {
+                shared = true;
+                break;
+            }
+        }
+        if( shared ) {
+            continue;
+        }
+
+        usize offset = 0;
+        ucycles( 256 ) {
+            usize bucketCount = histogram[i];
+            histogram[i] = offset;
+            offset += bucketCount;
+        }
+        ucycles( count ) {
+            const u8* record = source + i * recordSize;
+            usize bucket = ( StreamKey( record ) >> ( digit * 8 ) ) & 0xFF;
+            Platform::MemCopy( recordSize, record, destination + histogram[bucket]++ * recordSize );
+        }
+
+        u8* swap    = source;
+        source      = destination;
+        destination = swap;
+    }
+    return source;
+}
+
+/// @brief Min-heap order of merge ways, ties go to the earlier run so merging is stable
+static inline bool StreamWayLess( const u8* const* heads, u32 a, u32 b ) {
+    u64 keyA = StreamKey( heads[a] );
+    u64 keyB = StreamKey( heads[b] );
+    return keyA < keyB || ( keyA == keyB && a < b );
+}
+
+static void StreamSiftDown( const u8* const* heads, u32 heapCount, u32* heap, u32 position ) {
+    for( ;; ) {
+        u32 smallest = position;
+        u32 left  = position * 2 + 1;
+        u32 right = left + 1;
+        if( left < heapCount && StreamWayLess( heads, heap[left], heap[smallest] ) ) {
+            smallest = left;
+        }
+        if( right < heapCount && StreamWayLess( heads, heap[right], heap[smallest] ) ) {
+            smallest = right;
+        }
+        if( smallest == position ) {
+            return;
+        }
+        u32 swap        = heap[position];
+        heap[position]  = heap[smallest];
+        heap[smallest]  = swap;
+        position        = smallest;
+    }
+}
+
+/// @brief Merge every group of up to ways sorted runs of source into a single run of destination
+/// @param runCount [in/out] number of runs
+/// @param runLength [in/out] number of records in every run but the last
+/// @return true if successful
+static bool StreamMergePass(
+    const char* sourcePath, const char* destinationPath,
+    usize recordSize, usize recordCount, usize memoryBudget,
+    usize* runCount, usize* runLength
+) {
+    usize ways = memoryBudget / STREAM_MIN_BUFFER_SIZE;
+    ways = ways > 1 ? ways - 1 : 1;
+    if( ways > STREAM_MAX_MERGE_WAYS ) {
+        ways = STREAM_MAX_MERGE_WAYS;
+    }
+    if( ways < 2 ) {
+        ways = 2;
+    }
+    if( ways > *runCount ) {
+        ways = *runCount;
+    }
+    usize bufferSize = memoryBudget / ( ways + 1 );
+
+    Platform::FileStream source = {};
+    if( !Platform::OpenFileStream( sourcePath, Platform::FileStreamMode::READ, &source ) ) {
+        LOG_ERROR( "Stream > Failed to open \"%s\"!", sourcePath );
+        return false;
+    }
+    Core::RecordWriter writer = {};
+    if( !Core::CreateRecordWriter( destinationPath, recordSize, bufferSize, &writer ) ) {
+        Platform::CloseFileStream( &source );
+        return false;
+    }
+
+    bool success = true;
+    Core::RecordReader readers[STREAM_MAX_MERGE_WAYS];
+    const u8* heads[STREAM_MAX_MERGE_WAYS];
+    u32 heap[STREAM_MAX_MERGE_WAYS];
+    for( usize firstRun = 0; success && firstRun < *runCount; firstRun += ways ) {
+        usize groupRunCount = *runCount - firstRun < ways ? *runCount - firstRun : ways;
+
+        u32 heapCount = 0;
+        ucycles( groupRunCount ) {
+            usize begin = ( firstRun + i ) * *runLength;
+            usize end   = begin + *runLength < recordCount ? begin + *runLength : recordCount;
+            if( !StreamInitReader( &source, false, recordSize, begin * recordSize, end * recordSize, bufferSize, &readers[i] ) ) {
+                LOG_ERROR( "Stream > Failed to allocate read buffer!" );
+                success = false;
+            }
+            heads[i] = success ? (const u8*)Core::NextRecord( &readers[i] ) : nullptr;
+            if( heads[i] ) {
+                heap[heapCount++] = (u32)i;
+            }
+        }
+        for( u32 i = heapCount / 2; success && i-- > 0; ) {
+            StreamSiftDown( heads, heapCount, heap, i );
+        }
+
+        while( success && heapCount > 0 ) {
+            u32 way = heap[0];
+            Platform::MemCopy( recordSize, heads[way], Core::PushRecord( &writer ) );
+            heads[way] = (const u8*)Core::NextRecord( &readers[way] );
+            if( !heads[way] ) {
+                heap[0] = heap[--heapCount];
+            }
+            StreamSiftDown( heads, heapCount, heap, 0 );
+        }
+
+        ucycles( groupRunCount ) {
+            Core::CloseRecordReader( &readers[i] );
+        }
+    }
+
+    Platform::CloseFileStream( &source );
+    usize writtenCount = writer.recordCount;
+    if( !Core::CloseRecordWriter( &writer ) || writtenCount != recordCount ) {
+        success = false;
+    }
+    *runCount  = ( *runCount + ways - 1 ) / ways;
+    *runLength = *runLength * ways;
+    return success;
+}
+
+bool Core::SortRecords( const char* filePath, const char* scratchPath, usize recordSize, usize memoryBudget ) {
+    DEBUG_ASSERT_LOG( recordSize % sizeof(u64) == 0,
+        "SortRecords > Record size must be a multiple of 8! %llu", recordSize
+    );
+
+    Platform::FileStream file = {};
+    if( !Platform::OpenFileStream( filePath, Platform::FileStreamMode::READ, &file ) ) {
+        LOG_ERROR( "SortRecords > Failed to open \"%s\"!", filePath );
+        return false;
+    }
+    usize recordCount = file.size / recordSize;
+    if( recordCount <= 1 ) {
+        Platform::CloseFileStream( &file );
+        return true;
+    }
+
+    // NOTE(alicia): radix sort needs a second buffer as large as the run
+    usize runLength = memoryBudget / ( recordSize * 2 );
+    if( runLength < 1 ) {
+        runLength = 1;
+    }
+    if( runLength > recordCount ) {
+        runLength = recordCount;
+    }
+    usize runCount = ( recordCount + runLength - 1 ) / runLength;
+
+    u8* records = (u8*)Platform::Alloc( runLength * recordSize * 2 );
+    if( !records ) {
+        LOG_ERROR( "SortRecords > Failed to allocate run buffer!" );
+        Platform::CloseFileStream( &file );
+        return false;
+    }
+    u8* scratch = records + runLength * recordSize;
+
+    // everything fits in memory, sort in place
+    if( runCount == 1 ) {
+        usize size = recordCount * recordSize;
+        bool success = Platform::ReadFileStream( &file, 0, size, records ) == size;
+        Platform::CloseFileStream( &file );
+        if( success ) {
+            u8* sorted = StreamRadixSort( recordCount, recordSize, records, scratch );
+            success =
+                Platform::OpenFileStream( filePath, Platform::FileStreamMode::WRITE, &file ) &&
+                Platform::WriteFileStream( &file, 0, size, sorted );
+            Platform::CloseFileStream( &file );
+        }
+        Platform::Free( records );
+        if( !success ) {
+            LOG_ERROR( "SortRecords > Failed to sort \"%s\"!", filePath );
+        }
+        return success;
+    }
+
+    // run pass: sort every run in memory and spill it to scratch file
+    Platform::FileStream runFile = {};
+    bool success = Platform::OpenFileStream( scratchPath, Platform::FileStreamMode::WRITE, &runFile );
+    for( usize run = 0; success && run < runCount; ++run ) {
+        usize first = run * runLength;
+        usize count = recordCount - first < runLength ? recordCount - first : runLength;
+        usize size  = count * recordSize;
+        success = Platform::ReadFileStream( &file, first * recordSize, size, records ) == size;
+        if( success ) {
+            u8* sorted = StreamRadixSort( count, recordSize, records, scratch );
+            success = Platform::WriteFileStream( &runFile, first * recordSize, size, sorted );
+        }
+    }
+    Platform::CloseFileStream( &runFile );
+    Platform::CloseFileStream( &file );
+    Platform::Free( records );
+
+    // merge passes alternate between scratch file and file
+    const char* source      = scratchPath;
+    const char* destination = filePath;
+    while( success && runCount > 1 ) {
+        success = StreamMergePass( source, destination, recordSize, recordCount, memoryBudget, &runCount, &runLength );
+        const char* swap = source;
+        source      = destination;
+        destination = swap;
+    }
+    // NOTE(alicia): after an even number of passes the result is in scratch file,
+    // merging a single run copies it back
+    if( success && source != filePath ) {
+        success = StreamMergePass( source, destination, recordSize, recordCount, memoryBudget, &runCount, &runLength );
+    }
+
+    Platform::RemoveFile( scratchPath );
+    if( !success ) {
+        LOG_ERROR( "SortRecords > Failed to sort \"%s\"!", filePath );
+    }
+    return success;
+}
@@ -0,0 +1,86 @@
+/**
+ * Description:  Out-of-core record streams and external sorting
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "pch.hpp"
+#include "platform/io.hpp"
+
+namespace Core {
+
+/// @brief Smallest buffer a record reader or writer works with
+#define STREAM_MIN_BUFFER_SIZE KILOBYTES(64)
+/// @brief Maximum number of sorted runs merged in a single pass
+#define STREAM_MAX_MERGE_WAYS 64
+
+/// @brief Buffered writer that appends fixed-size records to a file
+struct RecordWriter {
+    Platform::FileStream file;
+    usize recordSize;
+    /// @brief File offset buffer is flushed to
+    usize offset;
+    u8* buffer;
+    usize bufferCapacity;
+    usize bufferedCount;
+    /// @brief Number of records pushed so far
+    usize recordCount;
+    bool failed;
+};
+
+/// @brief Buffered sequential reader of fixed-size records
+struct RecordReader {
+    Platform::FileStream file;
+    bool ownsFile;
+    usize recordSize;
+    /// @brief File offset of next read and offset reading stops at
+    usize offset;
+    usize end;
+    u8* buffer;
+    usize bufferCapacity;
+    usize bufferedCount;
+    usize bufferPosition;
+};
+
+/// @brief Create file, or truncate existing file, for writing records
+/// @param filePath path to file
+/// @param recordSize size of a record in bytes
+/// @param bufferSize size of write buffer in bytes, at least one record is buffered
+/// @param result [out] writer, close with CloseRecordWriter
+/// @return true if successful
+bool CreateRecordWriter( const char* filePath, usize recordSize, usize bufferSize, RecordWriter* result );
+/// @brief Reserve next record in write buffer, buffer is flushed when full
+/// @return record, valid until next push
+void* PushRecord( RecordWriter* writer );
+/// @brief Flush remaining records and close file
+/// @return false if any write failed
+bool CloseRecordWriter( RecordWriter* writer );
+
+/// @brief Open file of records for reading
+/// @param filePath path to file
+/// @param recordSize size of a record in bytes
+/// @param bufferSize size of read buffer in bytes, at least one record is buffered
+/// @param result [out] reader, close with CloseRecordReader
+/// @return true if successful
+bool OpenRecordReader( const char* filePath, usize recordSize, usize bufferSize, RecordReader* result );
+/// @brief Read next record
+/// @return record, valid until next read, nullptr at end of file
+const void* NextRecord( RecordReader* reader );
+/// @brief Close reader
+void CloseRecordReader( RecordReader* reader );
+/// @brief Number of records in file of reader
+inline usize RecordCount( const RecordReader* reader ) {
+    return reader->file.size / reader->recordSize;
+}
+
+/// @brief Sort file of records by the u64 key every record starts with.
+/// Runs that fit in memory budget are radix sorted and merged in as few passes as possible,
+/// records with equal keys keep their order
+/// @param filePath file to sort in place
+/// @param scratchPath file runs are spilled to, deleted when done
+/// @param recordSize size of a record in bytes, must be a multiple of 8
+/// @param memoryBudget maximum number of bytes held in memory
+/// @return true if successful
+bool SortRecords( const char* filePath, const char* scratchPath, usize recordSize, usize memoryBudget );
+
+} // namespace Core
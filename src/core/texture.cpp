@@ -0,0 +1,218 @@
+/**
+ * Description:  Texture loading
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "core/texture.hpp"
+#include "core/cache.hpp"
+#include "core/jobs.hpp"
+
+/// @brief How a texture is built from its source, textures built differently are cached separately
+static u32 TextureVariant( Core::ImageContent content, Core::BlockQuality quality ) {
+    return (u32)content | ( (u32)quality << 8 );
+}
+
+Platform::TextureFormat Core::BlockFormatToTextureFormat( BlockFormat format ) {
+    switch( format ) {
+        case BlockFormat::BC1: return Platform::TextureFormat::BC1_RGB;
+        case BlockFormat::BC3: return Platform::TextureFormat::BC3_RGBA;
+        case BlockFormat::BC4: return Platform::TextureFormat::BC4_R;
+        case BlockFormat::BC5: return Platform::TextureFormat::BC5_RG;
+        default: return Platform::TextureFormat::BC7_RGBA;
+    }
+}
+
+Platform::TextureFormat Core::ComponentTextureFormat( i32 colorComponentCount ) {
+    switch( colorComponentCount ) {
+        case 2: return Platform::TextureFormat::RG;
+        case 3: return Platform::TextureFormat::RGB;
+        case 4: return Platform::TextureFormat::RGBA;
+        default: return Platform::TextureFormat::R;
+    }
+}
+
+usize Core::TextureLevelSize( Platform::TextureFormat format, i32 width, i32 height ) {
+    usize blockBytes = Platform::TextureFormatBlockBytes( format );
+    if( blockBytes ) {
+        return (usize)( ( width + 3 ) / 4 ) * (usize)( ( height + 3 ) / 4 ) * blockBytes;
+    }
+    return (usize)width * (usize)height * Platform::TextureFormatComponentCount( format );
+}
+
+/// @brief Build texture from decoded image, image is moved into result.
+/// Falls back to uncompressed mips, then to image alone, if a step fails
+static void TextureBuild(
+    Core::Image* image,
+    Core::ImageContent content,
+    Core::BlockQuality quality,
+    Core::JobQueue* queue,
+    Core::TextureUploadData* result
+) {
+    *result = {};
+    result->image = *image;
+    *image = {};
+    result->width  = result->image.width;
+    result->height = result->image.height;
+
+    if( Core::GenerateMipChain( &result->image, Core::MipFilter::KAISER, content, queue, &result->mips ) ) {
+        Core::BlockFormat format = Core::ChooseBlockFormat( content, result->image.colorComponentCount, quality );
+        if( Core::CompressMipChain( &result->mips, format, quality, queue, &result->compressed ) ) {
+            Core::FreeMipChain( &result->mips );
+        }
+        Core::FreeImage( &result->image );
+        result->image = {};
+    }
+
+    if( result->compressed.data ) {
+        result->format     = Core::BlockFormatToTextureFormat( result->compressed.format );
+        result->levelCount = result->compressed.levelCount;
+        ucycles( result->levelCount ) {
+            result->levels[i]     = result->compressed.data + result->compressed.levelOffsets[i];
+            result->levelSizes[i] = result->compressed.levelSizes[i];
+        }
+    } else if( result->mips.data ) {
+        result->format     = Core::ComponentTextureFormat( result->mips.colorComponentCount );
+        result->levelCount = result->mips.levelCount;
+        ucycles( result->levelCount ) {
+            result->levels[i]     = result->mips.data + result->mips.levelOffsets[i];
+            result->levelSizes[i] = Core::TextureLevelSize(
+                result->format,
+                Core::MipLevelSize( result->width, (u32)i ),
+                Core::MipLevelSize( result->height, (u32)i )
+            );
+        }
+    } else {
+        result->format        = Core::ComponentTextureFormat( result->image.colorComponentCount );
+        result->levelCount    = 1;
+        result->levels[0]     = result->image.data;
+        result->levelSizes[0] = result->image.totalSize;
+    }
+}
+
+usize Core::LoadTextures(
+    usize fileCount,
+    const Platform::File* files,
+    const ImageContent* contents,
+    BlockQuality quality,
+    TextureCache* cache,
+    JobQueue* queue,
+    TextureUploadData* results
+) {
+    ucycles( fileCount ) {
+        results[i] = {};
+    }
+    u64* hashes = (u64*)Platform::Alloc( fileCount * sizeof(u64) );
+    Platform::File* decodeFiles = (Platform::File*)Platform::Alloc( fileCount * sizeof(Platform::File) );
+    usize* decodeIndices = (usize*)Platform::Alloc( fileCount * sizeof(usize) );
+    Image* images = (Image*)Platform::Alloc( fileCount * sizeof(Image) );
+    if( !hashes || !decodeFiles || !decodeIndices || !images ) {
+        LOG_ERROR( "LoadTextures > Failed to allocate textures!" );
+        if( hashes ) {
+            Platform::Free( hashes );
+        }
+        if( decodeFiles ) {
+            Platform::Free( decodeFiles );
+        }
+        if( decodeIndices ) {
+            Platform::Free( decodeIndices );
+        }
+        if( images ) {
+            Platform::Free( images );
+        }
+        return 0;
+    }
+
+    // NOTE(alicia): only files that aren't cached are decoded,
+    // they are packed together and decodeIndices maps them back to results
+    usize loadedCount = 0;
+    usize decodeCount = 0;
+    ucycles( fileCount ) {
+        if( !files[i].data ) {
+            continue;
+        }
+        if( cache ) {
+            hashes[i] = HashContents( files[i].size, files[i].data, queue );
+            if( LoadTextureCacheData(
+                cache, hashes[i], files[i].size,
+                TextureVariant( contents[i], quality ), &results[i]
+            ) ) {
+                loadedCount++;
+                continue;
+            }
+        }
+        decodeFiles[decodeCount]   = files[i];
+        decodeIndices[decodeCount] = i;
+        decodeCount++;
+    }
+    if( decodeCount ) {
+        ReadImages( decodeCount, decodeFiles, queue, images );
+    }
+    ucycles( decodeCount ) {
+        if( !images[i].data ) {
+            continue;
+        }
+        usize index = decodeIndices[i];
+        TextureBuild( &images[i], contents[index], quality, queue, &results[index] );
+        loadedCount++;
+        if( cache ) {
+            WriteTextureCache(
+                cache, hashes[index], files[index].size,
+                TextureVariant( contents[index], quality ), &results[index]
+            );
+        }
+    }
+
+    Platform::Free( hashes );
+    Platform::Free( decodeFiles );
+    Platform::Free( decodeIndices );
+    Platform::Free( images );
+    return loadedCount;
+}
+
+void Core::UploadTextureData(
+    const TextureUploadData* data,
+    Platform::TextureWrapMode wrap,
+    Platform::TextureMinFilter minFilter,
+    Platform::RendererAPI* api,
+    Platform::Texture2D* result
+) {
+    Platform::TextureMipChain levels = {};
+    levels.levelCount = data->levelCount;
+    ucycles( data->levelCount ) {
+        levels.levels[i] = data->levels[i];
+    }
+    if( Platform::TextureFormatBlockBytes( data->format ) ) {
+        *result = api->CreateCompressedTexture2D(
+            data->width, data->height,
+            data->format,
+            wrap, wrap,
+            minFilter,
+            Platform::TextureMagFilter::LINEAR,
+            &levels
+        );
+        return;
+    }
+    // NOTE(alicia): levels have tightly packed rows
+    api->SetUnPackAlignment( RENDERER_PACK_ALIGNMENT_1 );
+    *result = api->CreateTexture2D(
+        data->width, data->height,
+        (void*)data->levels[0],
+        data->format,
+        Platform::DataType::UNSIGNED_BYTE,
+        wrap, wrap,
+        minFilter,
+        Platform::TextureMagFilter::LINEAR,
+        data->levelCount > 1 ? &levels : nullptr
+    );
+    api->SetUnPackAlignment( RENDERER_PACK_ALIGNMENT_DEFAULT );
+}
+
+void Core::FreeTextureUploadData( TextureUploadData* data ) {
+    if( data->cacheFile.data ) {
+        Platform::UnmapFile( &data->cacheFile );
+    }
+    FreeImage( &data->image );
+    FreeMipChain( &data->mips );
+    FreeCompressedMipChain( &data->compressed );
+    *data = {};
+}
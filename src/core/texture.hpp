@@ -0,0 +1,85 @@
+/**
+ * Description:  Texture loading
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "pch.hpp"
+#include "core/image.hpp"
+#include "core/bcn.hpp"
+#include "platform/renderer.hpp"
+#include "platform/io.hpp"
+
+namespace Core {
+
+// forward declaration
+struct JobQueue;
+struct TextureCache;
+
+/// @brief Texture in the format it is uploaded in.
+/// Can be prepared on any thread, only UploadTextureData has to run on the main thread
+struct TextureUploadData {
+    i32 width, height;
+    Platform::TextureFormat format;
+    /// @brief Number of levels, if 1 the rest are generated on the GPU
+    u32 levelCount;
+    const u8* levels[IMAGE_MAX_MIP_LEVELS];
+    usize levelSizes[IMAGE_MAX_MIP_LEVELS];
+
+    // NOTE(alicia): levels point into exactly one of these
+
+    /// @brief Decoded image, if its mip chain failed to generate
+    Image image;
+    /// @brief Mip chain, if it failed to compress
+    MipChain mips;
+    CompressedMipChain compressed;
+    /// @brief Cache file, if texture was loaded from cache
+    Platform::MappedFile cacheFile;
+};
+
+/// @brief Load textures from image files in memory without touching the GPU, safe to call from any thread.
+/// Textures are loaded from the texture cache if possible, otherwise images are decoded in parallel,
+/// given Kaiser filtered mip chains, block compressed to the format ChooseBlockFormat picks and written to cache
+/// @param fileCount number of files
+/// @param files image files, files without data are skipped
+/// @param contents what every image represents
+/// @param quality quality images are block compressed with
+/// @param cache texture cache, can be nullptr
+/// @param queue job queue images are decoded and compressed on, can be nullptr
+/// @param results [out] upload data per file, empty if file failed to load, free with FreeTextureUploadData
+/// @return number of textures loaded
+usize LoadTextures(
+    usize fileCount,
+    const Platform::File* files,
+    const ImageContent* contents,
+    BlockQuality quality,
+    TextureCache* cache,
+    JobQueue* queue,
+    TextureUploadData* results
+);
+
+/// @brief Upload prepared texture to GPU, must run on the main thread.
+/// Levels that aren't prepared are generated on the GPU
+/// @param data upload data, still has to be freed with FreeTextureUploadData
+/// @param wrap wrap mode on both axes
+/// @param minFilter minification filtering
+/// @param api renderer api
+/// @param result [out] texture
+void UploadTextureData(
+    const TextureUploadData* data,
+    Platform::TextureWrapMode wrap,
+    Platform::TextureMinFilter minFilter,
+    Platform::RendererAPI* api,
+    Platform::Texture2D* result
+);
+
+void FreeTextureUploadData( TextureUploadData* data );
+
+/// @brief Texture format of block compressed format
+Platform::TextureFormat BlockFormatToTextureFormat( BlockFormat format );
+/// @brief Uncompressed texture format with given number of components
+Platform::TextureFormat ComponentTextureFormat( i32 colorComponentCount );
+/// @brief Size of a level of texture format
+usize TextureLevelSize( Platform::TextureFormat format, i32 width, i32 height );
+
+} // namespace Core
@@ -9,18 +9,6 @@
 #include "core/app.hpp"
 using namespace Core;
 
-void RenderText(
-    usize textBufferLen,
-    const char* textBuffer,
-    smath::vec2* screenPos,
-    f32 scale,
-    smath::vec4* color,
-    Core::Anchor alignment,
-    Core::FontAtlas* fontAtlas,
-    Platform::RendererAPI* api,
-    Core::RenderContext* ctx
-);
-
 bool Core::pointInBounds( const smath::vec2& point, const smath::vec4& bounds ) {
     if( point.x < bounds.x ) {
         return false;
@@ -60,24 +48,79 @@ void Label::setText( usize newTextLen, const char* newText ) {
     m_textBufferLen = newTextLen;
     m_textBuffer = (char*)Platform::Alloc( m_textBufferLen );
     stringCopy( m_textBufferLen, newText, m_textBufferLen, m_textBuffer );
+    m_layoutDirty = true;
 }
-void Label::renderLabel( const Platform::RendererAPI* api, const Core::RenderContext* ctx ) {
-    RenderText(
+void Label::setColor( const smath::vec4& newColor ) {
+    if( smath::cmp( m_color, newColor ) ) {
+        return;
+    }
+    m_color = newColor;
+    // NOTE(alicia): color doesn't move glyphs, recolor cached quads instead of laying text out again
+    if( !m_layoutDirty ) {
+        ucycles( m_glyphCount * TEXT_VERTICES_PER_GLYPH ) {
+            m_glyphVertices[i].color = m_color;
+        }
+    }
+}
+void Label::updateLayout( const smath::vec2& pixelPosition ) {
+    if(
+        !m_layoutDirty &&
+        m_layoutAnchor == m_anchor &&
+        smath::cmp( m_layoutPosition, pixelPosition )
+    ) {
+        return;
+    }
+
+    usize maxGlyphCount = m_textBufferLen ? m_textBufferLen - 1 : 0;
+    if( maxGlyphCount > m_glyphCapacity ) {
+        if( m_glyphVertices ) {
+            Platform::Free( m_glyphVertices );
+        }
+        m_glyphVertices = (TextVertex*)Platform::Alloc(
+            maxGlyphCount * TEXT_VERTICES_PER_GLYPH * sizeof(TextVertex) );
+        m_glyphCapacity = m_glyphVertices ? maxGlyphCount : 0;
+        if( !m_glyphVertices ) {
+            LOG_ERROR( "UI > Failed to allocate glyphs of label!" );
+            m_glyphCount = 0;
+            return;
+        }
+    }
+
+    m_glyphCount = Core::LayoutText(
+        m_fontAtlas,
         m_textBufferLen,
         m_textBuffer,
-        &m_screenSpacePosition,
+        pixelPosition,
         m_scale,
-        &m_color,
+        m_color,
         m_anchor,
-        (Core::FontAtlas*)m_fontAtlas,
-        (Platform::RendererAPI*)api,
-        (Core::RenderContext*)ctx
+        m_glyphVertices,
+        &m_textBounds
+    );
+    m_layoutPosition = pixelPosition;
+    m_layoutAnchor   = m_anchor;
+    m_layoutDirty    = false;
+}
+void Label::renderLabel( Core::RenderContext* ctx ) {
+    smath::vec2 pixelPosition = smath::vec2(
+        m_screenSpacePosition.x * (f32)ctx->viewport.x,
+        m_screenSpacePosition.y * (f32)ctx->viewport.y
+    );
+    updateLayout( pixelPosition );
+    Core::PushTextGlyphs(
+        &ctx->textBatch,
+        &ctx->fontAtlasTexture,
+        m_glyphCount,
+        m_glyphVertices
     );
 }
 Label::~Label() {
     if( m_textBuffer ) {
         Platform::Free( m_textBuffer );
     }
+    if( m_glyphVertices ) {
+        Platform::Free( m_glyphVertices );
+    }
 }
 
 LabelButton::LabelButton(
@@ -108,73 +151,22 @@ LabelButton::LabelButton(
 
 }
 void LabelButton::setText( usize newTextLen, const char* newText ) {
-    if( m_textBuffer ) {
-        Platform::Free( m_textBuffer );
-    }
-    m_textBufferLen = newTextLen;
-    m_textBuffer = (char*)Platform::Alloc( m_textBufferLen );
-    stringCopy( m_textBufferLen, newText, m_textBufferLen, m_textBuffer );
+    Label::setText( newTextLen, newText );
     recalculateBounds();
 }
 void LabelButton::setScale( f32 newScale ) {
-    m_scale = newScale;
+    Label::setScale( newScale );
     recalculateBounds();
 }
 void LabelButton::setFont( const Core::FontAtlas* newFontAtlas ) {
-    m_fontAtlas = newFontAtlas;
+    Label::setFont( newFontAtlas );
     recalculateBounds();
 }
 void LabelButton::recalculateBounds() {
-    smath::vec4 pixelBoundingBox = {};
-    usize textBufferLenNoNull = m_textBufferLen - 1;
-    ucycles( textBufferLenNoNull ) {
-        char currentChar = m_textBuffer[i];
-        Core::FontMetrics* charMetrics = m_fontAtlas->metrics.get( currentChar );
-        if( !charMetrics ) {
-            continue;
-        }
-        pixelBoundingBox.z += (f32)charMetrics->advance * m_scale;
-        f32 height = charMetrics->height * m_scale;
-        if( pixelBoundingBox.w < height ) {
-            pixelBoundingBox.w = height;
-        }
-    }
-
-    switch( m_anchor ) {
-        case Core::Anchor::CENTER_CENTER:
-        case Core::Anchor::CENTER_TOP:
-        case Core::Anchor::CENTER_BOTTOM: {
-            pixelBoundingBox.x = -( pixelBoundingBox.z / 2.0f );
-        } break;
-        case Core::Anchor::RIGHT_CENTER:
-        case Core::Anchor::RIGHT_TOP:
-        case Core::Anchor::RIGHT_BOTTOM: {
-            pixelBoundingBox.x = -pixelBoundingBox.z;
-        } break;
-        default: {
-            pixelBoundingBox.x = 0.0f;
-        }break;
-    }
-
-    switch( m_anchor ) {
-        case Core::Anchor::LEFT_CENTER:
-        case Core::Anchor::CENTER_CENTER:
-        case Core::Anchor::RIGHT_CENTER: {
-            pixelBoundingBox.y = -( ( m_fontAtlas->pointSize / 2.0f ) * m_scale );
-        } break;
-
-        case Core::Anchor::LEFT_TOP:
-        case Core::Anchor::CENTER_TOP:
-        case Core::Anchor::RIGHT_TOP: {
-            pixelBoundingBox.y = -( m_fontAtlas->pointSize * m_scale );
-        } break;
-
-        default: {
-            pixelBoundingBox.y = 0.0f;
-        }break;
-    }
-
-    m_boundingBox = pixelBoundingBox;
+    // NOTE(alicia): bounds are relative to anchor position,
+    // laying text out where it was last drawn gives the same bounds and keeps the cached glyphs
+    updateLayout( m_layoutPosition );
+    m_boundingBox = m_textBounds;
     recalculateScreenSpaceBounds();
 }
 void LabelButton::recalculateScreenSpaceBounds() {
@@ -209,13 +201,13 @@ void LabelButton::setState( ButtonState state ) {
     m_state = state;
     switch( m_state ) {
         case ButtonState::NORMAL: {
-            m_color = m_normalColor;
+            setColor( m_normalColor );
         } break;
         case ButtonState::HIGHLIGHTED: {
-            m_color = m_highlightColor;
+            setColor( m_highlightColor );
         } break;
         case ButtonState::PRESSED: {
-            m_color = m_pressedColor;
+            setColor( m_pressedColor );
         } break;
     }
 }
@@ -224,7 +216,7 @@ void LabelButton::onResolutionChange( const smath::vec2* resolutionPtr ) {
     recalculateScreenSpaceBounds();
 }
 void LabelButton::renderButton( Platform::RendererAPI* api, Core::RenderContext* ctx ) {
-    renderLabel( api, ctx );
+    renderLabel( ctx );
 
 #if DEBUG
 
@@ -254,6 +246,8 @@ void LabelButton::renderButton( Platform::RendererAPI* api, Core::RenderContext*
     api->DrawVertexArray( &ctx->boundsVertexArray );
     api->SetWireframeEnabled(false);
 
+#else
+    UNUSED_PARAM( api );
 #endif
 }
 
@@ -275,6 +269,13 @@ UserInterface::UserInterface( const Core::FontAtlas* defaultFont ) :
         Core::Anchor::LEFT_BOTTOM,
         defaultFont
     ),
+    m_statusLabel( "",
+        smath::vec2( 0.01f, 0.045f ),
+        smath::vec4::one(),
+        0.4f,
+        Core::Anchor::LEFT_BOTTOM,
+        defaultFont
+    ),
     m_loadMesh(
         "Load Mesh",
         smath::vec2( LABEL_BUTTON_XPOS, LABEL_BUTTON_YPOS - ( LABEL_BUTTON_YDELTA * 0.0f ) ),
@@ -318,12 +319,14 @@ UserInterface::UserInterface( const Core::FontAtlas* defaultFont ) :
 { }
 
 void UserInterface::renderInterface( Platform::RendererAPI* api, Core::RenderContext* ctx ) {
+    Core::BeginTextBatch( &ctx->textBatch );
     ucycles( m_labelCount ) {
-        getLabels()[i].renderLabel( api, ctx );
+        getLabels()[i].renderLabel( ctx );
     }
     ucycles( m_labelButtonCount ) {
         getLabelButtons()[i].renderButton( api, ctx );
     }
+    Core::DrawTextBatch( api, &ctx->fontShader, &ctx->textBatch );
 }
 void UserInterface::updateInterface( Core::Input* input ) {
     ucycles( m_labelButtonCount ) {
@@ -336,112 +339,157 @@ void UserInterface::onResolutionChange( const smath::vec2* newResolution ) {
     }
 }
 
-void RenderCharacter(
-    Platform::RendererAPI* api,
-    Core::RenderContext* ctx,
-    Core::FontMetrics* charMetrics,
-    smath::vec2* charPosition,
-    smath::vec2* pixelPosition,
-    f32 scale
-) {
-    smath::vec3 characterScale = smath::vec3( charMetrics->width, charMetrics->height, 0.0f ) * scale;
-    smath::vec3 characterTranslate = smath::vec3(
-        charPosition->x + ( (f32)charMetrics->leftBearing * scale ),
-        ( pixelPosition->y + charPosition->y ) - ( (f32)charMetrics->topBearing * scale ),
-        0.0f
-    );
+// NOTE(alicia): text batch ----------------------------------------------------------------------
 
-    smath::mat4 transform; {
-        smath::mat4 translate = smath::mat4::translate( characterTranslate );
-        smath::mat4 scale     = smath::mat4::scale( characterScale );
-        transform = translate * scale;
-    };
+/// @brief Create vertex array with room for glyphCount quads, vertex buffer is filled every frame
+static bool TextBatchCreateVertexArray( Platform::RendererAPI* api, usize glyphCount, TextBatch* batch ) {
+    usize indexCount = glyphCount * TEXT_INDICES_PER_GLYPH;
+    u32* indices = (u32*)Platform::Alloc( indexCount * sizeof(u32) );
+    if( !indices ) {
+        LOG_ERROR( "UI > Failed to allocate %llu text batch indices!", (u64)indexCount );
+        return false;
+    }
+    // NOTE(alicia): quad corners are top left, top right, bottom left, bottom right
+    ucycles( glyphCount ) {
+        u32 first = (u32)( i * TEXT_VERTICES_PER_GLYPH );
+        u32* quad = indices + i * TEXT_INDICES_PER_GLYPH;
+        quad[0] = first + 2;
+        quad[1] = first + 1;
+        quad[2] = first + 0;
+        quad[3] = first + 1;
+        quad[4] = first + 2;
+        quad[5] = first + 3;
+    }
 
-    api->UniformMat4(
-        &ctx->fontShader,
-        ctx->fontShaderUniformTransform,
-        &transform
+    batch->vertexArray = api->CreateVertexArray();
+    api->UseVertexArray( &batch->vertexArray );
+
+    Platform::VertexBufferElement textVertexElements[] = {
+        { Platform::DataStructure::VEC2, Platform::DataType::FLOAT, false },
+        { Platform::DataStructure::VEC2, Platform::DataType::FLOAT, false },
+        { Platform::DataStructure::VEC4, Platform::DataType::FLOAT, false },
+    };
+    Platform::VertexBufferLayout textVertexLayout = Platform::CreateVertexBufferLayout(
+        ARRAY_COUNT( textVertexElements ),
+        textVertexElements
     );
-    smath::vec4 fontCoords = smath::vec4(
-        charMetrics->atlasX,
-        charMetrics->atlasY,
-        charMetrics->atlasW,
-        charMetrics->atlasH
+    Platform::VertexBuffer textVertexBuffer = api->CreateVertexBuffer(
+        glyphCount * TEXT_VERTICES_PER_GLYPH * sizeof(TextVertex),
+        nullptr,
+        textVertexLayout
     );
-    api->UniformVec4(
-        &ctx->fontShader,
-        ctx->fontShaderUniformFontCoords,
-        &fontCoords
+    api->VertexArrayBindVertexBuffer( &batch->vertexArray, textVertexBuffer );
+
+    Platform::IndexBuffer textIndexBuffer = api->CreateIndexBuffer(
+        indexCount,
+        indices,
+        Platform::DataType::UNSIGNED_INT
     );
-    api->DrawVertexArray( &ctx->fontVertexArray );
+    api->VertexArrayBindIndexBuffer( &batch->vertexArray, textIndexBuffer );
+    Platform::Free( indices );
 
+    batch->vertexArrayCapacity = glyphCount;
+    return true;
 }
-void RenderText(
-    usize textBufferLen,
-    const char* textBuffer,
-    smath::vec2* screenPos,
-    f32 scale,
-    smath::vec4* color,
-    Core::Anchor alignment,
-    Core::FontAtlas* fontAtlas,
-    Platform::RendererAPI* api,
-    Core::RenderContext* ctx
-) {
-    usize textBufferLenNoNull = textBufferLen - 1;
 
-    api->SetBlendFunction(
-        Platform::BlendFactor::SRC_ALPHA,
-        Platform::BlendFactor::ONE_MINUS_SRC_ALPHA,
-        Platform::BlendFactor::SRC_ALPHA,
-        Platform::BlendFactor::ONE_MINUS_SRC_ALPHA
-    );
+bool Core::CreateTextBatch( Platform::RendererAPI* api, usize glyphCapacity, TextBatch* result ) {
+    *result = {};
+    if( !growArray(
+        (void**)&result->vertices, sizeof(TextVertex) * TEXT_VERTICES_PER_GLYPH,
+        &result->glyphCapacity, glyphCapacity
+    ) ) {
+        LOG_ERROR( "UI > Failed to allocate text batch!" );
+        return false;
+    }
+    return TextBatchCreateVertexArray( api, result->glyphCapacity, result );
+}
 
-    api->UseShader( &ctx->fontShader );
-    api->UniformVec4(
-        &ctx->fontShader,
-        ctx->fontShaderUniformColor,
-        color
-    );
-    api->UseTexture2D(
-        &ctx->fontAtlasTexture,
-        RENDER_CONTEXT_FONT_TEXTURE_UNIT
-    );
-    api->UseVertexArray( &ctx->fontVertexArray );
+void Core::FreeTextBatch( Platform::RendererAPI* api, TextBatch* batch ) {
+    if( batch->vertexArrayCapacity ) {
+        api->DeleteVertexArrays( 1, &batch->vertexArray );
+    }
+    if( batch->vertices ) {
+        Platform::Free( batch->vertices );
+    }
+    if( batch->runs ) {
+        Platform::Free( batch->runs );
+    }
+    *batch = {};
+}
 
-    smath::vec2 pixelPosition = smath::vec2(
-        screenPos->x * (f32)ctx->viewport.x,
-        screenPos->y * (f32)ctx->viewport.y
-    );
+void Core::BeginTextBatch( TextBatch* batch ) {
+    batch->glyphCount = 0;
+    batch->runCount   = 0;
+}
 
-    f32 originX = pixelPosition.x;
-    f32 yOffset = 0.0f;
-    f32 textWidth = 0.0f;
+usize Core::LayoutText(
+    const Core::FontAtlas* fontAtlas,
+    usize textBufferLen,
+    const char* text,
+    const smath::vec2& pixelPosition,
+    f32 scale,
+    const smath::vec4& color,
+    Anchor anchor,
+    TextVertex* vertices,
+    smath::vec4* bounds
+) {
+    usize textBufferLenNoNull = textBufferLen ? textBufferLen - 1 : 0;
+
+    // NOTE(alicia): glyphs are placed from the left edge of text while measuring it,
+    // anchor offset is applied to quads afterwards so every character is only looked up once
+    usize glyphCount = 0;
+    f32 textWidth  = 0.0f;
+    f32 textHeight = 0.0f;
     ucycles( textBufferLenNoNull ) {
-        char currentChar = textBuffer[i];
+        char currentChar = text[i];
         Core::FontMetrics* charMetrics = fontAtlas->metrics.get( currentChar );
         if( !charMetrics ) {
-            LOG_WARN("App > Character \'%c\' not found in font \"%s\"!",
+            LOG_WARN("UI > Character \'%c\' not found in font \"%s\"!",
                 currentChar, fontAtlas->fontName
             );
             continue;
         }
+        f32 left   = textWidth + ( (f32)charMetrics->leftBearing * scale );
+        f32 bottom = -( (f32)charMetrics->topBearing * scale );
+        f32 right  = left + charMetrics->width * scale;
+        f32 top    = bottom + charMetrics->height * scale;
+
+        // NOTE(alicia): atlas v runs opposite to screen y
+        f32 atlasLeft   = charMetrics->atlasX;
+        f32 atlasRight  = charMetrics->atlasX + charMetrics->atlasW;
+        f32 atlasTop    = charMetrics->atlasY;
+        f32 atlasBottom = charMetrics->atlasY + charMetrics->atlasH;
+
+        TextVertex* quad = vertices + glyphCount * TEXT_VERTICES_PER_GLYPH;
+        quad[0] = { smath::vec2( left,  top ),    smath::vec2( atlasLeft,  atlasTop ),    color };
+        quad[1] = { smath::vec2( right, top ),    smath::vec2( atlasRight, atlasTop ),    color };
+        quad[2] = { smath::vec2( left,  bottom ), smath::vec2( atlasLeft,  atlasBottom ), color };
+        quad[3] = { smath::vec2( right, bottom ), smath::vec2( atlasRight, atlasBottom ), color };
+        glyphCount++;
+
         textWidth += charMetrics->advance * scale;
+        f32 height = charMetrics->height * scale;
+        if( textHeight < height ) {
+            textHeight = height;
+        }
     }
-    switch( alignment ) {
+
+    f32 xOffset = 0.0f;
+    f32 yOffset = 0.0f;
+    switch( anchor ) {
         case Core::Anchor::CENTER_CENTER:
         case Core::Anchor::CENTER_TOP:
         case Core::Anchor::CENTER_BOTTOM: {
-            originX -= textWidth / 2.0f;
+            xOffset = -( textWidth / 2.0f );
         } break;
         case Core::Anchor::RIGHT_CENTER:
         case Core::Anchor::RIGHT_TOP:
         case Core::Anchor::RIGHT_BOTTOM: {
-            originX -= textWidth;
+            xOffset = -textWidth;
         } break;
         default: break;
     }
-
-    switch( alignment ) {
+    switch( anchor ) {
         case Core::Anchor::LEFT_CENTER:
         case Core::Anchor::CENTER_CENTER:
         case Core::Anchor::RIGHT_CENTER: {
@@ -455,24 +503,105 @@ void RenderText(
         default: break;
     }
 
-    ucycles( textBufferLenNoNull ) {
-        char currentChar = textBuffer[i];
-        Core::FontMetrics* charMetrics = fontAtlas->metrics.get( currentChar );
-        if( !charMetrics ) {
-            LOG_WARN("App > Character \'%c\' not found in font \"%s\"!",
-                currentChar, fontAtlas->fontName
-            );
-            continue;
+    smath::vec2 origin = smath::vec2( pixelPosition.x + xOffset, pixelPosition.y + yOffset );
+    ucycles( glyphCount * TEXT_VERTICES_PER_GLYPH ) {
+        vertices[i].position += origin;
+    }
+
+    *bounds = smath::vec4( xOffset, yOffset, textWidth, textHeight );
+    return glyphCount;
+}
+
+void Core::PushTextGlyphs(
+    TextBatch* batch,
+    const Platform::Texture2D* atlasTexture,
+    usize glyphCount,
+    const TextVertex* vertices
+) {
+    if( !glyphCount ) {
+        return;
+    }
+    usize vertexCount = glyphCount * TEXT_VERTICES_PER_GLYPH;
+    usize vertexSize  = vertexCount * sizeof(TextVertex);
+
+    bool newRun = !batch->runCount || batch->runs[batch->runCount - 1].texture.id != atlasTexture->id;
+    if(
+        !growArray(
+            (void**)&batch->vertices, sizeof(TextVertex) * TEXT_VERTICES_PER_GLYPH,
+            &batch->glyphCapacity, batch->glyphCount + glyphCount
+        ) ||
+        !growArray( (void**)&batch->runs, sizeof(TextRun), &batch->runCapacity, batch->runCount + 1 )
+    ) {
+        LOG_ERROR( "UI > Failed to allocate text batch glyphs!" );
+        return;
+    }
+    TextVertex* destination = batch->vertices + batch->glyphCount * TEXT_VERTICES_PER_GLYPH;
+    // NOTE(alicia): vertices of last frame are still in place,
+    // glyphs that didn't change since then don't need to be uploaded again
+    bool resident =
+        batch->glyphCount + glyphCount <= batch->residentGlyphCount &&
+        Platform::MemCompare( vertexSize, destination, vertices );
+    if( !resident ) {
+        Platform::MemCopy( vertexSize, vertices, destination );
+        batch->dirty = true;
+    }
+
+    TextRun* run;
+    if( newRun ) {
+        run = &batch->runs[batch->runCount++];
+        run->texture    = *atlasTexture;
+        run->firstGlyph = batch->glyphCount;
+        run->glyphCount = 0;
+    } else {
+        run = &batch->runs[batch->runCount - 1];
+    }
+    batch->glyphCount += glyphCount;
+    run->glyphCount   += glyphCount;
+}
+
+void Core::DrawTextBatch( Platform::RendererAPI* api, Platform::Shader* fontShader, TextBatch* batch ) {
+    if( !batch->glyphCount ) {
+        return;
+    }
+    if( batch->glyphCount > batch->vertexArrayCapacity ) {
+        if( batch->vertexArrayCapacity ) {
+            api->DeleteVertexArrays( 1, &batch->vertexArray );
+            batch->vertexArrayCapacity = 0;
+        }
+        batch->residentGlyphCount = 0;
+        batch->dirty = true;
+        if( !TextBatchCreateVertexArray( api, batch->glyphCapacity, batch ) ) {
+            return;
         }
-        smath::vec2 charPosition = smath::vec2( originX, yOffset );
-        RenderCharacter(
-            api, ctx,
-            charMetrics,
-            &charPosition,
-            &pixelPosition,
-            scale
+    }
+
+    if( batch->dirty ) {
+        api->VertexBufferSubData(
+            batch->vertexArray.buffers,
+            0,
+            batch->glyphCount * TEXT_VERTICES_PER_GLYPH * sizeof(TextVertex),
+            batch->vertices
         );
-        originX += charMetrics->advance * scale;
+        batch->residentGlyphCount = batch->glyphCount;
+        batch->dirty = false;
     }
 
+    api->SetBlendFunction(
+        Platform::BlendFactor::SRC_ALPHA,
+        Platform::BlendFactor::ONE_MINUS_SRC_ALPHA,
+        Platform::BlendFactor::SRC_ALPHA,
+        Platform::BlendFactor::ONE_MINUS_SRC_ALPHA
+    );
+    api->UseShader( fontShader );
+    api->UseVertexArray( &batch->vertexArray );
+    ucycles( batch->runCount ) {
+        TextRun* run = &batch->runs[i];
+        api->UseTexture2D( &run->texture, RENDER_CONTEXT_FONT_TEXTURE_UNIT );
+        api->DrawVertexArrayRange(
+            &batch->vertexArray,
+            run->firstGlyph * TEXT_INDICES_PER_GLYPH,
+            run->glyphCount * TEXT_INDICES_PER_GLYPH,
+            0
+        );
+    }
 }
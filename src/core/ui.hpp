@@ -6,11 +6,7 @@
 #pragma once
 #include "pch.hpp"
 #include "util.hpp"
-
-// forward declarations
-namespace Platform {
-    struct RendererAPI;
-};
+#include "platform/renderer.hpp"
 
 namespace Core {
 
@@ -33,6 +29,96 @@ enum class Anchor {
 
 typedef void (*ButtonCallbackFN)(void* params);
 
+/// @brief Glyphs a text batch has room for when it's created, it grows to fit the largest frame
+#define TEXT_BATCH_GLYPH_CAPACITY 1024
+#define TEXT_VERTICES_PER_GLYPH 4
+#define TEXT_INDICES_PER_GLYPH 6
+
+/// @brief Vertex of a glyph quad
+struct TextVertex {
+    /// @brief Position in pixels
+    smath::vec2 position;
+    /// @brief Coordinates on font atlas
+    smath::vec2 uv;
+    smath::vec4 color;
+};
+
+/// @brief Consecutive glyphs of a text batch that sample the same atlas
+struct TextRun {
+    Platform::Texture2D texture;
+    usize firstGlyph;
+    usize glyphCount;
+};
+
+/// @brief Glyph quads of every label of a frame.
+/// Quads are uploaded into one vertex buffer and drawn with one draw per run of glyphs sharing an atlas
+struct TextBatch {
+    TextVertex* vertices;
+    usize glyphCount;
+    usize glyphCapacity;
+
+    TextRun* runs;
+    usize runCount;
+    usize runCapacity;
+
+    /// @brief Dynamic vertex buffer and quad indices, vertexArrayCapacity is the number of glyphs they fit
+    Platform::VertexArray vertexArray;
+    usize vertexArrayCapacity;
+    /// @brief Glyphs of vertices that match vertex buffer contents
+    usize residentGlyphCount;
+    /// @brief Set if vertices pushed this frame differ from vertex buffer contents
+    bool  dirty;
+};
+
+/// @brief Create text batch
+/// @param api renderer api
+/// @param glyphCapacity initial number of glyphs
+/// @param result [out] text batch
+/// @return true if successful
+bool CreateTextBatch( Platform::RendererAPI* api, usize glyphCapacity, TextBatch* result );
+/// @brief Free text batch and its vertex array
+void FreeTextBatch( Platform::RendererAPI* api, TextBatch* batch );
+/// @brief Drop glyphs of last frame
+void BeginTextBatch( TextBatch* batch );
+/// @brief Lay text out into glyph quads, one lookup per character
+/// @param fontAtlas font atlas
+/// @param textBufferLen length of text including null terminator
+/// @param text text
+/// @param pixelPosition position of anchor in pixels
+/// @param scale scale of font
+/// @param color color of text
+/// @param anchor where pixelPosition is on text
+/// @param vertices [out] quads, room for textBufferLen - 1 glyphs
+/// @param bounds [out] xy - bounds offset from pixelPosition, zw - bounds dimensions
+/// @return number of glyphs written
+usize LayoutText(
+    const Core::FontAtlas* fontAtlas,
+    usize textBufferLen,
+    const char* text,
+    const smath::vec2& pixelPosition,
+    f32 scale,
+    const smath::vec4& color,
+    Anchor anchor,
+    TextVertex* vertices,
+    smath::vec4* bounds
+);
+/// @brief Append laid out glyph quads to batch
+/// @param batch text batch
+/// @param atlasTexture texture of font atlas glyphs were laid out from
+/// @param glyphCount number of glyphs
+/// @param vertices glyph quads
+void PushTextGlyphs(
+    TextBatch* batch,
+    const Platform::Texture2D* atlasTexture,
+    usize glyphCount,
+    const TextVertex* vertices
+);
+/// @brief Upload glyphs of batch and draw them, blending has to be enabled
+/// @param api renderer api
+/// @param fontShader shader glyphs are drawn with
+/// @param batch text batch
+void DrawTextBatch( Platform::RendererAPI* api, Platform::Shader* fontShader, TextBatch* batch );
+
 /// @brief Check if a given point is within given bounds
 /// @param point 2d point
 /// @param bounds xy - bounds position, zw - bounds dimensions
@@ -91,8 +177,12 @@ public:
     m_textBufferLen( other.m_textBufferLen ),
     m_textBuffer( other.m_textBuffer ),
     m_scale(other.m_scale),
-    m_fontAtlas(other.m_fontAtlas) {
-        other.m_textBuffer = nullptr;
+    m_fontAtlas(other.m_fontAtlas),
+    m_glyphVertices( other.m_glyphVertices ),
+    m_glyphCapacity( other.m_glyphCapacity ) {
+        other.m_textBuffer    = nullptr;
+        other.m_glyphVertices = nullptr;
+        other.m_glyphCapacity = 0;
     }
     // copy assign
     Label& operator=( const Label& other ) {
@@ -101,9 +191,17 @@ public:
     // move assign
     Label& operator=( Label&& other ) noexcept {
         swapPtr( m_textBuffer, other.m_textBuffer );
+        TextVertex* glyphVertices = m_glyphVertices;
+        m_glyphVertices           = other.m_glyphVertices;
+        other.m_glyphVertices     = glyphVertices;
+        usize glyphCapacity   = m_glyphCapacity;
+        m_glyphCapacity       = other.m_glyphCapacity;
+        other.m_glyphCapacity = glyphCapacity;
+        m_layoutDirty       = true;
+        other.m_layoutDirty = true;
         return *this;
     }
-    void renderLabel( const Platform::RendererAPI* api, const Core::RenderContext* ctx );
+    void renderLabel( Core::RenderContext* ctx );
 public: // getter
     const smath::vec4& color() const { return m_color; }
     const char* text() const { return m_textBuffer; }
@@ -111,17 +209,31 @@ public: // getter
     f32 scale() const { return m_scale; }
     const Core::FontAtlas* fontAtlas() const { return m_fontAtlas; }
 public: // setter
-    void setColor( const smath::vec4& newColor ) { m_color = newColor; }
+    void setColor( const smath::vec4& newColor );
     void setText( usize newTextLen, const char* newText );
     void setText( const char* newText ) { setText( stringLen(newText) + 1, newText ); }
-    void setScale( f32 newScale ) { m_scale = newScale; }
-    void setFont( const Core::FontAtlas* newFontAtlas ) { m_fontAtlas = newFontAtlas; }
+    void setScale( f32 newScale ) { m_scale = newScale; m_layoutDirty = true; }
+    void setFont( const Core::FontAtlas* newFontAtlas ) { m_fontAtlas = newFontAtlas; m_layoutDirty = true; }
 protected:
+    /// @brief Lay text out again if it changed or moved since last layout
+    void updateLayout( const smath::vec2& pixelPosition );
+
     smath::vec4 m_color;
     usize m_textBufferLen;
     char* m_textBuffer;
     f32 m_scale;
     const Core::FontAtlas* m_fontAtlas;
+
+    /// @brief Cached glyph quads of text, in pixels
+    TextVertex* m_glyphVertices = nullptr;
+    usize m_glyphCapacity       = 0;
+    usize m_glyphCount          = 0;
+    /// @brief xy - bounds offset from anchor position, zw - bounds dimensions, in pixels
+    smath::vec4 m_textBounds    = {};
+    /// @brief Anchor position and anchor glyphs were laid out at
+    smath::vec2 m_layoutPosition = {};
+    Anchor      m_layoutAnchor   = Anchor::LEFT_BOTTOM;
+    bool        m_layoutDirty    = true;
 };
 
 enum class ButtonState {
@@ -209,11 +321,13 @@ public: // getters
     LabelButton& loadAlbedoTextureButton() { return m_loadAlbedoTexture; }
     LabelButton& loadSpecularTextureButton() { return m_loadSpecularTexture; }
     LabelButton& loadNormalTextureButton() { return m_loadNormalTexture; }
+    Label& statusLabel() { return m_statusLabel; }
     Label* getLabels() { return &m_versionLabel; }
     LabelButton* getLabelButtons() { return &m_loadMesh; }
 private:
     Label m_versionLabel;
-    usize m_labelCount = 1;
+    Label m_statusLabel;
+    usize m_labelCount = 2;
 
     LabelButton m_loadMesh;
     LabelButton m_loadAlbedoTexture;
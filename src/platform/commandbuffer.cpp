@@ -0,0 +1,1217 @@
+/**
+ * Description:  Deferred renderer commands
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "commandbuffer.hpp"
+#include "platform/io.hpp"
+#include "util.hpp"
+
+using namespace Platform;
+
+/// @brief Texture units draws remember
+#define COMMAND_TEXTURE_UNITS 8
+/// @brief Initial size of command memory of a buffer, it grows to fit the largest frame
+#define COMMAND_BUFFER_SIZE KILOBYTES(64)
+#define COMMAND_NONE 0xFFFFFFFF
+
+// NOTE(alicia): sort key, most significant bits first
+// pass           2 bits, blended draws only have pass set so they stay in order
+// shader        12 bits
+// texture set   16 bits
+// vertex array  14 bits
+// depth         20 bits
+#define COMMAND_KEY_PASS_SHIFT    62
+#define COMMAND_KEY_SHADER_SHIFT  50
+#define COMMAND_KEY_TEXTURE_SHIFT 34
+#define COMMAND_KEY_VERTEX_SHIFT  20
+#define COMMAND_KEY_PASS_BLENDED  1ull
+
+enum class CommandType : u32 {
+    DRAW,
+    CLEAR_BUFFER,
+    SET_CLEAR_COLOR,
+    SET_VIEWPORT,
+    UNIFORM_BUFFER_DATA,
+    UNIFORM_BUFFER_SUB_DATA,
+    UNIFORM_BUFFER_BINDING,
+    UNIFORM_BUFFER_BINDING_RANGE,
+    VERTEX_BUFFER_SUB_DATA,
+};
+
+enum class CommandDrawType : u32 {
+    ARRAY,
+    RANGE,
+    RANGES,
+};
+
+enum class CommandUniformType : u32 {
+    FLOAT,
+    UINT,
+    INT,
+    VEC2,
+    VEC3,
+    VEC4,
+    MAT3,
+    MAT4,
+};
+static const u32 COMMAND_UNIFORM_SIZES[] = { 1, 1, 1, 2, 3, 4, 9, 16 };
+
+// NOTE(alicia): state is only applied on replay once it has been set,
+// until then draws use whatever backend was left with
+#define COMMAND_STATE_SHADER         ( 1 << 0 )
+#define COMMAND_STATE_BLENDING       ( 1 << 1 )
+#define COMMAND_STATE_BLEND_FUNCTION ( 1 << 2 )
+#define COMMAND_STATE_BLEND_EQUATION ( 1 << 3 )
+#define COMMAND_STATE_WIREFRAME      ( 1 << 4 )
+
+struct CommandState {
+    u32 setMask;
+    u32 textureMask;
+    Shader shader;
+    bool blending;
+    bool wireframe;
+    BlendFactor blendFactors[4];
+    BlendEq blendEqs[2];
+    Texture2D textures[COMMAND_TEXTURE_UNITS];
+};
+
+struct CommandUniform {
+    i32 location;
+    CommandUniformType type;
+    /// @brief Raw bits of value
+    u32 value[16];
+};
+
+/// @brief Uniform values set on a shader
+struct CommandShaderUniforms {
+    u32 shader;
+    CommandUniform* uniforms;
+    u32 uniformCount;
+    u32 uniformCapacity;
+    /// @brief Copy of uniforms in command memory, block is a u32 count followed by uniforms
+    u32 block;
+    bool dirty;
+};
+
+struct CommandDraw {
+    CommandDrawType type;
+    u32 state;
+    u32 uniforms;
+    VertexArray vertexArray;
+    usize firstIndex;
+    usize indexCount;
+    u32 baseVertex;
+    /// @brief First indices, index counts and base vertices back to back
+    u32 ranges;
+    usize rangeCount;
+};
+
+struct CommandUniformBufferData {
+    UniformBuffer buffer;
+    usize offset;
+    usize size;
+    u32 data;
+    u32 bindingPoint;
+};
+
+struct CommandVertexBufferData {
+    VertexBuffer buffer;
+    usize offset;
+    usize size;
+    u32 data;
+};
+
+struct CommandEntry {
+    u64 key;
+    CommandType type;
+    /// @brief Offset of command in command memory
+    u32 offset;
+};
+
+struct Platform::CommandBuffer {
+    u8* memory;
+    u32 memorySize;
+    u32 memoryCapacity;
+
+    CommandEntry* entries;
+    u32 entryCount;
+    u32 entryCapacity;
+
+    /// @brief State following draws use, kept between frames like backend state
+    CommandState state;
+    u32 stateBlock;
+    bool stateDirty;
+    VertexArray vertexArray;
+    bool vertexArraySet;
+    f32 sortDepth;
+
+    CommandShaderUniforms* shaders;
+    u32 shaderCount;
+    u32 shaderCapacity;
+
+    /// @brief Links of every created buffer
+    CommandBuffer* previous;
+    CommandBuffer* next;
+};
+
+struct CommandSortItem {
+    u64 key;
+    u32 buffer;
+    u32 entry;
+};
+
+#define COMMAND_REPLAY_VERTEX_ARRAY ( 1 << 5 )
+#define COMMAND_REPLAY_TEXTURE_SHIFT 8
+
+/// @brief Last state replayed on backend
+struct CommandReplayState {
+    /// @brief State bits backend is known to have, texture units start at COMMAND_REPLAY_TEXTURE_SHIFT
+    u32 knownMask;
+    u32 shader;
+    u32 textures[COMMAND_TEXTURE_UNITS];
+    u32 vertexArray;
+    bool blending;
+    bool wireframe;
+    BlendFactor blendFactors[4];
+    BlendEq blendEqs[2];
+};
+
+struct CommandRecorder {
+    bool created;
+    RendererAPI backend;
+    CommandBuffer* defaultBuffer;
+    CommandReplayState replay;
+
+    /// @brief Uniform values backend has, uniforms persist in shaders so this survives rebinds
+    CommandShaderUniforms* applied;
+    u32 appliedCount;
+    u32 appliedCapacity;
+
+    CommandSortItem* items;
+    CommandSortItem* scratch;
+    u32 itemCapacity;
+};
+static CommandRecorder COMMAND_RECORDER = {};
+/// @brief Every created buffer, worker buffers can outlive recording api
+static CommandBuffer* COMMAND_BUFFERS = nullptr;
+static thread_local CommandBuffer* BOUND_COMMAND_BUFFER = nullptr;
+
+// NOTE(alicia): memory ------------------------------------------------------------------------
+
+/// @brief Reserve command memory
+/// @return offset of memory, COMMAND_NONE if allocation failed. Pointers into command memory are invalidated
+static u32 CommandPush( CommandBuffer* buffer, usize size, const void* data ) {
+    // NOTE(alicia): commands stay 8 byte aligned
+    usize alignedSize = ( size + 7 ) & ~(usize)7;
+    if( !growArray( (void**)&buffer->memory, 1, &buffer->memoryCapacity, buffer->memorySize + alignedSize ) ) {
+        LOG_ERROR( "Commands > Failed to allocate command memory, command is dropped!" );
+        return COMMAND_NONE;
+    }
+    u32 result = buffer->memorySize;
+    buffer->memorySize += (u32)alignedSize;
+    if( data ) {
+        Platform::MemCopy( size, data, buffer->memory + result );
+    }
+    return result;
+}
+
+/// @return false if allocation failed
+static bool CommandPushEntry( CommandBuffer* buffer, CommandType type, u32 offset, u64 key ) {
+    if( !growArray( (void**)&buffer->entries, sizeof(CommandEntry), &buffer->entryCapacity, buffer->entryCount + 1 ) ) {
+        LOG_ERROR( "Commands > Failed to allocate command entry, command is dropped!" );
+        return false;
+    }
+    CommandEntry* entry = &buffer->entries[buffer->entryCount++];
+    entry->key    = key;
+    entry->type   = type;
+    entry->offset = offset;
+    return true;
+}
+
+static CommandShaderUniforms* CommandFindShaderUniforms(
+    CommandShaderUniforms** shaders, u32* count, u32* capacity, u32 shader, bool create
+) {
+    ucycles( *count ) {
+        if( (*shaders)[i].shader == shader ) {
+            return &(*shaders)[i];
+        }
+    }
+    if( !create ) {
+        return nullptr;
+    }
+    if( !growArray( (void**)shaders, sizeof(CommandShaderUniforms), capacity, *count + 1 ) ) {
+        LOG_ERROR( "Commands > Failed to allocate shader uniforms!" );
+        return nullptr;
+    }
+    CommandShaderUniforms* result = &(*shaders)[(*count)++];
+    *result = {};
+    result->shader = shader;
+    result->block  = COMMAND_NONE;
+    return result;
+}
+
+static void CommandRemoveShaderUniforms( CommandShaderUniforms* shaders, u32* count, u32 shader ) {
+    ucycles( *count ) {
+        if( shaders[i].shader != shader ) {
+            continue;
+        }
+        if( shaders[i].uniforms ) {
+            Platform::Free( shaders[i].uniforms );
+        }
+        shaders[i] = shaders[--(*count)];
+        return;
+    }
+}
+
+/// @brief Set uniform value
+/// @return false if uniform already had value, true if it changed or couldn't be cached
+static bool CommandSetUniform(
+    CommandShaderUniforms* shader, i32 location, CommandUniformType type, const void* value
+) {
+    u32 size = COMMAND_UNIFORM_SIZES[(u32)type] * sizeof(u32);
+    CommandUniform* uniform = nullptr;
+    ucycles( shader->uniformCount ) {
+        if( shader->uniforms[i].location == location ) {
+            uniform = &shader->uniforms[i];
+            break;
+        }
+    }
+    if( uniform ) {
+        if( uniform->type == type && MemCompare( size, uniform->value, value ) ) {
+            return false;
+        }
+    } else {
+        if( !growArray( (void**)&shader->uniforms, sizeof(CommandUniform), &shader->uniformCapacity, shader->uniformCount + 1 ) ) {
+            LOG_ERROR( "Commands > Failed to allocate uniform!" );
+            return true;
+        }
+        uniform = &shader->uniforms[shader->uniformCount++];
+        uniform->location = location;
+    }
+    uniform->type = type;
+    Platform::MemCopy( size, value, uniform->value );
+    return true;
+}
+
+static void CommandFreeShaderUniforms( CommandShaderUniforms* shaders, u32 count ) {
+    ucycles( count ) {
+        if( shaders[i].uniforms ) {
+            Platform::Free( shaders[i].uniforms );
+        }
+    }
+    if( shaders ) {
+        Platform::Free( shaders );
+    }
+}
+
+/// @brief Drop recorded commands, recorded state is kept
+static void CommandReset( CommandBuffer* buffer ) {
+    buffer->memorySize = 0;
+    buffer->entryCount = 0;
+    buffer->stateDirty = true;
+    ucycles( buffer->shaderCount ) {
+        buffer->shaders[i].dirty = true;
+    }
+}
+
+static CommandBuffer* CommandCurrentBuffer() {
+    return BOUND_COMMAND_BUFFER ? BOUND_COMMAND_BUFFER : COMMAND_RECORDER.defaultBuffer;
+}
+
+// NOTE(alicia): replay ------------------------------------------------------------------------
+
+/// @brief Stable sort by key, 8 bits at a time, bytes every key shares are skipped
+static CommandSortItem* CommandSortItems( CommandSortItem* items, CommandSortItem* scratch, u32 count ) {
+    ucyclesi( 8, pass ) {
+        u32 shift = (u32)pass * 8;
+        u32 offsets[256] = {};
+        ucycles( count ) {
+            offsets[( items[i].key >> shift ) & 0xFF]++;
+        }
+        if( offsets[( items[0].key >> shift ) & 0xFF] == count ) {
+            continue;
+        }
+        u32 total = 0;
+        ucycles( 256 ) {
+            u32 bucket = offsets[i];
+            offsets[i] = total;
+            total += bucket;
+        }
+        ucycles( count ) {
+            scratch[offsets[( items[i].key >> shift ) & 0xFF]++] = items[i];
+        }
+        CommandSortItem* swap = items;
+        items   = scratch;
+        scratch = swap;
+    }
+    return items;
+}
+
+static void CommandApplyUniforms( Shader* shader, const u8* block ) {
+    CommandRecorder* recorder = &COMMAND_RECORDER;
+    RendererAPI* backend = &recorder->backend;
+    u32 count;
+    Platform::MemCopy( sizeof(u32), block, &count );
+    const CommandUniform* uniforms = (const CommandUniform*)( block + 8 );
+    CommandShaderUniforms* applied = CommandFindShaderUniforms(
+        &recorder->applied, &recorder->appliedCount, &recorder->appliedCapacity, shader->id, true );
+
+    ucycles( count ) {
+        const CommandUniform* uniform = &uniforms[i];
+        // NOTE(alicia): uniforms are applied unfiltered if applied values can't be cached
+        if( applied && !CommandSetUniform( applied, uniform->location, uniform->type, uniform->value ) ) {
+            continue;
+        }
+        i32 location = uniform->location;
+        switch( uniform->type ) {
+            case CommandUniformType::FLOAT: {
+                f32 value;
+                Platform::MemCopy( sizeof(f32), uniform->value, &value );
+                backend->UniformFloat( shader, location, value );
+            } break;
+            case CommandUniformType::UINT: {
+                backend->UniformUInt( shader, location, uniform->value[0] );
+            } break;
+            case CommandUniformType::INT: {
+                backend->UniformInt( shader, location, (i32)uniform->value[0] );
+            } break;
+            case CommandUniformType::VEC2: {
+                smath::vec2 value;
+                Platform::MemCopy( sizeof(f32) * 2, uniform->value, value.ptr() );
+                backend->UniformVec2( shader, location, &value );
+            } break;
+            case CommandUniformType::VEC3: {
+                smath::vec3 value;
+                Platform::MemCopy( sizeof(f32) * 3, uniform->value, value.ptr() );
+                backend->UniformVec3( shader, location, &value );
+            } break;
+            case CommandUniformType::VEC4: {
+                smath::vec4 value;
+                Platform::MemCopy( sizeof(f32) * 4, uniform->value, value.ptr() );
+                backend->UniformVec4( shader, location, &value );
+            } break;
+            case CommandUniformType::MAT3: {
+                smath::mat3 value;
+                Platform::MemCopy( sizeof(f32) * 9, uniform->value, value.ptr() );
+                backend->UniformMat3( shader, location, &value );
+            } break;
+            case CommandUniformType::MAT4: {
+                smath::mat4 value;
+                Platform::MemCopy( sizeof(f32) * 16, uniform->value, value.ptr() );
+                backend->UniformMat4( shader, location, &value );
+            } break;
+        }
+    }
+}
+
+/// @brief Bind state of draw that differs from what backend has and issue it
+static void CommandReplayDraw( CommandBuffer* buffer, const CommandDraw* draw ) {
+    CommandRecorder* recorder = &COMMAND_RECORDER;
+    RendererAPI* backend = &recorder->backend;
+    CommandReplayState* replay = &recorder->replay;
+    CommandState* state = (CommandState*)( buffer->memory + draw->state );
+    u32 known = replay->knownMask;
+
+    if( state->setMask & COMMAND_STATE_SHADER ) {
+        if( !( known & COMMAND_STATE_SHADER ) || replay->shader != state->shader.id ) {
+            backend->UseShader( &state->shader );
+            replay->shader = state->shader.id;
+        }
+        if( draw->uniforms != COMMAND_NONE ) {
+            CommandApplyUniforms( &state->shader, buffer->memory + draw->uniforms );
+        }
+    }
+    ucycles( COMMAND_TEXTURE_UNITS ) {
+        if( !( state->textureMask & ( 1 << i ) ) ) {
+            continue;
+        }
+        u32 textureBit = 1 << ( COMMAND_REPLAY_TEXTURE_SHIFT + i );
+        if( !( known & textureBit ) || replay->textures[i] != state->textures[i].id ) {
+            backend->UseTexture2D( &state->textures[i], (u32)i );
+            replay->textures[i] = state->textures[i].id;
+        }
+        replay->knownMask |= textureBit;
+    }
+    if( state->setMask & COMMAND_STATE_BLENDING ) {
+        if( !( known & COMMAND_STATE_BLENDING ) || replay->blending != state->blending ) {
+            backend->SetBlendingEnable( state->blending );
+            replay->blending = state->blending;
+        }
+    }
+    if( state->setMask & COMMAND_STATE_BLEND_FUNCTION ) {
+        if(
+            !( known & COMMAND_STATE_BLEND_FUNCTION ) ||
+            !MemCompare( sizeof(state->blendFactors), replay->blendFactors, state->blendFactors )
+        ) {
+            backend->SetBlendFunction(
+                state->blendFactors[0], state->blendFactors[1],
+                state->blendFactors[2], state->blendFactors[3]
+            );
+            Platform::MemCopy( sizeof(state->blendFactors), state->blendFactors, replay->blendFactors );
+        }
+    }
+    if( state->setMask & COMMAND_STATE_BLEND_EQUATION ) {
+        if(
+            !( known & COMMAND_STATE_BLEND_EQUATION ) ||
+            replay->blendEqs[0] != state->blendEqs[0] || replay->blendEqs[1] != state->blendEqs[1]
+        ) {
+            backend->SetBlendEquation( state->blendEqs[0], state->blendEqs[1] );
+            replay->blendEqs[0] = state->blendEqs[0];
+            replay->blendEqs[1] = state->blendEqs[1];
+        }
+    }
+    if( state->setMask & COMMAND_STATE_WIREFRAME ) {
+        if( !( known & COMMAND_STATE_WIREFRAME ) || replay->wireframe != state->wireframe ) {
+            backend->SetWireframeEnabled( state->wireframe );
+            replay->wireframe = state->wireframe;
+        }
+    }
+    replay->knownMask |= state->setMask;
+
+    VertexArray vertexArray = draw->vertexArray;
+    if( !( known & COMMAND_REPLAY_VERTEX_ARRAY ) || replay->vertexArray != vertexArray.id ) {
+        backend->UseVertexArray( &vertexArray );
+        replay->vertexArray = vertexArray.id;
+    }
+    replay->knownMask |= COMMAND_REPLAY_VERTEX_ARRAY;
+
+    switch( draw->type ) {
+        case CommandDrawType::ARRAY: {
+            backend->DrawVertexArray( &vertexArray );
+        } break;
+        case CommandDrawType::RANGE: {
+            backend->DrawVertexArrayRange( &vertexArray, draw->firstIndex, draw->indexCount, draw->baseVertex );
+        } break;
+        case CommandDrawType::RANGES: {
+            const u32* ranges = (const u32*)( buffer->memory + draw->ranges );
+            backend->DrawVertexArrayRanges(
+                &vertexArray, draw->rangeCount,
+                ranges, ranges + draw->rangeCount, ranges + draw->rangeCount * 2
+            );
+        } break;
+    }
+}
+
+/// @brief Sort draws collected since last ordered command and replay them
+static void CommandReplayDraws( CommandBuffer** buffers, u32 count ) {
+    if( count == 0 ) {
+        return;
+    }
+    CommandRecorder* recorder = &COMMAND_RECORDER;
+    CommandSortItem* items = CommandSortItems( recorder->items, recorder->scratch, count );
+    ucycles( count ) {
+        CommandBuffer* buffer = buffers[items[i].buffer];
+        const CommandEntry* entry = &buffer->entries[items[i].entry];
+        CommandReplayDraw( buffer, (const CommandDraw*)( buffer->memory + entry->offset ) );
+    }
+}
+
+static void CommandReplayOrdered( CommandBuffer* buffer, const CommandEntry* entry ) {
+    RendererAPI* backend = &COMMAND_RECORDER.backend;
+    u8* command = buffer->memory + entry->offset;
+    switch( entry->type ) {
+        case CommandType::CLEAR_BUFFER: {
+            backend->ClearBuffer();
+        } break;
+        case CommandType::SET_CLEAR_COLOR: {
+            f32* color = (f32*)command;
+            backend->SetClearColor( color[0], color[1], color[2], color[3] );
+        } break;
+        case CommandType::SET_VIEWPORT: {
+            i32* dimensions = (i32*)command;
+            backend->SetViewport( dimensions[0], dimensions[1] );
+        } break;
+        case CommandType::UNIFORM_BUFFER_DATA: {
+            CommandUniformBufferData* data = (CommandUniformBufferData*)command;
+            backend->UniformBufferData( &data->buffer, data->size, buffer->memory + data->data );
+        } break;
+        case CommandType::UNIFORM_BUFFER_SUB_DATA: {
+            CommandUniformBufferData* data = (CommandUniformBufferData*)command;
+            backend->UniformBufferSubData( &data->buffer, data->offset, data->size, buffer->memory + data->data );
+        } break;
+        case CommandType::UNIFORM_BUFFER_BINDING: {
+            CommandUniformBufferData* data = (CommandUniformBufferData*)command;
+            backend->UniformBufferSetBindingPoint( &data->buffer, data->bindingPoint );
+        } break;
+        case CommandType::UNIFORM_BUFFER_BINDING_RANGE: {
+            CommandUniformBufferData* data = (CommandUniformBufferData*)command;
+            backend->UniformBufferSetBindingPointRange( &data->buffer, data->bindingPoint, data->offset, data->size );
+        } break;
+        case CommandType::VERTEX_BUFFER_SUB_DATA: {
+            CommandVertexBufferData* data = (CommandVertexBufferData*)command;
+            backend->VertexBufferSubData( &data->buffer, data->offset, data->size, buffer->memory + data->data );
+        } break;
+        default: break;
+    }
+}
+
+/// @brief Replay buffers as if they were one, draws between ordered commands are sorted
+static void CommandSubmit( u32 bufferCount, CommandBuffer** buffers ) {
+    CommandRecorder* recorder = &COMMAND_RECORDER;
+    u32 entryCount = 0;
+    ucycles( bufferCount ) {
+        entryCount += buffers[i]->entryCount;
+    }
+    if( entryCount && ( entryCount > recorder->itemCapacity || !recorder->scratch ) ) {
+        if( recorder->scratch ) {
+            Platform::Free( recorder->scratch );
+            recorder->scratch = nullptr;
+        }
+        if( growArray( (void**)&recorder->items, sizeof(CommandSortItem), &recorder->itemCapacity, entryCount ) ) {
+            recorder->scratch = (CommandSortItem*)Platform::Alloc( recorder->itemCapacity * sizeof(CommandSortItem) );
+        }
+        if( !recorder->scratch ) {
+            LOG_ERROR( "Commands > Failed to allocate sort items, recorded commands are dropped!" );
+            ucycles( bufferCount ) {
+                CommandReset( buffers[i] );
+            }
+            return;
+        }
+    }
+
+    u32 itemCount = 0;
+    ucyclesi( bufferCount, b ) {
+        CommandBuffer* buffer = buffers[b];
+        ucycles( buffer->entryCount ) {
+            const CommandEntry* entry = &buffer->entries[i];
+            if( entry->type == CommandType::DRAW ) {
+                CommandSortItem* item = &recorder->items[itemCount++];
+                item->key    = entry->key;
+                item->buffer = (u32)b;
+                item->entry  = (u32)i;
+                continue;
+            }
+            CommandReplayDraws( buffers, itemCount );
+            itemCount = 0;
+            CommandReplayOrdered( buffer, entry );
+        }
+    }
+    CommandReplayDraws( buffers, itemCount );
+
+    ucycles( bufferCount ) {
+        CommandReset( buffers[i] );
+    }
+}
+
+/// @brief Submit default buffer before a call that runs on backend immediately
+static void CommandFlush() {
+    CommandBuffer* buffer = COMMAND_RECORDER.defaultBuffer;
+    if( buffer->entryCount ) {
+        CommandSubmit( 1, &buffer );
+    }
+}
+
+/// @brief Backend state changed behind replay's back
+static void CommandInvalidate() {
+    COMMAND_RECORDER.replay.knownMask = 0;
+}
+
+// NOTE(alicia): recording ---------------------------------------------------------------------
+
+static u64 CommandSortKey( const CommandBuffer* buffer, const VertexArray* vertexArray ) {
+    const CommandState* state = &buffer->state;
+    if( ( state->setMask & COMMAND_STATE_BLENDING ) && state->blending ) {
+        return COMMAND_KEY_PASS_BLENDED << COMMAND_KEY_PASS_SHIFT;
+    }
+    u32 textureIDs[COMMAND_TEXTURE_UNITS] = {};
+    ucycles( COMMAND_TEXTURE_UNITS ) {
+        if( state->textureMask & ( 1 << i ) ) {
+            textureIDs[i] = state->textures[i].id;
+        }
+    }
+    u64 textureSet = hashBytes( sizeof(textureIDs), textureIDs, 0 ) & 0xFFFF;
+    u64 shader = ( state->setMask & COMMAND_STATE_SHADER ) ? state->shader.id & 0xFFF : 0;
+
+    // NOTE(alicia): non-negative floats sort like their bits
+    f32 depth = buffer->sortDepth > 0.0f ? buffer->sortDepth : 0.0f;
+    u32 depthBits;
+    Platform::MemCopy( sizeof(u32), &depth, &depthBits );
+
+    return
+        ( shader << COMMAND_KEY_SHADER_SHIFT ) |
+        ( textureSet << COMMAND_KEY_TEXTURE_SHIFT ) |
+        ( (u64)( vertexArray->id & 0x3FFF ) << COMMAND_KEY_VERTEX_SHIFT ) |
+        (u64)( depthBits >> 12 );
+}
+
+static CommandDraw* CommandRecordDraw( VertexArray* vertexArray, CommandDrawType type, u32 ranges ) {
+    CommandBuffer* buffer = CommandCurrentBuffer();
+    if( buffer->stateDirty ) {
+        u32 stateBlock = CommandPush( buffer, sizeof(CommandState), &buffer->state );
+        if( stateBlock == COMMAND_NONE ) {
+            return nullptr;
+        }
+        buffer->stateBlock = stateBlock;
+        buffer->stateDirty = false;
+    }
+    u32 uniforms = COMMAND_NONE;
+    if( buffer->state.setMask & COMMAND_STATE_SHADER ) {
+        CommandShaderUniforms* shader = CommandFindShaderUniforms(
+            &buffer->shaders, &buffer->shaderCount, &buffer->shaderCapacity, buffer->state.shader.id, false );
+        if( shader ) {
+            // NOTE(alicia): every draw carries every uniform of its shader since they can be reordered,
+            // the copy is shared until a uniform changes
+            if( shader->dirty ) {
+                u32 size = shader->uniformCount * sizeof(CommandUniform);
+                u32 block = CommandPush( buffer, 8 + size, nullptr );
+                if( block == COMMAND_NONE ) {
+                    return nullptr;
+                }
+                shader->block = block;
+                Platform::MemCopy( sizeof(u32), &shader->uniformCount, buffer->memory + shader->block );
+                Platform::MemCopy( size, shader->uniforms, buffer->memory + shader->block + 8 );
+                shader->dirty = false;
+            }
+            uniforms = shader->block;
+        }
+    }
+
+    u32 offset = CommandPush( buffer, sizeof(CommandDraw), nullptr );
+    if(
+        offset == COMMAND_NONE ||
+        !CommandPushEntry( buffer, CommandType::DRAW, offset, CommandSortKey( buffer, vertexArray ) )
+    ) {
+        return nullptr;
+    }
+    CommandDraw* draw = (CommandDraw*)( buffer->memory + offset );
+    draw->type        = type;
+    draw->state       = buffer->stateBlock;
+    draw->uniforms    = uniforms;
+    draw->vertexArray = *vertexArray;
+    draw->ranges      = ranges;
+    return draw;
+}
+
+static void CommandRecordUniform( Shader* shader, i32 uniform, CommandUniformType type, const void* value ) {
+    CommandBuffer* buffer = CommandCurrentBuffer();
+    CommandShaderUniforms* uniforms = CommandFindShaderUniforms(
+        &buffer->shaders, &buffer->shaderCount, &buffer->shaderCapacity, shader->id, true );
+    if( uniforms && CommandSetUniform( uniforms, uniform, type, value ) ) {
+        uniforms->dirty = true;
+    }
+}
+
+static u32 CommandRecordOrdered( CommandType type, usize size, const void* data ) {
+    CommandBuffer* buffer = CommandCurrentBuffer();
+    u32 offset = CommandPush( buffer, size ? size : 8, data );
+    if( offset == COMMAND_NONE || !CommandPushEntry( buffer, type, offset, 0 ) ) {
+        return COMMAND_NONE;
+    }
+    return offset;
+}
+
+static void CommandRecordUniformBuffer(
+    CommandType type, UniformBuffer* uniformBuffer,
+    usize offset, usize size, const void* data, u32 bindingPoint
+) {
+    CommandBuffer* buffer = CommandCurrentBuffer();
+    CommandUniformBufferData command = {};
+    command.buffer       = *uniformBuffer;
+    command.offset       = offset;
+    command.size         = size;
+    command.bindingPoint = bindingPoint;
+    command.data         = data ? CommandPush( buffer, size, data ) : COMMAND_NONE;
+    if( data && command.data == COMMAND_NONE ) {
+        return;
+    }
+    CommandRecordOrdered( type, sizeof(command), &command );
+}
+
+static void CommandInitialize() {
+    COMMAND_RECORDER.backend.Initialize();
+    CommandInvalidate();
+}
+static void CommandClearBuffer() {
+    CommandRecordOrdered( CommandType::CLEAR_BUFFER, 0, nullptr );
+}
+static void CommandSwapBuffers() {
+    CommandFlush();
+    COMMAND_RECORDER.backend.SwapBuffers();
+}
+static void CommandSetClearColor( f32 r, f32 g, f32 b, f32 a ) {
+    f32 color[4] = { r, g, b, a };
+    CommandRecordOrdered( CommandType::SET_CLEAR_COLOR, sizeof(color), color );
+}
+static void CommandSetViewport( i32 width, i32 height ) {
+    i32 dimensions[2] = { width, height };
+    CommandRecordOrdered( CommandType::SET_VIEWPORT, sizeof(dimensions), dimensions );
+}
+static void CommandSetPackAlignment( i32 packAlignment ) {
+    COMMAND_RECORDER.backend.SetPackAlignment( packAlignment );
+}
+static void CommandSetUnPackAlignment( i32 unpackAlignment ) {
+    COMMAND_RECORDER.backend.SetUnPackAlignment( unpackAlignment );
+}
+static void CommandSetBlendingEnable( bool enable ) {
+    CommandBuffer* buffer = CommandCurrentBuffer();
+    buffer->state.setMask |= COMMAND_STATE_BLENDING;
+    buffer->state.blending = enable;
+    buffer->stateDirty     = true;
+}
+static bool CommandIsBlendingEnabled() {
+    CommandBuffer* buffer = CommandCurrentBuffer();
+    if( buffer->state.setMask & COMMAND_STATE_BLENDING ) {
+        return buffer->state.blending;
+    }
+    return COMMAND_RECORDER.backend.IsBlendingEnabled();
+}
+static void CommandSetBlendFunction( BlendFactor srcColor, BlendFactor dstColor, BlendFactor srcAlpha, BlendFactor dstAlpha ) {
+    CommandBuffer* buffer = CommandCurrentBuffer();
+    buffer->state.setMask |= COMMAND_STATE_BLEND_FUNCTION;
+    buffer->state.blendFactors[0] = srcColor;
+    buffer->state.blendFactors[1] = dstColor;
+    buffer->state.blendFactors[2] = srcAlpha;
+    buffer->state.blendFactors[3] = dstAlpha;
+    buffer->stateDirty = true;
+}
+static void CommandSetBlendEquation( BlendEq colorEq, BlendEq alphaEq ) {
+    CommandBuffer* buffer = CommandCurrentBuffer();
+    buffer->state.setMask |= COMMAND_STATE_BLEND_EQUATION;
+    buffer->state.blendEqs[0] = colorEq;
+    buffer->state.blendEqs[1] = alphaEq;
+    buffer->stateDirty = true;
+}
+static void CommandDrawVertexArray( VertexArray* vertexArray ) {
+    CommandRecordDraw( vertexArray, CommandDrawType::ARRAY, COMMAND_NONE );
+}
+static void CommandDrawVertexArrayRange( VertexArray* vertexArray, usize firstIndex, usize indexCount, u32 baseVertex ) {
+    CommandDraw* draw = CommandRecordDraw( vertexArray, CommandDrawType::RANGE, COMMAND_NONE );
+    if( !draw ) {
+        return;
+    }
+    draw->firstIndex = firstIndex;
+    draw->indexCount = indexCount;
+    draw->baseVertex = baseVertex;
+}
+static void CommandDrawVertexArrayRanges(
+    VertexArray* vertexArray, usize rangeCount,
+    const u32* firstIndices, const u32* indexCounts, const u32* baseVertices
+) {
+    CommandBuffer* buffer = CommandCurrentBuffer();
+    u32 ranges = CommandPush( buffer, rangeCount * 3 * sizeof(u32), nullptr );
+    if( ranges == COMMAND_NONE ) {
+        return;
+    }
+    u32* rangeData = (u32*)( buffer->memory + ranges );
+    Platform::MemCopy( rangeCount * sizeof(u32), firstIndices, rangeData );
+    Platform::MemCopy( rangeCount * sizeof(u32), indexCounts, rangeData + rangeCount );
+    Platform::MemCopy( rangeCount * sizeof(u32), baseVertices, rangeData + rangeCount * 2 );
+    CommandDraw* draw = CommandRecordDraw( vertexArray, CommandDrawType::RANGES, ranges );
+    if( !draw ) {
+        return;
+    }
+    draw->rangeCount = rangeCount;
+}
+static void CommandSetWireframeEnabled( bool enabled ) {
+    CommandBuffer* buffer = CommandCurrentBuffer();
+    buffer->state.setMask  |= COMMAND_STATE_WIREFRAME;
+    buffer->state.wireframe = enabled;
+    buffer->stateDirty      = true;
+}
+
+// NOTE(alicia): vertex array
+
+static VertexArray CommandCreateVertexArray() {
+    CommandFlush();
+    VertexArray result = COMMAND_RECORDER.backend.CreateVertexArray();
+    CommandInvalidate();
+    return result;
+}
+static void CommandDeleteVertexArrays( usize count, VertexArray* vertexArrays ) {
+    CommandFlush();
+    COMMAND_RECORDER.backend.DeleteVertexArrays( count, vertexArrays );
+    CommandInvalidate();
+}
+static void CommandUseVertexArray( VertexArray* vertexArray ) {
+    CommandBuffer* buffer = CommandCurrentBuffer();
+    buffer->vertexArray    = *vertexArray;
+    buffer->vertexArraySet = true;
+}
+/// @brief Bind vertex array recorded last before creating something that's recorded into it
+static void CommandBindRecordedVertexArray() {
+    CommandBuffer* buffer = CommandCurrentBuffer();
+    if( buffer->vertexArraySet ) {
+        COMMAND_RECORDER.backend.UseVertexArray( &buffer->vertexArray );
+    }
+}
+static void CommandVertexArrayBindVertexBuffer( VertexArray* vertexArray, VertexBuffer buffer ) {
+    CommandFlush();
+    COMMAND_RECORDER.backend.VertexArrayBindVertexBuffer( vertexArray, buffer );
+    CommandInvalidate();
+}
+static void CommandVertexArrayBindIndexBuffer( VertexArray* vertexArray, IndexBuffer buffer ) {
+    CommandFlush();
+    COMMAND_RECORDER.backend.VertexArrayBindIndexBuffer( vertexArray, buffer );
+    CommandInvalidate();
+}
+
+// NOTE(alicia): vertex buffer
+
+static VertexBuffer CommandCreateVertexBuffer( usize bufferSize, void* vertices, VertexBufferLayout layout ) {
+    CommandFlush();
+    CommandBindRecordedVertexArray();
+    VertexBuffer result = COMMAND_RECORDER.backend.CreateVertexBuffer( bufferSize, vertices, layout );
+    CommandInvalidate();
+    return result;
+}
+static void CommandUseVertexBuffer( VertexBuffer* buffer ) {
+    CommandFlush();
+    CommandBindRecordedVertexArray();
+    COMMAND_RECORDER.backend.UseVertexBuffer( buffer );
+    CommandInvalidate();
+}
+static void CommandDeleteVertexBuffers( usize count, VertexBuffer* buffers ) {
+    CommandFlush();
+    COMMAND_RECORDER.backend.DeleteVertexBuffers( count, buffers );
+    CommandInvalidate();
+}
+/// @brief Recorded like uniform buffer updates so draws before and after it see the right data
+static void CommandVertexBufferSubData( VertexBuffer* vertexBuffer, usize offset, usize size, void* data ) {
+    CommandBuffer* buffer = CommandCurrentBuffer();
+    CommandVertexBufferData command = {};
+    command.buffer = *vertexBuffer;
+    command.offset = offset;
+    command.size   = size;
+    command.data   = CommandPush( buffer, size, data );
+    if( command.data == COMMAND_NONE ) {
+        return;
+    }
+    CommandRecordOrdered( CommandType::VERTEX_BUFFER_SUB_DATA, sizeof(command), &command );
+}
+
+// NOTE(alicia): index buffer
+
+static IndexBuffer CommandCreateIndexBuffer( usize indexCount, void* indices, DataType indexDataType ) {
+    CommandFlush();
+    CommandBindRecordedVertexArray();
+    IndexBuffer result = COMMAND_RECORDER.backend.CreateIndexBuffer( indexCount, indices, indexDataType );
+    CommandInvalidate();
+    return result;
+}
+static void CommandUseIndexBuffer( IndexBuffer* buffer ) {
+    CommandFlush();
+    CommandBindRecordedVertexArray();
+    COMMAND_RECORDER.backend.UseIndexBuffer( buffer );
+    CommandInvalidate();
+}
+static void CommandDeleteIndexBuffers( usize count, IndexBuffer* buffers ) {
+    CommandFlush();
+    COMMAND_RECORDER.backend.DeleteIndexBuffers( count, buffers );
+    CommandInvalidate();
+}
+
+// NOTE(alicia): uniform buffer
+
+static UniformBuffer CommandCreateUniformBuffer( usize size, void* data ) {
+    CommandFlush();
+    UniformBuffer result = COMMAND_RECORDER.backend.CreateUniformBuffer( size, data );
+    CommandInvalidate();
+    return result;
+}
+static void CommandDeleteUniformBuffers( usize bufferCount, UniformBuffer* buffers ) {
+    CommandFlush();
+    COMMAND_RECORDER.backend.DeleteUniformBuffers( bufferCount, buffers );
+    CommandInvalidate();
+}
+static void CommandUniformBufferData( UniformBuffer* uniformBuffer, usize size, void* data ) {
+    CommandRecordUniformBuffer( CommandType::UNIFORM_BUFFER_DATA, uniformBuffer, 0, size, data, 0 );
+}
+static void CommandUniformBufferSubData( UniformBuffer* uniformBuffer, usize offset, usize size, void* data ) {
+    CommandRecordUniformBuffer( CommandType::UNIFORM_BUFFER_SUB_DATA, uniformBuffer, offset, size, data, 0 );
+}
+static void CommandUniformBufferSetBindingPoint( UniformBuffer* uniformBuffer, u32 bindingPoint ) {
+    CommandRecordUniformBuffer( CommandType::UNIFORM_BUFFER_BINDING, uniformBuffer, 0, 0, nullptr, bindingPoint );
+}
+static void CommandUniformBufferSetBindingPointRange( UniformBuffer* uniformBuffer, u32 bindingPoint, usize offset, usize size ) {
+    CommandRecordUniformBuffer( CommandType::UNIFORM_BUFFER_BINDING_RANGE, uniformBuffer, offset, size, nullptr, bindingPoint );
+}
+
+// NOTE(alicia): shader
+
+static bool CommandCreateShader(
+    const char* vertexSrc, usize vertexLen,
+    const char* fragmentSrc, usize fragmentLen,
+    Shader* result
+) {
+    CommandFlush();
+    bool success = COMMAND_RECORDER.backend.CreateShader( vertexSrc, vertexLen, fragmentSrc, fragmentLen, result );
+    CommandInvalidate();
+    return success;
+}
+static void CommandDeleteShaders( usize shaderCount, Shader* shaders ) {
+    CommandRecorder* recorder = &COMMAND_RECORDER;
+    CommandFlush();
+    // NOTE(alicia): a new shader can reuse the id, uniforms cached for it in any buffer would be replayed on it
+    for( CommandBuffer* buffer = COMMAND_BUFFERS; buffer; buffer = buffer->next ) {
+        DEBUG_ASSERT_LOG( !buffer->entryCount,
+            "Commands > Shaders deleted while a worker buffer holds unsubmitted commands!" );
+        ucycles( shaderCount ) {
+            CommandRemoveShaderUniforms( buffer->shaders, &buffer->shaderCount, shaders[i].id );
+        }
+    }
+    ucycles( shaderCount ) {
+        CommandRemoveShaderUniforms( recorder->applied, &recorder->appliedCount, shaders[i].id );
+    }
+    recorder->backend.DeleteShaders( shaderCount, shaders );
+    CommandInvalidate();
+}
+static void CommandUseShader( Shader* shader ) {
+    CommandBuffer* buffer = CommandCurrentBuffer();
+    buffer->state.setMask |= COMMAND_STATE_SHADER;
+    buffer->state.shader   = *shader;
+    buffer->stateDirty     = true;
+}
+static bool CommandGetUniformID( Shader* shader, const char* uniformName, i32* result ) {
+    return COMMAND_RECORDER.backend.GetUniformID( shader, uniformName, result );
+}
+static void CommandUniformFloat( Shader* shader, i32 uniform, f32 value ) {
+    CommandRecordUniform( shader, uniform, CommandUniformType::FLOAT, &value );
+}
+static void CommandUniformUInt( Shader* shader, i32 uniform, u32 value ) {
+    CommandRecordUniform( shader, uniform, CommandUniformType::UINT, &value );
+}
+static void CommandUniformInt( Shader* shader, i32 uniform, i32 value ) {
+    CommandRecordUniform( shader, uniform, CommandUniformType::INT, &value );
+}
+static void CommandUniformVec2( Shader* shader, i32 uniform, smath::vec2* value ) {
+    CommandRecordUniform( shader, uniform, CommandUniformType::VEC2, value->ptr() );
+}
+static void CommandUniformVec3( Shader* shader, i32 uniform, smath::vec3* value ) {
+    CommandRecordUniform( shader, uniform, CommandUniformType::VEC3, value->ptr() );
+}
+static void CommandUniformVec4( Shader* shader, i32 uniform, smath::vec4* value ) {
+    CommandRecordUniform( shader, uniform, CommandUniformType::VEC4, value->ptr() );
+}
+static void CommandUniformMat3( Shader* shader, i32 uniform, smath::mat3* value ) {
+    CommandRecordUniform( shader, uniform, CommandUniformType::MAT3, value->ptr() );
+}
+static void CommandUniformMat4( Shader* shader, i32 uniform, smath::mat4* value ) {
+    CommandRecordUniform( shader, uniform, CommandUniformType::MAT4, value->ptr() );
+}
+
+// NOTE(alicia): texture 2D
+
+static Texture2D CommandCreateTexture2D(
+    i32 width,
+    i32 height,
+    void* data,
+    TextureFormat format,
+    DataType dataType,
+    TextureWrapMode wrapX,
+    TextureWrapMode wrapY,
+    TextureMinFilter minFilter,
+    TextureMagFilter magFilter,
+    const TextureMipChain* mips
+) {
+    CommandFlush();
+    Texture2D result = COMMAND_RECORDER.backend.CreateTexture2D(
+        width, height, data, format, dataType, wrapX, wrapY, minFilter, magFilter, mips );
+    CommandInvalidate();
+    return result;
+}
+static Texture2D CommandCreateCompressedTexture2D(
+    i32 width,
+    i32 height,
+    TextureFormat format,
+    TextureWrapMode wrapX,
+    TextureWrapMode wrapY,
+    TextureMinFilter minFilter,
+    TextureMagFilter magFilter,
+    const TextureMipChain* levels
+) {
+    CommandFlush();
+    Texture2D result = COMMAND_RECORDER.backend.CreateCompressedTexture2D(
+        width, height, format, wrapX, wrapY, minFilter, magFilter, levels );
+    CommandInvalidate();
+    return result;
+}
+static void CommandDeleteTextures2D( usize textureCount, Texture2D* textures ) {
+    CommandFlush();
+    COMMAND_RECORDER.backend.DeleteTextures2D( textureCount, textures );
+    CommandInvalidate();
+}
+static void CommandUseTexture2D( Texture2D* texture, u32 unit ) {
+    DEBUG_ASSERT_LOG( unit < COMMAND_TEXTURE_UNITS,
+        "Commands | UseTexture2D > Texture unit %u is out of range!", unit
+    );
+    if( unit >= COMMAND_TEXTURE_UNITS ) {
+        return;
+    }
+    CommandBuffer* buffer = CommandCurrentBuffer();
+    buffer->state.textureMask   |= 1 << unit;
+    buffer->state.textures[unit] = *texture;
+    buffer->stateDirty           = true;
+}
+static void CommandSetTexture2DWrapMode( Texture2D* texture, TextureWrapMode wrapX, TextureWrapMode wrapY ) {
+    CommandFlush();
+    COMMAND_RECORDER.backend.SetTexture2DWrapMode( texture, wrapX, wrapY );
+    CommandInvalidate();
+}
+static void CommandSetTexture2DFilter( Texture2D* texture, TextureMinFilter minFilter, TextureMagFilter magFilter ) {
+    CommandFlush();
+    COMMAND_RECORDER.backend.SetTexture2DFilter( texture, minFilter, magFilter );
+    CommandInvalidate();
+}
+
+// NOTE(alicia): api ---------------------------------------------------------------------------
+
+CommandBuffer* Platform::CreateCommandBuffer() {
+    CommandBuffer* buffer = (CommandBuffer*)Platform::Alloc( sizeof(CommandBuffer) );
+    if( !buffer ) {
+        return nullptr;
+    }
+    buffer->memory         = (u8*)Platform::Alloc( COMMAND_BUFFER_SIZE );
+    buffer->memoryCapacity = buffer->memory ? COMMAND_BUFFER_SIZE : 0;
+    buffer->stateDirty     = true;
+
+    buffer->next = COMMAND_BUFFERS;
+    if( COMMAND_BUFFERS ) {
+        COMMAND_BUFFERS->previous = buffer;
+    }
+    COMMAND_BUFFERS = buffer;
+    return buffer;
+}
+
+void Platform::DestroyCommandBuffer( CommandBuffer* buffer ) {
+    if( !buffer ) {
+        return;
+    }
+    if( buffer->previous ) {
+        buffer->previous->next = buffer->next;
+    } else {
+        COMMAND_BUFFERS = buffer->next;
+    }
+    if( buffer->next ) {
+        buffer->next->previous = buffer->previous;
+    }
+    if( buffer->memory ) {
+        Platform::Free( buffer->memory );
+    }
+    if( buffer->entries ) {
+        Platform::Free( buffer->entries );
+    }
+    CommandFreeShaderUniforms( buffer->shaders, buffer->shaderCount );
+    Platform::Free( buffer );
+}
+
+void Platform::BindCommandBuffer( CommandBuffer* buffer ) {
+    BOUND_COMMAND_BUFFER = buffer;
+}
+
+void Platform::SetCommandSortDepth( f32 depth ) {
+    CommandBuffer* buffer = CommandCurrentBuffer();
+    if( buffer ) {
+        buffer->sortDepth = depth;
+    }
+}
+
+void Platform::SubmitCommandBuffers( usize bufferCount, CommandBuffer** buffers ) {
+    CommandBuffer* submitted[bufferCount + 1];
+    submitted[0] = COMMAND_RECORDER.defaultBuffer;
+    ucycles( bufferCount ) {
+        submitted[i + 1] = buffers[i];
+    }
+    CommandSubmit( (u32)bufferCount + 1, submitted );
+}
+
+bool Platform::CreateCommandBufferAPI( RendererAPI* api, const RendererAPI* backend ) {
+    CommandRecorder* recorder = &COMMAND_RECORDER;
+    if( recorder->created ) {
+        DestroyCommandBufferAPI();
+    }
+    *recorder = {};
+    recorder->backend       = *backend;
+    recorder->defaultBuffer = CreateCommandBuffer();
+    if( !recorder->defaultBuffer ) {
+        LOG_ERROR( "Commands > Failed to create default command buffer!" );
+        return false;
+    }
+    recorder->created = true;
+
+    api->Initialize            = CommandInitialize;
+    api->ClearBuffer           = CommandClearBuffer;
+    api->SwapBuffers           = CommandSwapBuffers;
+    api->SetClearColor         = CommandSetClearColor;
+    api->SetViewport           = CommandSetViewport;
+    api->SetPackAlignment      = CommandSetPackAlignment;
+    api->SetUnPackAlignment    = CommandSetUnPackAlignment;
+    api->SetBlendingEnable     = CommandSetBlendingEnable;
+    api->IsBlendingEnabled     = CommandIsBlendingEnabled;
+    api->SetBlendFunction      = CommandSetBlendFunction;
+    api->SetBlendEquation      = CommandSetBlendEquation;
+    api->DrawVertexArray       = CommandDrawVertexArray;
+    api->DrawVertexArrayRange  = CommandDrawVertexArrayRange;
+    api->DrawVertexArrayRanges = CommandDrawVertexArrayRanges;
+    api->SetWireframeEnabled   = CommandSetWireframeEnabled;
+
+    // NOTE(alicia): Shader
+
+    api->CreateShader  = CommandCreateShader;
+    api->DeleteShaders = CommandDeleteShaders;
+    api->UseShader     = CommandUseShader;
+    api->GetUniformID  = CommandGetUniformID;
+    api->UniformFloat  = CommandUniformFloat;
+    api->UniformUInt   = CommandUniformUInt;
+    api->UniformInt    = CommandUniformInt;
+    api->UniformVec2   = CommandUniformVec2;
+    api->UniformVec3   = CommandUniformVec3;
+    api->UniformVec4   = CommandUniformVec4;
+    api->UniformMat3   = CommandUniformMat3;
+    api->UniformMat4   = CommandUniformMat4;
+
+    // NOTE(alicia): Texture2D
+
+    api->CreateTexture2D           = CommandCreateTexture2D;
+    api->CreateCompressedTexture2D = CommandCreateCompressedTexture2D;
+    api->DeleteTextures2D          = CommandDeleteTextures2D;
+    api->UseTexture2D              = CommandUseTexture2D;
+    api->SetTexture2DFilter        = CommandSetTexture2DFilter;
+    api->SetTexture2DWrapMode      = CommandSetTexture2DWrapMode;
+
+    // NOTE(alicia): Uniform Buffer
+
+    api->CreateUniformBuffer               = CommandCreateUniformBuffer;
+    api->DeleteUniformBuffers              = CommandDeleteUniformBuffers;
+    api->UniformBufferData                 = CommandUniformBufferData;
+    api->UniformBufferSubData              = CommandUniformBufferSubData;
+    api->UniformBufferSetBindingPoint      = CommandUniformBufferSetBindingPoint;
+    api->UniformBufferSetBindingPointRange = CommandUniformBufferSetBindingPointRange;
+
+    // NOTE(alicia): Vertex Array
+    api->CreateVertexArray           = CommandCreateVertexArray;
+    api->DeleteVertexArrays          = CommandDeleteVertexArrays;
+    api->UseVertexArray              = CommandUseVertexArray;
+    api->VertexArrayBindVertexBuffer = CommandVertexArrayBindVertexBuffer;
+    api->VertexArrayBindIndexBuffer  = CommandVertexArrayBindIndexBuffer;
+
+    // NOTE(alicia): Vertex Buffer
+    api->CreateVertexBuffer  = CommandCreateVertexBuffer;
+    api->UseVertexBuffer     = CommandUseVertexBuffer;
+    api->DeleteVertexBuffers = CommandDeleteVertexBuffers;
+    api->VertexBufferSubData = CommandVertexBufferSubData;
+
+    // NOTE(alicia): Index Buffer
+    api->CreateIndexBuffer  = CommandCreateIndexBuffer;
+    api->UseIndexBuffer     = CommandUseIndexBuffer;
+    api->DeleteIndexBuffers = CommandDeleteIndexBuffers;
+
+    LOG_INFO( "Commands > Recording renderer commands" );
+    return true;
+}
+
+void Platform::DestroyCommandBufferAPI() {
+    CommandRecorder* recorder = &COMMAND_RECORDER;
+    if( !recorder->created ) {
+        return;
+    }
+    DestroyCommandBuffer( recorder->defaultBuffer );
+    CommandFreeShaderUniforms( recorder->applied, recorder->appliedCount );
+    if( recorder->items ) {
+        Platform::Free( recorder->items );
+    }
+    if( recorder->scratch ) {
+        Platform::Free( recorder->scratch );
+    }
+    *recorder = {};
+}
@@ -0,0 +1,49 @@
+/**
+ * Description:  Deferred renderer commands
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "renderer.hpp"
+
+namespace Platform {
+
+/// @brief Commands recorded by a single thread, replayed on submit
+struct CommandBuffer;
+
+/// @brief Create renderer api that records calls into command buffers and replays them on backend.
+/// Draws are sorted by pass, shader, textures, vertex array and depth between ordered commands
+/// (clears, clear color, viewport, uniform and vertex buffer updates),
+/// blended draws keep the order they were recorded in and come after opaque draws.
+/// Resource creation, deletion and queries run on backend immediately,
+/// they have to be called from the thread that owns backend and submit the default buffer first
+/// @param api [out] recording api
+/// @param backend api commands are replayed on, copied
+/// @return true if successful
+bool CreateCommandBufferAPI( RendererAPI* api, const RendererAPI* backend );
+/// @brief Free default command buffer and replay state, pending commands are dropped
+void DestroyCommandBufferAPI();
+
+/// @brief Create command buffer for a worker thread to record into.
+/// Must be called from thread that owns backend.
+/// Shaders must not be deleted while buffer holds unsubmitted commands
+CommandBuffer* CreateCommandBuffer();
+/// @brief Free command buffer, it must not be bound to any thread.
+/// Must be called from thread that owns backend
+void DestroyCommandBuffer( CommandBuffer* buffer );
+/// @brief Record calls of recording api made on calling thread into buffer.
+/// Every buffer keeps its own state, state set on another thread isn't visible to it
+/// @param buffer command buffer, nullptr records into default buffer
+void BindCommandBuffer( CommandBuffer* buffer );
+/// @brief Set view depth following opaque draws of calling thread are sorted by, nearest first.
+/// Does nothing if command buffer api isn't created
+void SetCommandSortDepth( f32 depth );
+/// @brief Sort and replay default buffer followed by given buffers as if
+/// they were recorded one after the other, then reset them.
+/// SwapBuffers of recording api submits default buffer only.
+/// Must be called from thread that owns backend
+/// @param bufferCount number of worker buffers
+/// @param buffers worker buffers
+void SubmitCommandBuffers( usize bufferCount, CommandBuffer** buffers );
+
+} // namespace Platform
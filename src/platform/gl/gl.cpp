@@ -43,6 +43,57 @@ void Platform::OpenGLDrawVertexArray( VertexArray* vertexArray ) {
     }
 }
 
+void Platform::OpenGLDrawVertexArrayRange( VertexArray* vertexArray, usize firstIndex, usize indexCount, u32 baseVertex ) {
+    DEBUG_ASSERT_LOG( vertexArray->indexBuffer,
+        "OpenGL | DrawVertexArrayRange > Vertex array has no index buffer!"
+    );
+    DataType indexDataType = vertexArray->indexBuffer->dataType;
+    glDrawElementsBaseVertex(
+        GL_TRIANGLES,
+        indexCount,
+        DataTypeToGLenum( indexDataType ),
+        (void*)( firstIndex * DataTypeSize( indexDataType ) ),
+        (GLint)baseVertex
+    );
+}
+
+/// @brief Number of ranges converted on the stack per glMultiDrawElementsBaseVertex call
+#define OPENGL_MULTI_DRAW_BATCH_SIZE 128
+
+void Platform::OpenGLDrawVertexArrayRanges(
+    VertexArray* vertexArray, usize rangeCount,
+    const u32* firstIndices, const u32* indexCounts, const u32* baseVertices
+) {
+    DEBUG_ASSERT_LOG( vertexArray->indexBuffer,
+        "OpenGL | DrawVertexArrayRanges > Vertex array has no index buffer!"
+    );
+    DataType indexDataType = vertexArray->indexBuffer->dataType;
+    usize indexSize = DataTypeSize( indexDataType );
+
+    GLsizei     counts[OPENGL_MULTI_DRAW_BATCH_SIZE];
+    const void* offsets[OPENGL_MULTI_DRAW_BATCH_SIZE];
+    GLint       bases[OPENGL_MULTI_DRAW_BATCH_SIZE];
+    for( usize first = 0; first < rangeCount; first += OPENGL_MULTI_DRAW_BATCH_SIZE ) {
+        usize batchCount = rangeCount - first;
+        if( batchCount > OPENGL_MULTI_DRAW_BATCH_SIZE ) {
+            batchCount = OPENGL_MULTI_DRAW_BATCH_SIZE;
+        }
+        ucycles( batchCount ) {
+            counts[i]  = (GLsizei)indexCounts[first + i];
+            offsets[i] = (const void*)( (usize)firstIndices[first + i] * indexSize );
+            bases[i]   = (GLint)baseVertices[first + i];
+        }
+        glMultiDrawElementsBaseVertex(
+            GL_TRIANGLES,
+            counts,
+            DataTypeToGLenum( indexDataType ),
+            offsets,
+            (GLsizei)batchCount,
+            bases
+        );
+    }
+}
+
 void Platform::OpenGLDeleteBuffers( usize bufferCount, u32* bufferIDs ) {
     glDeleteBuffers( bufferCount, bufferIDs );
 }
@@ -56,20 +107,19 @@ Platform::IndexBuffer Platform::OpenGLCreateIndexBuffer( usize indexCount, void*
         Platform::DataTypeToString( indexDataType )
     );
 
+    // NOTE(alicia): no CPU copy is kept, index data lives on the GPU only
     IndexBuffer result = {};
     result.dataType   = indexDataType;
     result.indexCount = indexCount;
     result.bufferSize = result.indexCount * Platform::DataTypeSize( result.dataType );
-    result.indices    = Platform::Alloc( result.bufferSize );
-
-    Platform::MemCopy( result.bufferSize, indices, result.indices );
+    result.indices    = nullptr;
 
     glGenBuffers( 1, &result.id );
     glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, result.id );
     glBufferData(
         GL_ELEMENT_ARRAY_BUFFER,
         (GLsizeiptr)result.bufferSize,
-        result.indices,
+        indices,
         GL_STATIC_DRAW // TODO(alicia): usage?
     );
     
@@ -90,21 +140,21 @@ void Platform::OpenGLDeleteIndexBuffers( usize count, IndexBuffer* buffers ) {
 }
 
 Platform::VertexBuffer Platform::OpenGLCreateVertexBuffer( usize bufferSize, void* vertices, VertexBufferLayout layout ) {
+    // NOTE(alicia): no CPU copy is kept, vertex data lives on the GPU only
     VertexBuffer result = {};
     result.layout       = layout;
     result.bufferSize   = bufferSize;
-    result.vertices     = Platform::Alloc( result.bufferSize );
+    result.vertices     = nullptr;
     result.vertexCount  = result.bufferSize / result.layout.stride;
 
-    Platform::MemCopy( result.bufferSize, vertices, result.vertices );
-
     glGenBuffers( 1, &result.id );
     glBindBuffer( GL_ARRAY_BUFFER, result.id );
     glBufferData(
         GL_ARRAY_BUFFER,
         (GLsizeiptr)result.bufferSize,
         vertices,
-        GL_STATIC_DRAW
+        // NOTE(alicia): buffers created without vertices are filled with VertexBufferSubData
+        vertices ? GL_STATIC_DRAW : GL_DYNAMIC_DRAW
     );
 
     ucycles( result.layout.elementCount ) {
@@ -135,6 +185,20 @@ void Platform::OpenGLDeleteVertexBuffers( usize count, VertexBuffer* buffers ) {
     }
     glDeleteBuffers( count, vertexBufferIDs );
 }
+void Platform::OpenGLVertexBufferSubData( VertexBuffer* buffer, usize offset, usize size, void* data ) {
+    DEBUG_ASSERT_LOG( offset + size <= buffer->bufferSize,
+        "OpenGL | VertexBufferSubData > Offset + Size (%llu) is greater than Vertex Buffer size(%llu)!",
+        offset + size, buffer->bufferSize
+    );
+    // NOTE(alicia): array buffer binding isn't part of vertex array state
+    glBindBuffer( GL_ARRAY_BUFFER, buffer->id );
+    glBufferSubData(
+        GL_ARRAY_BUFFER,
+        (GLintptr)offset,
+        (GLsizeiptr)size,
+        data
+    );
+}
 
 Platform::VertexArray Platform::OpenGLCreateVertexArray() {
     VertexArray result = {};
@@ -162,14 +226,18 @@ void Platform::OpenGLDeleteVertexArrays( usize count, VertexArray* vertexArrays
         if( vertexArrays[i].buffers ) {
             ucyclesi( vertexArrays[i].vertexBufferCount, j ) {
                 bufferIDs[bufferIndex] = vertexArrays[i].buffers[j].id;
-                Platform::Free( vertexArrays[i].buffers[j].vertices );
+                if( vertexArrays[i].buffers[j].vertices ) {
+                    Platform::Free( vertexArrays[i].buffers[j].vertices );
+                }
                 Platform::FreeVertexBufferLayout( &vertexArrays[i].buffers[j].layout );
                 bufferIndex++;
             }
         }
         if( vertexArrays[i].indexBuffer ) {
             bufferIDs[bufferIndex] = vertexArrays[i].indexBuffer->id;
-            Platform::Free( vertexArrays[i].indexBuffer->indices );
+            if( vertexArrays[i].indexBuffer->indices ) {
+                Platform::Free( vertexArrays[i].indexBuffer->indices );
+            }
             bufferIndex++;
         }
     }
@@ -325,7 +393,8 @@ Platform::Texture2D Platform::OpenGLCreateTexture2D(
     TextureWrapMode wrapX,
     TextureWrapMode wrapY,
     TextureMinFilter minFilter,
-    TextureMagFilter magFilter
+    TextureMagFilter magFilter,
+    const TextureMipChain* mips
 ) {
     Texture2D result = {};
     result.width     = width;
@@ -352,7 +421,76 @@ Platform::Texture2D Platform::OpenGLCreateTexture2D(
         DataTypeToGLenum( result.dataType ),
         result.data
     );
-    glGenerateMipmap( GL_TEXTURE_2D );
+    if( mips && mips->levelCount > 1 ) {
+        // NOTE(alicia): precomputed levels have tightly packed rows
+        GLint unpackAlignment = 4;
+        glGetIntegerv( GL_UNPACK_ALIGNMENT, &unpackAlignment );
+        glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+        u32 levelCount = mips->levelCount < TEXTURE_MAX_MIP_LEVELS ? mips->levelCount : TEXTURE_MAX_MIP_LEVELS;
+        for( u32 level = 1; level < levelCount; ++level ) {
+            i32 levelWidth  = result.width  >> level;
+            i32 levelHeight = result.height >> level;
+            glTexImage2D(
+                GL_TEXTURE_2D,
+                level,
+                InternalTextureFormatToGLenum( result.format ),
+                levelWidth  > 0 ? levelWidth  : 1,
+                levelHeight > 0 ? levelHeight : 1,
+                TEX_NO_BORDER,
+                TextureFormatToGLenum(result.format),
+                DataTypeToGLenum( result.dataType ),
+                mips->levels[level]
+            );
+        }
+        glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levelCount - 1 );
+        glPixelStorei( GL_UNPACK_ALIGNMENT, unpackAlignment );
+    } else {
+        glGenerateMipmap( GL_TEXTURE_2D );
+    }
+
+    return result;
+}
+Platform::Texture2D Platform::OpenGLCreateCompressedTexture2D(
+    i32 width,
+    i32 height,
+    TextureFormat format,
+    TextureWrapMode wrapX,
+    TextureWrapMode wrapY,
+    TextureMinFilter minFilter,
+    TextureMagFilter magFilter,
+    const TextureMipChain* levels
+) {
+    Texture2D result = {};
+    result.width    = width;
+    result.height   = height;
+    result.format   = format;
+    result.dataType = DataType::UNSIGNED_BYTE;
+
+    glGenTextures( 1, &result.id );
+    glBindTexture( GL_TEXTURE_2D, result.id );
+
+    Platform::OpenGLSetTexture2DWrapMode( &result, wrapX, wrapY );
+    Platform::OpenGLSetTexture2DFilter( &result, minFilter, magFilter );
+
+    usize blockBytes = TextureFormatBlockBytes( format );
+    u32 levelCount = levels->levelCount < TEXTURE_MAX_MIP_LEVELS ? levels->levelCount : TEXTURE_MAX_MIP_LEVELS;
+    for( u32 level = 0; level < levelCount; ++level ) {
+        i32 levelWidth  = result.width  >> level;
+        i32 levelHeight = result.height >> level;
+        levelWidth  = levelWidth  > 0 ? levelWidth  : 1;
+        levelHeight = levelHeight > 0 ? levelHeight : 1;
+        usize levelSize = (usize)( ( levelWidth + 3 ) / 4 ) * (usize)( ( levelHeight + 3 ) / 4 ) * blockBytes;
+        glCompressedTexImage2D(
+            GL_TEXTURE_2D,
+            level,
+            InternalTextureFormatToGLenum( result.format ),
+            levelWidth, levelHeight,
+            TEX_NO_BORDER,
+            (GLsizei)levelSize,
+            levels->levels[level]
+        );
+    }
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levelCount > 0 ? levelCount - 1 : 0 );
 
     return result;
 }
@@ -700,6 +838,9 @@ GLenum DataTypeToGLenum( Platform::DataType format ) {
         case DataType::INT:            return GL_INT;
         case DataType::FLOAT:          return GL_FLOAT;
         case DataType::DOUBLE:         return GL_DOUBLE;
+        case DataType::HALF_FLOAT:     return GL_HALF_FLOAT;
+        case DataType::INT_2_10_10_10_REV:          return GL_INT_2_10_10_10_REV;
+        case DataType::UNSIGNED_INT_2_10_10_10_REV: return GL_UNSIGNED_INT_2_10_10_10_REV;
         default: return GL_INVALID_ENUM;
     }
 }
@@ -747,6 +888,11 @@ GLenum InternalTextureFormatToGLenum( Platform::TextureFormat format ) {
         case TextureFormat::RG:   return GL_RG8;
         case TextureFormat::RGB:  return GL_RGB8;
         case TextureFormat::RGBA: return GL_RGBA8;
+        case TextureFormat::BC1_RGB:  return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+        case TextureFormat::BC3_RGBA: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        case TextureFormat::BC4_R:    return GL_COMPRESSED_RED_RGTC1;
+        case TextureFormat::BC5_RG:   return GL_COMPRESSED_RG_RGTC2;
+        case TextureFormat::BC7_RGBA: return GL_COMPRESSED_RGBA_BPTC_UNORM;
         default: return GL_INVALID_ENUM;
     }
 }
@@ -11,6 +11,7 @@ namespace Platform {
 typedef void* (*OpenGLLoadProc)(const char* functionName);
 struct Shader;
 struct Texture2D;
+struct TextureMipChain;
 struct UniformBuffer;
 struct VertexArray;
 struct VertexBuffer;
@@ -36,6 +37,11 @@ bool OpenGLIsBlendingEnabled();
 void OpenGLSetBlendFunction( BlendFactor srcColor, BlendFactor dstColor, BlendFactor srcAlpha, BlendFactor dstAlpha );
 void OpenGLSetBlendEquation( BlendEq colorEq, BlendEq alphaEq );
 void OpenGLDrawVertexArray( VertexArray* vertexArray );
+void OpenGLDrawVertexArrayRange( VertexArray* vertexArray, usize firstIndex, usize indexCount, u32 baseVertex );
+void OpenGLDrawVertexArrayRanges(
+    VertexArray* vertexArray, usize rangeCount,
+    const u32* firstIndices, const u32* indexCounts, const u32* baseVertices
+);
 void OpenGLSetWireframeEnabled( bool enabled );
 
 // NOTE(alicia): shader
@@ -70,7 +76,18 @@ Texture2D OpenGLCreateTexture2D(
     TextureWrapMode wrapX,
     TextureWrapMode wrapY,
     TextureMinFilter minFilter,
-    TextureMagFilter magFilter
+    TextureMagFilter magFilter,
+    const TextureMipChain* mips
+);
+Texture2D OpenGLCreateCompressedTexture2D(
+    i32 width,
+    i32 height,
+    TextureFormat format,
+    TextureWrapMode wrapX,
+    TextureWrapMode wrapY,
+    TextureMinFilter minFilter,
+    TextureMagFilter magFilter,
+    const TextureMipChain* levels
 );
 void OpenGLDeleteTextures2D( usize textureCount, Texture2D* textures );
 void OpenGLUseTexture2D( Texture2D* texture, u32 unit );
@@ -90,6 +107,7 @@ void OpenGLVertexArrayBindIndexBuffer( VertexArray* vertexArray, IndexBuffer buf
 VertexBuffer OpenGLCreateVertexBuffer( usize bufferSize, void* vertices, VertexBufferLayout layout );
 void OpenGLUseVertexBuffer( VertexBuffer* buffer );
 void OpenGLDeleteVertexBuffers( usize count, VertexBuffer* buffers );
+void OpenGLVertexBufferSubData( VertexBuffer* buffer, usize offset, usize size, void* data );
 
 // NOTE(alicia): Index Buffer
 
@@ -15,6 +15,11 @@ void AppendToWindowTitle( const char* append, usize appendLen );
 /// @brief Get system time 
 u64 GetSystemTime();
 
+/// @brief Get high resolution performance counter
+u64 GetPerformanceCounter();
+/// @brief Get performance counter frequency in ticks per second
+u64 GetPerformanceFrequency();
+
 /// @brief Allocate memory in the heap
 /// @param size amount to alloc
 /// @return Pointer to memory
@@ -51,6 +56,22 @@ inline void MemCopy( usize size, const void* src, void* dst ) {
     }
 }
 
+/// @brief Compare memory of two buffers
+/// @param size size of buffers, both buffers must be greater than or equals to size
+/// @param a first buffer
+/// @param b second buffer
+/// @return true if buffers contain the same bytes
+inline bool MemCompare( usize size, const void* a, const void* b ) {
+    u8* aBytes = (u8*)a;
+    u8* bBytes = (u8*)b;
+    ucycles( size ) {
+        if( aBytes[i] != bBytes[i] ) {
+            return false;
+        }
+    }
+    return true;
+}
+
 // TODO(alicia): optimize memcopy range
 
 inline void MemCopyRanges(
@@ -86,6 +107,16 @@ struct File {
 /// @return true if successful
 bool LoadFile( const char* filePath, File* result );
 
+/// @brief Maximum length of a path picked with UserPickFile, including null-terminator
+#define USER_FILE_PATH_MAX_LEN 512
+
+/// @brief Pick file path from popup menu, file is not loaded
+/// @param dialogTitle popup title
+/// @param dstSize size of destination buffer, should be USER_FILE_PATH_MAX_LEN
+/// @param dst destination buffer
+/// @return true if a file was picked
+bool UserPickFile( const char* dialogTitle, usize dstSize, char* dst );
+
 /// @brief Load file from popup menu
 /// @param result file
 /// @return true if successful
@@ -100,6 +131,8 @@ enum class WriteFileType {
     NOT_CREATED_FAIL,
     // Create file if does not already exist
     CREATE,
+    // Append to end of file, create file if does not already exist
+    APPEND,
 };
 
 /// @brief Write file to disk
@@ -110,6 +143,67 @@ enum class WriteFileType {
 /// @return true if successful
 bool WriteFile( const char* filePath, void* buffer, usize bufferSize, WriteFileType writeType );
 
+/// @brief Create directory
+/// @param directoryPath path to directory
+/// @return true if directory was created or already exists
+bool MakeDirectory( const char* directoryPath );
+
+/// @brief Read-only memory mapped file
+struct MappedFile {
+    void* data;
+    usize size;
+    void* fileHandle;
+    void* mappingHandle;
+};
+
+/// @brief Map file into memory, pages are only read from disk when accessed
+/// @param filePath path to file
+/// @param result [out] mapped file
+/// @return true if successful
+bool MapFile( const char* filePath, MappedFile* result );
+/// @brief Unmap file
+void UnmapFile( MappedFile* file );
+
+enum class FileStreamMode {
+    // Open existing file for reading
+    READ,
+    // Create file or truncate existing file, for reading and writing
+    WRITE,
+};
+
+/// @brief File read and written at explicit offsets, nothing is buffered or kept in memory
+struct FileStream {
+    void* fileHandle;
+    /// @brief Size of file when it was opened
+    usize size;
+};
+
+/// @brief Open file stream
+/// @param filePath path to file
+/// @param mode open mode
+/// @param result [out] file stream
+/// @return true if successful
+bool OpenFileStream( const char* filePath, FileStreamMode mode, FileStream* result );
+/// @brief Read from file stream
+/// @param stream file stream
+/// @param offset offset in file to read from
+/// @param size number of bytes to read
+/// @param dst destination buffer, must hold size bytes
+/// @return number of bytes read, less than size at end of file or if read failed
+usize ReadFileStream( FileStream* stream, usize offset, usize size, void* dst );
+/// @brief Write to file stream, file grows if writing past the end
+/// @param stream file stream, must be opened with FileStreamMode::WRITE
+/// @param offset offset in file to write to
+/// @param size number of bytes to write
+/// @param src source buffer
+/// @return true if every byte was written
+bool WriteFileStream( FileStream* stream, usize offset, usize size, const void* src );
+/// @brief Close file stream
+void CloseFileStream( FileStream* stream );
+/// @brief Delete file from disk
+/// @return true if file was deleted or didn't exist
+bool RemoveFile( const char* filePath );
+
 /// @brief Cursor styles
 enum class CursorStyle {
     ARROW,
@@ -0,0 +1,515 @@
+/**
+ * Description:  Linux headless main, renders with software API and writes last frame to a bitmap
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#if LINUX
+#include "core/app.hpp"
+#include "platform/renderer.hpp"
+#include "util.hpp"
+#include "platform/io.hpp"
+#include "platform/threading.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/// @brief Log errno to the console
+#define LOG_LINUX_ERROR() LOG_ERROR( "Linux(#%i) > %s", errno, strerror( errno ) )
+#define SUCCESS_RETURN_CODE 0
+#define ERROR_RETURN_CODE -1
+
+Platform::CursorStyle CURSOR_STYLE = Platform::CursorStyle::ARROW;
+bool CURSOR_VISIBLE = true;
+bool CURSOR_LOCKED  = false;
+
+static i32 WINDOW_WIDTH  = 1280;
+static i32 WINDOW_HEIGHT = 720;
+/// @brief Frames advance by a fixed step so camera motion does not depend on render speed
+static const f32 FRAME_DELTA_TIME = 1.0f / 60.0f;
+
+/// @brief Write software framebuffer to a 32-bit bitmap
+static bool LinuxWriteFramebuffer( const char* filePath ) {
+    Platform::SoftwareFramebuffer framebuffer;
+    if( !Platform::SoftwareReadFramebuffer( &framebuffer ) ) {
+        LOG_ERROR( "Linux > Software framebuffer is empty!" );
+        return false;
+    }
+    // NOTE(alicia): bitmaps with positive height go from bottom to top like the framebuffer
+    const usize headerSize = 54;
+    usize pixelCount = (usize)framebuffer.width * (usize)framebuffer.height;
+    usize fileSize   = headerSize + pixelCount * sizeof(u32);
+    u8* file = (u8*)Platform::Alloc( fileSize );
+    if( !file ) {
+        LOG_ERROR( "Linux > Failed to allocate bitmap!" );
+        return false;
+    }
+    u32 header[] = {
+        (u32)fileSize, 0, (u32)headerSize,
+        40, (u32)framebuffer.width, (u32)framebuffer.height,
+        1 | ( 32 << 16 ), 0, (u32)( pixelCount * sizeof(u32) ),
+        2835, 2835, 0, 0
+    };
+    file[0] = 'B';
+    file[1] = 'M';
+    Platform::MemCopy( sizeof(header), header, file + 2 );
+
+    // NOTE(alicia): software framebuffer is RGBA, bitmap expects BGRA
+    u32* pixels = (u32*)( file + headerSize );
+    for( i32 y = 0; y < framebuffer.height; ++y ) {
+        const u32* row = framebuffer.color + (usize)y * (usize)framebuffer.stride;
+        for( i32 x = 0; x < framebuffer.width; ++x ) {
+            u32 pixel = row[x];
+            pixels[(usize)y * (usize)framebuffer.width + x] =
+                ( pixel & 0xFF00FF00 ) | ( ( pixel & 0xFF ) << 16 ) | ( ( pixel >> 16 ) & 0xFF );
+        }
+    }
+
+    bool result = Platform::WriteFile( filePath, file, fileSize, Platform::WriteFileType::CREATE );
+    Platform::Free( file );
+    if( result ) {
+        LOG_INFO( "Linux > Wrote frame to \"%s\"", filePath );
+    }
+    return result;
+}
+
+/// @brief Advance app by one fixed step
+static void LinuxUpdate( Core::AppContext* app ) {
+    app->time.deltaTime    = FRAME_DELTA_TIME;
+    app->time.elapsedTime += FRAME_DELTA_TIME;
+    app->time.fps          = 1.0f / FRAME_DELTA_TIME;
+    Core::OnUpdate( app );
+}
+
+/// @brief Usage: ModelViewer <model> [frames] [output.bmp]
+int main( int argc, char** argv ) {
+    INIT_CONSOLE();
+
+    if( argc < 2 ) {
+        LOG_ERROR( "Linux > Usage: %s <model> [frames] [output.bmp]", argv[0] );
+        return ERROR_RETURN_CODE;
+    }
+    const char* modelPath  = argv[1];
+    u32 frameCount         = argc > 2 ? (u32)strtoul( argv[2], nullptr, 10 ) : 1;
+    const char* outputPath = argc > 3 ? argv[3] : "./frame.bmp";
+    if( !frameCount ) {
+        frameCount = 1;
+    }
+
+    Core::AppContext app = Core::CreateContext();
+    app.windowDimensions = smath::vec2( WINDOW_WIDTH, WINDOW_HEIGHT );
+    if( !Platform::CreateSoftwareAPI( &app.rendererAPI, 0 ) ) {
+        LOG_ERROR( "Linux > Failed to create Software API!" );
+        return ERROR_RETURN_CODE;
+    }
+    app.rendererAPI.SetViewport( WINDOW_WIDTH, WINDOW_HEIGHT );
+
+    if( !Core::OnInit( &app ) ) {
+        Platform::DestroySoftwareAPI();
+        return ERROR_RETURN_CODE;
+    }
+
+    i32 returnCode = SUCCESS_RETURN_CODE;
+    if( !Core::RequestLoad( &app.loader, Core::LoadType::MESH, modelPath ) ) {
+        returnCode = ERROR_RETURN_CODE;
+    } else {
+        // NOTE(alicia): frames only start counting once model is uploaded,
+        // uploaded model replaces the default model's vertex array
+        u32 defaultModel = app.renderContext.modelVertexArray.id;
+        while( Core::PendingLoadCount( &app.loader ) ) {
+            LinuxUpdate( &app );
+            usleep( 1000 );
+        }
+        if( app.renderContext.modelVertexArray.id == defaultModel ) {
+            LOG_ERROR( "Linux > Failed to load \"%s\"!", modelPath );
+            returnCode = ERROR_RETURN_CODE;
+        } else {
+            ucycles( frameCount ) {
+                LinuxUpdate( &app );
+            }
+            if( !LinuxWriteFramebuffer( outputPath ) ) {
+                returnCode = ERROR_RETURN_CODE;
+            }
+        }
+    }
+
+    Core::OnClose( &app );
+    Platform::DestroySoftwareAPI();
+    return returnCode;
+}
+
+void* Platform::Alloc( usize size ) {
+    void* result = calloc( 1, size );
+    DEBUG_ASSERT_LOG( result, "Heap Alloc failed here!" );
+    return result;
+}
+
+void Platform::Free( void* mem ) {
+    free( mem );
+}
+
+void Platform::AppendToWindowTitle( const char* append, usize appendLen ) {
+    // NOTE(alicia): there is no window, title is only logged
+    LOG_INFO( "Linux > Window title: %.*s", (i32)appendLen, append );
+    UNUSED_PARAM( append );
+    UNUSED_PARAM( appendLen );
+}
+
+void Platform::SetCursorStyle( CursorStyle style ) { CURSOR_STYLE = style; }
+void Platform::ResetCursorStyle() { CURSOR_STYLE = CursorStyle::ARROW; }
+Platform::CursorStyle Platform::GetCursorStyle() { return CURSOR_STYLE; }
+void Platform::SetCursorVisibility( bool visible ) { CURSOR_VISIBLE = visible; }
+bool Platform::IsCursorVisible() { return CURSOR_VISIBLE; }
+void Platform::SetCursorLocked( bool lock ) { CURSOR_LOCKED = lock; }
+bool Platform::IsCursorLocked() { return CURSOR_LOCKED; }
+bool Platform::IsAppActive() { return true; }
+
+bool Platform::LoadFile( const char* filePath, File* result ) {
+    *result = {};
+    usize filePathLen = stringLen( filePath ) + 1;
+    if( filePathLen == 1 ) {
+        LOG_WARN( "Linux > Attempted to load file from empty path!" );
+        return false;
+    }
+    i32 file = open( filePath, O_RDONLY );
+    if( file < 0 ) {
+        LOG_LINUX_ERROR();
+        LOG_ERROR( "File path: %s", filePath );
+        return false;
+    }
+    struct stat fileStat;
+    if( fstat( file, &fileStat ) != 0 ) {
+        LOG_LINUX_ERROR();
+        close( file );
+        return false;
+    }
+
+    result->filePathLen = filePathLen;
+    result->filePath    = (char*)Platform::Alloc( filePathLen );
+    result->size        = (usize)fileStat.st_size;
+    result->data        = Platform::Alloc( result->size ? result->size : 1 );
+    if( !result->filePath || !result->data ) {
+        LOG_ERROR( "Linux | LoadFile > Failed to allocate %llu bytes of memory!", (u64)result->size );
+        FreeFile( result );
+        close( file );
+        return false;
+    }
+    stringCopy( filePath, filePathLen, result->filePath );
+
+    usize bytesRead = 0;
+    while( bytesRead < result->size ) {
+        ssize_t chunkRead = read( file, (u8*)result->data + bytesRead, result->size - bytesRead );
+        if( chunkRead <= 0 ) {
+            if( chunkRead < 0 ) {
+                LOG_LINUX_ERROR();
+            }
+            FreeFile( result );
+            close( file );
+            return false;
+        }
+        bytesRead += (usize)chunkRead;
+    }
+    close( file );
+
+    LOG_INFO( "Linux > Successfully loaded \"%s\" from disk!", result->filePath );
+    return true;
+}
+
+bool Platform::UserPickFile( const char* dialogTitle, usize dstSize, char* dst ) {
+    LOG_WARN( "Linux > \"%s\" needs a file dialog, headless build has none", dialogTitle );
+    UNUSED_PARAM( dialogTitle );
+    UNUSED_PARAM( dstSize );
+    UNUSED_PARAM( dst );
+    return false;
+}
+
+bool Platform::UserLoadFile( const char* dialogTitle, File* result ) {
+    char filePath[USER_FILE_PATH_MAX_LEN];
+    if( !UserPickFile( dialogTitle, USER_FILE_PATH_MAX_LEN, filePath ) ) {
+        *result = {};
+        return false;
+    }
+    return LoadFile( filePath, result );
+}
+
+void Platform::FreeFile( File* file ) {
+    Platform::Free( file->data );
+    Platform::Free( file->filePath );
+    *file = {};
+}
+
+bool Platform::WriteFile( const char* filePath, void* buffer, usize bufferSize, WriteFileType writeType ) {
+    i32 flags;
+    switch( writeType ) {
+        case WriteFileType::NOT_CREATED_FAIL: {
+            flags = O_WRONLY | O_TRUNC;
+        } break;
+        case WriteFileType::APPEND: {
+            flags = O_WRONLY | O_CREAT | O_APPEND;
+        } break;
+        default: {
+            flags = O_WRONLY | O_CREAT | O_TRUNC;
+        } break;
+    }
+    i32 file = open( filePath, flags, 0644 );
+    if( file < 0 ) {
+        LOG_LINUX_ERROR();
+        return false;
+    }
+
+    const u8* bytes = (const u8*)buffer;
+    usize bytesRemaining = bufferSize;
+    while( bytesRemaining > 0 ) {
+        ssize_t bytesWritten = write( file, bytes, bytesRemaining );
+        if( bytesWritten <= 0 ) {
+            LOG_LINUX_ERROR();
+            close( file );
+            return false;
+        }
+        bytes          += bytesWritten;
+        bytesRemaining -= (usize)bytesWritten;
+    }
+    close( file );
+    return true;
+}
+
+bool Platform::MakeDirectory( const char* directoryPath ) {
+    if( mkdir( directoryPath, 0755 ) != 0 ) {
+        if( errno == EEXIST ) {
+            return true;
+        }
+        LOG_LINUX_ERROR();
+        return false;
+    }
+    return true;
+}
+
+// NOTE(alicia): file descriptors are stored off by one so 0 stays an empty handle
+
+bool Platform::MapFile( const char* filePath, MappedFile* result ) {
+    *result = {};
+    i32 file = open( filePath, O_RDONLY );
+    if( file < 0 ) {
+        return false;
+    }
+    struct stat fileStat;
+    if( fstat( file, &fileStat ) != 0 || fileStat.st_size == 0 ) {
+        close( file );
+        return false;
+    }
+
+    void* data = mmap( nullptr, (usize)fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0 );
+    if( data == MAP_FAILED ) {
+        LOG_LINUX_ERROR();
+        close( file );
+        return false;
+    }
+    madvise( data, (usize)fileStat.st_size, MADV_SEQUENTIAL );
+
+    result->data       = data;
+    result->size       = (usize)fileStat.st_size;
+    result->fileHandle = (void*)(usize)( file + 1 );
+    return true;
+}
+
+void Platform::UnmapFile( MappedFile* file ) {
+    if( file->data ) {
+        munmap( file->data, file->size );
+    }
+    if( file->fileHandle ) {
+        close( (i32)(usize)file->fileHandle - 1 );
+    }
+    *file = {};
+}
+
+bool Platform::OpenFileStream( const char* filePath, FileStreamMode mode, FileStream* result ) {
+    *result = {};
+    i32 file = mode == FileStreamMode::WRITE ?
+        open( filePath, O_RDWR | O_CREAT | O_TRUNC, 0644 ) :
+        open( filePath, O_RDONLY );
+    if( file < 0 ) {
+        LOG_LINUX_ERROR();
+        return false;
+    }
+    struct stat fileStat;
+    if( fstat( file, &fileStat ) != 0 ) {
+        LOG_LINUX_ERROR();
+        close( file );
+        return false;
+    }
+    result->fileHandle = (void*)(usize)( file + 1 );
+    result->size       = (usize)fileStat.st_size;
+    return true;
+}
+
+usize Platform::ReadFileStream( FileStream* stream, usize offset, usize size, void* dst ) {
+    i32 file = (i32)(usize)stream->fileHandle - 1;
+    u8* bytes = (u8*)dst;
+    usize bytesRead = 0;
+    while( bytesRead < size ) {
+        ssize_t chunkRead = pread( file, bytes + bytesRead, size - bytesRead, (off_t)( offset + bytesRead ) );
+        if( chunkRead <= 0 ) {
+            if( chunkRead < 0 ) {
+                LOG_LINUX_ERROR();
+            }
+            break;
+        }
+        bytesRead += (usize)chunkRead;
+    }
+    return bytesRead;
+}
+
+bool Platform::WriteFileStream( FileStream* stream, usize offset, usize size, const void* src ) {
+    i32 file = (i32)(usize)stream->fileHandle - 1;
+    const u8* bytes = (const u8*)src;
+    usize bytesWritten = 0;
+    while( bytesWritten < size ) {
+        ssize_t chunkWritten = pwrite( file, bytes + bytesWritten, size - bytesWritten, (off_t)( offset + bytesWritten ) );
+        if( chunkWritten <= 0 ) {
+            LOG_LINUX_ERROR();
+            return false;
+        }
+        bytesWritten += (usize)chunkWritten;
+    }
+    return true;
+}
+
+void Platform::CloseFileStream( FileStream* stream ) {
+    if( stream->fileHandle ) {
+        close( (i32)(usize)stream->fileHandle - 1 );
+    }
+    *stream = {};
+}
+
+bool Platform::RemoveFile( const char* filePath ) {
+    if( unlink( filePath ) != 0 ) {
+        if( errno == ENOENT ) {
+            return true;
+        }
+        LOG_LINUX_ERROR();
+        return false;
+    }
+    return true;
+}
+
+u64 Platform::GetSystemTime() {
+    timespec time;
+    clock_gettime( CLOCK_REALTIME, &time );
+    return (u64)time.tv_sec * 1000000000ull + (u64)time.tv_nsec;
+}
+
+u64 Platform::GetPerformanceCounter() {
+    timespec time;
+    clock_gettime( CLOCK_MONOTONIC, &time );
+    return (u64)time.tv_sec * 1000000000ull + (u64)time.tv_nsec;
+}
+
+u64 Platform::GetPerformanceFrequency() {
+    return 1000000000ull;
+}
+
+struct LinuxThreadParams {
+    Platform::ThreadProcFN proc;
+    void* params;
+};
+
+static void* LinuxThreadProc( void* parameter ) {
+    LinuxThreadParams threadParams = *(LinuxThreadParams*)parameter;
+    Platform::Free( parameter );
+    threadParams.proc( threadParams.params );
+    return nullptr;
+}
+
+bool Platform::ThreadCreate( ThreadProcFN proc, void* params, Thread* result ) {
+    LinuxThreadParams* threadParams = (LinuxThreadParams*)Platform::Alloc( sizeof(LinuxThreadParams) );
+    pthread_t* handle = (pthread_t*)Platform::Alloc( sizeof(pthread_t) );
+    if( !threadParams || !handle ) {
+        Platform::Free( threadParams );
+        Platform::Free( handle );
+        return false;
+    }
+    threadParams->proc   = proc;
+    threadParams->params = params;
+    i32 error = pthread_create( handle, nullptr, LinuxThreadProc, threadParams );
+    if( error ) {
+        LOG_ERROR( "Linux(#%i) > %s", error, strerror( error ) );
+        Platform::Free( threadParams );
+        Platform::Free( handle );
+        return false;
+    }
+    result->handle = handle;
+    return true;
+}
+
+void Platform::ThreadJoin( Thread* thread ) {
+    pthread_join( *(pthread_t*)thread->handle, nullptr );
+    Platform::Free( thread->handle );
+    thread->handle = nullptr;
+}
+
+bool Platform::SemaphoreCreate( u32 initialCount, u32 maxCount, Semaphore* result ) {
+    // NOTE(alicia): POSIX semaphores have no maximum count
+    UNUSED_PARAM( maxCount );
+    sem_t* handle = (sem_t*)Platform::Alloc( sizeof(sem_t) );
+    if( !handle ) {
+        return false;
+    }
+    if( sem_init( handle, 0, initialCount ) != 0 ) {
+        LOG_LINUX_ERROR();
+        Platform::Free( handle );
+        return false;
+    }
+    result->handle = handle;
+    return true;
+}
+
+void Platform::SemaphoreSignal( Semaphore* semaphore, u32 count ) {
+    ucycles( count ) {
+        sem_post( (sem_t*)semaphore->handle );
+    }
+}
+
+void Platform::SemaphoreWait( Semaphore* semaphore ) {
+    while( sem_wait( (sem_t*)semaphore->handle ) != 0 && errno == EINTR ) {}
+}
+
+void Platform::SemaphoreDestroy( Semaphore* semaphore ) {
+    sem_destroy( (sem_t*)semaphore->handle );
+    Platform::Free( semaphore->handle );
+    semaphore->handle = nullptr;
+}
+
+u32 Platform::GetProcessorCount() {
+    long processorCount = sysconf( _SC_NPROCESSORS_ONLN );
+    return processorCount > 0 ? (u32)processorCount : 1;
+}
+
+i32 Platform::AtomicIncrement( volatile i32* value ) {
+    return __atomic_add_fetch( value, 1, __ATOMIC_SEQ_CST );
+}
+
+i32 Platform::AtomicDecrement( volatile i32* value ) {
+    return __atomic_sub_fetch( value, 1, __ATOMIC_SEQ_CST );
+}
+
+i32 Platform::AtomicAdd( volatile i32* value, i32 addend ) {
+    return __atomic_fetch_add( value, addend, __ATOMIC_SEQ_CST );
+}
+
+i64 Platform::AtomicAdd( volatile i64* value, i64 addend ) {
+    return __atomic_fetch_add( value, addend, __ATOMIC_SEQ_CST );
+}
+
+i32 Platform::AtomicCompareExchange( volatile i32* value, i32 exchange, i32 comparand ) {
+    __atomic_compare_exchange_n( value, &comparand, exchange, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST );
+    return comparand;
+}
+
+#endif
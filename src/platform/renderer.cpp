@@ -5,7 +5,9 @@
 */
 #include "renderer.hpp"
 #include "gl/gl.hpp"
+#include "software/software.hpp"
 #include "platform/io.hpp"
+#include "util.hpp"
 
 using namespace Platform;
 
@@ -24,8 +26,10 @@ bool Platform::CreateOpenGLAPI( RendererAPI* api, OpenGLLoadProc loadProc ) {
     api->IsBlendingEnabled   = OpenGLIsBlendingEnabled;
     api->SetBlendFunction    = OpenGLSetBlendFunction;
     api->SetBlendEquation    = OpenGLSetBlendEquation;
-    api->DrawVertexArray     = OpenGLDrawVertexArray;
-    api->SetWireframeEnabled = OpenGLSetWireframeEnabled;
+    api->DrawVertexArray       = OpenGLDrawVertexArray;
+    api->DrawVertexArrayRange  = OpenGLDrawVertexArrayRange;
+    api->DrawVertexArrayRanges = OpenGLDrawVertexArrayRanges;
+    api->SetWireframeEnabled   = OpenGLSetWireframeEnabled;
 
     // NOTE(alicia): Shader
 
@@ -44,11 +48,12 @@ bool Platform::CreateOpenGLAPI( RendererAPI* api, OpenGLLoadProc loadProc ) {
 
     // NOTE(alicia): Texture2D
 
-    api->CreateTexture2D      = OpenGLCreateTexture2D;
-    api->DeleteTextures2D     = OpenGLDeleteTextures2D;
-    api->UseTexture2D         = OpenGLUseTexture2D;
-    api->SetTexture2DFilter   = OpenGLSetTexture2DFilter;
-    api->SetTexture2DWrapMode = OpenGLSetTexture2DWrapMode;
+    api->CreateTexture2D           = OpenGLCreateTexture2D;
+    api->CreateCompressedTexture2D = OpenGLCreateCompressedTexture2D;
+    api->DeleteTextures2D          = OpenGLDeleteTextures2D;
+    api->UseTexture2D              = OpenGLUseTexture2D;
+    api->SetTexture2DFilter        = OpenGLSetTexture2DFilter;
+    api->SetTexture2DWrapMode      = OpenGLSetTexture2DWrapMode;
     
     // NOTE(alicia): Uniform Buffer
 
@@ -70,6 +75,7 @@ bool Platform::CreateOpenGLAPI( RendererAPI* api, OpenGLLoadProc loadProc ) {
     api->CreateVertexBuffer  = OpenGLCreateVertexBuffer;
     api->UseVertexBuffer     = OpenGLUseVertexBuffer;
     api->DeleteVertexBuffers = OpenGLDeleteVertexBuffers;
+    api->VertexBufferSubData = OpenGLVertexBufferSubData;
 
     // NOTE(alicia): Index Buffer
     api->CreateIndexBuffer  = OpenGLCreateIndexBuffer;
@@ -79,13 +85,117 @@ bool Platform::CreateOpenGLAPI( RendererAPI* api, OpenGLLoadProc loadProc ) {
     return true;
 }
 
+bool Platform::CreateSoftwareAPI( RendererAPI* api, u32 threadCount ) {
+    if( !SoftwareCreate( threadCount ) ) {
+        return false;
+    }
+
+    api->Initialize          = SoftwareInitialize;
+    api->ClearBuffer         = SoftwareClearBuffer;
+    api->SwapBuffers         = SoftwareSwapBuffers;
+    api->SetClearColor       = SoftwareSetClearColor;
+    api->SetViewport         = SoftwareSetViewport;
+    api->SetPackAlignment    = SoftwareSetPackAlignment;
+    api->SetUnPackAlignment  = SoftwareSetUnPackAlignment;
+    api->SetBlendingEnable   = SoftwareSetBlendingEnable;
+    api->IsBlendingEnabled   = SoftwareIsBlendingEnabled;
+    api->SetBlendFunction    = SoftwareSetBlendFunction;
+    api->SetBlendEquation    = SoftwareSetBlendEquation;
+    api->DrawVertexArray       = SoftwareDrawVertexArray;
+    api->DrawVertexArrayRange  = SoftwareDrawVertexArrayRange;
+    api->DrawVertexArrayRanges = SoftwareDrawVertexArrayRanges;
+    api->SetWireframeEnabled   = SoftwareSetWireframeEnabled;
+
+    // NOTE(alicia): Shader
+
+    api->CreateShader  = SoftwareCreateShader;
+    api->DeleteShaders = SoftwareDeleteShaders;
+    api->UseShader     = SoftwareUseShader;
+    api->GetUniformID  = SoftwareGetUniformID;
+    api->UniformFloat  = SoftwareUniformFloat;
+    api->UniformUInt   = SoftwareUniformUInt;
+    api->UniformInt    = SoftwareUniformInt;
+    api->UniformVec2   = SoftwareUniformVec2;
+    api->UniformVec3   = SoftwareUniformVec3;
+    api->UniformVec4   = SoftwareUniformVec4;
+    api->UniformMat3   = SoftwareUniformMat3;
+    api->UniformMat4   = SoftwareUniformMat4;
+
+    // NOTE(alicia): Texture2D
+
+    api->CreateTexture2D           = SoftwareCreateTexture2D;
+    api->CreateCompressedTexture2D = SoftwareCreateCompressedTexture2D;
+    api->DeleteTextures2D          = SoftwareDeleteTextures2D;
+    api->UseTexture2D              = SoftwareUseTexture2D;
+    api->SetTexture2DFilter        = SoftwareSetTexture2DFilter;
+    api->SetTexture2DWrapMode      = SoftwareSetTexture2DWrapMode;
+    
+    // NOTE(alicia): Uniform Buffer
+
+    api->CreateUniformBuffer               = SoftwareCreateUniformBuffer;
+    api->DeleteUniformBuffers              = SoftwareDeleteUniformBuffers;
+    api->UniformBufferData                 = SoftwareUniformBufferData;
+    api->UniformBufferSubData              = SoftwareUniformBufferSubData;
+    api->UniformBufferSetBindingPoint      = SoftwareUniformBufferSetBindingPoint;
+    api->UniformBufferSetBindingPointRange = SoftwareUniformBufferSetBindingPointRange;
+
+    // NOTE(alicia): Vertex Array
+    api->CreateVertexArray           = SoftwareCreateVertexArray;
+    api->DeleteVertexArrays          = SoftwareDeleteVertexArrays;
+    api->UseVertexArray              = SoftwareUseVertexArray;
+    api->VertexArrayBindVertexBuffer = SoftwareVertexArrayBindVertexBuffer;
+    api->VertexArrayBindIndexBuffer  = SoftwareVertexArrayBindIndexBuffer;
+
+    // NOTE(alicia): Vertex Buffer
+    api->CreateVertexBuffer  = SoftwareCreateVertexBuffer;
+    api->UseVertexBuffer     = SoftwareUseVertexBuffer;
+    api->DeleteVertexBuffers = SoftwareDeleteVertexBuffers;
+    api->VertexBufferSubData = SoftwareVertexBufferSubData;
+
+    // NOTE(alicia): Index Buffer
+    api->CreateIndexBuffer  = SoftwareCreateIndexBuffer;
+    api->UseIndexBuffer     = SoftwareUseIndexBuffer;
+    api->DeleteIndexBuffers = SoftwareDeleteIndexBuffers;
+
+    return true;
+}
+
+void Platform::DestroySoftwareAPI() {
+    SoftwareDestroy();
+}
+
 const char* Platform::RendererBackendToString( RendererBackend backend ) {
     switch( backend ) {
-        case RendererBackend::OPENGL: return "OpenGL Core 4.6";
+        case RendererBackend::OPENGL:   return "OpenGL Core 4.6";
+        case RendererBackend::SOFTWARE: return "Software";
         default: return "UNKNOWN BACKEND";
     }
 }
 
+bool Platform::RendererBackendFromString( usize nameLen, const char* name, RendererBackend* result ) {
+    const char* names[] = { "opengl", "software" };
+    const RendererBackend backends[] = { RendererBackend::OPENGL, RendererBackend::SOFTWARE };
+    ucycles( ARRAY_COUNT( names ) ) {
+        usize len = stringLen( names[i] );
+        if( len != nameLen ) {
+            continue;
+        }
+        bool match = true;
+        ucyclesi( len, c ) {
+            char lower = name[c] >= 'A' && name[c] <= 'Z' ? name[c] - 'A' + 'a' : name[c];
+            if( lower != names[i][c] ) {
+                match = false;
+                break;
+            }
+        }
+        if( match ) {
+            *result = backends[i];
+            return true;
+        }
+    }
+    return false;
+}
+
 const char* Platform::TextureMinFilterToString( TextureMinFilter minFilter ) {
     switch( minFilter ) {
         case TextureMinFilter::NEAREST:                return "NEAREST";
@@ -122,6 +232,11 @@ const char* Platform::TextureFormatToString( TextureFormat format ) {
         case TextureFormat::RG:   return "RED_GREEN";
         case TextureFormat::RGB:  return "RED_GREEN_BLUE";
         case TextureFormat::RGBA: return "RED_GREEN_BLUE_ALPHA";
+        case TextureFormat::BC1_RGB:  return "BC1_RED_GREEN_BLUE";
+        case TextureFormat::BC3_RGBA: return "BC3_RED_GREEN_BLUE_ALPHA";
+        case TextureFormat::BC4_R:    return "BC4_RED";
+        case TextureFormat::BC5_RG:   return "BC5_RED_GREEN";
+        case TextureFormat::BC7_RGBA: return "BC7_RED_GREEN_BLUE_ALPHA";
         default: return "UNKNOWN";
     }
 }
@@ -132,6 +247,22 @@ usize Platform::TextureFormatComponentCount( TextureFormat format ) {
         case TextureFormat::RG:   return 2;
         case TextureFormat::RGB:  return 3;
         case TextureFormat::RGBA: return 4;
+        case TextureFormat::BC1_RGB:  return 3;
+        case TextureFormat::BC3_RGBA: return 4;
+        case TextureFormat::BC4_R:    return 1;
+        case TextureFormat::BC5_RG:   return 2;
+        case TextureFormat::BC7_RGBA: return 4;
+        default: return 0;
+    }
+}
+
+usize Platform::TextureFormatBlockBytes( TextureFormat format ) {
+    switch( format ) {
+        case TextureFormat::BC1_RGB:  return 8;
+        case TextureFormat::BC4_R:    return 8;
+        case TextureFormat::BC3_RGBA: return 16;
+        case TextureFormat::BC5_RG:   return 16;
+        case TextureFormat::BC7_RGBA: return 16;
         default: return 0;
     }
 }
@@ -146,6 +277,9 @@ const char* Platform::DataTypeToString( DataType type ) {
         case DataType::INT:            return "INT";
         case DataType::FLOAT:          return "FLOAT";
         case DataType::DOUBLE:         return "DOUBLE";
+        case DataType::HALF_FLOAT:     return "HALF_FLOAT";
+        case DataType::INT_2_10_10_10_REV:          return "INT_2_10_10_10_REV";
+        case DataType::UNSIGNED_INT_2_10_10_10_REV: return "UNSIGNED_INT_2_10_10_10_REV";
         default: return "UNKNOWN";
     }
 }
@@ -203,15 +337,23 @@ usize Platform::DataTypeSize( DataType type ) {
         case DataType::UNSIGNED_BYTE:
         case DataType::BYTE:           return 1;
         case DataType::UNSIGNED_SHORT:
-        case DataType::SHORT:          return 2;
+        case DataType::SHORT:
+        case DataType::HALF_FLOAT:     return 2;
         case DataType::UNSIGNED_INT:
         case DataType::INT:
-        case DataType::FLOAT:          return 4;
+        case DataType::FLOAT:
+        case DataType::INT_2_10_10_10_REV:
+        case DataType::UNSIGNED_INT_2_10_10_10_REV: return 4;
         case DataType::DOUBLE:         return 8;
         default: return 0;
     }
 }
 
+bool Platform::DataTypeIsPacked( DataType type ) {
+    return type == DataType::INT_2_10_10_10_REV ||
+        type == DataType::UNSIGNED_INT_2_10_10_10_REV;
+}
+
 usize Platform::DataStructureCount( DataStructure structure ) {
     switch( structure ) {
         case DataStructure::SCALAR: return 1;
@@ -236,8 +378,10 @@ VertexBufferLayout Platform::CreateVertexBufferLayout( usize elementCount, Verte
     result.stride = 0;
 
     ucycles( elementCount ) {
-        usize elementSize = DataTypeSize(result.elements[i].dataType) *
-            DataStructureCount(result.elements[i].structure);
+        usize elementSize = DataTypeSize(result.elements[i].dataType);
+        if( !DataTypeIsPacked( result.elements[i].dataType ) ) {
+            elementSize *= DataStructureCount(result.elements[i].structure);
+        }
         result.elementOffsets[i] = result.stride;
         result.stride           += elementSize;
     }
@@ -63,16 +63,28 @@ enum class DataType : i32 {
     UNSIGNED_INT,
     INT,
     FLOAT,
-    DOUBLE
+    DOUBLE,
+    HALF_FLOAT,
+    /// @brief Packed signed 10-bit xyz and 2-bit w, use with VEC4
+    INT_2_10_10_10_REV,
+    /// @brief Packed unsigned 10-bit xyz and 2-bit w, use with VEC4
+    UNSIGNED_INT_2_10_10_10_REV
 };
 const char* DataTypeToString( DataType type );
+/// @brief Size of a single component, or size of the whole element for packed data types
 usize DataTypeSize( DataType type );
+/// @brief Check if data type packs every component of an element into a single value
+bool DataTypeIsPacked( DataType type );
 
 enum class TextureFormat : i32 {
-    R, RG, RGB, RGBA
+    R, RG, RGB, RGBA,
+    // NOTE(alicia): block compressed, 4x4 texels per block
+    BC1_RGB, BC3_RGBA, BC4_R, BC5_RG, BC7_RGBA
 };
 const char* TextureFormatToString( TextureFormat format );
 usize TextureFormatComponentCount( Platform::TextureFormat format );
+/// @brief Size of a single 4x4 block of a block compressed format, 0 if format isn't compressed
+usize TextureFormatBlockBytes( Platform::TextureFormat format );
 enum class TextureWrapMode : i32 {
     CLAMP,
     REPEAT,
@@ -109,6 +121,16 @@ struct Texture2D {
     TextureMinFilter minFilter;
 };
 
+/// @brief Maximum number of levels of a texture, including base level
+#define TEXTURE_MAX_MIP_LEVELS 16
+/// @brief Precomputed mip levels of a texture, tightly packed rows
+struct TextureMipChain {
+    /// @brief number of levels, including base level
+    u32 levelCount;
+    /// @brief data of every level, CreateTexture2D ignores levels[0] in favor of texture data
+    const void* levels[TEXTURE_MAX_MIP_LEVELS];
+};
+
 struct UniformBuffer {
     usize size;
     u32 id;
@@ -125,6 +147,7 @@ struct IndexBuffer {
 struct VertexBufferElement {
     DataStructure structure;
     DataType      dataType;
+    /// @brief Integer data is read as 0.0-1.0 (unsigned) or -1.0-1.0 (signed) floats
     bool          normalized;
 };
 
@@ -155,10 +178,17 @@ struct VertexArray {
 };
 
 enum class RendererBackend : i32 {
-    OPENGL
+    OPENGL,
+    SOFTWARE
 };
 /// @brief Convert renderer backend enum to string
 const char* RendererBackendToString( RendererBackend backend );
+/// @brief Parse renderer backend name as written in settings.ini, case insensitive
+/// @param nameLen length of name
+/// @param name "OpenGL" or "Software"
+/// @param result [out] backend
+/// @return true if name is a known backend
+bool RendererBackendFromString( usize nameLen, const char* name, RendererBackend* result );
 
 #define RENDERER_PACK_ALIGNMENT_1 1
 #define RENDERER_PACK_ALIGNMENT_4 4
@@ -177,6 +207,11 @@ typedef bool (*IsBlendingEnabledFN)();
 typedef void (*SetBlendFunctionFN)( BlendFactor srcColor, BlendFactor dstColor, BlendFactor srcAlpha, BlendFactor dstAlpha );
 typedef void (*SetBlendEquationFN)( BlendEq colorEq, BlendEq alphaEq );
 typedef void (*DrawVertexArrayFN)( VertexArray* vertexArray );
+typedef void (*DrawVertexArrayRangeFN)( VertexArray* vertexArray, usize firstIndex, usize indexCount, u32 baseVertex );
+typedef void (*DrawVertexArrayRangesFN)(
+    VertexArray* vertexArray, usize rangeCount,
+    const u32* firstIndices, const u32* indexCounts, const u32* baseVertices
+);
 typedef void (*SetWireframeEnabledFN)( bool enabled );
 
 // NOTE(alicia): Vertex Array
@@ -190,6 +225,7 @@ typedef void (*VertexArrayBindIndexBufferFN)( VertexArray* vertexArray, IndexBuf
 typedef VertexBuffer (*CreateVertexBufferFN)( usize bufferSize, void* vertices, VertexBufferLayout layout );
 typedef void (*UseVertexBufferFN)( VertexBuffer* buffer );
 typedef void (*DeleteVertexBuffersFN)( usize count, VertexBuffer* buffers );
+typedef void (*VertexBufferSubDataFN)( VertexBuffer* buffer, usize offset, usize size, void* data );
 
 // NOTE(alicia): Index Buffer
 typedef IndexBuffer (*CreateIndexBufferFN)( usize indexCount, void* indices, DataType indexDataType );
@@ -231,7 +267,18 @@ typedef Texture2D (*CreateTexture2DFN)(
     TextureWrapMode wrapX,
     TextureWrapMode wrapY,
     TextureMinFilter minFilter,
-    TextureMagFilter magFilter
+    TextureMagFilter magFilter,
+    const TextureMipChain* mips
+);
+typedef Texture2D (*CreateCompressedTexture2DFN)(
+    i32 width,
+    i32 height,
+    TextureFormat format,
+    TextureWrapMode wrapX,
+    TextureWrapMode wrapY,
+    TextureMinFilter minFilter,
+    TextureMagFilter magFilter,
+    const TextureMipChain* levels
 );
 typedef void (*DeleteTextures2DFN)( usize textureCount, Texture2D* textures );
 typedef void (*UseTexture2DFN)( Texture2D* texture, u32 unit );
@@ -278,6 +325,21 @@ struct RendererAPI {
     /// If vertex array has an index buffer, draw indexed triangles, else draw contiguous vertices.
     /// @param vertexArray [VertexArray*] vertex array to draw
     DrawVertexArrayFN DrawVertexArray;
+    /// @brief Draw range of indexed vertex array.
+    /// Vertex array must have an index buffer.
+    /// @param vertexArray [VertexArray*] vertex array to draw
+    /// @param firstIndex [usize] first index of range
+    /// @param indexCount [usize] number of indices in range
+    /// @param baseVertex [u32] added to every index in range
+    DrawVertexArrayRangeFN DrawVertexArrayRange;
+    /// @brief Draw many ranges of indexed vertex array with a single call.
+    /// Vertex array must have an index buffer.
+    /// @param vertexArray [VertexArray*] vertex array to draw
+    /// @param rangeCount [usize] number of ranges
+    /// @param firstIndices [const u32*] first index of every range
+    /// @param indexCounts [const u32*] number of indices in every range
+    /// @param baseVertices [const u32*] added to every index of range
+    DrawVertexArrayRangesFN DrawVertexArrayRanges;
     /// @brief Set wireframe mode enabled or disabled
     SetWireframeEnabledFN SetWireframeEnabled;
 
@@ -308,6 +370,12 @@ struct RendererAPI {
     /// @param count [usize] number of vertex buffers to delete
     /// @param vertexArrays [VertexBuffer*] vertex buffers
     DeleteVertexBuffersFN DeleteVertexBuffers;
+    /// @brief Replace part of a vertex buffer's data, draws issued before keep the old data
+    /// @param buffer [VertexBuffer*] vertex buffer
+    /// @param offset [usize] offset into buffer in bytes
+    /// @param size [usize] size of data in bytes, offset + size must not be greater than buffer size
+    /// @param data [void*] new data
+    VertexBufferSubDataFN VertexBufferSubData;
     /// @brief Create new index buffer
     /// @param indexCount [usize] number of indices in buffer
     /// @param indices [void*] indices
@@ -430,8 +498,20 @@ struct RendererAPI {
     /// @param wrapY [TextureWrapMode] wrap mode on y-axis
     /// @param minFilter [TextureMinFilter] minification filtering
     /// @param magFilter [TextureMinFilter] magnification filtering
+    /// @param mips [const TextureMipChain*] precomputed levels after data, nullptr to generate them on the GPU
     /// @return [Texture2D] texture 2D
     CreateTexture2DFN CreateTexture2D;
+    /// @brief Create texture 2D from block compressed levels, data isn't kept on the CPU
+    /// @param width [i32] texture width
+    /// @param height [i32] texture height
+    /// @param format [TextureFormat] block compressed format
+    /// @param wrapX [TextureWrapMode] wrap mode on x-axis
+    /// @param wrapY [TextureWrapMode] wrap mode on y-axis
+    /// @param minFilter [TextureMinFilter] minification filtering
+    /// @param magFilter [TextureMinFilter] magnification filtering
+    /// @param levels [const TextureMipChain*] blocks of every level, starting with base level
+    /// @return [Texture2D] texture 2D
+    CreateCompressedTexture2DFN CreateCompressedTexture2D;
     /// @brief Delete textures
     /// @param textureCount [usize] number of textures to delete
     /// @param textures [Texture2D*] textures to delete
@@ -460,5 +540,29 @@ typedef void* (*OpenGLLoadProc)(const char* functionName);
 /// @return true if successful
 bool CreateOpenGLAPI( RendererAPI* api, OpenGLLoadProc loadProc );
 
+/// @brief Create software API, triangles are rasterized on the CPU into a framebuffer in memory.
+/// SwapBuffers finishes pending draws, platform layer can replace it to present the framebuffer
+/// @param api pointer to structure to hold functions
+/// @param threadCount number of threads that rasterize, including calling thread, 0 for one per logical processor
+/// @return true if successful
+bool CreateSoftwareAPI( RendererAPI* api, u32 threadCount );
+/// @brief Stop software API threads and free its framebuffer and resources
+void DestroySoftwareAPI();
+
+/// @brief Framebuffer of software API, rows go from bottom to top like OpenGL
+struct SoftwareFramebuffer {
+    i32 width;
+    i32 height;
+    /// @brief Number of pixels from the start of a row to the start of the next
+    i32 stride;
+    /// @brief RGBA8 pixels, red in the lowest byte
+    const u32* color;
+    const f32* depth;
+};
+/// @brief Finish pending draws of software API and get its framebuffer
+/// @param result [out] framebuffer, valid until next draw or SetViewport
+/// @return false if software API wasn't created or viewport is empty
+bool SoftwareReadFramebuffer( SoftwareFramebuffer* result );
+
 } // namespace Platform
 
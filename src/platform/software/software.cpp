@@ -0,0 +1,2330 @@
+/**
+ * Description:  Software renderer
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "software.hpp"
+#include "swshader.hpp"
+#include "platform/renderer.hpp"
+#include "platform/io.hpp"
+#include "platform/threading.hpp"
+#include "core/bcn.hpp"
+#include "util.hpp"
+
+using namespace Platform;
+
+// NOTE(alicia): draws are shaded and binned into tiles as soon as they are recorded,
+// tiles are rasterized in parallel when the frame is flushed by SwapBuffers,
+// ClearBuffer or anything that changes resources pending draws read
+
+/// @brief Framebuffer is rasterized in square tiles of this many pixels, a multiple of 4
+#define SOFTWARE_TILE_SIZE 64
+/// @brief Screen positions are 28.4 fixed point
+#define SOFTWARE_SUBPIXEL_BITS 4
+#define SOFTWARE_SUBPIXEL_SCALE ( 1 << SOFTWARE_SUBPIXEL_BITS )
+/// @brief Triangles are only clipped on x and y when they reach this many pixels past the viewport
+#define SOFTWARE_GUARD_BAND 2048.0f
+/// @brief Largest viewport, keeps edge functions inside a tile within 32 bits
+#define SOFTWARE_MAX_VIEWPORT 8192
+#define SOFTWARE_MAX_THREADS 64
+/// @brief Smallest number of vertices or triangles worth processing on their own job
+#define SOFTWARE_MIN_JOB_VERTICES 1024
+#define SOFTWARE_MIN_JOB_TRIANGLES 1024
+#define SOFTWARE_MAX_JOBS 64
+/// @brief Initial size of memory draws are recorded into, it grows to fit the largest frame
+#define SOFTWARE_ARENA_SIZE MEGABYTES(4)
+/// @brief Vertex of triangle is in batch clipped vertices rather than draw vertices
+#define SOFTWARE_CLIPPED_VERTEX 0x80000000u
+/// @brief Sutherland-Hodgman adds at most one vertex per clip plane
+#define SOFTWARE_MAX_CLIP_VERTICES 12
+
+typedef void (*SWJobFN)( void* params, u32 index );
+
+/// @brief Worker threads that share parallel loops with the calling thread
+struct SWPool {
+    Thread threads[SOFTWARE_MAX_THREADS];
+    u32 workerCount;
+    Semaphore wake;
+    Semaphore done;
+    volatile i32 running;
+
+    SWJobFN job;
+    void* params;
+    volatile i32 next;
+    i32 count;
+};
+
+struct SWArenaOverflow {
+    SWArenaOverflow* next;
+    usize size;
+};
+/// @brief Linear memory of a frame, overflow allocations are merged into it on reset
+struct SWArena {
+    u8* base;
+    usize size;
+    usize used;
+    SWArenaOverflow* overflow;
+    usize overflowSize;
+};
+
+struct SWBuffer {
+    u8* data;
+    usize size;
+    /// @brief Incremented every time data changes
+    u32 version;
+};
+
+struct SWShader {
+    const SoftwareShaderPort* port;
+    alignas(16) u8 uniforms[SOFTWARE_MAX_UNIFORM_BYTES];
+};
+
+struct SWBinding {
+    u32 buffer;
+    usize offset;
+    usize size;
+    /// @brief Copy of range recorded this frame and version of buffer it was copied from
+    const u8* copy;
+    u32 version;
+};
+
+/// @brief Resources by id, id is index + 1, deleted ids are never reused
+struct SWTable {
+    void** items;
+    u32 count;
+    u32 capacity;
+};
+
+struct SWAttribute {
+    const u8* data;
+    usize stride;
+    usize vertexCount;
+    VertexBufferElement element;
+};
+
+struct SWRange {
+    u32 firstIndex;
+    u32 indexCount;
+    u32 baseVertex;
+    u32 firstTriangle;
+};
+
+struct SWDraw {
+    SoftwareDrawState state;
+    bool wireframe;
+    bool blending;
+    BlendFactor blendFactors[4];
+    BlendEq blendEqs[2];
+
+    u32 attributeCount;
+    SWAttribute attributes[SOFTWARE_MAX_ATTRIBUTES];
+    /// @brief nullptr if draw isn't indexed, then firstIndex of ranges is their first vertex
+    const u8* indices;
+    DataType indexType;
+    u32 rangeCount;
+    const SWRange* ranges;
+    u32 triangleCount;
+
+    /// @brief Shaded vertices, clip space position followed by varyings
+    u32 vertexMin;
+    u32 vertexCount;
+    u32 vertexFloats;
+    f32* vertices;
+};
+
+struct SWTriangle {
+    /// @brief 28.4 fixed point window position
+    i32 x[3];
+    i32 y[3];
+    /// @brief Pixel bounds, inclusive, inside viewport
+    i32 minX, minY, maxX, maxY;
+    f32 z[3];
+    /// @brief 1 / w of every vertex
+    f32 q[3];
+    /// @brief Change of barycentric weights of vertex 1 and 2 from one pixel to the next
+    f32 weight1DX, weight1DY;
+    f32 weight2DX, weight2DY;
+    /// @brief Twice the area in sub-pixels
+    f32 area;
+    u32 vertices[3];
+};
+
+/// @brief Triangles of a contiguous range of a draw and the tiles they touch
+struct SWBatch {
+    u32 drawIndex;
+
+    SWTriangle* triangles;
+    u32 triangleCount;
+    u32 triangleCapacity;
+
+    /// @brief Vertices created by clipping
+    f32* vertices;
+    u32 vertexCount;
+    u32 vertexCapacity;
+
+    /// @brief Triangles of tile t are refs[tileOffsets[t]..tileOffsets[t + 1]]
+    u32* refs;
+    u32 refCapacity;
+    u32* tileOffsets;
+    u32* tileCursors;
+    u32 tileCapacity;
+    /// @brief Tiles batch touches, inclusive
+    i32 tileMinX, tileMinY, tileMaxX, tileMaxY;
+};
+
+struct SWState {
+    bool created;
+    SWPool pool;
+    SWArena arena;
+
+    // NOTE(alicia): framebuffer
+    i32 width;
+    i32 height;
+    i32 stride;
+    u32* color;
+    f32* depth;
+    i32 tilesX;
+    i32 tilesY;
+    u32 clearColor;
+    bool clearPending;
+
+    // NOTE(alicia): pipeline state
+    bool blending;
+    bool wireframe;
+    BlendFactor blendFactors[4];
+    BlendEq blendEqs[2];
+    i32 packAlignment;
+    i32 unpackAlignment;
+    SWShader* shader;
+    SoftwareTexture* textureUnits[SOFTWARE_TEXTURE_UNITS];
+    SWBinding bindings[SOFTWARE_UNIFORM_BINDINGS];
+
+    // NOTE(alicia): resources, vertex, index and uniform buffers share ids like GL buffers
+    SWTable buffers;
+    SWTable shaders;
+    SWTable textures;
+    u32 vertexArrayCount;
+
+    // NOTE(alicia): pending frame
+    SWDraw* draws;
+    u32 drawCount;
+    u32 drawCapacity;
+    SWBatch* batches;
+    u32 batchCount;
+    u32 batchCapacity;
+};
+static SWState SOFTWARE_STATE = {};
+
+// NOTE(alicia): memory ------------------------------------------------------------------------
+
+/// @return memory, nullptr if overflow allocation failed and size isn't 0
+static void* SWArenaPush( SWArena* arena, usize size ) {
+    size = ( size + 15 ) & ~(usize)15;
+    if( arena->used + size <= arena->size ) {
+        void* result = arena->base + arena->used;
+        arena->used += size;
+        return result;
+    }
+    // NOTE(alicia): header is 16 bytes so allocation stays 16 byte aligned
+    SWArenaOverflow* overflow = (SWArenaOverflow*)Platform::Alloc( 16 + size );
+    if( !overflow ) {
+        return nullptr;
+    }
+    overflow->next = arena->overflow;
+    overflow->size = size;
+    arena->overflow = overflow;
+    arena->overflowSize += size;
+    return (u8*)overflow + 16;
+}
+
+static void SWArenaReset( SWArena* arena ) {
+    if( arena->overflow ) {
+        while( arena->overflow ) {
+            SWArenaOverflow* next = arena->overflow->next;
+            Platform::Free( arena->overflow );
+            arena->overflow = next;
+        }
+        // NOTE(alicia): old base is kept if it can't grow, overflow is allocated again next frame
+        u8* base = (u8*)Platform::Alloc( arena->size + arena->overflowSize );
+        if( base ) {
+            if( arena->base ) {
+                Platform::Free( arena->base );
+            }
+            arena->base  = base;
+            arena->size += arena->overflowSize;
+        }
+        arena->overflowSize = 0;
+    }
+    arena->used = 0;
+}
+
+static void SWArenaFree( SWArena* arena ) {
+    SWArenaReset( arena );
+    if( arena->base ) {
+        Platform::Free( arena->base );
+    }
+    *arena = {};
+}
+
+/// @return id of item, 0 if allocation failed
+static u32 SWTableAdd( SWTable* table, void* item ) {
+    if( !growArray( (void**)&table->items, sizeof(void*), &table->capacity, table->count + 1 ) ) {
+        LOG_ERROR( "Software > Failed to allocate object table!" );
+        return 0;
+    }
+    table->items[table->count++] = item;
+    return table->count;
+}
+
+static void* SWTableGet( const SWTable* table, u32 id ) {
+    if( id == 0 || id > table->count ) {
+        return nullptr;
+    }
+    return table->items[id - 1];
+}
+
+/// @brief Remove item from table
+/// @return removed item, nullptr if id wasn't valid
+static void* SWTableRemove( SWTable* table, u32 id ) {
+    void* result = SWTableGet( table, id );
+    if( result ) {
+        table->items[id - 1] = nullptr;
+    }
+    return result;
+}
+
+// NOTE(alicia): threads -----------------------------------------------------------------------
+
+static void SWRunJobs( SWPool* pool ) {
+    for( ;; ) {
+        i32 index = Platform::AtomicIncrement( &pool->next ) - 1;
+        if( index >= pool->count ) {
+            break;
+        }
+        pool->job( pool->params, (u32)index );
+    }
+}
+
+static void SWWorkerProc( void* params ) {
+    SWPool* pool = (SWPool*)params;
+    for( ;; ) {
+        Platform::SemaphoreWait( &pool->wake );
+        if( !pool->running ) {
+            break;
+        }
+        SWRunJobs( pool );
+        Platform::SemaphoreSignal( &pool->done, 1 );
+    }
+}
+
+/// @brief Run job for every index on calling thread and worker threads.
+/// Jobs are claimed one at a time from a shared counter so
+/// threads that finish early keep taking work from slower ones
+static void SWParallelFor( u32 count, SWJobFN job, void* params ) {
+    SWPool* pool = &SOFTWARE_STATE.pool;
+    if( count <= 1 || pool->workerCount == 0 ) {
+        ucycles( count ) {
+            job( params, (u32)i );
+        }
+        return;
+    }
+    pool->job    = job;
+    pool->params = params;
+    pool->count  = (i32)count;
+    pool->next   = 0;
+    u32 wakeCount = count - 1 < pool->workerCount ? count - 1 : pool->workerCount;
+    Platform::SemaphoreSignal( &pool->wake, wakeCount );
+    SWRunJobs( pool );
+    ucycles( wakeCount ) {
+        Platform::SemaphoreWait( &pool->done );
+    }
+}
+
+/// @brief Split count items into chunks of at least minimum items
+static u32 SWChunkCount( u32 count, u32 minimum ) {
+    u32 result = ( count + minimum - 1 ) / minimum;
+    if( result > SOFTWARE_MAX_JOBS ) {
+        result = SOFTWARE_MAX_JOBS;
+    }
+    return result ? result : 1;
+}
+
+// NOTE(alicia): texture sampling --------------------------------------------------------------
+
+static inline void SWUnpackTexel( u32 texel, f32* result ) {
+    const f32 scale = 1.0f / 255.0f;
+    result[0] = (f32)( texel & 0xFF ) * scale;
+    result[1] = (f32)( ( texel >> 8 ) & 0xFF ) * scale;
+    result[2] = (f32)( ( texel >> 16 ) & 0xFF ) * scale;
+    result[3] = (f32)( texel >> 24 ) * scale;
+}
+
+static inline i32 SWWrap( i32 coord, i32 size, TextureWrapMode mode ) {
+    switch( mode ) {
+        case TextureWrapMode::REPEAT: {
+            i32 result = coord % size;
+            return result < 0 ? result + size : result;
+        }
+        case TextureWrapMode::MIRROR_REPEAT: {
+            i32 period = size * 2;
+            i32 result = coord % period;
+            result = result < 0 ? result + period : result;
+            return result < size ? result : period - 1 - result;
+        }
+        case TextureWrapMode::MIRROR_CLAMP: {
+            coord = coord < 0 ? -1 - coord : coord;
+            return coord < size ? coord : size - 1;
+        }
+        default: {
+            return coord < 0 ? 0 : ( coord < size ? coord : size - 1 );
+        }
+    }
+}
+
+static void SWSampleLevel( const SoftwareTexture* texture, u32 level, f32 u, f32 v, bool linear, f32* result ) {
+    i32 width  = texture->width  >> level;
+    i32 height = texture->height >> level;
+    width  = width  > 0 ? width  : 1;
+    height = height > 0 ? height : 1;
+    const u32* texels = texture->levels[level];
+
+    if( !linear ) {
+        i32 x = SWWrap( (i32)__builtin_floorf( u * (f32)width ),  width,  texture->wrapX );
+        i32 y = SWWrap( (i32)__builtin_floorf( v * (f32)height ), height, texture->wrapY );
+        SWUnpackTexel( texels[y * width + x], result );
+        return;
+    }
+
+    f32 fx = u * (f32)width  - 0.5f;
+    f32 fy = v * (f32)height - 0.5f;
+    f32 floorX = __builtin_floorf( fx );
+    f32 floorY = __builtin_floorf( fy );
+    f32 ax = fx - floorX;
+    f32 ay = fy - floorY;
+    i32 x0 = SWWrap( (i32)floorX,     width,  texture->wrapX );
+    i32 x1 = SWWrap( (i32)floorX + 1, width,  texture->wrapX );
+    i32 y0 = SWWrap( (i32)floorY,     height, texture->wrapY );
+    i32 y1 = SWWrap( (i32)floorY + 1, height, texture->wrapY );
+    f32 t00[4], t10[4], t01[4], t11[4];
+    SWUnpackTexel( texels[y0 * width + x0], t00 );
+    SWUnpackTexel( texels[y0 * width + x1], t10 );
+    SWUnpackTexel( texels[y1 * width + x0], t01 );
+    SWUnpackTexel( texels[y1 * width + x1], t11 );
+    ucycles( 4 ) {
+        f32 bottom = t00[i] + ( t10[i] - t00[i] ) * ax;
+        f32 top    = t01[i] + ( t11[i] - t01[i] ) * ax;
+        result[i]  = bottom + ( top - bottom ) * ay;
+    }
+}
+
+void Platform::SoftwareSample(
+    const SoftwareTexture* texture,
+    __m128 u, __m128 v,
+    __m128 dudx, __m128 dvdx, __m128 dudy, __m128 dvdy,
+    __m128 result[4]
+) {
+    if( !texture || texture->levelCount == 0 ) {
+        result[0] = _mm_setzero_ps();
+        result[1] = _mm_setzero_ps();
+        result[2] = _mm_setzero_ps();
+        result[3] = _mm_set1_ps( 1.0f );
+        return;
+    }
+
+    // NOTE(alicia): SSE, squared footprint of a pixel in texels
+    __m128 width  = _mm_set1_ps( (f32)texture->width );
+    __m128 height = _mm_set1_ps( (f32)texture->height );
+    __m128 ux = _mm_mul_ps( dudx, width );
+    __m128 vx = _mm_mul_ps( dvdx, height );
+    __m128 uy = _mm_mul_ps( dudy, width );
+    __m128 vy = _mm_mul_ps( dvdy, height );
+    __m128 footprint = _mm_max_ps(
+        _mm_add_ps( _mm_mul_ps( ux, ux ), _mm_mul_ps( vx, vx ) ),
+        _mm_add_ps( _mm_mul_ps( uy, uy ), _mm_mul_ps( vy, vy ) )
+    );
+
+    alignas(16) f32 us[4];
+    alignas(16) f32 vs[4];
+    alignas(16) f32 footprints[4];
+    alignas(16) f32 lanes[4][4];
+    _mm_store_ps( us, u );
+    _mm_store_ps( vs, v );
+    _mm_store_ps( footprints, footprint );
+
+    f32 maxLevel = (f32)( texture->levelCount - 1 );
+    ucycles( 4 ) {
+        // NOTE(alicia): lanes outside of triangle can have wild coordinates
+        f32 laneU = us[i] > -1000000.0f && us[i] < 1000000.0f ? us[i] : 0.0f;
+        f32 laneV = vs[i] > -1000000.0f && vs[i] < 1000000.0f ? vs[i] : 0.0f;
+        f32 lod = footprints[i] > 0.0f && footprints[i] < 1e30f ?
+            0.5f * __builtin_log2f( footprints[i] ) : 0.0f;
+
+        f32* texel = lanes[i];
+        if( lod <= 0.0f ) {
+            SWSampleLevel( texture, 0, laneU, laneV, texture->magFilter == TextureMagFilter::LINEAR, texel );
+            continue;
+        }
+        lod = lod < maxLevel ? lod : maxLevel;
+        switch( texture->minFilter ) {
+            case TextureMinFilter::NEAREST: {
+                SWSampleLevel( texture, 0, laneU, laneV, false, texel );
+            } break;
+            case TextureMinFilter::LINEAR: {
+                SWSampleLevel( texture, 0, laneU, laneV, true, texel );
+            } break;
+            case TextureMinFilter::NEAREST_MIPMAP_NEAREST:
+            case TextureMinFilter::LINEAR_MIPMAP_NEAREST: {
+                SWSampleLevel( texture, (u32)( lod + 0.5f ), laneU, laneV,
+                    texture->minFilter == TextureMinFilter::LINEAR_MIPMAP_NEAREST, texel );
+            } break;
+            case TextureMinFilter::NEAREST_MIPMAP_LINEAR:
+            case TextureMinFilter::LINEAR_MIPMAP_LINEAR: {
+                bool linear = texture->minFilter == TextureMinFilter::LINEAR_MIPMAP_LINEAR;
+                u32 level = (u32)lod;
+                f32 blend = lod - (f32)level;
+                SWSampleLevel( texture, level, laneU, laneV, linear, texel );
+                if( blend > 0.0f && level + 1 < texture->levelCount ) {
+                    f32 next[4];
+                    SWSampleLevel( texture, level + 1, laneU, laneV, linear, next );
+                    ucyclesi( 4, c ) {
+                        texel[c] += ( next[c] - texel[c] ) * blend;
+                    }
+                }
+            } break;
+        }
+    }
+    result[0] = _mm_setr_ps( lanes[0][0], lanes[1][0], lanes[2][0], lanes[3][0] );
+    result[1] = _mm_setr_ps( lanes[0][1], lanes[1][1], lanes[2][1], lanes[3][1] );
+    result[2] = _mm_setr_ps( lanes[0][2], lanes[1][2], lanes[2][2], lanes[3][2] );
+    result[3] = _mm_setr_ps( lanes[0][3], lanes[1][3], lanes[2][3], lanes[3][3] );
+}
+
+// NOTE(alicia): vertex stage ------------------------------------------------------------------
+
+static f32 SWHalfToFloat( u16 half ) {
+    u32 sign     = (u32)( half & 0x8000 ) << 16;
+    u32 exponent = ( half >> 10 ) & 0x1F;
+    u32 mantissa = half & 0x3FF;
+    u32 bits;
+    if( exponent == 0 ) {
+        if( mantissa == 0 ) {
+            bits = sign;
+        } else {
+            // NOTE(alicia): subnormal, renormalize
+            exponent = 127 - 15 + 1;
+            while( !( mantissa & 0x400 ) ) {
+                mantissa <<= 1;
+                exponent--;
+            }
+            mantissa &= 0x3FF;
+            bits = sign | ( exponent << 23 ) | ( mantissa << 13 );
+        }
+    } else if( exponent == 0x1F ) {
+        bits = sign | 0x7F800000 | ( mantissa << 13 );
+    } else {
+        bits = sign | ( ( exponent + 127 - 15 ) << 23 ) | ( mantissa << 13 );
+    }
+    f32 result;
+    Platform::MemCopy( sizeof(f32), &bits, &result );
+    return result;
+}
+
+/// @brief Read attribute of vertex the way glVertexAttribPointer describes it
+static void SWFetchAttribute( const SWAttribute* attribute, u32 vertex, f32* result ) {
+    result[0] = 0.0f;
+    result[1] = 0.0f;
+    result[2] = 0.0f;
+    result[3] = 1.0f;
+    if( vertex >= attribute->vertexCount ) {
+        return;
+    }
+    const u8* src = attribute->data + (usize)vertex * attribute->stride;
+    bool normalized = attribute->element.normalized;
+    usize count = DataStructureCount( attribute->element.structure );
+    count = count < 4 ? count : 4;
+
+    switch( attribute->element.dataType ) {
+        case DataType::INT_2_10_10_10_REV: {
+            u32 packed;
+            Platform::MemCopy( sizeof(u32), src, &packed );
+            ucycles( 4 ) {
+                u32 bits  = i < 3 ? 10 : 2;
+                i32 value = (i32)( packed << ( 32 - bits - i * 10 ) ) >> ( 32 - bits );
+                f32 maxValue = (f32)( ( 1 << ( bits - 1 ) ) - 1 );
+                result[i] = normalized ? smath::clamp( (f32)value / maxValue, -1.0f, 1.0f ) : (f32)value;
+            }
+        } return;
+        case DataType::UNSIGNED_INT_2_10_10_10_REV: {
+            u32 packed;
+            Platform::MemCopy( sizeof(u32), src, &packed );
+            ucycles( 4 ) {
+                u32 bits  = i < 3 ? 10 : 2;
+                u32 value = ( packed >> ( i * 10 ) ) & ( ( 1u << bits ) - 1 );
+                result[i] = normalized ? (f32)value / (f32)( ( 1u << bits ) - 1 ) : (f32)value;
+            }
+        } return;
+        default: break;
+    }
+
+    ucycles( count ) {
+        switch( attribute->element.dataType ) {
+            case DataType::FLOAT: {
+                Platform::MemCopy( sizeof(f32), src + i * sizeof(f32), &result[i] );
+            } break;
+            case DataType::HALF_FLOAT: {
+                u16 half;
+                Platform::MemCopy( sizeof(u16), src + i * sizeof(u16), &half );
+                result[i] = SWHalfToFloat( half );
+            } break;
+            case DataType::DOUBLE: {
+                f64 value;
+                Platform::MemCopy( sizeof(f64), src + i * sizeof(f64), &value );
+                result[i] = (f32)value;
+            } break;
+            case DataType::UNSIGNED_BYTE: {
+                u8 value = src[i];
+                result[i] = normalized ? (f32)value / 255.0f : (f32)value;
+            } break;
+            case DataType::BYTE: {
+                i8 value = (i8)src[i];
+                result[i] = normalized ? smath::clamp( (f32)value / 127.0f, -1.0f, 1.0f ) : (f32)value;
+            } break;
+            case DataType::UNSIGNED_SHORT: {
+                u16 value;
+                Platform::MemCopy( sizeof(u16), src + i * sizeof(u16), &value );
+                result[i] = normalized ? (f32)value / 65535.0f : (f32)value;
+            } break;
+            case DataType::SHORT: {
+                i16 value;
+                Platform::MemCopy( sizeof(i16), src + i * sizeof(i16), &value );
+                result[i] = normalized ? smath::clamp( (f32)value / 32767.0f, -1.0f, 1.0f ) : (f32)value;
+            } break;
+            case DataType::UNSIGNED_INT: {
+                u32 value;
+                Platform::MemCopy( sizeof(u32), src + i * sizeof(u32), &value );
+                result[i] = normalized ? (f32)( (f64)value / 4294967295.0 ) : (f32)value;
+            } break;
+            case DataType::INT: {
+                i32 value;
+                Platform::MemCopy( sizeof(i32), src + i * sizeof(i32), &value );
+                result[i] = normalized ? (f32)smath::clamp( (f64)value / 2147483647.0, -1.0, 1.0 ) : (f32)value;
+            } break;
+            default: break;
+        }
+    }
+}
+
+static inline u32 SWFetchIndex( const SWDraw* draw, usize index ) {
+    switch( draw->indexType ) {
+        case DataType::UNSIGNED_BYTE: {
+            return draw->indices[index];
+        }
+        case DataType::UNSIGNED_SHORT: {
+            u16 value;
+            Platform::MemCopy( sizeof(u16), draw->indices + index * sizeof(u16), &value );
+            return value;
+        }
+        default: {
+            u32 value;
+            Platform::MemCopy( sizeof(u32), draw->indices + index * sizeof(u32), &value );
+            return value;
+        }
+    }
+}
+
+/// @brief Vertex of draw that triangle uses as its corner
+static inline u32 SWTriangleVertex( const SWDraw* draw, const SWRange* range, u32 triangle, u32 corner ) {
+    usize index = (usize)range->firstIndex + (usize)( triangle - range->firstTriangle ) * 3 + corner;
+    if( !draw->indices ) {
+        return (u32)index;
+    }
+    return SWFetchIndex( draw, index ) + range->baseVertex;
+}
+
+/// @brief Range of draw that contains triangle
+static const SWRange* SWFindRange( const SWDraw* draw, u32 triangle ) {
+    u32 low  = 0;
+    u32 high = draw->rangeCount - 1;
+    while( low < high ) {
+        u32 middle = ( low + high + 1 ) / 2;
+        if( draw->ranges[middle].firstTriangle <= triangle ) {
+            low = middle;
+        } else {
+            high = middle - 1;
+        }
+    }
+    return &draw->ranges[low];
+}
+
+struct SWDrawJob {
+    SWDraw* draw;
+    u32 batchStart;
+    u32 trianglesPerChunk;
+    u32 verticesPerChunk;
+    u32 vertexMins[SOFTWARE_MAX_JOBS];
+    u32 vertexMaxs[SOFTWARE_MAX_JOBS];
+};
+
+static void SWVertexBoundsJob( void* params, u32 chunk ) {
+    SWDrawJob* job = (SWDrawJob*)params;
+    const SWDraw* draw = job->draw;
+    u32 first = chunk * job->trianglesPerChunk;
+    u32 last  = first + job->trianglesPerChunk;
+    last = last < draw->triangleCount ? last : draw->triangleCount;
+
+    u32 vertexMin = 0xFFFFFFFF;
+    u32 vertexMax = 0;
+    const SWRange* range = SWFindRange( draw, first );
+    for( u32 triangle = first; triangle < last; ++triangle ) {
+        while( triangle >= range->firstTriangle + range->indexCount / 3 ) {
+            range++;
+        }
+        ucycles( 3 ) {
+            u32 vertex = SWTriangleVertex( draw, range, triangle, (u32)i );
+            vertexMin = vertex < vertexMin ? vertex : vertexMin;
+            vertexMax = vertex > vertexMax ? vertex : vertexMax;
+        }
+    }
+    job->vertexMins[chunk] = vertexMin;
+    job->vertexMaxs[chunk] = vertexMax;
+}
+
+static void SWVertexJob( void* params, u32 chunk ) {
+    SWDrawJob* job = (SWDrawJob*)params;
+    const SWDraw* draw = job->draw;
+    u32 first = chunk * job->verticesPerChunk;
+    u32 last  = first + job->verticesPerChunk;
+    last = last < draw->vertexCount ? last : draw->vertexCount;
+
+    f32 attributes[SOFTWARE_MAX_ATTRIBUTES][4] = {};
+    for( u32 vertex = first; vertex < last; ++vertex ) {
+        ucycles( SOFTWARE_MAX_ATTRIBUTES ) {
+            if( i < draw->attributeCount ) {
+                SWFetchAttribute( &draw->attributes[i], draw->vertexMin + vertex, attributes[i] );
+            } else {
+                attributes[i][0] = attributes[i][1] = attributes[i][2] = 0.0f;
+                attributes[i][3] = 1.0f;
+            }
+        }
+        draw->state.port->vertex(
+            &draw->state, attributes, draw->vertices + (usize)vertex * draw->vertexFloats );
+    }
+}
+
+// NOTE(alicia): triangle setup ----------------------------------------------------------------
+
+#define SW_OUT_LEFT         ( 1 << 0 )
+#define SW_OUT_RIGHT        ( 1 << 1 )
+#define SW_OUT_BOTTOM       ( 1 << 2 )
+#define SW_OUT_TOP          ( 1 << 3 )
+#define SW_OUT_NEAR         ( 1 << 4 )
+#define SW_OUT_FAR          ( 1 << 5 )
+#define SW_OUT_GUARD_LEFT   ( 1 << 6 )
+#define SW_OUT_GUARD_RIGHT  ( 1 << 7 )
+#define SW_OUT_GUARD_BOTTOM ( 1 << 8 )
+#define SW_OUT_GUARD_TOP    ( 1 << 9 )
+/// @brief Triangle is rejected when every vertex is outside one of these
+#define SW_OUT_REJECT ( SW_OUT_LEFT | SW_OUT_RIGHT | SW_OUT_BOTTOM | SW_OUT_TOP | SW_OUT_NEAR | SW_OUT_FAR )
+/// @brief Triangle is clipped when a vertex is outside one of these
+#define SW_OUT_CLIP ( SW_OUT_NEAR | SW_OUT_FAR | SW_OUT_GUARD_LEFT | SW_OUT_GUARD_RIGHT | SW_OUT_GUARD_BOTTOM | SW_OUT_GUARD_TOP )
+#define SW_CLIP_PLANE_COUNT 6
+
+struct SWSetupContext {
+    SWState* sw;
+    const SWDraw* draw;
+    SWBatch* batch;
+    /// @brief Guard band in clip space units of w
+    f32 guardX;
+    f32 guardY;
+};
+
+static inline u32 SWOutcode( const SWSetupContext* ctx, const f32* position ) {
+    f32 x = position[0];
+    f32 y = position[1];
+    f32 z = position[2];
+    f32 w = position[3];
+    u32 result = 0;
+    result |= x < -w ? SW_OUT_LEFT   : 0;
+    result |= x >  w ? SW_OUT_RIGHT  : 0;
+    result |= y < -w ? SW_OUT_BOTTOM : 0;
+    result |= y >  w ? SW_OUT_TOP    : 0;
+    result |= z < -w ? SW_OUT_NEAR   : 0;
+    result |= z >  w ? SW_OUT_FAR    : 0;
+    result |= x < -ctx->guardX * w ? SW_OUT_GUARD_LEFT   : 0;
+    result |= x >  ctx->guardX * w ? SW_OUT_GUARD_RIGHT  : 0;
+    result |= y < -ctx->guardY * w ? SW_OUT_GUARD_BOTTOM : 0;
+    result |= y >  ctx->guardY * w ? SW_OUT_GUARD_TOP    : 0;
+    return result;
+}
+
+/// @brief Distance of position to clip plane, inside when positive
+static inline f32 SWClipDistance( const SWSetupContext* ctx, u32 plane, const f32* position ) {
+    switch( plane ) {
+        case 0:  return position[2] + position[3];
+        case 1:  return position[3] - position[2];
+        case 2:  return position[0] + ctx->guardX * position[3];
+        case 3:  return ctx->guardX * position[3] - position[0];
+        case 4:  return position[1] + ctx->guardY * position[3];
+        default: return ctx->guardY * position[3] - position[1];
+    }
+}
+
+static void SWEmitTriangle( const SWSetupContext* ctx, const f32* positions[3], const u32 vertices[3] ) {
+    SWState* sw = ctx->sw;
+    SWTriangle triangle;
+    f32 halfWidth  = (f32)sw->width  * 0.5f;
+    f32 halfHeight = (f32)sw->height * 0.5f;
+    ucycles( 3 ) {
+        f32 q = 1.0f / positions[i][3];
+        f32 x = ( positions[i][0] * q + 1.0f ) * halfWidth;
+        f32 y = ( positions[i][1] * q + 1.0f ) * halfHeight;
+        triangle.x[i] = (i32)__builtin_floorf( x * (f32)SOFTWARE_SUBPIXEL_SCALE + 0.5f );
+        triangle.y[i] = (i32)__builtin_floorf( y * (f32)SOFTWARE_SUBPIXEL_SCALE + 0.5f );
+        triangle.z[i] = positions[i][2] * q * 0.5f + 0.5f;
+        triangle.q[i] = q;
+        triangle.vertices[i] = vertices[i];
+    }
+
+    // NOTE(alicia): back faces and degenerate triangles are culled,
+    // front faces are counter-clockwise like glEnable( GL_CULL_FACE )
+    i64 area =
+        (i64)( triangle.x[1] - triangle.x[0] ) * (i64)( triangle.y[2] - triangle.y[0] ) -
+        (i64)( triangle.x[2] - triangle.x[0] ) * (i64)( triangle.y[1] - triangle.y[0] );
+    if( area <= 0 ) {
+        return;
+    }
+
+    // pixels whose centers fall inside bounds, wireframe lines reach half a pixel past them
+    i32 minX = triangle.x[0], maxX = triangle.x[0];
+    i32 minY = triangle.y[0], maxY = triangle.y[0];
+    for( u32 i = 1; i < 3; ++i ) {
+        minX = triangle.x[i] < minX ? triangle.x[i] : minX;
+        maxX = triangle.x[i] > maxX ? triangle.x[i] : maxX;
+        minY = triangle.y[i] < minY ? triangle.y[i] : minY;
+        maxY = triangle.y[i] > maxY ? triangle.y[i] : maxY;
+    }
+    const i32 half = SOFTWARE_SUBPIXEL_SCALE / 2;
+    triangle.minX = ( minX - half + SOFTWARE_SUBPIXEL_SCALE - 1 ) >> SOFTWARE_SUBPIXEL_BITS;
+    triangle.minY = ( minY - half + SOFTWARE_SUBPIXEL_SCALE - 1 ) >> SOFTWARE_SUBPIXEL_BITS;
+    triangle.maxX = ( maxX - half ) >> SOFTWARE_SUBPIXEL_BITS;
+    triangle.maxY = ( maxY - half ) >> SOFTWARE_SUBPIXEL_BITS;
+    if( ctx->draw->wireframe ) {
+        triangle.minX--;
+        triangle.minY--;
+        triangle.maxX++;
+        triangle.maxY++;
+    }
+    triangle.minX = triangle.minX > 0 ? triangle.minX : 0;
+    triangle.minY = triangle.minY > 0 ? triangle.minY : 0;
+    triangle.maxX = triangle.maxX < sw->width  - 1 ? triangle.maxX : sw->width  - 1;
+    triangle.maxY = triangle.maxY < sw->height - 1 ? triangle.maxY : sw->height - 1;
+    if( triangle.minX > triangle.maxX || triangle.minY > triangle.maxY ) {
+        return;
+    }
+
+    f32 scale = (f32)SOFTWARE_SUBPIXEL_SCALE / (f32)area;
+    triangle.area      = (f32)area;
+    triangle.weight1DX = (f32)( triangle.y[2] - triangle.y[0] ) * scale;
+    triangle.weight1DY = (f32)( triangle.x[0] - triangle.x[2] ) * scale;
+    triangle.weight2DX = (f32)( triangle.y[0] - triangle.y[1] ) * scale;
+    triangle.weight2DY = (f32)( triangle.x[1] - triangle.x[0] ) * scale;
+
+    SWBatch* batch = ctx->batch;
+    if( !growArray( (void**)&batch->triangles, sizeof(SWTriangle), &batch->triangleCapacity, batch->triangleCount + 1 ) ) {
+        return;
+    }
+    batch->triangles[batch->triangleCount++] = triangle;
+}
+
+/// @brief Clip triangle against near and far planes and guard band, then emit it as a fan
+static void SWClipTriangle( const SWSetupContext* ctx, const f32* corners[3] ) {
+    u32 floats = ctx->draw->vertexFloats;
+    f32 polygons[2][SOFTWARE_MAX_CLIP_VERTICES][4 + SOFTWARE_MAX_VARYINGS];
+    u32 count = 3;
+    ucycles( 3 ) {
+        Platform::MemCopy( floats * sizeof(f32), corners[i], polygons[0][i] );
+    }
+
+    u32 current = 0;
+    ucyclesi( SW_CLIP_PLANE_COUNT, plane ) {
+        f32 (*src)[4 + SOFTWARE_MAX_VARYINGS] = polygons[current];
+        f32 (*dst)[4 + SOFTWARE_MAX_VARYINGS] = polygons[current ^ 1];
+        u32 dstCount = 0;
+        ucycles( count ) {
+            const f32* a = src[i];
+            const f32* b = src[( i + 1 ) % count];
+            f32 distanceA = SWClipDistance( ctx, (u32)plane, a );
+            f32 distanceB = SWClipDistance( ctx, (u32)plane, b );
+            if( distanceA >= 0.0f ) {
+                Platform::MemCopy( floats * sizeof(f32), a, dst[dstCount++] );
+            }
+            if( ( distanceA >= 0.0f ) != ( distanceB >= 0.0f ) ) {
+                f32 t = distanceA / ( distanceA - distanceB );
+                ucyclesi( floats, f ) {
+                    dst[dstCount][f] = a[f] + ( b[f] - a[f] ) * t;
+                }
+                dstCount++;
+            }
+        }
+        count = dstCount;
+        current ^= 1;
+        if( count < 3 ) {
+            return;
+        }
+    }
+
+    SWBatch* batch = ctx->batch;
+    u32 first = batch->vertexCount;
+    if( !growArray( (void**)&batch->vertices, floats * sizeof(f32), &batch->vertexCapacity, batch->vertexCount + count ) ) {
+        return;
+    }
+    ucycles( count ) {
+        if( polygons[current][i][3] <= 0.0f ) {
+            return;
+        }
+    }
+    ucycles( count ) {
+        Platform::MemCopy( floats * sizeof(f32), polygons[current][i],
+            batch->vertices + (usize)( first + i ) * floats );
+    }
+    batch->vertexCount += count;
+
+    for( u32 i = 1; i + 1 < count; ++i ) {
+        const f32* positions[3] = { polygons[current][0], polygons[current][i], polygons[current][i + 1] };
+        u32 vertices[3] = {
+            ( first + 0 ) | SOFTWARE_CLIPPED_VERTEX,
+            ( first + i ) | SOFTWARE_CLIPPED_VERTEX,
+            ( first + i + 1 ) | SOFTWARE_CLIPPED_VERTEX
+        };
+        SWEmitTriangle( ctx, positions, vertices );
+    }
+}
+
+/// @brief Sort triangles of batch into the tiles their bounds touch
+static void SWBinBatch( SWBatch* batch ) {
+    if( batch->triangleCount == 0 ) {
+        batch->tileMinX = batch->tileMinY = 1;
+        batch->tileMaxX = batch->tileMaxY = 0;
+        return;
+    }
+    i32 tileMinX = 0x7FFFFFFF, tileMinY = 0x7FFFFFFF;
+    i32 tileMaxX = 0, tileMaxY = 0;
+    ucycles( batch->triangleCount ) {
+        const SWTriangle* triangle = &batch->triangles[i];
+        i32 minX = triangle->minX / SOFTWARE_TILE_SIZE;
+        i32 minY = triangle->minY / SOFTWARE_TILE_SIZE;
+        i32 maxX = triangle->maxX / SOFTWARE_TILE_SIZE;
+        i32 maxY = triangle->maxY / SOFTWARE_TILE_SIZE;
+        tileMinX = minX < tileMinX ? minX : tileMinX;
+        tileMinY = minY < tileMinY ? minY : tileMinY;
+        tileMaxX = maxX > tileMaxX ? maxX : tileMaxX;
+        tileMaxY = maxY > tileMaxY ? maxY : tileMaxY;
+    }
+    batch->tileMinX = tileMinX;
+    batch->tileMinY = tileMinY;
+    batch->tileMaxX = tileMaxX;
+    batch->tileMaxY = tileMaxY;
+
+    i32 rectWidth = tileMaxX - tileMinX + 1;
+    u32 tileCount = (u32)( rectWidth * ( tileMaxY - tileMinY + 1 ) );
+    if( tileCount + 1 > batch->tileCapacity ) {
+        if( batch->tileOffsets ) {
+            Platform::Free( batch->tileOffsets );
+            Platform::Free( batch->tileCursors );
+        }
+        batch->tileCapacity = tileCount + 1;
+        batch->tileOffsets  = (u32*)Platform::Alloc( batch->tileCapacity * sizeof(u32) );
+        batch->tileCursors  = (u32*)Platform::Alloc( batch->tileCapacity * sizeof(u32) );
+    }
+    u32* counts = batch->tileCursors;
+    ucycles( tileCount ) {
+        counts[i] = 0;
+    }
+    ucycles( batch->triangleCount ) {
+        const SWTriangle* triangle = &batch->triangles[i];
+        for( i32 y = triangle->minY / SOFTWARE_TILE_SIZE; y <= triangle->maxY / SOFTWARE_TILE_SIZE; ++y ) {
+            for( i32 x = triangle->minX / SOFTWARE_TILE_SIZE; x <= triangle->maxX / SOFTWARE_TILE_SIZE; ++x ) {
+                counts[( y - tileMinY ) * rectWidth + ( x - tileMinX )]++;
+            }
+        }
+    }
+    u32 refCount = 0;
+    ucycles( tileCount ) {
+        batch->tileOffsets[i] = refCount;
+        refCount += counts[i];
+        counts[i] = batch->tileOffsets[i];
+    }
+    batch->tileOffsets[tileCount] = refCount;
+
+    if( !growArray( (void**)&batch->refs, sizeof(u32), &batch->refCapacity, refCount ) ) {
+        // NOTE(alicia): tiles without refs skip the batch
+        ucycles( tileCount + 1 ) {
+            batch->tileOffsets[i] = 0;
+        }
+        return;
+    }
+    ucycles( batch->triangleCount ) {
+        const SWTriangle* triangle = &batch->triangles[i];
+        for( i32 y = triangle->minY / SOFTWARE_TILE_SIZE; y <= triangle->maxY / SOFTWARE_TILE_SIZE; ++y ) {
+            for( i32 x = triangle->minX / SOFTWARE_TILE_SIZE; x <= triangle->maxX / SOFTWARE_TILE_SIZE; ++x ) {
+                batch->refs[counts[( y - tileMinY ) * rectWidth + ( x - tileMinX )]++] = (u32)i;
+            }
+        }
+    }
+}
+
+static void SWSetupJob( void* params, u32 chunk ) {
+    SWDrawJob* job = (SWDrawJob*)params;
+    SWState* sw = &SOFTWARE_STATE;
+    const SWDraw* draw = job->draw;
+
+    SWSetupContext ctx = {};
+    ctx.sw     = sw;
+    ctx.draw   = draw;
+    ctx.batch  = &sw->batches[job->batchStart + chunk];
+    ctx.guardX = 1.0f + SOFTWARE_GUARD_BAND / ( (f32)sw->width  * 0.5f );
+    ctx.guardY = 1.0f + SOFTWARE_GUARD_BAND / ( (f32)sw->height * 0.5f );
+    ctx.batch->drawIndex     = (u32)( draw - sw->draws );
+    ctx.batch->triangleCount = 0;
+    ctx.batch->vertexCount   = 0;
+
+    u32 first = chunk * job->trianglesPerChunk;
+    u32 last  = first + job->trianglesPerChunk;
+    last = last < draw->triangleCount ? last : draw->triangleCount;
+
+    const SWRange* range = first < last ? SWFindRange( draw, first ) : nullptr;
+    for( u32 triangle = first; triangle < last; ++triangle ) {
+        while( triangle >= range->firstTriangle + range->indexCount / 3 ) {
+            range++;
+        }
+        const f32* corners[3];
+        u32 vertices[3];
+        bool valid = true;
+        ucycles( 3 ) {
+            u32 vertex = SWTriangleVertex( draw, range, triangle, (u32)i );
+            if( vertex < draw->vertexMin || vertex - draw->vertexMin >= draw->vertexCount ) {
+                valid = false;
+                break;
+            }
+            vertices[i] = vertex - draw->vertexMin;
+            corners[i]  = draw->vertices + (usize)vertices[i] * draw->vertexFloats;
+        }
+        if( !valid ) {
+            continue;
+        }
+        u32 outcodes[3] = {
+            SWOutcode( &ctx, corners[0] ),
+            SWOutcode( &ctx, corners[1] ),
+            SWOutcode( &ctx, corners[2] )
+        };
+        if( outcodes[0] & outcodes[1] & outcodes[2] & SW_OUT_REJECT ) {
+            continue;
+        }
+        if( ( outcodes[0] | outcodes[1] | outcodes[2] ) & SW_OUT_CLIP ) {
+            SWClipTriangle( &ctx, corners );
+        } else {
+            SWEmitTriangle( &ctx, corners, vertices );
+        }
+    }
+    SWBinBatch( ctx.batch );
+}
+
+// NOTE(alicia): rasterization -----------------------------------------------------------------
+
+static inline __m128 SWBlendFactor( BlendFactor factor, u32 channel, const __m128 src[4], const __m128 dst[4] ) {
+    // NOTE(alicia): constant color is always zero and dual source blending reads the only source
+    __m128 one = _mm_set1_ps( 1.0f );
+    switch( factor ) {
+        case BlendFactor::ZERO:                     return _mm_setzero_ps();
+        case BlendFactor::ONE:                      return one;
+        case BlendFactor::SRC1_COLOR:
+        case BlendFactor::SRC_COLOR:                return src[channel];
+        case BlendFactor::ONE_MINUS_SRC1_COLOR:
+        case BlendFactor::ONE_MINUS_SRC_COLOR:      return _mm_sub_ps( one, src[channel] );
+        case BlendFactor::DST_COLOR:                return dst[channel];
+        case BlendFactor::ONE_MINUS_DST_COLOR:      return _mm_sub_ps( one, dst[channel] );
+        case BlendFactor::SRC1_ALPHA:
+        case BlendFactor::SRC_ALPHA:                return src[3];
+        case BlendFactor::ONE_MINUS_SRC1_ALPHA:
+        case BlendFactor::ONE_MINUS_SRC_ALPHA:      return _mm_sub_ps( one, src[3] );
+        case BlendFactor::DST_ALPHA:                return dst[3];
+        case BlendFactor::ONE_MINUS_DST_ALPHA:      return _mm_sub_ps( one, dst[3] );
+        case BlendFactor::CONSTANT_COLOR:
+        case BlendFactor::CONSTANT_ALPHA:           return _mm_setzero_ps();
+        case BlendFactor::ONE_MINUS_CONSTANT_COLOR:
+        case BlendFactor::ONE_MINUS_CONSTANT_ALPHA: return one;
+        case BlendFactor::SRC_ALPHA_SATURATE: {
+            return channel < 3 ? _mm_min_ps( src[3], _mm_sub_ps( one, dst[3] ) ) : one;
+        }
+        default: return one;
+    }
+}
+
+static inline __m128 SWBlendEquation( BlendEq eq, __m128 src, __m128 srcFactor, __m128 dst, __m128 dstFactor ) {
+    switch( eq ) {
+        case BlendEq::SUB:     return _mm_sub_ps( _mm_mul_ps( src, srcFactor ), _mm_mul_ps( dst, dstFactor ) );
+        case BlendEq::REV_SUB: return _mm_sub_ps( _mm_mul_ps( dst, dstFactor ), _mm_mul_ps( src, srcFactor ) );
+        case BlendEq::MIN:     return _mm_min_ps( src, dst );
+        case BlendEq::MAX:     return _mm_max_ps( src, dst );
+        default:               return _mm_add_ps( _mm_mul_ps( src, srcFactor ), _mm_mul_ps( dst, dstFactor ) );
+    }
+}
+
+/// @brief Per triangle values of rasterizing it in a tile
+struct SWRasterTriangle {
+    const SWDraw* draw;
+    const SWTriangle* triangle;
+    SoftwareFragments fragments;
+    f32 originX;
+    f32 originY;
+    /// @brief Pixels per unit of barycentric weight of every edge, for wireframe
+    f32 edgeScales[3];
+    /// @brief Change of (weight * q) of every vertex from one pixel to the next
+    f32 weightedDX[3];
+    f32 weightedDY[3];
+    f32 denominatorDX;
+    f32 denominatorDY;
+};
+
+/// @brief Depth test, shade and blend four pixels
+static void SWShadePixels( SWRasterTriangle* raster, i32 x, i32 y, __m128 mask, u32* colorRow, f32* depthRow ) {
+    // NOTE(alicia): SSE
+    const SWTriangle* triangle = raster->triangle;
+    const SWDraw* draw = raster->draw;
+    __m128 one = _mm_set1_ps( 1.0f );
+    __m128 zero = _mm_setzero_ps();
+
+    __m128 dx = _mm_sub_ps(
+        _mm_add_ps( _mm_set1_ps( (f32)x ), _mm_setr_ps( 0.5f, 1.5f, 2.5f, 3.5f ) ),
+        _mm_set1_ps( raster->originX ) );
+    __m128 dy = _mm_set1_ps( (f32)y + 0.5f - raster->originY );
+    __m128 weight1 = _mm_add_ps(
+        _mm_mul_ps( _mm_set1_ps( triangle->weight1DX ), dx ),
+        _mm_mul_ps( _mm_set1_ps( triangle->weight1DY ), dy ) );
+    __m128 weight2 = _mm_add_ps(
+        _mm_mul_ps( _mm_set1_ps( triangle->weight2DX ), dx ),
+        _mm_mul_ps( _mm_set1_ps( triangle->weight2DY ), dy ) );
+    __m128 weight0 = _mm_sub_ps( _mm_sub_ps( one, weight1 ), weight2 );
+
+    if( draw->wireframe ) {
+        // pixels within half a pixel of an edge
+        __m128 half = _mm_set1_ps( 0.5f );
+        __m128 distance0 = _mm_mul_ps( weight0, _mm_set1_ps( raster->edgeScales[0] ) );
+        __m128 distance1 = _mm_mul_ps( weight1, _mm_set1_ps( raster->edgeScales[1] ) );
+        __m128 distance2 = _mm_mul_ps( weight2, _mm_set1_ps( raster->edgeScales[2] ) );
+        __m128 nearest = _mm_min_ps( _mm_min_ps( distance0, distance1 ), distance2 );
+        mask = _mm_and_ps( mask, _mm_cmpge_ps( nearest, _mm_set1_ps( -0.5f ) ) );
+        mask = _mm_and_ps( mask, _mm_cmple_ps( nearest, half ) );
+    }
+
+    __m128 z = _mm_add_ps( _mm_set1_ps( triangle->z[0] ), _mm_add_ps(
+        _mm_mul_ps( weight1, _mm_set1_ps( triangle->z[1] - triangle->z[0] ) ),
+        _mm_mul_ps( weight2, _mm_set1_ps( triangle->z[2] - triangle->z[0] ) ) ) );
+    __m128 depth = _mm_loadu_ps( depthRow );
+    mask = _mm_and_ps( mask, _mm_cmplt_ps( z, depth ) );
+    if( _mm_movemask_ps( mask ) == 0 ) {
+        return;
+    }
+
+    // perspective correct weights and their derivatives
+    __m128 weighted0 = _mm_mul_ps( weight0, _mm_set1_ps( triangle->q[0] ) );
+    __m128 weighted1 = _mm_mul_ps( weight1, _mm_set1_ps( triangle->q[1] ) );
+    __m128 weighted2 = _mm_mul_ps( weight2, _mm_set1_ps( triangle->q[2] ) );
+    __m128 invDenominator = _mm_div_ps( one, _mm_add_ps( _mm_add_ps( weighted0, weighted1 ), weighted2 ) );
+    SoftwareFragments* fragments = &raster->fragments;
+    fragments->weights[0] = _mm_mul_ps( weighted0, invDenominator );
+    fragments->weights[1] = _mm_mul_ps( weighted1, invDenominator );
+    fragments->weights[2] = _mm_mul_ps( weighted2, invDenominator );
+    __m128 denominatorDX = _mm_set1_ps( raster->denominatorDX );
+    __m128 denominatorDY = _mm_set1_ps( raster->denominatorDY );
+    ucycles( 3 ) {
+        fragments->weightsDX[i] = _mm_mul_ps( invDenominator, _mm_sub_ps(
+            _mm_set1_ps( raster->weightedDX[i] ), _mm_mul_ps( fragments->weights[i], denominatorDX ) ) );
+        fragments->weightsDY[i] = _mm_mul_ps( invDenominator, _mm_sub_ps(
+            _mm_set1_ps( raster->weightedDY[i] ), _mm_mul_ps( fragments->weights[i], denominatorDY ) ) );
+    }
+
+    __m128 color[4];
+    draw->state.port->fragment( &draw->state, fragments, color );
+    ucycles( 4 ) {
+        color[i] = _mm_min_ps( _mm_max_ps( color[i], zero ), one );
+    }
+
+    __m128i destination = _mm_loadu_si128( (const __m128i*)colorRow );
+    if( draw->blending ) {
+        __m128i byteMask = _mm_set1_epi32( 0xFF );
+        __m128 scale = _mm_set1_ps( 1.0f / 255.0f );
+        __m128 dst[4];
+        ucycles( 4 ) {
+            dst[i] = _mm_mul_ps( _mm_cvtepi32_ps(
+                _mm_and_si128( _mm_srli_epi32( destination, (i32)i * 8 ), byteMask ) ), scale );
+        }
+        __m128 blended[4];
+        ucycles( 4 ) {
+            u32 factor = i < 3 ? 0 : 2;
+            blended[i] = SWBlendEquation(
+                draw->blendEqs[i < 3 ? 0 : 1],
+                color[i], SWBlendFactor( draw->blendFactors[factor], (u32)i, color, dst ),
+                dst[i], SWBlendFactor( draw->blendFactors[factor + 1], (u32)i, color, dst )
+            );
+        }
+        ucycles( 4 ) {
+            color[i] = _mm_min_ps( _mm_max_ps( blended[i], zero ), one );
+        }
+    }
+
+    __m128 scale = _mm_set1_ps( 255.0f );
+    __m128i packed = _mm_cvtps_epi32( _mm_mul_ps( color[0], scale ) );
+    packed = _mm_or_si128( packed, _mm_slli_epi32( _mm_cvtps_epi32( _mm_mul_ps( color[1], scale ) ), 8 ) );
+    packed = _mm_or_si128( packed, _mm_slli_epi32( _mm_cvtps_epi32( _mm_mul_ps( color[2], scale ) ), 16 ) );
+    packed = _mm_or_si128( packed, _mm_slli_epi32( _mm_cvtps_epi32( _mm_mul_ps( color[3], scale ) ), 24 ) );
+
+    __m128i integerMask = _mm_castps_si128( mask );
+    _mm_storeu_si128( (__m128i*)colorRow, _mm_or_si128(
+        _mm_and_si128( integerMask, packed ), _mm_andnot_si128( integerMask, destination ) ) );
+    _mm_storeu_ps( depthRow, _mm_or_ps( _mm_and_ps( mask, z ), _mm_andnot_ps( mask, depth ) ) );
+}
+
+/// @brief Rasterize part of triangle inside tile
+static void SWRasterizeTriangle(
+    const SWDraw* draw, const SWBatch* batch, const SWTriangle* triangle,
+    i32 tileX0, i32 tileY0, i32 tileX1, i32 tileY1
+) {
+    SWState* sw = &SOFTWARE_STATE;
+    i32 minX = triangle->minX > tileX0 ? triangle->minX : tileX0;
+    i32 minY = triangle->minY > tileY0 ? triangle->minY : tileY0;
+    i32 maxX = triangle->maxX < tileX1 - 1 ? triangle->maxX : tileX1 - 1;
+    i32 maxY = triangle->maxY < tileY1 - 1 ? triangle->maxY : tileY1 - 1;
+    if( minX > maxX || minY > maxY ) {
+        return;
+    }
+
+    // NOTE(alicia): edge i is opposite of vertex i, inside is positive,
+    // pixel centers exactly on an edge belong to it only if it's a top or left edge
+    i64 a[3], b[3], c[3];
+    ucycles( 3 ) {
+        u32 from = ( i + 1 ) % 3;
+        u32 to   = ( i + 2 ) % 3;
+        a[i] = (i64)triangle->y[from] - (i64)triangle->y[to];
+        b[i] = (i64)triangle->x[to]   - (i64)triangle->x[from];
+        c[i] = -( a[i] * triangle->x[from] + b[i] * triangle->y[from] );
+        if( !( a[i] > 0 || ( a[i] == 0 && b[i] < 0 ) ) ) {
+            c[i] -= 1;
+        }
+    }
+
+    const i32 half = SOFTWARE_SUBPIXEL_SCALE / 2;
+    i32 groupX0 = minX & ~3;
+    i64 startX  = (i64)groupX0 * SOFTWARE_SUBPIXEL_SCALE + half;
+    i64 startY  = (i64)minY * SOFTWARE_SUBPIXEL_SCALE + half;
+
+    // trivially accept or reject every edge over pixel centers of bounds
+    u32 partialCount = 0;
+    __m128i rowEdges[3];
+    __m128i stepX[3];
+    __m128i stepY[3];
+    if( !draw->wireframe ) {
+        i64 cornersX[2] = { (i64)minX * SOFTWARE_SUBPIXEL_SCALE + half, (i64)maxX * SOFTWARE_SUBPIXEL_SCALE + half };
+        i64 cornersY[2] = { startY, (i64)maxY * SOFTWARE_SUBPIXEL_SCALE + half };
+        ucycles( 3 ) {
+            u32 inside = 0;
+            ucyclesi( 4, corner ) {
+                i64 edge = a[i] * cornersX[corner & 1] + b[i] * cornersY[corner >> 1] + c[i];
+                inside += edge >= 0 ? 1 : 0;
+            }
+            if( inside == 0 ) {
+                return;
+            }
+            if( inside == 4 ) {
+                continue;
+            }
+            // NOTE(alicia): SSE, edge crosses bounds so its values inside the tile fit in 32 bits
+            i32 start = (i32)( a[i] * startX + b[i] * startY + c[i] );
+            i32 step  = (i32)( a[i] * SOFTWARE_SUBPIXEL_SCALE );
+            rowEdges[partialCount] = _mm_setr_epi32( start, start + step, start + step * 2, start + step * 3 );
+            stepX[partialCount] = _mm_set1_epi32( step * 4 );
+            stepY[partialCount] = _mm_set1_epi32( (i32)( b[i] * SOFTWARE_SUBPIXEL_SCALE ) );
+            partialCount++;
+        }
+    }
+
+    SWRasterTriangle raster;
+    raster.draw     = draw;
+    raster.triangle = triangle;
+    raster.originX  = (f32)triangle->x[0] / (f32)SOFTWARE_SUBPIXEL_SCALE;
+    raster.originY  = (f32)triangle->y[0] / (f32)SOFTWARE_SUBPIXEL_SCALE;
+    f32 weightDX[3] = { -( triangle->weight1DX + triangle->weight2DX ), triangle->weight1DX, triangle->weight2DX };
+    f32 weightDY[3] = { -( triangle->weight1DY + triangle->weight2DY ), triangle->weight1DY, triangle->weight2DY };
+    raster.denominatorDX = 0.0f;
+    raster.denominatorDY = 0.0f;
+    ucycles( 3 ) {
+        raster.weightedDX[i] = weightDX[i] * triangle->q[i];
+        raster.weightedDY[i] = weightDY[i] * triangle->q[i];
+        raster.denominatorDX += raster.weightedDX[i];
+        raster.denominatorDY += raster.weightedDY[i];
+        f32 length = smath::sqrt( (f32)( a[i] * a[i] + b[i] * b[i] ) );
+        raster.edgeScales[i] = length > 0.0f ?
+            triangle->area / ( length * (f32)SOFTWARE_SUBPIXEL_SCALE ) : 0.0f;
+
+        u32 vertex = triangle->vertices[i];
+        raster.fragments.varyings[i] = 4 + ( vertex & SOFTWARE_CLIPPED_VERTEX ?
+            batch->vertices + (usize)( vertex & ~SOFTWARE_CLIPPED_VERTEX ) * draw->vertexFloats :
+            draw->vertices + (usize)vertex * draw->vertexFloats );
+    }
+
+    // NOTE(alicia): SSE
+    __m128i laneX   = _mm_setr_epi32( 0, 1, 2, 3 );
+    __m128i boundsX0 = _mm_set1_epi32( minX - 1 );
+    __m128i boundsX1 = _mm_set1_epi32( maxX + 1 );
+    __m128i zero = _mm_setzero_si128();
+    for( i32 y = minY; y <= maxY; ++y ) {
+        __m128i edges[3];
+        ucycles( partialCount ) {
+            edges[i] = rowEdges[i];
+            rowEdges[i] = _mm_add_epi32( rowEdges[i], stepY[i] );
+        }
+        u32* colorRow = sw->color + (usize)y * (usize)sw->stride;
+        f32* depthRow = sw->depth + (usize)y * (usize)sw->stride;
+        for( i32 x = groupX0; x <= maxX; x += 4 ) {
+            __m128i lanes = _mm_add_epi32( _mm_set1_epi32( x ), laneX );
+            __m128i mask  = _mm_and_si128( _mm_cmpgt_epi32( lanes, boundsX0 ), _mm_cmplt_epi32( lanes, boundsX1 ) );
+            ucycles( partialCount ) {
+                mask = _mm_andnot_si128( _mm_cmplt_epi32( edges[i], zero ), mask );
+                edges[i] = _mm_add_epi32( edges[i], stepX[i] );
+            }
+            if( _mm_movemask_epi8( mask ) == 0 ) {
+                continue;
+            }
+            SWShadePixels( &raster, x, y, _mm_castsi128_ps( mask ), colorRow + x, depthRow + x );
+        }
+    }
+}
+
+static void SWRasterTileJob( void*, u32 tile ) {
+    SWState* sw = &SOFTWARE_STATE;
+    i32 tileX = (i32)tile % sw->tilesX;
+    i32 tileY = (i32)tile / sw->tilesX;
+    i32 x0 = tileX * SOFTWARE_TILE_SIZE;
+    i32 y0 = tileY * SOFTWARE_TILE_SIZE;
+    i32 x1 = x0 + SOFTWARE_TILE_SIZE < sw->width  ? x0 + SOFTWARE_TILE_SIZE : sw->width;
+    i32 y1 = y0 + SOFTWARE_TILE_SIZE < sw->height ? y0 + SOFTWARE_TILE_SIZE : sw->height;
+
+    if( sw->clearPending ) {
+        for( i32 y = y0; y < y1; ++y ) {
+            u32* colorRow = sw->color + (usize)y * (usize)sw->stride;
+            f32* depthRow = sw->depth + (usize)y * (usize)sw->stride;
+            for( i32 x = x0; x < x1; ++x ) {
+                colorRow[x] = sw->clearColor;
+                depthRow[x] = 1.0f;
+            }
+        }
+    }
+
+    ucycles( sw->batchCount ) {
+        const SWBatch* batch = &sw->batches[i];
+        if(
+            tileX < batch->tileMinX || tileX > batch->tileMaxX ||
+            tileY < batch->tileMinY || tileY > batch->tileMaxY
+        ) {
+            continue;
+        }
+        u32 local = (u32)( ( tileY - batch->tileMinY ) * ( batch->tileMaxX - batch->tileMinX + 1 ) +
+            ( tileX - batch->tileMinX ) );
+        const SWDraw* draw = &sw->draws[batch->drawIndex];
+        for( u32 ref = batch->tileOffsets[local]; ref < batch->tileOffsets[local + 1]; ++ref ) {
+            SWRasterizeTriangle( draw, batch, &batch->triangles[batch->refs[ref]], x0, y0, x1, y1 );
+        }
+    }
+}
+
+/// @brief Rasterize pending draws and start a new frame
+static void SWFlush() {
+    SWState* sw = &SOFTWARE_STATE;
+    if( sw->color && ( sw->clearPending || sw->batchCount ) ) {
+        SWParallelFor( (u32)( sw->tilesX * sw->tilesY ), SWRasterTileJob, nullptr );
+    }
+    sw->clearPending = false;
+    sw->batchCount   = 0;
+    sw->drawCount    = 0;
+    SWArenaReset( &sw->arena );
+    ucycles( SOFTWARE_UNIFORM_BINDINGS ) {
+        sw->bindings[i].copy = nullptr;
+    }
+}
+
+// NOTE(alicia): draws -------------------------------------------------------------------------
+
+/// @brief Copy state of draw, shade its vertices and bin its triangles
+static void SWRecordDraw(
+    VertexArray* vertexArray, usize rangeCount,
+    const u32* firstIndices, const u32* indexCounts, const u32* baseVertices,
+    bool indexed
+) {
+    SWState* sw = &SOFTWARE_STATE;
+    if( !sw->shader || !sw->color || rangeCount == 0 ) {
+        return;
+    }
+    const SoftwareShaderPort* port = sw->shader->port;
+
+    if( !growArray( (void**)&sw->draws, sizeof(SWDraw), &sw->drawCapacity, sw->drawCount + 1 ) ) {
+        LOG_ERROR( "Software > Failed to allocate draw!" );
+        return;
+    }
+    SWDraw* draw = &sw->draws[sw->drawCount];
+    *draw = {};
+
+    usize indexLimit = vertexArray->totalVertexCount;
+    if( indexed ) {
+        if( !vertexArray->indexBuffer ) {
+            return;
+        }
+        SWBuffer* indexBuffer = (SWBuffer*)SWTableGet( &sw->buffers, vertexArray->indexBuffer->id );
+        if( !indexBuffer ) {
+            return;
+        }
+        draw->indices   = indexBuffer->data;
+        draw->indexType = vertexArray->indexBuffer->dataType;
+        indexLimit      = vertexArray->indexBuffer->indexCount;
+    }
+
+    // NOTE(alicia): attribute i of every vertex buffer is location i, like glVertexAttribPointer
+    ucycles( vertexArray->vertexBufferCount ) {
+        const VertexBuffer* buffer = &vertexArray->buffers[i];
+        SWBuffer* record = (SWBuffer*)SWTableGet( &sw->buffers, buffer->id );
+        if( !record ) {
+            continue;
+        }
+        ucyclesi( buffer->layout.elementCount, element ) {
+            if( element >= SOFTWARE_MAX_ATTRIBUTES ) {
+                break;
+            }
+            SWAttribute* attribute = &draw->attributes[element];
+            attribute->data        = record->data + buffer->layout.elementOffsets[element];
+            attribute->stride      = buffer->layout.stride;
+            attribute->vertexCount = buffer->vertexCount;
+            attribute->element     = buffer->layout.elements[element];
+            if( element + 1 > draw->attributeCount ) {
+                draw->attributeCount = (u32)element + 1;
+            }
+        }
+    }
+
+    SWRange* ranges = (SWRange*)SWArenaPush( &sw->arena, rangeCount * sizeof(SWRange) );
+    if( !ranges ) {
+        LOG_ERROR( "Software > Failed to allocate draw ranges!" );
+        return;
+    }
+    u32 triangleCount = 0;
+    u32 vertexMin = 0xFFFFFFFF;
+    u32 vertexMax = 0;
+    ucycles( rangeCount ) {
+        usize first = firstIndices[i];
+        usize count = indexCounts[i];
+        first = first < indexLimit ? first : indexLimit;
+        count = first + count <= indexLimit ? count : indexLimit - first;
+        ranges[i].firstIndex    = (u32)first;
+        ranges[i].indexCount    = (u32)( count - count % 3 );
+        ranges[i].baseVertex    = baseVertices ? baseVertices[i] : 0;
+        ranges[i].firstTriangle = triangleCount;
+        triangleCount += (u32)( count / 3 );
+        if( !indexed && count ) {
+            vertexMin = (u32)first < vertexMin ? (u32)first : vertexMin;
+            vertexMax = (u32)( first + count - 1 ) > vertexMax ? (u32)( first + count - 1 ) : vertexMax;
+        }
+    }
+    if( triangleCount == 0 ) {
+        return;
+    }
+
+    SoftwareDrawState* state = &draw->state;
+    state->port = port;
+    u8* uniforms = (u8*)SWArenaPush( &sw->arena, port->uniformSize );
+    if( !uniforms && port->uniformSize ) {
+        LOG_ERROR( "Software > Failed to allocate draw uniforms!" );
+        return;
+    }
+    Platform::MemCopy( port->uniformSize, sw->shader->uniforms, uniforms );
+    state->uniforms = uniforms;
+    ucycles( SOFTWARE_UNIFORM_BINDINGS ) {
+        if( !( port->uniformBufferMask & ( 1 << i ) ) ) {
+            continue;
+        }
+        SWBinding* binding = &sw->bindings[i];
+        SWBuffer* buffer = (SWBuffer*)SWTableGet( &sw->buffers, binding->buffer );
+        if( !buffer || binding->offset >= buffer->size ) {
+            continue;
+        }
+        usize size = binding->size < buffer->size - binding->offset ? binding->size : buffer->size - binding->offset;
+        // NOTE(alicia): a range is copied once per frame unless buffer changes between draws
+        if( !binding->copy || binding->version != buffer->version ) {
+            u8* copy = (u8*)SWArenaPush( &sw->arena, size );
+            if( !copy && size ) {
+                LOG_ERROR( "Software > Failed to allocate uniform buffer copy!" );
+                return;
+            }
+            Platform::MemCopy( size, buffer->data + binding->offset, copy );
+            binding->copy    = copy;
+            binding->version = buffer->version;
+        }
+        state->uniformBuffers[i]     = binding->copy;
+        state->uniformBufferSizes[i] = size;
+    }
+    ucycles( SOFTWARE_TEXTURE_UNITS ) {
+        state->textures[i] = sw->textureUnits[i];
+    }
+    draw->wireframe = sw->wireframe;
+    draw->blending  = sw->blending;
+    ucycles( 4 ) {
+        draw->blendFactors[i] = sw->blendFactors[i];
+    }
+    draw->blendEqs[0]   = sw->blendEqs[0];
+    draw->blendEqs[1]   = sw->blendEqs[1];
+    draw->ranges        = ranges;
+    draw->rangeCount    = (u32)rangeCount;
+    draw->triangleCount = triangleCount;
+    draw->vertexFloats  = 4 + port->varyingCount;
+
+    SWDrawJob job = {};
+    job.draw       = draw;
+    job.batchStart = sw->batchCount;
+    u32 chunkCount = SWChunkCount( triangleCount, SOFTWARE_MIN_JOB_TRIANGLES );
+    job.trianglesPerChunk = ( triangleCount + chunkCount - 1 ) / chunkCount;
+
+    if( indexed ) {
+        SWParallelFor( chunkCount, SWVertexBoundsJob, &job );
+        ucycles( chunkCount ) {
+            vertexMin = job.vertexMins[i] < vertexMin ? job.vertexMins[i] : vertexMin;
+            vertexMax = job.vertexMaxs[i] > vertexMax ? job.vertexMaxs[i] : vertexMax;
+        }
+    }
+    if( vertexMin > vertexMax ) {
+        return;
+    }
+    draw->vertexMin   = vertexMin;
+    draw->vertexCount = vertexMax - vertexMin + 1;
+    draw->vertices    = (f32*)SWArenaPush( &sw->arena,
+        (usize)draw->vertexCount * draw->vertexFloats * sizeof(f32) );
+    if( !draw->vertices ) {
+        LOG_ERROR( "Software > Failed to allocate transformed vertices!" );
+        return;
+    }
+    u32 vertexChunkCount = SWChunkCount( draw->vertexCount, SOFTWARE_MIN_JOB_VERTICES );
+    job.verticesPerChunk = ( draw->vertexCount + vertexChunkCount - 1 ) / vertexChunkCount;
+    SWParallelFor( vertexChunkCount, SWVertexJob, &job );
+
+    // NOTE(alicia): batches keep their memory between frames
+    u32 batchCapacity = sw->batchCapacity;
+    if( !growArray( (void**)&sw->batches, sizeof(SWBatch), &sw->batchCapacity, sw->batchCount + chunkCount ) ) {
+        LOG_ERROR( "Software > Failed to allocate triangle batches!" );
+        return;
+    }
+    for( u32 i = batchCapacity; i < sw->batchCapacity; ++i ) {
+        sw->batches[i] = {};
+    }
+    SWParallelFor( chunkCount, SWSetupJob, &job );
+
+    sw->batchCount += chunkCount;
+    sw->drawCount++;
+}
+
+void Platform::SoftwareDrawVertexArray( VertexArray* vertexArray ) {
+    u32 first = 0;
+    u32 base  = 0;
+    u32 count;
+    if( vertexArray->indexBuffer ) {
+        count = (u32)vertexArray->indexBuffer->indexCount;
+        SWRecordDraw( vertexArray, 1, &first, &count, &base, true );
+    } else {
+        count = (u32)vertexArray->totalVertexCount;
+        SWRecordDraw( vertexArray, 1, &first, &count, &base, false );
+    }
+}
+
+void Platform::SoftwareDrawVertexArrayRange( VertexArray* vertexArray, usize firstIndex, usize indexCount, u32 baseVertex ) {
+    DEBUG_ASSERT_LOG( vertexArray->indexBuffer,
+        "Software | DrawVertexArrayRange > Vertex array has no index buffer!"
+    );
+    u32 first = (u32)firstIndex;
+    u32 count = (u32)indexCount;
+    SWRecordDraw( vertexArray, 1, &first, &count, &baseVertex, true );
+}
+
+void Platform::SoftwareDrawVertexArrayRanges(
+    VertexArray* vertexArray, usize rangeCount,
+    const u32* firstIndices, const u32* indexCounts, const u32* baseVertices
+) {
+    DEBUG_ASSERT_LOG( vertexArray->indexBuffer,
+        "Software | DrawVertexArrayRanges > Vertex array has no index buffer!"
+    );
+    SWRecordDraw( vertexArray, rangeCount, firstIndices, indexCounts, baseVertices, true );
+}
+
+void Platform::SoftwareSetWireframeEnabled( bool enabled ) {
+    SOFTWARE_STATE.wireframe = enabled;
+}
+
+// NOTE(alicia): state -------------------------------------------------------------------------
+
+bool Platform::SoftwareCreate( u32 threadCount ) {
+    SWState* sw = &SOFTWARE_STATE;
+    if( sw->created ) {
+        return true;
+    }
+    *sw = {};
+    sw->blendFactors[0] = BlendFactor::ONE;
+    sw->blendFactors[1] = BlendFactor::ZERO;
+    sw->blendFactors[2] = BlendFactor::ONE;
+    sw->blendFactors[3] = BlendFactor::ZERO;
+    sw->blendEqs[0]     = BlendEq::ADD;
+    sw->blendEqs[1]     = BlendEq::ADD;
+    sw->packAlignment   = RENDERER_PACK_ALIGNMENT_DEFAULT;
+    sw->unpackAlignment = RENDERER_PACK_ALIGNMENT_DEFAULT;
+    sw->clearColor      = 0xFF000000;
+
+    sw->arena.size = SOFTWARE_ARENA_SIZE;
+    sw->arena.base = (u8*)Platform::Alloc( sw->arena.size );
+
+    if( threadCount == 0 ) {
+        threadCount = Platform::GetProcessorCount();
+    }
+    threadCount = threadCount < SOFTWARE_MAX_THREADS ? threadCount : SOFTWARE_MAX_THREADS;
+    SWPool* pool = &sw->pool;
+    if( threadCount > 1 ) {
+        if(
+            !Platform::SemaphoreCreate( 0, SOFTWARE_MAX_THREADS, &pool->wake ) ||
+            !Platform::SemaphoreCreate( 0, SOFTWARE_MAX_THREADS, &pool->done )
+        ) {
+            LOG_ERROR( "Software > Failed to create semaphores!" );
+            SWArenaFree( &sw->arena );
+            return false;
+        }
+        pool->running = 1;
+        ucycles( threadCount - 1 ) {
+            if( !Platform::ThreadCreate( SWWorkerProc, pool, &pool->threads[pool->workerCount] ) ) {
+                LOG_WARN( "Software > Failed to create worker thread, rasterizing with %u threads",
+                    pool->workerCount + 1 );
+                break;
+            }
+            pool->workerCount++;
+        }
+    }
+    sw->created = true;
+    return true;
+}
+
+void Platform::SoftwareDestroy() {
+    SWState* sw = &SOFTWARE_STATE;
+    if( !sw->created ) {
+        return;
+    }
+    SWPool* pool = &sw->pool;
+    if( pool->wake.handle ) {
+        pool->running = 0;
+        Platform::SemaphoreSignal( &pool->wake, pool->workerCount );
+        ucycles( pool->workerCount ) {
+            Platform::ThreadJoin( &pool->threads[i] );
+        }
+        Platform::SemaphoreDestroy( &pool->wake );
+        Platform::SemaphoreDestroy( &pool->done );
+    }
+
+    ucycles( sw->buffers.count ) {
+        SWBuffer* buffer = (SWBuffer*)sw->buffers.items[i];
+        if( buffer ) {
+            if( buffer->data ) {
+                Platform::Free( buffer->data );
+            }
+            Platform::Free( buffer );
+        }
+    }
+    ucycles( sw->shaders.count ) {
+        if( sw->shaders.items[i] ) {
+            Platform::Free( sw->shaders.items[i] );
+        }
+    }
+    ucycles( sw->textures.count ) {
+        SoftwareTexture* texture = (SoftwareTexture*)sw->textures.items[i];
+        if( texture ) {
+            Platform::Free( texture->levels[0] );
+            Platform::Free( texture );
+        }
+    }
+    SWTable* tables[] = { &sw->buffers, &sw->shaders, &sw->textures };
+    ucycles( ARRAY_COUNT( tables ) ) {
+        if( tables[i]->items ) {
+            Platform::Free( tables[i]->items );
+        }
+    }
+    ucycles( sw->batchCapacity ) {
+        SWBatch* batch = &sw->batches[i];
+        void* arrays[] = { batch->triangles, batch->vertices, batch->refs, batch->tileOffsets, batch->tileCursors };
+        ucyclesi( ARRAY_COUNT( arrays ), array ) {
+            if( arrays[array] ) {
+                Platform::Free( arrays[array] );
+            }
+        }
+    }
+    if( sw->batches ) {
+        Platform::Free( sw->batches );
+    }
+    if( sw->draws ) {
+        Platform::Free( sw->draws );
+    }
+    if( sw->color ) {
+        Platform::Free( sw->color );
+        Platform::Free( sw->depth );
+    }
+    SWArenaFree( &sw->arena );
+    *sw = {};
+}
+
+void Platform::SoftwareInitialize() {
+    SWState* sw = &SOFTWARE_STATE;
+    LOG_INFO( "Software > %u threads, %ix%i tiles",
+        sw->pool.workerCount + 1, SOFTWARE_TILE_SIZE, SOFTWARE_TILE_SIZE );
+    const char* titleAppend = " | Software";
+    Platform::AppendToWindowTitle( titleAppend, stringLen( titleAppend ) + 1 );
+}
+
+void Platform::SoftwareSwapBuffers() {
+    SWFlush();
+}
+
+bool Platform::SoftwareReadFramebuffer( SoftwareFramebuffer* result ) {
+    SWState* sw = &SOFTWARE_STATE;
+    *result = {};
+    if( !sw->created || !sw->color ) {
+        return false;
+    }
+    SWFlush();
+    result->width  = sw->width;
+    result->height = sw->height;
+    result->stride = sw->stride;
+    result->color  = sw->color;
+    result->depth  = sw->depth;
+    return true;
+}
+
+void Platform::SoftwareClearBuffer() {
+    // NOTE(alicia): pending draws would be cleared anyway, so they are dropped
+    SWState* sw = &SOFTWARE_STATE;
+    sw->batchCount = 0;
+    SWFlush();
+    sw->clearPending = true;
+}
+
+void Platform::SoftwareSetClearColor( f32 r, f32 g, f32 b, f32 a ) {
+    f32 color[4] = { r, g, b, a };
+    u32 packed = 0;
+    ucycles( 4 ) {
+        packed |= (u32)( smath::clamp( color[i], 0.0f, 1.0f ) * 255.0f + 0.5f ) << ( i * 8 );
+    }
+    SOFTWARE_STATE.clearColor = packed;
+}
+
+void Platform::SoftwareSetViewport( i32 width, i32 height ) {
+    SWState* sw = &SOFTWARE_STATE;
+    SWFlush();
+    width  = smath::clamp( width,  0, SOFTWARE_MAX_VIEWPORT );
+    height = smath::clamp( height, 0, SOFTWARE_MAX_VIEWPORT );
+    if( width == sw->width && height == sw->height ) {
+        return;
+    }
+    if( sw->color ) {
+        Platform::Free( sw->color );
+        Platform::Free( sw->depth );
+        sw->color = nullptr;
+        sw->depth = nullptr;
+    }
+    sw->width  = width;
+    sw->height = height;
+    // NOTE(alicia): rows are padded to whole groups of four pixels
+    sw->stride = ( width + 3 ) & ~3;
+    sw->tilesX = ( width  + SOFTWARE_TILE_SIZE - 1 ) / SOFTWARE_TILE_SIZE;
+    sw->tilesY = ( height + SOFTWARE_TILE_SIZE - 1 ) / SOFTWARE_TILE_SIZE;
+    if( width > 0 && height > 0 ) {
+        usize pixelCount = (usize)sw->stride * (usize)height;
+        sw->color = (u32*)Platform::Alloc( pixelCount * sizeof(u32) );
+        sw->depth = (f32*)Platform::Alloc( pixelCount * sizeof(f32) );
+        sw->clearPending = true;
+    }
+}
+
+void Platform::SoftwareSetPackAlignment( i32 packAlignment ) {
+    SOFTWARE_STATE.packAlignment = packAlignment;
+}
+
+void Platform::SoftwareSetUnPackAlignment( i32 unpackAlignment ) {
+    SOFTWARE_STATE.unpackAlignment = unpackAlignment;
+}
+
+void Platform::SoftwareSetBlendingEnable( bool enable ) {
+    SOFTWARE_STATE.blending = enable;
+}
+
+bool Platform::SoftwareIsBlendingEnabled() {
+    return SOFTWARE_STATE.blending;
+}
+
+void Platform::SoftwareSetBlendFunction( BlendFactor srcColor, BlendFactor dstColor, BlendFactor srcAlpha, BlendFactor dstAlpha ) {
+    SWState* sw = &SOFTWARE_STATE;
+    sw->blendFactors[0] = srcColor;
+    sw->blendFactors[1] = dstColor;
+    sw->blendFactors[2] = srcAlpha;
+    sw->blendFactors[3] = dstAlpha;
+}
+
+void Platform::SoftwareSetBlendEquation( BlendEq colorEq, BlendEq alphaEq ) {
+    SOFTWARE_STATE.blendEqs[0] = colorEq;
+    SOFTWARE_STATE.blendEqs[1] = alphaEq;
+}
+
+// NOTE(alicia): shader ------------------------------------------------------------------------
+
+bool Platform::SoftwareCreateShader(
+    const char* vertexSrc,
+    usize vertexLen,
+    const char* fragmentSrc,
+    usize fragmentLen,
+    Shader* result
+) {
+    *result = {};
+    const SoftwareShaderPort* port = SoftwareFindShaderPort( vertexSrc, vertexLen, fragmentSrc, fragmentLen );
+    if( !port ) {
+        LOG_ERROR( "Software > Shader has no software port!" );
+        return false;
+    }
+    SWShader* shader = (SWShader*)Platform::Alloc( sizeof(SWShader) );
+    shader->port = port;
+    result->id = SWTableAdd( &SOFTWARE_STATE.shaders, shader );
+    if( !result->id ) {
+        Platform::Free( shader );
+        return false;
+    }
+    return true;
+}
+
+void Platform::SoftwareDeleteShaders( usize shaderCount, Shader* shaders ) {
+    SWState* sw = &SOFTWARE_STATE;
+    ucycles( shaderCount ) {
+        SWShader* shader = (SWShader*)SWTableRemove( &sw->shaders, shaders[i].id );
+        if( !shader ) {
+            continue;
+        }
+        if( sw->shader == shader ) {
+            sw->shader = nullptr;
+        }
+        Platform::Free( shader );
+    }
+}
+
+void Platform::SoftwareUseShader( Shader* shader ) {
+    SOFTWARE_STATE.shader = (SWShader*)SWTableGet( &SOFTWARE_STATE.shaders, shader->id );
+}
+
+bool Platform::SoftwareGetUniformID( Shader* shader, const char* uniformName, i32* result ) {
+    SWShader* record = (SWShader*)SWTableGet( &SOFTWARE_STATE.shaders, shader->id );
+    if( record ) {
+        ucycles( record->port->uniformCount ) {
+            if( stringCmp( record->port->uniforms[i].name, uniformName ) ) {
+                *result = (i32)i;
+                return true;
+            }
+        }
+    }
+    LOG_ERROR( "Software > Uniform \"%s\" could not be found!", uniformName );
+    return false;
+}
+
+/// @brief Write value of uniform, structure must match its declaration
+static void SWUniform( Shader* shader, i32 uniform, DataStructure structure, const void* value ) {
+    SWShader* record = (SWShader*)SWTableGet( &SOFTWARE_STATE.shaders, shader->id );
+    if( !record || uniform < 0 || (usize)uniform >= record->port->uniformCount ) {
+        return;
+    }
+    const SoftwareUniform* declaration = &record->port->uniforms[uniform];
+    if( declaration->structure != structure ) {
+        LOG_ERROR( "Software > Uniform \"%s\" is %s, not %s!",
+            declaration->name,
+            DataStructureToString( declaration->structure ),
+            DataStructureToString( structure )
+        );
+        return;
+    }
+    Platform::MemCopy( DataStructureCount( structure ) * sizeof(f32), value,
+        record->uniforms + declaration->offset );
+}
+
+/// @brief Write scalar uniform as the type it's declared with, like glProgramUniform1* does for bools
+static void SWUniformScalar( Shader* shader, i32 uniform, f32 floatValue, i32 intValue ) {
+    SWShader* record = (SWShader*)SWTableGet( &SOFTWARE_STATE.shaders, shader->id );
+    if( !record || uniform < 0 || (usize)uniform >= record->port->uniformCount ) {
+        return;
+    }
+    if( record->port->uniforms[uniform].dataType == DataType::FLOAT ) {
+        SWUniform( shader, uniform, DataStructure::SCALAR, &floatValue );
+    } else {
+        SWUniform( shader, uniform, DataStructure::SCALAR, &intValue );
+    }
+}
+
+void Platform::SoftwareUniformFloat( Shader* shader, i32 uniform, f32 value ) {
+    SWUniformScalar( shader, uniform, value, (i32)value );
+}
+void Platform::SoftwareUniformUInt( Shader* shader, i32 uniform, u32 value ) {
+    SWUniformScalar( shader, uniform, (f32)value, (i32)value );
+}
+void Platform::SoftwareUniformInt( Shader* shader, i32 uniform, i32 value ) {
+    SWUniformScalar( shader, uniform, (f32)value, value );
+}
+void Platform::SoftwareUniformVec2( Shader* shader, i32 uniform, smath::vec2* value ) {
+    SWUniform( shader, uniform, DataStructure::VEC2, value->ptr() );
+}
+void Platform::SoftwareUniformVec3( Shader* shader, i32 uniform, smath::vec3* value ) {
+    SWUniform( shader, uniform, DataStructure::VEC3, value->ptr() );
+}
+void Platform::SoftwareUniformVec4( Shader* shader, i32 uniform, smath::vec4* value ) {
+    SWUniform( shader, uniform, DataStructure::VEC4, value->ptr() );
+}
+void Platform::SoftwareUniformMat3( Shader* shader, i32 uniform, smath::mat3* value ) {
+    SWUniform( shader, uniform, DataStructure::MAT3, value->ptr() );
+}
+void Platform::SoftwareUniformMat4( Shader* shader, i32 uniform, smath::mat4* value ) {
+    SWUniform( shader, uniform, DataStructure::MAT4, value->ptr() );
+}
+
+// NOTE(alicia): texture 2D --------------------------------------------------------------------
+
+/// @brief Number of levels of a full mip chain
+static u32 SWFullLevelCount( i32 width, i32 height ) {
+    i32 size = width > height ? width : height;
+    u32 result = 1;
+    while( size > 1 && result < TEXTURE_MAX_MIP_LEVELS ) {
+        size >>= 1;
+        result++;
+    }
+    return result;
+}
+
+static inline i32 SWLevelSize( i32 size, u32 level ) {
+    size >>= level;
+    return size > 0 ? size : 1;
+}
+
+/// @brief Allocate texture record with room for every level
+static SoftwareTexture* SWAllocTexture( i32 width, i32 height, u32 levelCount ) {
+    SoftwareTexture* texture = (SoftwareTexture*)Platform::Alloc( sizeof(SoftwareTexture) );
+    texture->width      = width;
+    texture->height     = height;
+    texture->levelCount = levelCount;
+    usize texelCount = 0;
+    ucycles( levelCount ) {
+        texelCount += (usize)SWLevelSize( width, (u32)i ) * (usize)SWLevelSize( height, (u32)i );
+    }
+    u32* texels = (u32*)Platform::Alloc( texelCount * sizeof(u32) );
+    ucycles( levelCount ) {
+        texture->levels[i] = texels;
+        texels += (usize)SWLevelSize( width, (u32)i ) * (usize)SWLevelSize( height, (u32)i );
+    }
+    return texture;
+}
+
+/// @brief Convert texels to RGBA8, components format doesn't have are (0, 0, 0, 1)
+static void SWConvertTexels(
+    const u8* src, usize rowPitch, i32 width, i32 height,
+    TextureFormat format, DataType dataType, u32* dst
+) {
+    usize componentCount = TextureFormatComponentCount( format );
+    usize componentSize  = DataTypeSize( dataType );
+    if( dataType != DataType::UNSIGNED_BYTE && dataType != DataType::FLOAT ) {
+        LOG_WARN( "Software > Textures of %s aren't supported!", DataTypeToString( dataType ) );
+    }
+    for( i32 y = 0; y < height; ++y ) {
+        const u8* row = src + (usize)y * rowPitch;
+        for( i32 x = 0; x < width; ++x ) {
+            u8 texel[4] = { 0, 0, 0, 255 };
+            ucycles( componentCount ) {
+                const u8* component = row + ( (usize)x * componentCount + i ) * componentSize;
+                if( dataType == DataType::UNSIGNED_BYTE ) {
+                    texel[i] = *component;
+                } else if( dataType == DataType::FLOAT ) {
+                    f32 value;
+                    Platform::MemCopy( sizeof(f32), component, &value );
+                    texel[i] = (u8)( smath::clamp( value, 0.0f, 1.0f ) * 255.0f + 0.5f );
+                }
+            }
+            dst[(usize)y * (usize)width + (usize)x] =
+                (u32)texel[0] | ( (u32)texel[1] << 8 ) | ( (u32)texel[2] << 16 ) | ( (u32)texel[3] << 24 );
+        }
+    }
+}
+
+/// @brief Box filter level into the next one, like glGenerateMipmap
+static void SWDownsample( const u32* src, i32 srcWidth, i32 srcHeight, u32* dst, i32 dstWidth, i32 dstHeight ) {
+    for( i32 y = 0; y < dstHeight; ++y ) {
+        i32 y0 = y * 2 < srcHeight ? y * 2 : srcHeight - 1;
+        i32 y1 = y * 2 + 1 < srcHeight ? y * 2 + 1 : srcHeight - 1;
+        for( i32 x = 0; x < dstWidth; ++x ) {
+            i32 x0 = x * 2 < srcWidth ? x * 2 : srcWidth - 1;
+            i32 x1 = x * 2 + 1 < srcWidth ? x * 2 + 1 : srcWidth - 1;
+            u32 texels[4] = {
+                src[y0 * srcWidth + x0], src[y0 * srcWidth + x1],
+                src[y1 * srcWidth + x0], src[y1 * srcWidth + x1]
+            };
+            u32 result = 0;
+            ucyclesi( 4, channel ) {
+                u32 sum = 2;
+                ucycles( 4 ) {
+                    sum += ( texels[i] >> ( channel * 8 ) ) & 0xFF;
+                }
+                result |= ( sum / 4 ) << ( channel * 8 );
+            }
+            dst[y * dstWidth + x] = result;
+        }
+    }
+}
+
+static Texture2D SWRegisterTexture(
+    SoftwareTexture* texture,
+    TextureFormat format,
+    DataType dataType,
+    TextureWrapMode wrapX,
+    TextureWrapMode wrapY,
+    TextureMinFilter minFilter,
+    TextureMagFilter magFilter
+) {
+    texture->wrapX     = wrapX;
+    texture->wrapY     = wrapY;
+    texture->minFilter = minFilter;
+    texture->magFilter = magFilter;
+
+    Texture2D result = {};
+    result.width     = texture->width;
+    result.height    = texture->height;
+    result.format    = format;
+    result.dataType  = dataType;
+    result.wrapModeX = wrapX;
+    result.wrapModeY = wrapY;
+    result.minFilter = minFilter;
+    result.magFilter = magFilter;
+    result.id        = SWTableAdd( &SOFTWARE_STATE.textures, texture );
+    if( !result.id ) {
+        Platform::Free( texture->levels[0] );
+        Platform::Free( texture );
+    }
+    return result;
+}
+
+Texture2D Platform::SoftwareCreateTexture2D(
+    i32 width,
+    i32 height,
+    void* data,
+    TextureFormat format,
+    DataType dataType,
+    TextureWrapMode wrapX,
+    TextureWrapMode wrapY,
+    TextureMinFilter minFilter,
+    TextureMagFilter magFilter,
+    const TextureMipChain* mips
+) {
+    SWState* sw = &SOFTWARE_STATE;
+    bool precomputed = mips && mips->levelCount > 1;
+    u32 levelCount = precomputed ?
+        ( mips->levelCount < TEXTURE_MAX_MIP_LEVELS ? mips->levelCount : TEXTURE_MAX_MIP_LEVELS ) :
+        SWFullLevelCount( width, height );
+    SoftwareTexture* texture = SWAllocTexture( width, height, levelCount );
+
+    usize texelSize = DataTypeSize( dataType ) * TextureFormatComponentCount( format );
+    usize alignment = sw->unpackAlignment > 0 ? (usize)sw->unpackAlignment : 1;
+    usize rowPitch  = ( (usize)width * texelSize + alignment - 1 ) / alignment * alignment;
+    SWConvertTexels( (const u8*)data, rowPitch, width, height, format, dataType, texture->levels[0] );
+    for( u32 level = 1; level < levelCount; ++level ) {
+        i32 levelWidth  = SWLevelSize( width, level );
+        i32 levelHeight = SWLevelSize( height, level );
+        if( precomputed ) {
+            // NOTE(alicia): precomputed levels have tightly packed rows
+            SWConvertTexels(
+                (const u8*)mips->levels[level], (usize)levelWidth * texelSize, levelWidth, levelHeight,
+                format, dataType, texture->levels[level]
+            );
+        } else {
+            SWDownsample(
+                texture->levels[level - 1], SWLevelSize( width, level - 1 ), SWLevelSize( height, level - 1 ),
+                texture->levels[level], levelWidth, levelHeight
+            );
+        }
+    }
+
+    Texture2D result = SWRegisterTexture( texture, format, dataType, wrapX, wrapY, minFilter, magFilter );
+    result.dataSize = (usize)width * (usize)height * texelSize;
+    result.data     = (u8*)Platform::Alloc( result.dataSize );
+    Platform::MemCopy( result.dataSize, data, result.data );
+    return result;
+}
+
+/// @brief Block format of compressed texture format
+static Core::BlockFormat SWBlockFormat( TextureFormat format ) {
+    switch( format ) {
+        case TextureFormat::BC1_RGB:  return Core::BlockFormat::BC1;
+        case TextureFormat::BC3_RGBA: return Core::BlockFormat::BC3;
+        case TextureFormat::BC4_R:    return Core::BlockFormat::BC4;
+        case TextureFormat::BC5_RG:   return Core::BlockFormat::BC5;
+        default:                      return Core::BlockFormat::BC7;
+    }
+}
+
+Texture2D Platform::SoftwareCreateCompressedTexture2D(
+    i32 width,
+    i32 height,
+    TextureFormat format,
+    TextureWrapMode wrapX,
+    TextureWrapMode wrapY,
+    TextureMinFilter minFilter,
+    TextureMagFilter magFilter,
+    const TextureMipChain* levels
+) {
+    // NOTE(alicia): blocks are decoded once, sampling reads RGBA8 like every other texture
+    u32 levelCount = levels->levelCount < TEXTURE_MAX_MIP_LEVELS ? levels->levelCount : TEXTURE_MAX_MIP_LEVELS;
+    levelCount = levelCount > 0 ? levelCount : 1;
+    SoftwareTexture* texture = SWAllocTexture( width, height, levelCount );
+    ucycles( levelCount ) {
+        if( levels->levels[i] ) {
+            Core::DecompressBlocks(
+                SWBlockFormat( format ),
+                SWLevelSize( width, (u32)i ), SWLevelSize( height, (u32)i ),
+                levels->levels[i], (u8*)texture->levels[i]
+            );
+        }
+    }
+    return SWRegisterTexture( texture, format, DataType::UNSIGNED_BYTE, wrapX, wrapY, minFilter, magFilter );
+}
+
+void Platform::SoftwareDeleteTextures2D( usize textureCount, Texture2D* textures ) {
+    SWState* sw = &SOFTWARE_STATE;
+    SWFlush();
+    ucycles( textureCount ) {
+        if( textures[i].data ) {
+            Platform::Free( textures[i].data );
+        }
+        SoftwareTexture* texture = (SoftwareTexture*)SWTableRemove( &sw->textures, textures[i].id );
+        if( !texture ) {
+            continue;
+        }
+        ucyclesi( SOFTWARE_TEXTURE_UNITS, unit ) {
+            if( sw->textureUnits[unit] == texture ) {
+                sw->textureUnits[unit] = nullptr;
+            }
+        }
+        Platform::Free( texture->levels[0] );
+        Platform::Free( texture );
+    }
+}
+
+void Platform::SoftwareUseTexture2D( Texture2D* texture, u32 unit ) {
+    if( unit < SOFTWARE_TEXTURE_UNITS ) {
+        SOFTWARE_STATE.textureUnits[unit] = (SoftwareTexture*)SWTableGet( &SOFTWARE_STATE.textures, texture->id );
+    }
+}
+
+void Platform::SoftwareSetTexture2DWrapMode( Texture2D* texture, TextureWrapMode wrapX, TextureWrapMode wrapY ) {
+    texture->wrapModeX = wrapX;
+    texture->wrapModeY = wrapY;
+    SoftwareTexture* record = (SoftwareTexture*)SWTableGet( &SOFTWARE_STATE.textures, texture->id );
+    if( record ) {
+        // NOTE(alicia): pending draws sample with the modes they were recorded with
+        SWFlush();
+        record->wrapX = wrapX;
+        record->wrapY = wrapY;
+    }
+}
+
+void Platform::SoftwareSetTexture2DFilter( Texture2D* texture, TextureMinFilter minFilter, TextureMagFilter magFilter ) {
+    texture->minFilter = minFilter;
+    texture->magFilter = magFilter;
+    SoftwareTexture* record = (SoftwareTexture*)SWTableGet( &SOFTWARE_STATE.textures, texture->id );
+    if( record ) {
+        SWFlush();
+        record->minFilter = minFilter;
+        record->magFilter = magFilter;
+    }
+}
+
+// NOTE(alicia): buffers -----------------------------------------------------------------------
+
+static u32 SWCreateBuffer( usize size, const void* data ) {
+    SWBuffer* buffer = (SWBuffer*)Platform::Alloc( sizeof(SWBuffer) );
+    buffer->size = size;
+    buffer->data = (u8*)Platform::Alloc( size ? size : 1 );
+    if( data ) {
+        Platform::MemCopy( size, data, buffer->data );
+    }
+    u32 id = SWTableAdd( &SOFTWARE_STATE.buffers, buffer );
+    if( !id ) {
+        Platform::Free( buffer->data );
+        Platform::Free( buffer );
+    }
+    return id;
+}
+
+void Platform::SoftwareDeleteBuffers( usize bufferCount, u32* bufferIDs ) {
+    SWState* sw = &SOFTWARE_STATE;
+    SWFlush();
+    ucycles( bufferCount ) {
+        SWBuffer* buffer = (SWBuffer*)SWTableRemove( &sw->buffers, bufferIDs[i] );
+        if( buffer ) {
+            Platform::Free( buffer->data );
+            Platform::Free( buffer );
+        }
+    }
+}
+
+IndexBuffer Platform::SoftwareCreateIndexBuffer( usize indexCount, void* indices, DataType indexDataType ) {
+    DEBUG_ASSERT_LOG(
+        indexDataType == DataType::UNSIGNED_BYTE ||
+        indexDataType == DataType::UNSIGNED_SHORT ||
+        indexDataType == DataType::UNSIGNED_INT,
+        "Index Data type can only be unsigned byte, short or int! Data type given: %s",
+        Platform::DataTypeToString( indexDataType )
+    );
+    // NOTE(alicia): index data is kept by the renderer, like it is on the GPU for OpenGL
+    IndexBuffer result = {};
+    result.dataType   = indexDataType;
+    result.indexCount = indexCount;
+    result.bufferSize = result.indexCount * Platform::DataTypeSize( result.dataType );
+    result.indices    = nullptr;
+    result.id         = SWCreateBuffer( result.bufferSize, indices );
+    return result;
+}
+void Platform::SoftwareUseIndexBuffer( IndexBuffer* ) {
+    // NOTE(alicia): draws read buffers of the vertex array they are given
+}
+void Platform::SoftwareDeleteIndexBuffers( usize count, IndexBuffer* buffers ) {
+    ucycles( count ) {
+        if( buffers[i].indices ) {
+            Platform::Free( buffers[i].indices );
+        }
+        Platform::SoftwareDeleteBuffers( 1, &buffers[i].id );
+    }
+}
+
+VertexBuffer Platform::SoftwareCreateVertexBuffer( usize bufferSize, void* vertices, VertexBufferLayout layout ) {
+    VertexBuffer result = {};
+    result.layout      = layout;
+    result.bufferSize  = bufferSize;
+    result.vertices    = nullptr;
+    result.vertexCount = result.bufferSize / result.layout.stride;
+    result.id          = SWCreateBuffer( bufferSize, vertices );
+    return result;
+}
+void Platform::SoftwareUseVertexBuffer( VertexBuffer* ) {
+}
+void Platform::SoftwareDeleteVertexBuffers( usize count, VertexBuffer* buffers ) {
+    ucycles( count ) {
+        if( buffers[i].vertices ) {
+            Platform::Free( buffers[i].vertices );
+        }
+        Platform::FreeVertexBufferLayout( &buffers[i].layout );
+        Platform::SoftwareDeleteBuffers( 1, &buffers[i].id );
+    }
+}
+void Platform::SoftwareVertexBufferSubData( VertexBuffer* vertexBuffer, usize offset, usize size, void* data ) {
+    DEBUG_ASSERT_LOG( offset + size <= vertexBuffer->bufferSize,
+        "Software | VertexBufferSubData > Offset + Size (%llu) is greater than Vertex Buffer size(%llu)!",
+        offset + size, vertexBuffer->bufferSize
+    );
+    SWBuffer* buffer = (SWBuffer*)SWTableGet( &SOFTWARE_STATE.buffers, vertexBuffer->id );
+    if( !buffer || offset + size > buffer->size ) {
+        return;
+    }
+    // NOTE(alicia): vertices are shaded when a draw is recorded, pending draws don't read buffer
+    Platform::MemCopy( size, data, buffer->data + offset );
+    buffer->version++;
+}
+
+VertexArray Platform::SoftwareCreateVertexArray() {
+    VertexArray result = {};
+    result.id = ++SOFTWARE_STATE.vertexArrayCount;
+    return result;
+}
+void Platform::SoftwareDeleteVertexArrays( usize count, VertexArray* vertexArrays ) {
+    ucycles( count ) {
+        VertexArray* vertexArray = &vertexArrays[i];
+        if( vertexArray->buffers ) {
+            Platform::SoftwareDeleteVertexBuffers( vertexArray->vertexBufferCount, vertexArray->buffers );
+            Platform::Free( vertexArray->buffers );
+            vertexArray->buffers = nullptr;
+        }
+        if( vertexArray->indexBuffer ) {
+            Platform::SoftwareDeleteIndexBuffers( 1, vertexArray->indexBuffer );
+            Platform::Free( vertexArray->indexBuffer );
+            vertexArray->indexBuffer = nullptr;
+        }
+    }
+}
+void Platform::SoftwareUseVertexArray( VertexArray* ) {
+}
+void Platform::SoftwareVertexArrayBindVertexBuffer( VertexArray* vertexArray, VertexBuffer buffer ) {
+    usize newSize = ( vertexArray->vertexBufferCount + 1 ) * sizeof(VertexBuffer);
+    VertexBuffer* buffers = (VertexBuffer*)Platform::Alloc( newSize );
+    if( vertexArray->buffers ) {
+        Platform::MemCopy( vertexArray->vertexBufferCount * sizeof(VertexBuffer), vertexArray->buffers, buffers );
+        Platform::Free( vertexArray->buffers );
+    }
+    buffers[vertexArray->vertexBufferCount] = buffer;
+    vertexArray->buffers = buffers;
+    vertexArray->vertexBufferCount++;
+    vertexArray->totalVertexCount += buffer.vertexCount;
+}
+void Platform::SoftwareVertexArrayBindIndexBuffer( VertexArray* vertexArray, IndexBuffer buffer ) {
+    if( vertexArray->indexBuffer ) {
+        Platform::SoftwareDeleteIndexBuffers( 1, vertexArray->indexBuffer );
+        Platform::Free( vertexArray->indexBuffer );
+    }
+    vertexArray->indexBuffer = (IndexBuffer*)Platform::Alloc( sizeof(IndexBuffer) );
+    Platform::MemCopy( sizeof(IndexBuffer), &buffer, vertexArray->indexBuffer );
+}
+
+UniformBuffer Platform::SoftwareCreateUniformBuffer( usize size, void* data ) {
+    UniformBuffer result = {};
+    result.size = size;
+    result.id   = SWCreateBuffer( size, data );
+    return result;
+}
+void Platform::SoftwareDeleteUniformBuffers( usize bufferCount, UniformBuffer* buffers ) {
+    ucycles( bufferCount ) {
+        Platform::SoftwareDeleteBuffers( 1, &buffers[i].id );
+    }
+}
+void Platform::SoftwareUniformBufferData( UniformBuffer* uniformBuffer, usize size, void* data ) {
+    DEBUG_ASSERT_LOG( size == uniformBuffer->size,
+        "Software | UniformBufferData > Uniform Buffer size(%llu) does not match input size(%llu)!",
+        uniformBuffer->size, size
+    );
+    Platform::SoftwareUniformBufferSubData( uniformBuffer, 0, size, data );
+}
+void Platform::SoftwareUniformBufferSubData( UniformBuffer* uniformBuffer, usize offset, usize size, void* data ) {
+    DEBUG_ASSERT_LOG( offset + size <= uniformBuffer->size,
+        "Software | UniformBufferSubData > Offset + Size (%llu) is greater than Uniform Buffer size(%llu)!",
+        offset + size, uniformBuffer->size
+    );
+    SWBuffer* buffer = (SWBuffer*)SWTableGet( &SOFTWARE_STATE.buffers, uniformBuffer->id );
+    if( !buffer || offset + size > buffer->size ) {
+        return;
+    }
+    // NOTE(alicia): pending draws keep the copy they were recorded with
+    Platform::MemCopy( size, data, buffer->data + offset );
+    buffer->version++;
+}
+void Platform::SoftwareUniformBufferSetBindingPoint( UniformBuffer* uniformBuffer, u32 bindingPoint ) {
+    Platform::SoftwareUniformBufferSetBindingPointRange( uniformBuffer, bindingPoint, 0, uniformBuffer->size );
+}
+void Platform::SoftwareUniformBufferSetBindingPointRange( UniformBuffer* uniformBuffer, u32 bindingPoint, usize offset, usize size ) {
+    if( bindingPoint >= SOFTWARE_UNIFORM_BINDINGS ) {
+        return;
+    }
+    SWBinding* binding = &SOFTWARE_STATE.bindings[bindingPoint];
+    binding->buffer = uniformBuffer->id;
+    binding->offset = offset;
+    binding->size   = size;
+    binding->copy   = nullptr;
+}
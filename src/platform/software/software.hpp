@@ -0,0 +1,136 @@
+/**
+ * Description:  Software renderer
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "pch.hpp"
+
+namespace Platform {
+
+struct Shader;
+struct Texture2D;
+struct TextureMipChain;
+struct UniformBuffer;
+struct VertexArray;
+struct VertexBuffer;
+struct IndexBuffer;
+struct VertexBufferLayout;
+enum class TextureFormat;
+enum class DataType;
+enum class TextureWrapMode;
+enum class TextureMinFilter;
+enum class TextureMagFilter;
+enum class BlendFactor;
+enum class BlendEq;
+
+/// @brief Start rasterizer threads
+/// @param threadCount number of threads including calling thread, 0 for one per logical processor
+/// @return true if successful
+bool SoftwareCreate( u32 threadCount );
+/// @brief Stop rasterizer threads and free every resource
+void SoftwareDestroy();
+/// @brief Finish pending draws
+void SoftwareSwapBuffers();
+void SoftwareInitialize();
+void SoftwareClearBuffer();
+void SoftwareSetClearColor( f32 r, f32 g, f32 b, f32 a );
+void SoftwareSetViewport( i32 width, i32 height );
+void SoftwareSetPackAlignment( i32 packAlignment );
+void SoftwareSetUnPackAlignment( i32 unpackAlignment );
+void SoftwareSetBlendingEnable( bool enable );
+bool SoftwareIsBlendingEnabled();
+void SoftwareSetBlendFunction( BlendFactor srcColor, BlendFactor dstColor, BlendFactor srcAlpha, BlendFactor dstAlpha );
+void SoftwareSetBlendEquation( BlendEq colorEq, BlendEq alphaEq );
+void SoftwareDrawVertexArray( VertexArray* vertexArray );
+void SoftwareDrawVertexArrayRange( VertexArray* vertexArray, usize firstIndex, usize indexCount, u32 baseVertex );
+void SoftwareDrawVertexArrayRanges(
+    VertexArray* vertexArray, usize rangeCount,
+    const u32* firstIndices, const u32* indexCounts, const u32* baseVertices
+);
+void SoftwareSetWireframeEnabled( bool enabled );
+
+// NOTE(alicia): shader
+
+bool SoftwareCreateShader(
+    const char* vertexSrc,
+    usize vertexLen,
+    const char* fragmentSrc,
+    usize fragmentLen,
+    Shader* result
+);
+void SoftwareDeleteShaders( usize shaderCount, Shader* shaders );
+void SoftwareUseShader( Shader* shader );
+bool SoftwareGetUniformID( Shader* shader, const char* uniformName, i32* result );
+void SoftwareUniformFloat( Shader* shader, i32 uniform, f32 value );
+void SoftwareUniformUInt( Shader* shader, i32 uniform, u32 value );
+void SoftwareUniformInt( Shader* shader, i32 uniform, i32 value );
+void SoftwareUniformVec2( Shader* shader, i32 uniform, smath::vec2* value );
+void SoftwareUniformVec3( Shader* shader, i32 uniform, smath::vec3* value );
+void SoftwareUniformVec4( Shader* shader, i32 uniform, smath::vec4* value );
+void SoftwareUniformMat3( Shader* shader, i32 uniform, smath::mat3* value );
+void SoftwareUniformMat4( Shader* shader, i32 uniform, smath::mat4* value );
+
+// NOTE(alicia): texture 2D
+
+Texture2D SoftwareCreateTexture2D(
+    i32 width,
+    i32 height,
+    void* data,
+    TextureFormat format,
+    DataType dataType,
+    TextureWrapMode wrapX,
+    TextureWrapMode wrapY,
+    TextureMinFilter minFilter,
+    TextureMagFilter magFilter,
+    const TextureMipChain* mips
+);
+Texture2D SoftwareCreateCompressedTexture2D(
+    i32 width,
+    i32 height,
+    TextureFormat format,
+    TextureWrapMode wrapX,
+    TextureWrapMode wrapY,
+    TextureMinFilter minFilter,
+    TextureMagFilter magFilter,
+    const TextureMipChain* levels
+);
+void SoftwareDeleteTextures2D( usize textureCount, Texture2D* textures );
+void SoftwareUseTexture2D( Texture2D* texture, u32 unit );
+void SoftwareSetTexture2DWrapMode( Texture2D* texture, TextureWrapMode wrapX, TextureWrapMode wrapY );
+void SoftwareSetTexture2DFilter( Texture2D* texture, TextureMinFilter minFilter, TextureMagFilter magFilter );
+
+// NOTE(alicia): Vertex Array
+
+VertexArray SoftwareCreateVertexArray();
+void SoftwareDeleteVertexArrays( usize count, VertexArray* vertexArrays );
+void SoftwareUseVertexArray( VertexArray* vertexArray );
+void SoftwareVertexArrayBindVertexBuffer( VertexArray* vertexArray, VertexBuffer buffer );
+void SoftwareVertexArrayBindIndexBuffer( VertexArray* vertexArray, IndexBuffer buffer );
+
+// NOTE(alicia): Vertex Buffer
+
+VertexBuffer SoftwareCreateVertexBuffer( usize bufferSize, void* vertices, VertexBufferLayout layout );
+void SoftwareUseVertexBuffer( VertexBuffer* buffer );
+void SoftwareDeleteVertexBuffers( usize count, VertexBuffer* buffers );
+void SoftwareVertexBufferSubData( VertexBuffer* buffer, usize offset, usize size, void* data );
+
+// NOTE(alicia): Index Buffer
+
+IndexBuffer SoftwareCreateIndexBuffer( usize indexCount, void* indices, DataType indexDataType );
+void SoftwareUseIndexBuffer( IndexBuffer* buffer );
+void SoftwareDeleteIndexBuffers( usize count, IndexBuffer* buffers );
+
+// NOTE(alicia): Uniform Buffer
+
+UniformBuffer SoftwareCreateUniformBuffer( usize size, void* data );
+void SoftwareDeleteUniformBuffers( usize bufferCount, UniformBuffer* buffers );
+void SoftwareUniformBufferData(UniformBuffer* uniformBuffer, usize size, void* data);
+void SoftwareUniformBufferSubData(UniformBuffer* uniformBuffer, usize offset, usize size, void* data);
+void SoftwareUniformBufferSetBindingPoint(UniformBuffer* uniformBuffer, u32 bindingPoint);
+void SoftwareUniformBufferSetBindingPointRange(UniformBuffer* uniformBuffer, u32 bindingPoint, usize offset, usize size);
+
+// NOTE(alicia): Buffers
+void SoftwareDeleteBuffers( usize bufferCount, u32* bufferIDs );
+
+} // namespace Platform
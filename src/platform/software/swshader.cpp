@@ -0,0 +1,442 @@
+/**
+ * Description:  Software renderer shader ports
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "swshader.hpp"
+#include <cstddef>
+
+using namespace Platform;
+
+// NOTE(alicia): every port mirrors a program in resources/shaders,
+// uniform names, binding points and varyings match their GLSL
+
+/// @brief Multiply column-major 4x4 matrix with vector
+static void SWMulMat4( const f32* matrix, const f32* vector, f32* result ) {
+    ucyclesi( 4, row ) {
+        result[row] =
+            matrix[ 0 + row] * vector[0] +
+            matrix[ 4 + row] * vector[1] +
+            matrix[ 8 + row] * vector[2] +
+            matrix[12 + row] * vector[3];
+    }
+}
+
+/// @brief Multiply column-major 3x3 matrix with vector
+static void SWMulMat3( const f32* matrix, const f32* vector, f32* result ) {
+    ucyclesi( 3, row ) {
+        result[row] =
+            matrix[0 + row] * vector[0] +
+            matrix[3 + row] * vector[1] +
+            matrix[6 + row] * vector[2];
+    }
+}
+
+/// @brief Read a block of uniform buffer binding, zeroes if binding is smaller than size
+static const u8* SWUniformBlock( const SoftwareDrawState* state, u32 binding, usize size ) {
+    static const u8 ZERO_BLOCK[512] = {};
+    if( !state->uniformBuffers[binding] || state->uniformBufferSizes[binding] < size ) {
+        return ZERO_BLOCK;
+    }
+    return state->uniformBuffers[binding];
+}
+
+/// @brief u_viewProjection * u_transform * vec4( x, y, 0.0, 1.0 )
+static void SWTransform2D( const SoftwareDrawState* state, const f32* transform, f32 x, f32 y, f32* result ) {
+    const f32* viewProjection = (const f32*)SWUniformBlock( state, 0, 64 );
+    f32 vertex[4] = { x, y, 0.0f, 1.0f };
+    f32 world[4];
+    SWMulMat4( transform, vertex, world );
+    SWMulMat4( viewProjection, world, result );
+}
+
+// NOTE(alicia): four lane vector math of fragment ports
+
+struct SWVec3 {
+    __m128 x, y, z;
+};
+
+static inline SWVec3 SWSet3( f32 x, f32 y, f32 z ) {
+    return { _mm_set1_ps( x ), _mm_set1_ps( y ), _mm_set1_ps( z ) };
+}
+static inline SWVec3 SWAdd3( SWVec3 a, SWVec3 b ) {
+    return { _mm_add_ps( a.x, b.x ), _mm_add_ps( a.y, b.y ), _mm_add_ps( a.z, b.z ) };
+}
+static inline SWVec3 SWSub3( SWVec3 a, SWVec3 b ) {
+    return { _mm_sub_ps( a.x, b.x ), _mm_sub_ps( a.y, b.y ), _mm_sub_ps( a.z, b.z ) };
+}
+static inline SWVec3 SWMul3( SWVec3 a, SWVec3 b ) {
+    return { _mm_mul_ps( a.x, b.x ), _mm_mul_ps( a.y, b.y ), _mm_mul_ps( a.z, b.z ) };
+}
+static inline SWVec3 SWScale3( SWVec3 a, __m128 scale ) {
+    return { _mm_mul_ps( a.x, scale ), _mm_mul_ps( a.y, scale ), _mm_mul_ps( a.z, scale ) };
+}
+static inline __m128 SWDot3( SWVec3 a, SWVec3 b ) {
+    return _mm_add_ps( _mm_add_ps( _mm_mul_ps( a.x, b.x ), _mm_mul_ps( a.y, b.y ) ), _mm_mul_ps( a.z, b.z ) );
+}
+static inline SWVec3 SWNormalize3( SWVec3 a ) {
+    // NOTE(alicia): zero vectors stay zero rather than NaN
+    __m128 lengthSqr = SWDot3( a, a );
+    __m128 nonZero   = _mm_cmpgt_ps( lengthSqr, _mm_setzero_ps() );
+    __m128 invLength = _mm_and_ps( nonZero,
+        _mm_div_ps( _mm_set1_ps( 1.0f ), _mm_sqrt_ps( lengthSqr ) ) );
+    return SWScale3( a, invLength );
+}
+static inline SWVec3 SWVarying3( const SoftwareFragments* fragments, u32 index ) {
+    return {
+        SoftwareVarying( fragments, index + 0 ),
+        SoftwareVarying( fragments, index + 1 ),
+        SoftwareVarying( fragments, index + 2 )
+    };
+}
+/// @brief pow for every lane
+static inline __m128 SWPow( __m128 x, f32 exponent ) {
+    alignas(16) f32 lanes[4];
+    _mm_store_ps( lanes, x );
+    ucycles( 4 ) {
+        lanes[i] = smath::pow( lanes[i], exponent );
+    }
+    return _mm_load_ps( lanes );
+}
+
+// NOTE(alicia): blinn_phong ------------------------------------------------------------------
+
+struct SWBlinnPhongUniforms {
+    f32 transform[16];
+    f32 normalMat[9];
+    i32 packedVertex;
+    i32 uvOriginTop;
+    f32 positionOffset[3];
+    f32 positionScale[3];
+    f32 surfaceTint[3];
+    i32 normalTexturePresent;
+    f32 glossiness;
+};
+
+// NOTE(alicia): std140 blocks of blinn_phong
+#define SW_MATRICES_BINDING 1
+#define SW_LIGHTS_BINDING 2
+#define SW_DATA_BINDING 3
+#define SW_LIGHTS_SIZE 320
+#define SW_DATA_SIZE 24
+#define SW_MAX_POINT_LIGHTS 4
+#define SW_POINT_LIGHTS_OFFSET 64
+#define SW_POINT_LIGHT_SIZE 64
+
+// varyings, localPosition isn't read by fragment shader so it's left out
+#define SW_BP_WORLD_POSITION 0
+#define SW_BP_NORMAL 3
+#define SW_BP_TANGENT 6
+#define SW_BP_BITANGENT 9
+#define SW_BP_UV 12
+#define SW_BP_VARYING_COUNT 14
+
+static void SWBlinnPhongVertex( const SoftwareDrawState* state, const f32 (*attributes)[4], f32* out ) {
+    const SWBlinnPhongUniforms* uniforms = (const SWBlinnPhongUniforms*)state->uniforms;
+    const f32* matrices = (const f32*)SWUniformBlock( state, SW_MATRICES_BINDING, 128 );
+
+    f32 position[4];
+    ucycles( 3 ) {
+        position[i] = uniforms->positionOffset[i] + attributes[0][i] * uniforms->positionScale[i];
+    }
+    position[3] = 1.0f;
+
+    f32 normal[3];
+    if( uniforms->packedVertex ) {
+        // octahedral decode
+        normal[0] = attributes[2][0];
+        normal[1] = attributes[2][1];
+        normal[2] = 1.0f - smath::abs( normal[0] ) - smath::abs( normal[1] );
+        f32 t = normal[2] < 0.0f ? -normal[2] : 0.0f;
+        normal[0] += normal[0] >= 0.0f ? -t : t;
+        normal[1] += normal[1] >= 0.0f ? -t : t;
+        f32 lengthSqr = normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2];
+        f32 invLength = lengthSqr > 0.0f ? 1.0f / smath::sqrt( lengthSqr ) : 0.0f;
+        ucycles( 3 ) {
+            normal[i] *= invLength;
+        }
+    } else {
+        ucycles( 3 ) {
+            normal[i] = attributes[2][i];
+        }
+    }
+    const f32* tangent = attributes[3];
+    f32 bitangent[3] = {
+        ( normal[1] * tangent[2] - normal[2] * tangent[1] ) * tangent[3],
+        ( normal[2] * tangent[0] - normal[0] * tangent[2] ) * tangent[3],
+        ( normal[0] * tangent[1] - normal[1] * tangent[0] ) * tangent[3]
+    };
+
+    f32* varyings = out + 4;
+    varyings[SW_BP_UV + 0] = attributes[1][0];
+    varyings[SW_BP_UV + 1] = uniforms->uvOriginTop ? 1.0f - attributes[1][1] : attributes[1][1];
+
+    f32 worldPosition[4];
+    SWMulMat4( uniforms->transform, position, worldPosition );
+    ucycles( 3 ) {
+        varyings[SW_BP_WORLD_POSITION + i] = worldPosition[i];
+    }
+    SWMulMat3( uniforms->normalMat, normal,    varyings + SW_BP_NORMAL );
+    SWMulMat3( uniforms->normalMat, tangent,   varyings + SW_BP_TANGENT );
+    SWMulMat3( uniforms->normalMat, bitangent, varyings + SW_BP_BITANGENT );
+
+    f32 viewPosition[4];
+    SWMulMat4( matrices, worldPosition, viewPosition );
+    SWMulMat4( matrices + 16, viewPosition, out );
+}
+
+static SWVec3 SWCalcDirectionalLight(
+    f32 glossiness,
+    SWVec3 surfaceNormal,
+    SWVec3 surfaceAlbedo,
+    __m128 surfaceSpecular,
+    SWVec3 cameraDirection,
+    SWVec3 lightDirection,
+    SWVec3 lightDiffuse,
+    SWVec3 lightSpecular
+) {
+    // NOTE(alicia): SSE
+    __m128 zero   = _mm_setzero_ps();
+    __m128 cutoff = _mm_max_ps( SWDot3( surfaceNormal, lightDirection ), zero );
+    SWVec3 surface = SWMul3( surfaceAlbedo, lightDiffuse );
+    SWVec3 ambient = SWScale3( surface, _mm_set1_ps( 0.2f ) );
+    SWVec3 diffuse = SWScale3( surface, cutoff );
+
+    // reflect( -lightDirection, surfaceNormal )
+    __m128 twoDot = _mm_mul_ps( _mm_set1_ps( 2.0f ), SWDot3( surfaceNormal, lightDirection ) );
+    SWVec3 reflectDirection = SWSub3( SWScale3( surfaceNormal, twoDot ), lightDirection );
+    __m128 specularStrength = SWPow(
+        _mm_max_ps( SWDot3( cameraDirection, reflectDirection ), zero ),
+        glossiness > 1.0f ? glossiness : 1.0f
+    );
+    SWVec3 specular = SWScale3( SWScale3( lightSpecular, surfaceSpecular ),
+        _mm_mul_ps( specularStrength, cutoff ) );
+
+    return SWAdd3( SWAdd3( diffuse, ambient ), specular );
+}
+
+static void SWBlinnPhongFragment( const SoftwareDrawState* state, const SoftwareFragments* fragments, __m128 color[4] ) {
+    const SWBlinnPhongUniforms* uniforms = (const SWBlinnPhongUniforms*)state->uniforms;
+    const u8* lights = SWUniformBlock( state, SW_LIGHTS_BINDING, SW_LIGHTS_SIZE );
+    const f32* data  = (const f32*)SWUniformBlock( state, SW_DATA_BINDING, SW_DATA_SIZE );
+
+    __m128 u = SoftwareVarying( fragments, SW_BP_UV + 0 );
+    __m128 v = SoftwareVarying( fragments, SW_BP_UV + 1 );
+    __m128 dudx, dudy, dvdx, dvdy;
+    SoftwareVaryingDerivatives( fragments, SW_BP_UV + 0, &dudx, &dudy );
+    SoftwareVaryingDerivatives( fragments, SW_BP_UV + 1, &dvdx, &dvdy );
+
+    __m128 texel[4];
+    SoftwareSample( state->textures[0], u, v, dudx, dvdx, dudy, dvdy, texel );
+    SWVec3 surfaceAlbedo = SWMul3(
+        SWSet3( uniforms->surfaceTint[0], uniforms->surfaceTint[1], uniforms->surfaceTint[2] ),
+        { texel[0], texel[1], texel[2] }
+    );
+    SoftwareSample( state->textures[1], u, v, dudx, dvdx, dudy, dvdy, texel );
+    __m128 surfaceSpecular = texel[0];
+    SWVec3 surfaceNormal = SWNormalize3( SWVarying3( fragments, SW_BP_NORMAL ) );
+
+    if( uniforms->normalTexturePresent ) {
+        SWVec3 tangent   = SWNormalize3( SWVarying3( fragments, SW_BP_TANGENT ) );
+        SWVec3 bitangent = SWNormalize3( SWVarying3( fragments, SW_BP_BITANGENT ) );
+        SoftwareSample( state->textures[2], u, v, dudx, dvdx, dudy, dvdy, texel );
+        __m128 one = _mm_set1_ps( 1.0f );
+        __m128 two = _mm_set1_ps( 2.0f );
+        __m128 x = _mm_sub_ps( _mm_mul_ps( texel[0], two ), one );
+        __m128 y = _mm_sub_ps( _mm_mul_ps( texel[1], two ), one );
+        __m128 z = _mm_sqrt_ps( _mm_max_ps(
+            _mm_sub_ps( one, _mm_add_ps( _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) ) ),
+            _mm_setzero_ps() ) );
+        surfaceNormal = SWNormalize3( SWAdd3(
+            SWAdd3( SWScale3( tangent, x ), SWScale3( bitangent, y ) ),
+            SWScale3( surfaceNormal, z )
+        ) );
+    }
+
+    const f32* ambient = (const f32*)lights;
+    SWVec3 surfaceColor = SWSet3( ambient[0], ambient[1], ambient[2] );
+
+    SWVec3 worldPosition   = SWVarying3( fragments, SW_BP_WORLD_POSITION );
+    SWVec3 cameraDirection = SWNormalize3( SWSub3( SWSet3( data[0], data[1], data[2] ), worldPosition ) );
+
+    const f32* directional = (const f32*)( lights + 16 );
+    surfaceColor = SWAdd3( surfaceColor, SWCalcDirectionalLight(
+        uniforms->glossiness,
+        surfaceNormal, surfaceAlbedo, surfaceSpecular, cameraDirection,
+        SWSet3( directional[0], directional[1], directional[2] ),
+        SWSet3( directional[4], directional[5], directional[6] ),
+        SWSet3( directional[8], directional[9], directional[10] )
+    ) );
+
+    ucycles( SW_MAX_POINT_LIGHTS ) {
+        const u8* point = lights + SW_POINT_LIGHTS_OFFSET + i * SW_POINT_LIGHT_SIZE;
+        if( !*(const i32*)( point + 60 ) ) {
+            continue;
+        }
+        const f32* values = (const f32*)point;
+        SWVec3 lightDirection = SWSub3( SWSet3( values[0], values[1], values[2] ), worldPosition );
+        __m128 lightDistance  = _mm_sqrt_ps( SWDot3( lightDirection, lightDirection ) );
+        SWVec3 lightColor = SWCalcDirectionalLight(
+            uniforms->glossiness,
+            surfaceNormal, surfaceAlbedo, surfaceSpecular, cameraDirection,
+            SWScale3( lightDirection, _mm_div_ps( _mm_set1_ps( 1.0f ), lightDistance ) ),
+            SWSet3( values[4], values[5], values[6] ),
+            SWSet3( values[8], values[9], values[10] )
+        );
+        __m128 attenuation = _mm_div_ps( _mm_set1_ps( 1.0f ), _mm_add_ps(
+            _mm_add_ps( _mm_set1_ps( values[12] ), _mm_mul_ps( _mm_set1_ps( values[13] ), lightDistance ) ),
+            _mm_mul_ps( _mm_set1_ps( values[14] ), _mm_mul_ps( lightDistance, lightDistance ) )
+        ) );
+        surfaceColor = SWAdd3( surfaceColor, SWScale3( lightColor, attenuation ) );
+    }
+
+    color[0] = surfaceColor.x;
+    color[1] = surfaceColor.y;
+    color[2] = surfaceColor.z;
+    color[3] = _mm_set1_ps( 1.0f );
+}
+
+static const char* const SW_BLINN_PHONG_IDENTIFIERS[] = { "u_albedoSampler", "u_normalMat" };
+static const SoftwareUniform SW_BLINN_PHONG_UNIFORMS[] = {
+    { "u_transform",            DataStructure::MAT4,   DataType::FLOAT, offsetof( SWBlinnPhongUniforms, transform ) },
+    { "u_normalMat",            DataStructure::MAT3,   DataType::FLOAT, offsetof( SWBlinnPhongUniforms, normalMat ) },
+    { "u_packedVertex",         DataStructure::SCALAR, DataType::INT,   offsetof( SWBlinnPhongUniforms, packedVertex ) },
+    { "u_uvOriginTop",          DataStructure::SCALAR, DataType::INT,   offsetof( SWBlinnPhongUniforms, uvOriginTop ) },
+    { "u_positionOffset",       DataStructure::VEC3,   DataType::FLOAT, offsetof( SWBlinnPhongUniforms, positionOffset ) },
+    { "u_positionScale",        DataStructure::VEC3,   DataType::FLOAT, offsetof( SWBlinnPhongUniforms, positionScale ) },
+    { "u_surfaceTint",          DataStructure::VEC3,   DataType::FLOAT, offsetof( SWBlinnPhongUniforms, surfaceTint ) },
+    { "u_normalTexturePresent", DataStructure::SCALAR, DataType::INT,   offsetof( SWBlinnPhongUniforms, normalTexturePresent ) },
+    { "u_glossiness",           DataStructure::SCALAR, DataType::FLOAT, offsetof( SWBlinnPhongUniforms, glossiness ) },
+};
+
+// NOTE(alicia): font --------------------------------------------------------------------------
+
+// NOTE(alicia): glyph quads are pre-transformed to pixels and carry their own atlas uv and color
+
+static void SWFontVertex( const SoftwareDrawState* state, const f32 (*attributes)[4], f32* out ) {
+    const f32* viewProjection = (const f32*)SWUniformBlock( state, 0, 64 );
+    f32 vertex[4] = { attributes[0][0], attributes[0][1], 0.0f, 1.0f };
+    SWMulMat4( viewProjection, vertex, out );
+    out[4 + 0] = attributes[1][0];
+    out[4 + 1] = attributes[1][1];
+    ucycles( 4 ) {
+        out[4 + 2 + i] = attributes[2][i];
+    }
+}
+
+static void SWFontFragment( const SoftwareDrawState* state, const SoftwareFragments* fragments, __m128 color[4] ) {
+    // NOTE(alicia): SSE
+    __m128 u = SoftwareVarying( fragments, 0 );
+    __m128 v = SoftwareVarying( fragments, 1 );
+    __m128 dudx, dudy, dvdx, dvdy;
+    SoftwareVaryingDerivatives( fragments, 0, &dudx, &dudy );
+    SoftwareVaryingDerivatives( fragments, 1, &dvdx, &dvdy );
+
+    __m128 texel[4];
+    SoftwareSample( state->textures[0], u, v, dudx, dvdx, dudy, dvdy, texel );
+    color[0] = SoftwareVarying( fragments, 2 );
+    color[1] = SoftwareVarying( fragments, 3 );
+    color[2] = SoftwareVarying( fragments, 4 );
+    color[3] = _mm_mul_ps( SoftwareVarying( fragments, 5 ), texel[0] );
+}
+
+static const char* const SW_FONT_IDENTIFIERS[] = { "vec4 v_color" };
+
+// NOTE(alicia): bounds ------------------------------------------------------------------------
+
+struct SWBoundsUniforms {
+    f32 transform[16];
+};
+
+static void SWBoundsVertex( const SoftwareDrawState* state, const f32 (*attributes)[4], f32* out ) {
+    const SWBoundsUniforms* uniforms = (const SWBoundsUniforms*)state->uniforms;
+    SWTransform2D( state, uniforms->transform, attributes[0][0], attributes[0][1], out );
+}
+
+static void SWBoundsFragment( const SoftwareDrawState*, const SoftwareFragments*, __m128 color[4] ) {
+    color[0] = _mm_setzero_ps();
+    color[1] = _mm_set1_ps( 1.0f );
+    color[2] = _mm_setzero_ps();
+    color[3] = _mm_set1_ps( 0.2f );
+}
+
+static const char* const SW_BOUNDS_IDENTIFIERS[] = { "vec2 v_vertex" };
+static const SoftwareUniform SW_BOUNDS_UNIFORMS[] = {
+    { "u_transform", DataStructure::MAT4, DataType::FLOAT, offsetof( SWBoundsUniforms, transform ) },
+};
+
+// ---------------------------------------------------------------------------------------------
+
+static const SoftwareShaderPort SW_SHADER_PORTS[] = {
+    {
+        "blinn_phong",
+        SW_BLINN_PHONG_IDENTIFIERS, ARRAY_COUNT( SW_BLINN_PHONG_IDENTIFIERS ),
+        SW_BLINN_PHONG_UNIFORMS, ARRAY_COUNT( SW_BLINN_PHONG_UNIFORMS ),
+        sizeof( SWBlinnPhongUniforms ),
+        ( 1 << SW_MATRICES_BINDING ) | ( 1 << SW_LIGHTS_BINDING ) | ( 1 << SW_DATA_BINDING ),
+        4, SW_BP_VARYING_COUNT,
+        SWBlinnPhongVertex, SWBlinnPhongFragment
+    },
+    {
+        "font",
+        SW_FONT_IDENTIFIERS, ARRAY_COUNT( SW_FONT_IDENTIFIERS ),
+        nullptr, 0,
+        0,
+        1 << 0,
+        3, 6,
+        SWFontVertex, SWFontFragment
+    },
+    {
+        "bounds",
+        SW_BOUNDS_IDENTIFIERS, ARRAY_COUNT( SW_BOUNDS_IDENTIFIERS ),
+        SW_BOUNDS_UNIFORMS, ARRAY_COUNT( SW_BOUNDS_UNIFORMS ),
+        sizeof( SWBoundsUniforms ),
+        1 << 0,
+        1, 0,
+        SWBoundsVertex, SWBoundsFragment
+    },
+};
+
+/// @brief Check if null-terminated identifier appears in source
+static bool SWSourceContains( const char* source, usize sourceLen, const char* identifier ) {
+    usize identifierLen = 0;
+    while( identifier[identifierLen] ) {
+        identifierLen++;
+    }
+    if( identifierLen > sourceLen ) {
+        return false;
+    }
+    for( usize start = 0; start + identifierLen <= sourceLen; ++start ) {
+        usize matched = 0;
+        while( matched < identifierLen && source[start + matched] == identifier[matched] ) {
+            matched++;
+        }
+        if( matched == identifierLen ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const SoftwareShaderPort* Platform::SoftwareFindShaderPort(
+    const char* vertexSrc, usize vertexLen,
+    const char* fragmentSrc, usize fragmentLen
+) {
+    ucycles( ARRAY_COUNT( SW_SHADER_PORTS ) ) {
+        const SoftwareShaderPort* port = &SW_SHADER_PORTS[i];
+        bool match = true;
+        ucyclesi( port->identifierCount, identifier ) {
+            if(
+                !SWSourceContains( vertexSrc, vertexLen, port->identifiers[identifier] ) &&
+                !SWSourceContains( fragmentSrc, fragmentLen, port->identifiers[identifier] )
+            ) {
+                match = false;
+                break;
+            }
+        }
+        if( match ) {
+            return port;
+        }
+    }
+    return nullptr;
+}
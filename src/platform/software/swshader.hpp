@@ -0,0 +1,127 @@
+/**
+ * Description:  Software renderer shader ports
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "pch.hpp"
+#include "platform/renderer.hpp"
+
+namespace Platform {
+
+#define SOFTWARE_TEXTURE_UNITS 4
+#define SOFTWARE_UNIFORM_BINDINGS 8
+#define SOFTWARE_MAX_ATTRIBUTES 8
+/// @brief Maximum number of floats a vertex port passes to its fragment port
+#define SOFTWARE_MAX_VARYINGS 16
+#define SOFTWARE_MAX_UNIFORM_BYTES 256
+
+/// @brief Texture as sampled by shader ports, every level is RGBA8
+struct SoftwareTexture {
+    i32 width;
+    i32 height;
+    u32 levelCount;
+    u32* levels[TEXTURE_MAX_MIP_LEVELS];
+    TextureWrapMode  wrapX;
+    TextureWrapMode  wrapY;
+    TextureMinFilter minFilter;
+    TextureMagFilter magFilter;
+};
+
+struct SoftwareShaderPort;
+
+/// @brief Everything shader ports read during a draw, copied when draw is recorded
+struct SoftwareDrawState {
+    const SoftwareShaderPort* port;
+    /// @brief Values of port uniforms, laid out as port describes them
+    const u8* uniforms;
+    /// @brief Uniform buffer ranges bound when draw was recorded, nullptr if port doesn't read binding
+    const u8* uniformBuffers[SOFTWARE_UNIFORM_BINDINGS];
+    usize uniformBufferSizes[SOFTWARE_UNIFORM_BINDINGS];
+    const SoftwareTexture* textures[SOFTWARE_TEXTURE_UNITS];
+};
+
+/// @brief Four horizontally adjacent fragments of a triangle, one per SSE lane
+struct SoftwareFragments {
+    /// @brief Perspective correct weights of triangle vertices
+    __m128 weights[3];
+    /// @brief Change of weights from one pixel to the next on x and y
+    __m128 weightsDX[3];
+    __m128 weightsDY[3];
+    /// @brief Varyings written by vertex port for each vertex of triangle
+    const f32* varyings[3];
+};
+
+/// @brief Interpolate varying at every fragment
+inline __m128 SoftwareVarying( const SoftwareFragments* fragments, u32 index ) {
+    // NOTE(alicia): SSE
+    __m128 result = _mm_mul_ps( fragments->weights[0], _mm_set1_ps( fragments->varyings[0][index] ) );
+    result = _mm_add_ps( result, _mm_mul_ps( fragments->weights[1], _mm_set1_ps( fragments->varyings[1][index] ) ) );
+    result = _mm_add_ps( result, _mm_mul_ps( fragments->weights[2], _mm_set1_ps( fragments->varyings[2][index] ) ) );
+    return result;
+}
+/// @brief Screen space derivatives of varying at every fragment, like dFdx and dFdy
+inline void SoftwareVaryingDerivatives( const SoftwareFragments* fragments, u32 index, __m128* dx, __m128* dy ) {
+    // NOTE(alicia): SSE
+    *dx = _mm_setzero_ps();
+    *dy = _mm_setzero_ps();
+    ucycles( 3 ) {
+        __m128 value = _mm_set1_ps( fragments->varyings[i][index] );
+        *dx = _mm_add_ps( *dx, _mm_mul_ps( fragments->weightsDX[i], value ) );
+        *dy = _mm_add_ps( *dy, _mm_mul_ps( fragments->weightsDY[i], value ) );
+    }
+}
+
+/// @brief Sample texture at four coordinates with its wrap modes and filters.
+/// Level of detail comes from derivatives of coordinates, the same way texture() picks it
+/// @param texture texture to sample, nullptr samples (0, 0, 0, 1) like an incomplete texture
+/// @param u,v texture coordinates
+/// @param dudx,dvdx,dudy,dvdy screen space derivatives of coordinates
+/// @param result [out] red, green, blue and alpha of every coordinate
+void SoftwareSample(
+    const SoftwareTexture* texture,
+    __m128 u, __m128 v,
+    __m128 dudx, __m128 dvdx, __m128 dudy, __m128 dvdy,
+    __m128 result[4]
+);
+
+/// @brief Transform vertex attributes, location i is attributes[i], missing components are (0, 0, 0, 1)
+/// @param out clip space position followed by varyings
+typedef void (*SoftwareVertexFN)( const SoftwareDrawState* state, const f32 (*attributes)[4], f32* out );
+/// @brief Shade four fragments
+/// @param color [out] red, green, blue and alpha of every fragment
+typedef void (*SoftwareFragmentFN)( const SoftwareDrawState* state, const SoftwareFragments* fragments, __m128 color[4] );
+
+struct SoftwareUniform {
+    const char*   name;
+    DataStructure structure;
+    DataType      dataType;
+    /// @brief Offset of value in draw state uniforms
+    usize         offset;
+};
+
+/// @brief C++ port of a GLSL program the app draws with
+struct SoftwareShaderPort {
+    const char* name;
+    /// @brief Port is picked when every identifier is found in vertex or fragment source
+    const char* const* identifiers;
+    usize identifierCount;
+    const SoftwareUniform* uniforms;
+    usize uniformCount;
+    usize uniformSize;
+    /// @brief Bit i is set if port reads uniform buffer binding i
+    u32 uniformBufferMask;
+    u32 attributeCount;
+    u32 varyingCount;
+    SoftwareVertexFN   vertex;
+    SoftwareFragmentFN fragment;
+};
+
+/// @brief Find the port of a GLSL program from its source
+/// @return port, nullptr if no port matches
+const SoftwareShaderPort* SoftwareFindShaderPort(
+    const char* vertexSrc, usize vertexLen,
+    const char* fragmentSrc, usize fragmentLen
+);
+
+} // namespace Platform
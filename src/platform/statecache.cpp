@@ -0,0 +1,566 @@
+/**
+ * Description:  Renderer state cache
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#include "statecache.hpp"
+#include "platform/io.hpp"
+
+using namespace Platform;
+
+/// @brief Texture units state cache remembers, binds to other units are passed through
+#define STATE_CACHE_TEXTURE_UNITS 16
+/// @brief Initial capacity of uniform table, must be a power of two
+#define STATE_CACHE_UNIFORM_CAPACITY 256
+
+#define STATE_KNOWN_SHADER         ( 1 << 0 )
+#define STATE_KNOWN_VERTEX_ARRAY   ( 1 << 1 )
+#define STATE_KNOWN_BLENDING       ( 1 << 2 )
+#define STATE_KNOWN_BLEND_FUNCTION ( 1 << 3 )
+#define STATE_KNOWN_BLEND_EQUATION ( 1 << 4 )
+#define STATE_KNOWN_WIREFRAME      ( 1 << 5 )
+#define STATE_KNOWN_CLEAR_COLOR    ( 1 << 6 )
+#define STATE_KNOWN_VIEWPORT       ( 1 << 7 )
+
+/// @brief Last value uploaded to a uniform, key is shader id in high bits and location in low bits
+struct StateCacheUniform {
+    u64 key;
+    bool used;
+    u32 size;
+    u32 value[16];
+};
+
+struct StateCache {
+    bool created;
+    RendererAPI backend;
+
+    u32 knownMask;
+    /// @brief Bit per texture unit
+    u32 knownTextures;
+    u32 shader;
+    u32 vertexArray;
+    u32 textures[STATE_CACHE_TEXTURE_UNITS];
+    bool blending;
+    bool wireframe;
+    BlendFactor blendFactors[4];
+    BlendEq blendEqs[2];
+    f32 clearColor[4];
+    i32 viewport[2];
+
+    /// @brief Open addressing table of uniform values
+    StateCacheUniform* uniforms;
+    u32 uniformCount;
+    u32 uniformCapacity;
+
+    StateCacheStats frame;
+    StateCacheStats lastFrame;
+};
+static StateCache STATE_CACHE = {};
+
+static u32 StateCacheUniformSlot( u64 key, u32 capacity ) {
+    return (u32)( ( key * 0x9E3779B97F4A7C15ull ) >> 32 ) & ( capacity - 1 );
+}
+
+static void StateCacheRebuildUniforms( u32 capacity, usize removedCount, const Shader* removed ) {
+    StateCache* cache = &STATE_CACHE;
+    StateCacheUniform* oldUniforms = cache->uniforms;
+    u32 oldCapacity = cache->uniformCapacity;
+
+    cache->uniforms = (StateCacheUniform*)Platform::Alloc( capacity * sizeof(StateCacheUniform) );
+    cache->uniformCapacity = cache->uniforms ? capacity : 0;
+    cache->uniformCount    = 0;
+    if( !cache->uniforms ) {
+        LOG_WARN( "State Cache > Failed to allocate uniform table, uniform uploads won't be filtered" );
+    }
+
+    ucycles( oldCapacity ) {
+        StateCacheUniform* uniform = &oldUniforms[i];
+        if( !uniform->used || !cache->uniforms ) {
+            continue;
+        }
+        u32 shader = (u32)( uniform->key >> 32 );
+        bool keep = true;
+        ucyclesi( removedCount, r ) {
+            if( removed[r].id == shader ) {
+                keep = false;
+                break;
+            }
+        }
+        if( !keep ) {
+            continue;
+        }
+        u32 slot = StateCacheUniformSlot( uniform->key, capacity );
+        while( cache->uniforms[slot].used ) {
+            slot = ( slot + 1 ) & ( capacity - 1 );
+        }
+        cache->uniforms[slot] = *uniform;
+        cache->uniformCount++;
+    }
+    if( oldUniforms ) {
+        Platform::Free( oldUniforms );
+    }
+}
+
+/// @brief Remember uniform value
+/// @return false if uniform already had value
+static bool StateCacheSetUniform( Shader* shader, i32 location, u32 size, const void* value ) {
+    StateCache* cache = &STATE_CACHE;
+    if( ( cache->uniformCount + 1 ) * 2 > cache->uniformCapacity ) {
+        StateCacheRebuildUniforms(
+            cache->uniformCapacity ? cache->uniformCapacity * 2 : STATE_CACHE_UNIFORM_CAPACITY, 0, nullptr );
+        if( !cache->uniforms ) {
+            return true;
+        }
+    }
+    u64 key  = ( (u64)shader->id << 32 ) | (u32)location;
+    u32 slot = StateCacheUniformSlot( key, cache->uniformCapacity );
+    while( cache->uniforms[slot].used && cache->uniforms[slot].key != key ) {
+        slot = ( slot + 1 ) & ( cache->uniformCapacity - 1 );
+    }
+    StateCacheUniform* uniform = &cache->uniforms[slot];
+    if( uniform->used ) {
+        if( uniform->size == size && MemCompare( size, uniform->value, value ) ) {
+            cache->frame.uniformsFiltered++;
+            return false;
+        }
+    } else {
+        uniform->used = true;
+        uniform->key  = key;
+        cache->uniformCount++;
+    }
+    uniform->size = size;
+    Platform::MemCopy( size, value, uniform->value );
+    cache->frame.uniformsIssued++;
+    return true;
+}
+
+/// @brief Count bind
+/// @return true if bind has to be passed to backend
+static bool StateCacheBind( bool changed ) {
+    if( changed ) {
+        STATE_CACHE.frame.bindsIssued++;
+    } else {
+        STATE_CACHE.frame.bindsFiltered++;
+    }
+    return changed;
+}
+
+static void StateCacheForgetTextures() {
+    STATE_CACHE.knownTextures = 0;
+}
+
+static void StateCacheInitialize() {
+    STATE_CACHE.backend.Initialize();
+    STATE_CACHE.knownMask     = 0;
+    STATE_CACHE.knownTextures = 0;
+}
+static void StateCacheClearBuffer() {
+    STATE_CACHE.backend.ClearBuffer();
+}
+static void StateCacheSwapBuffers() {
+    StateCache* cache = &STATE_CACHE;
+    cache->backend.SwapBuffers();
+    cache->lastFrame = cache->frame;
+    cache->frame     = {};
+}
+static void StateCacheSetClearColor( f32 r, f32 g, f32 b, f32 a ) {
+    StateCache* cache = &STATE_CACHE;
+    bool changed = !( cache->knownMask & STATE_KNOWN_CLEAR_COLOR ) ||
+        cache->clearColor[0] != r || cache->clearColor[1] != g ||
+        cache->clearColor[2] != b || cache->clearColor[3] != a;
+    if( StateCacheBind( changed ) ) {
+        cache->backend.SetClearColor( r, g, b, a );
+        cache->clearColor[0] = r;
+        cache->clearColor[1] = g;
+        cache->clearColor[2] = b;
+        cache->clearColor[3] = a;
+        cache->knownMask |= STATE_KNOWN_CLEAR_COLOR;
+    }
+}
+static void StateCacheSetViewport( i32 width, i32 height ) {
+    StateCache* cache = &STATE_CACHE;
+    bool changed = !( cache->knownMask & STATE_KNOWN_VIEWPORT ) ||
+        cache->viewport[0] != width || cache->viewport[1] != height;
+    if( StateCacheBind( changed ) ) {
+        cache->backend.SetViewport( width, height );
+        cache->viewport[0] = width;
+        cache->viewport[1] = height;
+        cache->knownMask |= STATE_KNOWN_VIEWPORT;
+    }
+}
+static void StateCacheSetPackAlignment( i32 packAlignment ) {
+    STATE_CACHE.backend.SetPackAlignment( packAlignment );
+}
+static void StateCacheSetUnPackAlignment( i32 unpackAlignment ) {
+    STATE_CACHE.backend.SetUnPackAlignment( unpackAlignment );
+}
+static void StateCacheSetBlendingEnable( bool enable ) {
+    StateCache* cache = &STATE_CACHE;
+    bool changed = !( cache->knownMask & STATE_KNOWN_BLENDING ) || cache->blending != enable;
+    if( StateCacheBind( changed ) ) {
+        cache->backend.SetBlendingEnable( enable );
+        cache->blending   = enable;
+        cache->knownMask |= STATE_KNOWN_BLENDING;
+    }
+}
+static bool StateCacheIsBlendingEnabled() {
+    StateCache* cache = &STATE_CACHE;
+    if( !( cache->knownMask & STATE_KNOWN_BLENDING ) ) {
+        cache->blending   = cache->backend.IsBlendingEnabled();
+        cache->knownMask |= STATE_KNOWN_BLENDING;
+    }
+    return cache->blending;
+}
+static void StateCacheSetBlendFunction( BlendFactor srcColor, BlendFactor dstColor, BlendFactor srcAlpha, BlendFactor dstAlpha ) {
+    StateCache* cache = &STATE_CACHE;
+    bool changed = !( cache->knownMask & STATE_KNOWN_BLEND_FUNCTION ) ||
+        cache->blendFactors[0] != srcColor || cache->blendFactors[1] != dstColor ||
+        cache->blendFactors[2] != srcAlpha || cache->blendFactors[3] != dstAlpha;
+    if( StateCacheBind( changed ) ) {
+        cache->backend.SetBlendFunction( srcColor, dstColor, srcAlpha, dstAlpha );
+        cache->blendFactors[0] = srcColor;
+        cache->blendFactors[1] = dstColor;
+        cache->blendFactors[2] = srcAlpha;
+        cache->blendFactors[3] = dstAlpha;
+        cache->knownMask |= STATE_KNOWN_BLEND_FUNCTION;
+    }
+}
+static void StateCacheSetBlendEquation( BlendEq colorEq, BlendEq alphaEq ) {
+    StateCache* cache = &STATE_CACHE;
+    bool changed = !( cache->knownMask & STATE_KNOWN_BLEND_EQUATION ) ||
+        cache->blendEqs[0] != colorEq || cache->blendEqs[1] != alphaEq;
+    if( StateCacheBind( changed ) ) {
+        cache->backend.SetBlendEquation( colorEq, alphaEq );
+        cache->blendEqs[0] = colorEq;
+        cache->blendEqs[1] = alphaEq;
+        cache->knownMask |= STATE_KNOWN_BLEND_EQUATION;
+    }
+}
+static void StateCacheDrawVertexArray( VertexArray* vertexArray ) {
+    STATE_CACHE.backend.DrawVertexArray( vertexArray );
+}
+static void StateCacheDrawVertexArrayRange( VertexArray* vertexArray, usize firstIndex, usize indexCount, u32 baseVertex ) {
+    STATE_CACHE.backend.DrawVertexArrayRange( vertexArray, firstIndex, indexCount, baseVertex );
+}
+static void StateCacheDrawVertexArrayRanges(
+    VertexArray* vertexArray, usize rangeCount,
+    const u32* firstIndices, const u32* indexCounts, const u32* baseVertices
+) {
+    STATE_CACHE.backend.DrawVertexArrayRanges( vertexArray, rangeCount, firstIndices, indexCounts, baseVertices );
+}
+static void StateCacheSetWireframeEnabled( bool enabled ) {
+    StateCache* cache = &STATE_CACHE;
+    bool changed = !( cache->knownMask & STATE_KNOWN_WIREFRAME ) || cache->wireframe != enabled;
+    if( StateCacheBind( changed ) ) {
+        cache->backend.SetWireframeEnabled( enabled );
+        cache->wireframe  = enabled;
+        cache->knownMask |= STATE_KNOWN_WIREFRAME;
+    }
+}
+
+// NOTE(alicia): vertex array
+
+static VertexArray StateCacheCreateVertexArray() {
+    return STATE_CACHE.backend.CreateVertexArray();
+}
+static void StateCacheDeleteVertexArrays( usize count, VertexArray* vertexArrays ) {
+    // NOTE(alicia): deleting bound vertex array unbinds it
+    STATE_CACHE.knownMask &= ~STATE_KNOWN_VERTEX_ARRAY;
+    STATE_CACHE.backend.DeleteVertexArrays( count, vertexArrays );
+}
+static void StateCacheUseVertexArray( VertexArray* vertexArray ) {
+    StateCache* cache = &STATE_CACHE;
+    bool changed = !( cache->knownMask & STATE_KNOWN_VERTEX_ARRAY ) || cache->vertexArray != vertexArray->id;
+    if( StateCacheBind( changed ) ) {
+        cache->backend.UseVertexArray( vertexArray );
+        cache->vertexArray = vertexArray->id;
+        cache->knownMask  |= STATE_KNOWN_VERTEX_ARRAY;
+    }
+}
+static void StateCacheVertexArrayBindVertexBuffer( VertexArray* vertexArray, VertexBuffer buffer ) {
+    STATE_CACHE.backend.VertexArrayBindVertexBuffer( vertexArray, buffer );
+}
+static void StateCacheVertexArrayBindIndexBuffer( VertexArray* vertexArray, IndexBuffer buffer ) {
+    STATE_CACHE.backend.VertexArrayBindIndexBuffer( vertexArray, buffer );
+}
+
+// NOTE(alicia): vertex buffer
+
+static VertexBuffer StateCacheCreateVertexBuffer( usize bufferSize, void* vertices, VertexBufferLayout layout ) {
+    return STATE_CACHE.backend.CreateVertexBuffer( bufferSize, vertices, layout );
+}
+static void StateCacheUseVertexBuffer( VertexBuffer* buffer ) {
+    STATE_CACHE.backend.UseVertexBuffer( buffer );
+}
+static void StateCacheDeleteVertexBuffers( usize count, VertexBuffer* buffers ) {
+    STATE_CACHE.backend.DeleteVertexBuffers( count, buffers );
+}
+static void StateCacheVertexBufferSubData( VertexBuffer* buffer, usize offset, usize size, void* data ) {
+    STATE_CACHE.backend.VertexBufferSubData( buffer, offset, size, data );
+}
+
+// NOTE(alicia): index buffer
+
+static IndexBuffer StateCacheCreateIndexBuffer( usize indexCount, void* indices, DataType indexDataType ) {
+    return STATE_CACHE.backend.CreateIndexBuffer( indexCount, indices, indexDataType );
+}
+static void StateCacheUseIndexBuffer( IndexBuffer* buffer ) {
+    STATE_CACHE.backend.UseIndexBuffer( buffer );
+}
+static void StateCacheDeleteIndexBuffers( usize count, IndexBuffer* buffers ) {
+    STATE_CACHE.backend.DeleteIndexBuffers( count, buffers );
+}
+
+// NOTE(alicia): uniform buffer
+
+static UniformBuffer StateCacheCreateUniformBuffer( usize size, void* data ) {
+    return STATE_CACHE.backend.CreateUniformBuffer( size, data );
+}
+static void StateCacheDeleteUniformBuffers( usize bufferCount, UniformBuffer* buffers ) {
+    STATE_CACHE.backend.DeleteUniformBuffers( bufferCount, buffers );
+}
+static void StateCacheUniformBufferData( UniformBuffer* uniformBuffer, usize size, void* data ) {
+    STATE_CACHE.backend.UniformBufferData( uniformBuffer, size, data );
+}
+static void StateCacheUniformBufferSubData( UniformBuffer* uniformBuffer, usize offset, usize size, void* data ) {
+    STATE_CACHE.backend.UniformBufferSubData( uniformBuffer, offset, size, data );
+}
+static void StateCacheUniformBufferSetBindingPoint( UniformBuffer* uniformBuffer, u32 bindingPoint ) {
+    STATE_CACHE.backend.UniformBufferSetBindingPoint( uniformBuffer, bindingPoint );
+}
+static void StateCacheUniformBufferSetBindingPointRange( UniformBuffer* uniformBuffer, u32 bindingPoint, usize offset, usize size ) {
+    STATE_CACHE.backend.UniformBufferSetBindingPointRange( uniformBuffer, bindingPoint, offset, size );
+}
+
+// NOTE(alicia): shader
+
+static bool StateCacheCreateShader(
+    const char* vertexSrc, usize vertexLen,
+    const char* fragmentSrc, usize fragmentLen,
+    Shader* result
+) {
+    StateCache* cache = &STATE_CACHE;
+    bool success = cache->backend.CreateShader( vertexSrc, vertexLen, fragmentSrc, fragmentLen, result );
+    // NOTE(alicia): new shader can reuse id of a deleted one, its uniforms start out unknown
+    if( success && cache->uniformCount ) {
+        StateCacheRebuildUniforms( cache->uniformCapacity, 1, result );
+    }
+    return success;
+}
+static void StateCacheDeleteShaders( usize shaderCount, Shader* shaders ) {
+    StateCache* cache = &STATE_CACHE;
+    if( cache->uniformCount ) {
+        StateCacheRebuildUniforms( cache->uniformCapacity, shaderCount, shaders );
+    }
+    cache->knownMask &= ~STATE_KNOWN_SHADER;
+    cache->backend.DeleteShaders( shaderCount, shaders );
+}
+static void StateCacheUseShader( Shader* shader ) {
+    StateCache* cache = &STATE_CACHE;
+    bool changed = !( cache->knownMask & STATE_KNOWN_SHADER ) || cache->shader != shader->id;
+    if( StateCacheBind( changed ) ) {
+        cache->backend.UseShader( shader );
+        cache->shader     = shader->id;
+        cache->knownMask |= STATE_KNOWN_SHADER;
+    }
+}
+static bool StateCacheGetUniformID( Shader* shader, const char* uniformName, i32* result ) {
+    return STATE_CACHE.backend.GetUniformID( shader, uniformName, result );
+}
+static void StateCacheUniformFloat( Shader* shader, i32 uniform, f32 value ) {
+    if( StateCacheSetUniform( shader, uniform, sizeof(value), &value ) ) {
+        STATE_CACHE.backend.UniformFloat( shader, uniform, value );
+    }
+}
+static void StateCacheUniformUInt( Shader* shader, i32 uniform, u32 value ) {
+    if( StateCacheSetUniform( shader, uniform, sizeof(value), &value ) ) {
+        STATE_CACHE.backend.UniformUInt( shader, uniform, value );
+    }
+}
+static void StateCacheUniformInt( Shader* shader, i32 uniform, i32 value ) {
+    if( StateCacheSetUniform( shader, uniform, sizeof(value), &value ) ) {
+        STATE_CACHE.backend.UniformInt( shader, uniform, value );
+    }
+}
+static void StateCacheUniformVec2( Shader* shader, i32 uniform, smath::vec2* value ) {
+    if( StateCacheSetUniform( shader, uniform, sizeof(f32) * 2, value->ptr() ) ) {
+        STATE_CACHE.backend.UniformVec2( shader, uniform, value );
+    }
+}
+static void StateCacheUniformVec3( Shader* shader, i32 uniform, smath::vec3* value ) {
+    if( StateCacheSetUniform( shader, uniform, sizeof(f32) * 3, value->ptr() ) ) {
+        STATE_CACHE.backend.UniformVec3( shader, uniform, value );
+    }
+}
+static void StateCacheUniformVec4( Shader* shader, i32 uniform, smath::vec4* value ) {
+    if( StateCacheSetUniform( shader, uniform, sizeof(f32) * 4, value->ptr() ) ) {
+        STATE_CACHE.backend.UniformVec4( shader, uniform, value );
+    }
+}
+static void StateCacheUniformMat3( Shader* shader, i32 uniform, smath::mat3* value ) {
+    if( StateCacheSetUniform( shader, uniform, sizeof(f32) * 9, value->ptr() ) ) {
+        STATE_CACHE.backend.UniformMat3( shader, uniform, value );
+    }
+}
+static void StateCacheUniformMat4( Shader* shader, i32 uniform, smath::mat4* value ) {
+    if( StateCacheSetUniform( shader, uniform, sizeof(f32) * 16, value->ptr() ) ) {
+        STATE_CACHE.backend.UniformMat4( shader, uniform, value );
+    }
+}
+
+// NOTE(alicia): texture 2D
+// creating textures and changing their parameters binds them on OpenGL
+
+static Texture2D StateCacheCreateTexture2D(
+    i32 width,
+    i32 height,
+    void* data,
+    TextureFormat format,
+    DataType dataType,
+    TextureWrapMode wrapX,
+    TextureWrapMode wrapY,
+    TextureMinFilter minFilter,
+    TextureMagFilter magFilter,
+    const TextureMipChain* mips
+) {
+    StateCacheForgetTextures();
+    return STATE_CACHE.backend.CreateTexture2D(
+        width, height, data, format, dataType, wrapX, wrapY, minFilter, magFilter, mips );
+}
+static Texture2D StateCacheCreateCompressedTexture2D(
+    i32 width,
+    i32 height,
+    TextureFormat format,
+    TextureWrapMode wrapX,
+    TextureWrapMode wrapY,
+    TextureMinFilter minFilter,
+    TextureMagFilter magFilter,
+    const TextureMipChain* levels
+) {
+    StateCacheForgetTextures();
+    return STATE_CACHE.backend.CreateCompressedTexture2D(
+        width, height, format, wrapX, wrapY, minFilter, magFilter, levels );
+}
+static void StateCacheDeleteTextures2D( usize textureCount, Texture2D* textures ) {
+    StateCacheForgetTextures();
+    STATE_CACHE.backend.DeleteTextures2D( textureCount, textures );
+}
+static void StateCacheUseTexture2D( Texture2D* texture, u32 unit ) {
+    StateCache* cache = &STATE_CACHE;
+    if( unit >= STATE_CACHE_TEXTURE_UNITS ) {
+        StateCacheBind( true );
+        cache->backend.UseTexture2D( texture, unit );
+        return;
+    }
+    bool changed = !( cache->knownTextures & ( 1 << unit ) ) || cache->textures[unit] != texture->id;
+    if( StateCacheBind( changed ) ) {
+        cache->backend.UseTexture2D( texture, unit );
+        cache->textures[unit]  = texture->id;
+        cache->knownTextures  |= 1 << unit;
+    }
+}
+static void StateCacheSetTexture2DWrapMode( Texture2D* texture, TextureWrapMode wrapX, TextureWrapMode wrapY ) {
+    StateCacheForgetTextures();
+    STATE_CACHE.backend.SetTexture2DWrapMode( texture, wrapX, wrapY );
+}
+static void StateCacheSetTexture2DFilter( Texture2D* texture, TextureMinFilter minFilter, TextureMagFilter magFilter ) {
+    StateCacheForgetTextures();
+    STATE_CACHE.backend.SetTexture2DFilter( texture, minFilter, magFilter );
+}
+
+// NOTE(alicia): api ---------------------------------------------------------------------------
+
+bool Platform::CreateStateCacheAPI( RendererAPI* api, const RendererAPI* backend ) {
+    StateCache* cache = &STATE_CACHE;
+    if( cache->created ) {
+        DestroyStateCacheAPI();
+    }
+    *cache = {};
+    cache->backend = *backend;
+    cache->created = true;
+
+    api->Initialize            = StateCacheInitialize;
+    api->ClearBuffer           = StateCacheClearBuffer;
+    api->SwapBuffers           = StateCacheSwapBuffers;
+    api->SetClearColor         = StateCacheSetClearColor;
+    api->SetViewport           = StateCacheSetViewport;
+    api->SetPackAlignment      = StateCacheSetPackAlignment;
+    api->SetUnPackAlignment    = StateCacheSetUnPackAlignment;
+    api->SetBlendingEnable     = StateCacheSetBlendingEnable;
+    api->IsBlendingEnabled     = StateCacheIsBlendingEnabled;
+    api->SetBlendFunction      = StateCacheSetBlendFunction;
+    api->SetBlendEquation      = StateCacheSetBlendEquation;
+    api->DrawVertexArray       = StateCacheDrawVertexArray;
+    api->DrawVertexArrayRange  = StateCacheDrawVertexArrayRange;
+    api->DrawVertexArrayRanges = StateCacheDrawVertexArrayRanges;
+    api->SetWireframeEnabled   = StateCacheSetWireframeEnabled;
+
+    // NOTE(alicia): Shader
+
+    api->CreateShader  = StateCacheCreateShader;
+    api->DeleteShaders = StateCacheDeleteShaders;
+    api->UseShader     = StateCacheUseShader;
+    api->GetUniformID  = StateCacheGetUniformID;
+    api->UniformFloat  = StateCacheUniformFloat;
+    api->UniformUInt   = StateCacheUniformUInt;
+    api->UniformInt    = StateCacheUniformInt;
+    api->UniformVec2   = StateCacheUniformVec2;
+    api->UniformVec3   = StateCacheUniformVec3;
+    api->UniformVec4   = StateCacheUniformVec4;
+    api->UniformMat3   = StateCacheUniformMat3;
+    api->UniformMat4   = StateCacheUniformMat4;
+
+    // NOTE(alicia): Texture2D
+
+    api->CreateTexture2D           = StateCacheCreateTexture2D;
+    api->CreateCompressedTexture2D = StateCacheCreateCompressedTexture2D;
+    api->DeleteTextures2D          = StateCacheDeleteTextures2D;
+    api->UseTexture2D              = StateCacheUseTexture2D;
+    api->SetTexture2DFilter        = StateCacheSetTexture2DFilter;
+    api->SetTexture2DWrapMode      = StateCacheSetTexture2DWrapMode;
+
+    // NOTE(alicia): Uniform Buffer
+
+    api->CreateUniformBuffer               = StateCacheCreateUniformBuffer;
+    api->DeleteUniformBuffers              = StateCacheDeleteUniformBuffers;
+    api->UniformBufferData                 = StateCacheUniformBufferData;
+    api->UniformBufferSubData              = StateCacheUniformBufferSubData;
+    api->UniformBufferSetBindingPoint      = StateCacheUniformBufferSetBindingPoint;
+    api->UniformBufferSetBindingPointRange = StateCacheUniformBufferSetBindingPointRange;
+
+    // NOTE(alicia): Vertex Array
+    api->CreateVertexArray           = StateCacheCreateVertexArray;
+    api->DeleteVertexArrays          = StateCacheDeleteVertexArrays;
+    api->UseVertexArray              = StateCacheUseVertexArray;
+    api->VertexArrayBindVertexBuffer = StateCacheVertexArrayBindVertexBuffer;
+    api->VertexArrayBindIndexBuffer  = StateCacheVertexArrayBindIndexBuffer;
+
+    // NOTE(alicia): Vertex Buffer
+    api->CreateVertexBuffer  = StateCacheCreateVertexBuffer;
+    api->UseVertexBuffer     = StateCacheUseVertexBuffer;
+    api->DeleteVertexBuffers = StateCacheDeleteVertexBuffers;
+    api->VertexBufferSubData = StateCacheVertexBufferSubData;
+
+    // NOTE(alicia): Index Buffer
+    api->CreateIndexBuffer  = StateCacheCreateIndexBuffer;
+    api->UseIndexBuffer     = StateCacheUseIndexBuffer;
+    api->DeleteIndexBuffers = StateCacheDeleteIndexBuffers;
+
+    LOG_INFO( "State Cache > Filtering redundant renderer calls" );
+    return true;
+}
+
+void Platform::DestroyStateCacheAPI() {
+    StateCache* cache = &STATE_CACHE;
+    if( !cache->created ) {
+        return;
+    }
+    if( cache->uniforms ) {
+        Platform::Free( cache->uniforms );
+    }
+    *cache = {};
+}
+
+void Platform::GetStateCacheStats( StateCacheStats* result ) {
+    *result = STATE_CACHE.lastFrame;
+}
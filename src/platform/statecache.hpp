@@ -0,0 +1,36 @@
+/**
+ * Description:  Renderer state cache
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+*/
+#pragma once
+#include "renderer.hpp"
+
+namespace Platform {
+
+/// @brief Renderer calls of a frame
+struct StateCacheStats {
+    /// @brief Binds and fixed function state changes passed to backend
+    u32 bindsIssued;
+    /// @brief Binds and fixed function state changes backend already had
+    u32 bindsFiltered;
+    /// @brief Uniform uploads passed to backend
+    u32 uniformsIssued;
+    /// @brief Uniform uploads of values shader already had
+    u32 uniformsFiltered;
+};
+
+/// @brief Create renderer api that remembers state it set on backend
+/// and drops binds, state changes and uniform uploads that wouldn't change anything.
+/// State is forgotten whenever backend could have changed it on its own
+/// (texture creation, deletion and parameter changes bind textures on OpenGL)
+/// @param api [out] caching api
+/// @param backend api calls are passed to, copied
+/// @return true if successful
+bool CreateStateCacheAPI( RendererAPI* api, const RendererAPI* backend );
+/// @brief Free state cache
+void DestroyStateCacheAPI();
+/// @brief Get counters of last frame, a frame ends with SwapBuffers
+void GetStateCacheStats( StateCacheStats* result );
+
+} // namespace Platform
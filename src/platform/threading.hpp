@@ -0,0 +1,65 @@
+/**
+ * Description:  Threading Platform Functions
+ * Author:       Alicia Amarilla (smushy) 
+ * File Created: October 17, 2026 
+ */
+#pragma once
+#include "pch.hpp"
+
+namespace Platform {
+
+/// @brief Thread entry point
+typedef void (*ThreadProcFN)( void* params );
+
+struct Thread {
+    void* handle;
+};
+
+/// @brief Create and start a thread
+/// @param proc thread entry point
+/// @param params parameters passed to entry point
+/// @param result [out] thread
+/// @return true if successful
+bool ThreadCreate( ThreadProcFN proc, void* params, Thread* result );
+/// @brief Wait for thread to finish and release its handle
+void ThreadJoin( Thread* thread );
+
+struct Semaphore {
+    void* handle;
+};
+
+/// @brief Create a semaphore
+/// @param initialCount initial count
+/// @param maxCount maximum count
+/// @param result [out] semaphore
+/// @return true if successful
+bool SemaphoreCreate( u32 initialCount, u32 maxCount, Semaphore* result );
+/// @brief Increment semaphore count by given amount
+void SemaphoreSignal( Semaphore* semaphore, u32 count );
+/// @brief Wait until semaphore count is greater than zero then decrement it
+void SemaphoreWait( Semaphore* semaphore );
+/// @brief Destroy semaphore
+void SemaphoreDestroy( Semaphore* semaphore );
+
+/// @brief Get number of logical processors
+u32 GetProcessorCount();
+
+// NOTE(alicia): all atomic functions are full memory barriers
+
+/// @brief Atomically increment value
+/// @return incremented value
+i32 AtomicIncrement( volatile i32* value );
+/// @brief Atomically decrement value
+/// @return decremented value
+i32 AtomicDecrement( volatile i32* value );
+/// @brief Atomically add to value
+/// @return value before addition
+i32 AtomicAdd( volatile i32* value, i32 addend );
+/// @brief Atomically add to value
+/// @return value before addition
+i64 AtomicAdd( volatile i64* value, i64 addend );
+/// @brief Atomically replace value with exchange if it equals comparand
+/// @return value before exchange
+i32 AtomicCompareExchange( volatile i32* value, i32 exchange, i32 comparand );
+
+} // namespace Platform
@@ -8,8 +8,11 @@
 #include "win64main.hpp"
 #include "core/app.hpp"
 #include "platform/renderer.hpp"
+#include "platform/commandbuffer.hpp"
+#include "platform/statecache.hpp"
 #include "util.hpp"
 #include "platform/io.hpp"
+#include "platform/threading.hpp"
 
 void CenterCursor( HWND window );
 Platform::CursorStyle CURSOR_STYLE = Platform::CursorStyle::ARROW;
@@ -23,6 +26,115 @@ void WinSwapBuffers() {
     SwapBuffers( DEVICE_CONTEXT );
 }
 
+static u32* SOFTWARE_PRESENT_BUFFER = nullptr;
+static usize SOFTWARE_PRESENT_BUFFER_SIZE = 0;
+void WinSoftwareSwapBuffers() {
+    Platform::SoftwareFramebuffer framebuffer;
+    if( !Platform::SoftwareReadFramebuffer( &framebuffer ) ) {
+        return;
+    }
+    // NOTE(alicia): software framebuffer is RGBA, GDI expects BGRA
+    usize pixelCount = (usize)framebuffer.stride * (usize)framebuffer.height;
+    if( pixelCount > SOFTWARE_PRESENT_BUFFER_SIZE ) {
+        if( SOFTWARE_PRESENT_BUFFER ) {
+            Platform::Free( SOFTWARE_PRESENT_BUFFER );
+        }
+        SOFTWARE_PRESENT_BUFFER = (u32*)Platform::Alloc( pixelCount * sizeof(u32) );
+        SOFTWARE_PRESENT_BUFFER_SIZE = pixelCount;
+    }
+    ucycles( pixelCount ) {
+        u32 pixel = framebuffer.color[i];
+        SOFTWARE_PRESENT_BUFFER[i] =
+            ( pixel & 0xFF00FF00 ) | ( ( pixel & 0xFF ) << 16 ) | ( ( pixel >> 16 ) & 0xFF );
+    }
+
+    // positive height, rows are bottom to top like the framebuffer
+    BITMAPINFO bitmapInfo = {};
+    bitmapInfo.bmiHeader.biSize        = sizeof( bitmapInfo.bmiHeader );
+    bitmapInfo.bmiHeader.biWidth       = framebuffer.stride;
+    bitmapInfo.bmiHeader.biHeight      = framebuffer.height;
+    bitmapInfo.bmiHeader.biPlanes      = 1;
+    bitmapInfo.bmiHeader.biBitCount    = 32;
+    bitmapInfo.bmiHeader.biCompression = BI_RGB;
+    StretchDIBits(
+        DEVICE_CONTEXT,
+        0, 0, framebuffer.width, framebuffer.height,
+        0, 0, framebuffer.width, framebuffer.height,
+        SOFTWARE_PRESENT_BUFFER,
+        &bitmapInfo,
+        DIB_RGB_COLORS,
+        SRCCOPY
+    );
+}
+
+/// @brief Find value of key in settings.ini text
+/// @return false if key isn't set
+static bool WinFindSetting( const Platform::File* settings, const char* key, usize* valueLen, const char** value ) {
+    const char* text = (const char*)settings->data;
+    usize keyLen = stringLen( key );
+    usize at = 0;
+    while( at < settings->size ) {
+        usize lineStart = at;
+        while( at < settings->size && text[at] != '\n' ) {
+            at++;
+        }
+        usize lineEnd = at++;
+        while( lineStart < lineEnd && ( text[lineStart] == ' ' || text[lineStart] == '\t' ) ) {
+            lineStart++;
+        }
+        if(
+            lineEnd - lineStart <= keyLen ||
+            !stringCmp( keyLen, text + lineStart, keyLen, key ) ||
+            ( text[lineStart + keyLen] != ' ' && text[lineStart + keyLen] != '\t' && text[lineStart + keyLen] != '=' )
+        ) {
+            continue;
+        }
+        usize valueStart = lineStart + keyLen;
+        while( valueStart < lineEnd &&
+            ( text[valueStart] == ' ' || text[valueStart] == '\t' || text[valueStart] == '=' )
+        ) {
+            valueStart++;
+        }
+        usize valueEnd = valueStart;
+        while( valueEnd < lineEnd &&
+            text[valueEnd] != ' ' && text[valueEnd] != '\t' &&
+            text[valueEnd] != '\r' && text[valueEnd] != ';'
+        ) {
+            valueEnd++;
+        }
+        *valueLen = valueEnd - valueStart;
+        *value    = text + valueStart;
+        return true;
+    }
+    return false;
+}
+
+/// @brief Read renderer settings from settings.ini, OpenGL without state cache or deferred commands if they aren't set
+static void WinReadRendererSettings( Platform::RendererBackend* backend, bool* stateCache, bool* deferred ) {
+    *backend    = Platform::RendererBackend::OPENGL;
+    *stateCache = false;
+    *deferred   = false;
+    Platform::File settings = {};
+    if( !Platform::LoadFile( "./resources/settings.ini", &settings ) ) {
+        return;
+    }
+    usize valueLen;
+    const char* value;
+    if( WinFindSetting( &settings, "backend", &valueLen, &value ) ) {
+        if( !Platform::RendererBackendFromString( valueLen, value, backend ) ) {
+            LOG_WARN( "Windows x64 > Unknown renderer backend in settings.ini, using OpenGL" );
+            *backend = Platform::RendererBackend::OPENGL;
+        }
+    }
+    if( WinFindSetting( &settings, "statecache", &valueLen, &value ) ) {
+        *stateCache = stringCmp( valueLen, value, 4, "true" );
+    }
+    if( WinFindSetting( &settings, "deferred", &valueLen, &value ) ) {
+        *deferred = stringCmp( valueLen, value, 4, "true" );
+    }
+    Platform::FreeFile( &settings );
+}
+
 static i32 WINDOW_WIDTH  = 1280;
 static i32 WINDOW_HEIGHT = 720;
 
@@ -51,8 +163,10 @@ i32 APIENTRY WinMain( HINSTANCE hInstance, HINSTANCE, PSTR, i32 ) {
 
 #endif
 
-    // TODO(alicia): parse settings
-    Platform::RendererBackend backend = Platform::RendererBackend::OPENGL;
+    Platform::RendererBackend backend;
+    bool stateCache;
+    bool deferred;
+    WinReadRendererSettings( &backend, &stateCache, &deferred );
 
     u64 perfFrequency; {
         LARGE_INTEGER perfFrequencyLI;
@@ -79,7 +193,7 @@ i32 APIENTRY WinMain( HINSTANCE hInstance, HINSTANCE, PSTR, i32 ) {
         return ERROR_RETURN_CODE;
     }
 
-    HGLRC openGLContext;
+    HGLRC openGLContext = nullptr;
     switch( backend ) {
         case Platform::RendererBackend::OPENGL: {
             HMODULE openglModule = LoadLibrary( L"opengl32.dll" );
@@ -95,15 +209,50 @@ i32 APIENTRY WinMain( HINSTANCE hInstance, HINSTANCE, PSTR, i32 ) {
             app.rendererAPI.SwapBuffers = WinSwapBuffers;
             FreeModule( openglModule );
         } break;
+        case Platform::RendererBackend::SOFTWARE: {
+            DEVICE_CONTEXT = deviceContext;
+            if( !Platform::CreateSoftwareAPI( &app.rendererAPI, 0 ) ) {
+                LOG_ERROR("Windows x64 > Failed to create Software API!");
+                return ERROR_RETURN_CODE;
+            }
+            app.rendererAPI.SwapBuffers = WinSoftwareSwapBuffers;
+            // NOTE(alicia): OpenGL starts with a viewport the size of the window, software starts empty
+            RECT clientRect;
+            if( GetClientRect( window, &clientRect ) ) {
+                app.rendererAPI.SetViewport(
+                    clientRect.right - clientRect.left,
+                    clientRect.bottom - clientRect.top
+                );
+            }
+        } break;
         default: {
             LOG_ERROR("Windows x64 > \"%s\" is not yet supported!", Platform::RendererBackendToString( backend ));
             return ERROR_RETURN_CODE;
         } break;
     }
 
+    // NOTE(alicia): state cache sits right above backend so it also filters what deferred commands replay
+    if( stateCache ) {
+        Platform::RendererAPI backendAPI = app.rendererAPI;
+        if( !Platform::CreateStateCacheAPI( &app.rendererAPI, &backendAPI ) ) {
+            LOG_ERROR("Windows x64 > Failed to create state cache API!");
+            return ERROR_RETURN_CODE;
+        }
+    }
+    if( deferred ) {
+        Platform::RendererAPI backendAPI = app.rendererAPI;
+        if( !Platform::CreateCommandBufferAPI( &app.rendererAPI, &backendAPI ) ) {
+            LOG_ERROR("Windows x64 > Failed to create command buffer API!");
+            return ERROR_RETURN_CODE;
+        }
+    }
+
     u64 frameCount = 0;
     f32 dt         = 0.0f;
     f32 updateRate = 4.0f;
+#if DEBUG
+    u32 statsUpdates = 0;
+#endif
 
     if(!Core::OnInit( &app )) {
         return ERROR_RETURN_CODE;
@@ -121,6 +270,18 @@ i32 APIENTRY WinMain( HINSTANCE hInstance, HINSTANCE, PSTR, i32 ) {
             app.time.fps = (f32)frameCount / dt;
             frameCount = 0;
             dt -= 1.0f / updateRate;
+#if DEBUG
+            if( stateCache && ++statsUpdates >= updateRate ) {
+                Platform::StateCacheStats stats;
+                Platform::GetStateCacheStats( &stats );
+                LOG_INFO(
+                    "Windows x64 > Binds: %u issued %u filtered | Uniforms: %u issued %u filtered",
+                    stats.bindsIssued, stats.bindsFiltered,
+                    stats.uniformsIssued, stats.uniformsFiltered
+                );
+                statsUpdates = 0;
+            }
+#endif
         }
 
         WinProcessMessages( window, &app );
@@ -128,6 +289,12 @@ i32 APIENTRY WinMain( HINSTANCE hInstance, HINSTANCE, PSTR, i32 ) {
         app.input.mouseUpdated = false;
     }
 
+    if( deferred ) {
+        Platform::DestroyCommandBufferAPI();
+    }
+    if( stateCache ) {
+        Platform::DestroyStateCacheAPI();
+    }
     if( openGLContext ) {
         if(wglMakeCurrent( deviceContext, nullptr ) == FALSE) {
             LOG_WINDOWS_ERROR();
@@ -140,6 +307,12 @@ i32 APIENTRY WinMain( HINSTANCE hInstance, HINSTANCE, PSTR, i32 ) {
             LOG_INFO("Windows x64 > Deleted OpenGL context.");
         }
     }
+    if( backend == Platform::RendererBackend::SOFTWARE ) {
+        Platform::DestroySoftwareAPI();
+        if( SOFTWARE_PRESENT_BUFFER ) {
+            Platform::Free( SOFTWARE_PRESENT_BUFFER );
+        }
+    }
 
     return SUCCESS_RETURN_CODE;
 }
@@ -650,15 +823,13 @@ bool Platform::LoadFile( const char* filePath, File* result ) {
     return success;
 }
 
-bool Platform::UserLoadFile( const char* dialogTitle, File* result ) {
-    const usize MAX_FILE_NAME = 512;
-
+bool Platform::UserPickFile( const char* dialogTitle, usize dstSize, char* dst ) {
     usize dialogTitleLen = stringLen(dialogTitle) + 1;
     wchar_t wdialogTitle[dialogTitleLen];
     stringToWstring( dialogTitle, dialogTitleLen, wdialogTitle );
 
     // buffer for file name
-    wchar_t szFile[MAX_FILE_NAME];
+    wchar_t szFile[USER_FILE_PATH_MAX_LEN];
 
     HWND window = GetActiveWindow();
 
@@ -667,7 +838,7 @@ bool Platform::UserLoadFile( const char* dialogTitle, File* result ) {
     openFileName.hwndOwner       = window;
     openFileName.lpstrFile       = szFile;
     openFileName.lpstrFile[0]    = '\0';
-    openFileName.nMaxFile        = sizeof(szFile);
+    openFileName.nMaxFile        = USER_FILE_PATH_MAX_LEN;
     openFileName.lpstrFilter     = L"All\0*.*\0Text\0*.TXT\0";
     openFileName.nFilterIndex    = 1;
     openFileName.lpstrFileTitle  = NULL;
@@ -677,29 +848,25 @@ bool Platform::UserLoadFile( const char* dialogTitle, File* result ) {
     openFileName.lpstrTitle      = wdialogTitle;
 
     if( GetOpenFileName( &openFileName ) == FALSE ) {
-        result = {};
         return false;
     }
 
-    HANDLE fileHandle = CreateFile(
-        openFileName.lpstrFile,
-        GENERIC_READ,
-        FILE_SHARE_READ, // dwShareMode
-        NULL, // lpSecurityAttributes
-        OPEN_EXISTING, // dwCreationDisposition
-        0, 0
-    );
-
-    result->filePathLen = stringLen( openFileName.lpstrFile ) + 1;
-    result->filePath    = (char*)Platform::Alloc( result->filePathLen );
-    wstringToString( openFileName.lpstrFile, result->filePathLen, result->filePath );
-
-    bool success = WinLoadFileFromHandle( fileHandle, result );
-
-    CloseHandle( fileHandle );
-    CloseHandle( window );
+    usize pathLen = stringLen( openFileName.lpstrFile ) + 1;
+    if( pathLen > dstSize ) {
+        LOG_WARN( "Windows x64 > Picked file path is too long!" );
+        return false;
+    }
+    wstringToString( openFileName.lpstrFile, pathLen, dst );
+    return true;
+}
 
-    return success;
+bool Platform::UserLoadFile( const char* dialogTitle, File* result ) {
+    char filePath[USER_FILE_PATH_MAX_LEN];
+    if( !UserPickFile( dialogTitle, USER_FILE_PATH_MAX_LEN, filePath ) ) {
+        *result = {};
+        return false;
+    }
+    return LoadFile( filePath, result );
 }
 
 void Platform::FreeFile( File* file ) {
@@ -716,6 +883,9 @@ bool Platform::WriteFile( const char* filePath, void* buffer, usize bufferSize,
             // TODO(alicia): check if this is the right flag
             createDisposition = OPEN_EXISTING;
         } break;
+        case WriteFileType::APPEND: {
+            createDisposition = OPEN_ALWAYS;
+        } break;
         default: {
             createDisposition = CREATE_ALWAYS;
         } break;
@@ -741,23 +911,214 @@ bool Platform::WriteFile( const char* filePath, void* buffer, usize bufferSize,
         return false;
     }
 
-    DWORD bytesToWrite = bufferSize;
-    DEBUG_ASSERT_LOG(bufferSize < (usize)U32::MAX, "Trying to write over 4GB!");
-    // TODO(alicia): handle >=4GB case
+    if( writeType == WriteFileType::APPEND ) {
+        LARGE_INTEGER zero = {};
+        SetFilePointerEx( fileHandle, zero, nullptr, FILE_END );
+    }
 
-    DWORD bytesWritten;
-    if( !::WriteFile( fileHandle, buffer, bytesToWrite, &bytesWritten, nullptr ) ) {
+    // NOTE(alicia): WriteFile can only write up to 4GB at a time
+    const usize MAX_WRITE_SIZE = (usize)GIGABYTES(1);
+    u8* bytes = (u8*)buffer;
+    usize bytesRemaining = bufferSize;
+    while( bytesRemaining > 0 ) {
+        DWORD bytesToWrite = (DWORD)( bytesRemaining < MAX_WRITE_SIZE ? bytesRemaining : MAX_WRITE_SIZE );
+        DWORD bytesWritten;
+        if( !::WriteFile( fileHandle, bytes, bytesToWrite, &bytesWritten, nullptr ) ) {
+            LOG_WINDOWS_ERROR();
+            CloseHandle( fileHandle );
+            return false;
+        }
+        if( bytesWritten != bytesToWrite ) {
+            LOG_ERROR("Windows x64 > Failed to write %li bytes, wrote %li bytes instead?", bytesToWrite, bytesWritten);
+            CloseHandle( fileHandle );
+            return false;
+        }
+        bytes          += bytesWritten;
+        bytesRemaining -= bytesWritten;
+    }
+    CloseHandle( fileHandle );
+
+    return true;
+}
+
+bool Platform::MakeDirectory( const char* directoryPath ) {
+    usize directoryPathLen = stringLen( directoryPath ) + 1;
+    wchar_t wdirectoryPath[directoryPathLen];
+    stringToWstring( directoryPath, directoryPathLen, wdirectoryPath );
+
+    if( !CreateDirectory( wdirectoryPath, nullptr ) ) {
+        if( GetLastError() == ERROR_ALREADY_EXISTS ) {
+            return true;
+        }
         LOG_WINDOWS_ERROR();
+        return false;
+    }
+    return true;
+}
+
+bool Platform::MapFile( const char* filePath, MappedFile* result ) {
+    usize filePathLen = stringLen( filePath ) + 1;
+    wchar_t wfilePath[filePathLen];
+    stringToWstring( filePath, filePathLen, wfilePath );
+
+    *result = {};
+    HANDLE fileHandle = CreateFile(
+        wfilePath,
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        NULL,
+        OPEN_EXISTING,
+        FILE_FLAG_SEQUENTIAL_SCAN, 0
+    );
+    if( fileHandle == INVALID_HANDLE_VALUE ) {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if( GetFileSizeEx( fileHandle, &fileSize ) == FALSE || fileSize.QuadPart == 0 ) {
         CloseHandle( fileHandle );
         return false;
     }
-    CloseHandle( fileHandle );
 
-    if( bytesWritten != bytesToWrite ) {
-        LOG_ERROR("Windows x64 > Failed to write %li bytes, wrote %li bytes instead?", bytesToWrite, bytesWritten);
+    HANDLE mappingHandle = CreateFileMapping( fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr );
+    if( !mappingHandle ) {
+        LOG_WINDOWS_ERROR();
+        CloseHandle( fileHandle );
+        return false;
+    }
+
+    void* data = MapViewOfFile( mappingHandle, FILE_MAP_READ, 0, 0, 0 );
+    if( !data ) {
+        LOG_WINDOWS_ERROR();
+        CloseHandle( mappingHandle );
+        CloseHandle( fileHandle );
+        return false;
+    }
+
+    result->data          = data;
+    result->size          = (usize)fileSize.QuadPart;
+    result->fileHandle    = fileHandle;
+    result->mappingHandle = mappingHandle;
+    return true;
+}
+
+void Platform::UnmapFile( MappedFile* file ) {
+    if( file->data ) {
+        UnmapViewOfFile( file->data );
+    }
+    if( file->mappingHandle ) {
+        CloseHandle( (HANDLE)file->mappingHandle );
+    }
+    if( file->fileHandle ) {
+        CloseHandle( (HANDLE)file->fileHandle );
+    }
+    *file = {};
+}
+
+bool Platform::OpenFileStream( const char* filePath, FileStreamMode mode, FileStream* result ) {
+    usize filePathLen = stringLen( filePath ) + 1;
+    wchar_t wfilePath[filePathLen];
+    stringToWstring( filePath, filePathLen, wfilePath );
+
+    *result = {};
+    bool write = mode == FileStreamMode::WRITE;
+    HANDLE fileHandle = CreateFile(
+        wfilePath,
+        write ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ,
+        write ? 0 : FILE_SHARE_READ,
+        NULL,
+        write ? CREATE_ALWAYS : OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, 0
+    );
+    if( fileHandle == INVALID_HANDLE_VALUE ) {
+        LOG_WINDOWS_ERROR();
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if( GetFileSizeEx( fileHandle, &fileSize ) == FALSE ) {
+        LOG_WINDOWS_ERROR();
+        CloseHandle( fileHandle );
+        return false;
+    }
+
+    result->fileHandle = fileHandle;
+    result->size       = (usize)fileSize.QuadPart;
+    return true;
+}
+
+usize Platform::ReadFileStream( FileStream* stream, usize offset, usize size, void* dst ) {
+    // NOTE(alicia): ReadFile can only read up to 4GB at a time
+    const usize MAX_READ_SIZE = (usize)GIGABYTES(1);
+    u8* bytes = (u8*)dst;
+    usize bytesRead = 0;
+    while( bytesRead < size ) {
+        usize position = offset + bytesRead;
+        OVERLAPPED overlapped = {};
+        overlapped.Offset     = (DWORD)( position & 0xFFFFFFFF );
+        overlapped.OffsetHigh = (DWORD)( position >> 32 );
+
+        DWORD bytesToRead = (DWORD)( size - bytesRead < MAX_READ_SIZE ? size - bytesRead : MAX_READ_SIZE );
+        DWORD chunkRead = 0;
+        if( !::ReadFile( (HANDLE)stream->fileHandle, bytes + bytesRead, bytesToRead, &chunkRead, &overlapped ) ) {
+            if( GetLastError() != ERROR_HANDLE_EOF ) {
+                LOG_WINDOWS_ERROR();
+            }
+            break;
+        }
+        if( chunkRead == 0 ) {
+            break;
+        }
+        bytesRead += chunkRead;
+    }
+    return bytesRead;
+}
+
+bool Platform::WriteFileStream( FileStream* stream, usize offset, usize size, const void* src ) {
+    // NOTE(alicia): WriteFile can only write up to 4GB at a time
+    const usize MAX_WRITE_SIZE = (usize)GIGABYTES(1);
+    const u8* bytes = (const u8*)src;
+    usize bytesWritten = 0;
+    while( bytesWritten < size ) {
+        usize position = offset + bytesWritten;
+        OVERLAPPED overlapped = {};
+        overlapped.Offset     = (DWORD)( position & 0xFFFFFFFF );
+        overlapped.OffsetHigh = (DWORD)( position >> 32 );
+
+        DWORD bytesToWrite = (DWORD)( size - bytesWritten < MAX_WRITE_SIZE ? size - bytesWritten : MAX_WRITE_SIZE );
+        DWORD chunkWritten = 0;
+        if( !::WriteFile( (HANDLE)stream->fileHandle, bytes + bytesWritten, bytesToWrite, &chunkWritten, &overlapped ) ) {
+            LOG_WINDOWS_ERROR();
+            return false;
+        }
+        if( chunkWritten != bytesToWrite ) {
+            LOG_ERROR("Windows x64 > Failed to write %li bytes, wrote %li bytes instead?", bytesToWrite, chunkWritten);
+            return false;
+        }
+        bytesWritten += chunkWritten;
+    }
+    return true;
+}
+
+void Platform::CloseFileStream( FileStream* stream ) {
+    if( stream->fileHandle ) {
+        CloseHandle( (HANDLE)stream->fileHandle );
+    }
+    *stream = {};
+}
+
+bool Platform::RemoveFile( const char* filePath ) {
+    usize filePathLen = stringLen( filePath ) + 1;
+    wchar_t wfilePath[filePathLen];
+    stringToWstring( filePath, filePathLen, wfilePath );
+
+    if( !DeleteFile( wfilePath ) ) {
+        if( GetLastError() == ERROR_FILE_NOT_FOUND ) {
+            return true;
+        }
+        LOG_WINDOWS_ERROR();
         return false;
     }
-    
     return true;
 }
 
@@ -868,5 +1229,96 @@ u64 Platform::GetSystemTime() {
     return fileTime64;
 }
 
+u64 Platform::GetPerformanceCounter() {
+    return WinGetTime();
+}
+
+u64 Platform::GetPerformanceFrequency() {
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency( &frequency );
+    return frequency.QuadPart;
+}
+
+struct WinThreadParams {
+    Platform::ThreadProcFN proc;
+    void* params;
+};
+
+DWORD WINAPI WinThreadProc( LPVOID lpParameter ) {
+    WinThreadParams threadParams = *(WinThreadParams*)lpParameter;
+    Platform::Free( lpParameter );
+    threadParams.proc( threadParams.params );
+    return 0;
+}
+
+bool Platform::ThreadCreate( ThreadProcFN proc, void* params, Thread* result ) {
+    WinThreadParams* threadParams = (WinThreadParams*)Platform::Alloc( sizeof(WinThreadParams) );
+    threadParams->proc   = proc;
+    threadParams->params = params;
+    HANDLE handle = CreateThread( nullptr, 0, WinThreadProc, threadParams, 0, nullptr );
+    if( !handle ) {
+        LOG_WINDOWS_ERROR();
+        Platform::Free( threadParams );
+        return false;
+    }
+    result->handle = handle;
+    return true;
+}
+
+void Platform::ThreadJoin( Thread* thread ) {
+    WaitForSingleObject( (HANDLE)thread->handle, INFINITE );
+    CloseHandle( (HANDLE)thread->handle );
+    thread->handle = nullptr;
+}
+
+bool Platform::SemaphoreCreate( u32 initialCount, u32 maxCount, Semaphore* result ) {
+    HANDLE handle = CreateSemaphoreEx( nullptr, (LONG)initialCount, (LONG)maxCount, nullptr, 0, SEMAPHORE_ALL_ACCESS );
+    if( !handle ) {
+        LOG_WINDOWS_ERROR();
+        return false;
+    }
+    result->handle = handle;
+    return true;
+}
+
+void Platform::SemaphoreSignal( Semaphore* semaphore, u32 count ) {
+    ReleaseSemaphore( (HANDLE)semaphore->handle, (LONG)count, nullptr );
+}
+
+void Platform::SemaphoreWait( Semaphore* semaphore ) {
+    WaitForSingleObjectEx( (HANDLE)semaphore->handle, INFINITE, FALSE );
+}
+
+void Platform::SemaphoreDestroy( Semaphore* semaphore ) {
+    CloseHandle( (HANDLE)semaphore->handle );
+    semaphore->handle = nullptr;
+}
+
+u32 Platform::GetProcessorCount() {
+    SYSTEM_INFO systemInfo = {};
+    GetSystemInfo( &systemInfo );
+    return (u32)systemInfo.dwNumberOfProcessors;
+}
+
+i32 Platform::AtomicIncrement( volatile i32* value ) {
+    return (i32)InterlockedIncrement( (volatile LONG*)value );
+}
+
+i32 Platform::AtomicDecrement( volatile i32* value ) {
+    return (i32)InterlockedDecrement( (volatile LONG*)value );
+}
+
+i32 Platform::AtomicAdd( volatile i32* value, i32 addend ) {
+    return (i32)InterlockedExchangeAdd( (volatile LONG*)value, (LONG)addend );
+}
+
+i64 Platform::AtomicAdd( volatile i64* value, i64 addend ) {
+    return (i64)InterlockedExchangeAdd64( (volatile LONG64*)value, (LONG64)addend );
+}
+
+i32 Platform::AtomicCompareExchange( volatile i32* value, i32 exchange, i32 comparand ) {
+    return (i32)InterlockedCompareExchange( (volatile LONG*)value, (LONG)exchange, (LONG)comparand );
+}
+
 #endif
 
@@ -239,6 +239,23 @@ inline f64 acos( f64 x ) {
     // TODO(alicia): temp?
     return __builtin_acos( x );
 }
+/// arc-cosine of 4 lanes, approximation with largest error of about 7e-5 radians
+inline __m128 acos4( __m128 x ) {
+    // NOTE(alicia): SSE
+    __m128 one      = _mm_set1_ps( 1.0f );
+    __m128 negative = _mm_cmplt_ps( x, _mm_setzero_ps() );
+    __m128 a = _mm_min_ps( _mm_andnot_ps( _mm_set1_ps( -0.0f ), x ), one );
+
+    __m128 poly = _mm_set1_ps( -0.0187293f );
+    poly = _mm_add_ps( _mm_mul_ps( poly, a ), _mm_set1_ps(  0.0742610f ) );
+    poly = _mm_add_ps( _mm_mul_ps( poly, a ), _mm_set1_ps( -0.2121144f ) );
+    poly = _mm_add_ps( _mm_mul_ps( poly, a ), _mm_set1_ps(  1.5707288f ) );
+    __m128 result = _mm_mul_ps( poly, _mm_sqrt_ps( _mm_sub_ps( one, a ) ) );
+
+    // acos( -x ) = pi - acos( x )
+    __m128 reflected = _mm_sub_ps( _mm_set1_ps( F32::PI ), result );
+    return _mm_or_ps( _mm_and_ps( negative, reflected ), _mm_andnot_ps( negative, result ) );
+}
 // 2 argument arc-tangent
 inline f32 atan2( f32 a, f32 b ) {
     // TODO(alicia): temp?
@@ -2079,11 +2096,11 @@ struct mat3 {
         return ptr()[index];
     }
     mat3& operator+=( const mat3& rhs ) {
-        __m128 _lhs1 = _mm_load_ps( ptr() );
-        __m128 _lhs2 = _mm_load_ps( &ptr()[4] );
+        __m128 _lhs1 = _mm_loadu_ps( ptr() );
+        __m128 _lhs2 = _mm_loadu_ps( &ptr()[4] );
 
-        __m128 _rhs1 = _mm_load_ps( &rhs.ptr()[0] );
-        __m128 _rhs2 = _mm_load_ps( &rhs.ptr()[4] );
+        __m128 _rhs1 = _mm_loadu_ps( &rhs.ptr()[0] );
+        __m128 _rhs2 = _mm_loadu_ps( &rhs.ptr()[4] );
 
         _mm_storeu_ps( ptr(), _mm_add_ps( _lhs1, _rhs1 ) );
         _mm_storeu_ps( &ptr()[4], _mm_add_ps( _lhs2, _rhs2 ) );
@@ -2092,11 +2109,11 @@ struct mat3 {
         return *this;
     }
     mat3& operator-=( const mat3& rhs ) {
-        __m128 _lhs1 = _mm_load_ps( ptr() );
-        __m128 _lhs2 = _mm_load_ps( &ptr()[4] );
+        __m128 _lhs1 = _mm_loadu_ps( ptr() );
+        __m128 _lhs2 = _mm_loadu_ps( &ptr()[4] );
 
-        __m128 _rhs1 = _mm_load_ps( &rhs.ptr()[0] );
-        __m128 _rhs2 = _mm_load_ps( &rhs.ptr()[4] );
+        __m128 _rhs1 = _mm_loadu_ps( &rhs.ptr()[0] );
+        __m128 _rhs2 = _mm_loadu_ps( &rhs.ptr()[4] );
 
         _mm_storeu_ps( ptr(), _mm_sub_ps( _lhs1, _rhs1 ) );
         _mm_storeu_ps( &ptr()[4], _mm_sub_ps( _lhs2, _rhs2 ) );
@@ -2105,8 +2122,8 @@ struct mat3 {
         return *this;
     }
     mat3& operator*=( const f32& rhs ) {
-        __m128 _lhs1 = _mm_load_ps( ptr() );
-        __m128 _lhs2 = _mm_load_ps( &ptr()[4] );
+        __m128 _lhs1 = _mm_loadu_ps( ptr() );
+        __m128 _lhs2 = _mm_loadu_ps( &ptr()[4] );
 
         __m128 _rhs = _mm_set1_ps( rhs );
 
@@ -2117,8 +2134,8 @@ struct mat3 {
         return *this;
     }
     mat3& operator/=( const f32& rhs ) {
-        __m128 _lhs1 = _mm_load_ps( ptr() );
-        __m128 _lhs2 = _mm_load_ps( &ptr()[4] );
+        __m128 _lhs1 = _mm_loadu_ps( ptr() );
+        __m128 _lhs2 = _mm_loadu_ps( &ptr()[4] );
 
         __m128 _rhs = _mm_set1_ps( rhs );
 
@@ -2286,15 +2303,15 @@ struct mat4 {
     mat4& operator+=( const mat4& rhs ) {
         // TODO(alicia): AVX
         // NOTE(alicia): SSE
-        __m128 _lhsCol1 = _mm_load_ps( &ptr()[0] );
-        __m128 _lhsCol2 = _mm_load_ps( &ptr()[4] );
-        __m128 _lhsCol3 = _mm_load_ps( &ptr()[8] );
-        __m128 _lhsCol4 = _mm_load_ps( &ptr()[12] );
+        __m128 _lhsCol1 = _mm_loadu_ps( &ptr()[0] );
+        __m128 _lhsCol2 = _mm_loadu_ps( &ptr()[4] );
+        __m128 _lhsCol3 = _mm_loadu_ps( &ptr()[8] );
+        __m128 _lhsCol4 = _mm_loadu_ps( &ptr()[12] );
 
-        __m128 _rhsCol1 = _mm_load_ps( &rhs.ptr()[0] );
-        __m128 _rhsCol2 = _mm_load_ps( &rhs.ptr()[4] );
-        __m128 _rhsCol3 = _mm_load_ps( &rhs.ptr()[8] );
-        __m128 _rhsCol4 = _mm_load_ps( &rhs.ptr()[12] );
+        __m128 _rhsCol1 = _mm_loadu_ps( &rhs.ptr()[0] );
+        __m128 _rhsCol2 = _mm_loadu_ps( &rhs.ptr()[4] );
+        __m128 _rhsCol3 = _mm_loadu_ps( &rhs.ptr()[8] );
+        __m128 _rhsCol4 = _mm_loadu_ps( &rhs.ptr()[12] );
 
         _mm_storeu_ps( &ptr()[ 0], _mm_add_ps( _lhsCol1, _rhsCol1 ) );
         _mm_storeu_ps( &ptr()[ 4], _mm_add_ps( _lhsCol2, _rhsCol2 ) );
@@ -2306,15 +2323,15 @@ struct mat4 {
     mat4& operator-=( const mat4& rhs ) {
         // TODO(alicia): AVX
         // NOTE(alicia): SSE
-        __m128 _lhsCol1 = _mm_load_ps( &ptr()[0] );
-        __m128 _lhsCol2 = _mm_load_ps( &ptr()[4] );
-        __m128 _lhsCol3 = _mm_load_ps( &ptr()[8] );
-        __m128 _lhsCol4 = _mm_load_ps( &ptr()[12] );
+        __m128 _lhsCol1 = _mm_loadu_ps( &ptr()[0] );
+        __m128 _lhsCol2 = _mm_loadu_ps( &ptr()[4] );
+        __m128 _lhsCol3 = _mm_loadu_ps( &ptr()[8] );
+        __m128 _lhsCol4 = _mm_loadu_ps( &ptr()[12] );
 
-        __m128 _rhsCol1 = _mm_load_ps( &rhs.ptr()[0] );
-        __m128 _rhsCol2 = _mm_load_ps( &rhs.ptr()[4] );
-        __m128 _rhsCol3 = _mm_load_ps( &rhs.ptr()[8] );
-        __m128 _rhsCol4 = _mm_load_ps( &rhs.ptr()[12] );
+        __m128 _rhsCol1 = _mm_loadu_ps( &rhs.ptr()[0] );
+        __m128 _rhsCol2 = _mm_loadu_ps( &rhs.ptr()[4] );
+        __m128 _rhsCol3 = _mm_loadu_ps( &rhs.ptr()[8] );
+        __m128 _rhsCol4 = _mm_loadu_ps( &rhs.ptr()[12] );
 
         _mm_storeu_ps( &ptr()[ 0], _mm_sub_ps( _lhsCol1, _rhsCol1 ) );
         _mm_storeu_ps( &ptr()[ 4], _mm_sub_ps( _lhsCol2, _rhsCol2 ) );
@@ -2325,10 +2342,10 @@ struct mat4 {
     mat4& operator*=( const f32& rhs ) {
         // TODO(alicia): AVX
         // NOTE(alicia): SSE
-        __m128 _lhsCol1 = _mm_load_ps( &ptr()[0] );
-        __m128 _lhsCol2 = _mm_load_ps( &ptr()[4] );
-        __m128 _lhsCol3 = _mm_load_ps( &ptr()[8] );
-        __m128 _lhsCol4 = _mm_load_ps( &ptr()[12] );
+        __m128 _lhsCol1 = _mm_loadu_ps( &ptr()[0] );
+        __m128 _lhsCol2 = _mm_loadu_ps( &ptr()[4] );
+        __m128 _lhsCol3 = _mm_loadu_ps( &ptr()[8] );
+        __m128 _lhsCol4 = _mm_loadu_ps( &ptr()[12] );
 
         __m128 _rhs = _mm_set1_ps( rhs );
 
@@ -2341,10 +2358,10 @@ struct mat4 {
     mat4& operator/=( const f32& rhs ) {
         // TODO(alicia): AVX
         // NOTE(alicia): SSE
-        __m128 _lhsCol1 = _mm_load_ps( &ptr()[0] );
-        __m128 _lhsCol2 = _mm_load_ps( &ptr()[4] );
-        __m128 _lhsCol3 = _mm_load_ps( &ptr()[8] );
-        __m128 _lhsCol4 = _mm_load_ps( &ptr()[12] );
+        __m128 _lhsCol1 = _mm_loadu_ps( &ptr()[0] );
+        __m128 _lhsCol2 = _mm_loadu_ps( &ptr()[4] );
+        __m128 _lhsCol3 = _mm_loadu_ps( &ptr()[8] );
+        __m128 _lhsCol4 = _mm_loadu_ps( &ptr()[12] );
 
         __m128 _rhs = _mm_set1_ps( rhs );
 
@@ -2564,10 +2581,10 @@ inline mat4 operator*( const mat4& lhs, const mat4& rhs ) {
     smath::mat4 result = {};
 
     __m128 _lhs[4];
-    _lhs[0] = _mm_load_ps( &lhs.ptr()[0] );
-    _lhs[1] = _mm_load_ps( &lhs.ptr()[4] );
-    _lhs[2] = _mm_load_ps( &lhs.ptr()[8] );
-    _lhs[3] = _mm_load_ps( &lhs.ptr()[12] );
+    _lhs[0] = _mm_loadu_ps( &lhs.ptr()[0] );
+    _lhs[1] = _mm_loadu_ps( &lhs.ptr()[4] );
+    _lhs[2] = _mm_loadu_ps( &lhs.ptr()[8] );
+    _lhs[3] = _mm_loadu_ps( &lhs.ptr()[12] );
 
     __m128 _mul[16];
     for( usize i = 0; i < 16; ++i ) {
@@ -2590,10 +2607,10 @@ inline vec4 operator*( const mat4& lhs, const vec4& rhs ) {
     smath::vec4 result = {};
 
     __m128 _tlhs[4];
-    _tlhs[0] = _mm_load_ps( &tlhs.ptr()[0] );
-    _tlhs[1] = _mm_load_ps( &tlhs.ptr()[4] );
-    _tlhs[2] = _mm_load_ps( &tlhs.ptr()[8] );
-    _tlhs[3] = _mm_load_ps( &tlhs.ptr()[12] );
+    _tlhs[0] = _mm_loadu_ps( &tlhs.ptr()[0] );
+    _tlhs[1] = _mm_loadu_ps( &tlhs.ptr()[4] );
+    _tlhs[2] = _mm_loadu_ps( &tlhs.ptr()[8] );
+    _tlhs[3] = _mm_loadu_ps( &tlhs.ptr()[12] );
 
     __m128 _mul[4];
     for( usize i = 0; i < 4; ++i ) {
@@ -382,3 +382,141 @@ void stringCopy( usize srcLen, const wchar_t* src, usize dstSize, wchar_t* dst )
 void stringCopy( const wchar_t* src, usize dstSize, wchar_t* dst ) {
     stringCopy( stringLen(src) + 1, src, dstSize, dst );
 }
+
+static const u64 XXH_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+static const u64 XXH_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+static const u64 XXH_PRIME64_3 = 0x165667B19E3779F9ULL;
+static const u64 XXH_PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+static const u64 XXH_PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+static inline u64 xxhRotl( u64 value, u32 bits ) {
+    return ( value << bits ) | ( value >> ( 64 - bits ) );
+}
+static inline u64 xxhRead64( const u8* bytes ) {
+    u64 result;
+    Platform::MemCopy( sizeof(u64), bytes, &result );
+    return result;
+}
+static inline u32 xxhRead32( const u8* bytes ) {
+    return (u32)bytes[0] | (u32)bytes[1] << 8 | (u32)bytes[2] << 16 | (u32)bytes[3] << 24;
+}
+static inline u64 xxhRound( u64 accumulator, u64 input ) {
+    accumulator += input * XXH_PRIME64_2;
+    accumulator  = xxhRotl( accumulator, 31 );
+    return accumulator * XXH_PRIME64_1;
+}
+static inline u64 xxhMergeRound( u64 accumulator, u64 value ) {
+    accumulator ^= xxhRound( 0, value );
+    return accumulator * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+u64 hashBytes( usize size, const void* data, u64 seed ) {
+    const u8* at  = (const u8*)data;
+    const u8* end = at + size;
+    u64 hash;
+
+    if( size >= 32 ) {
+        u64 v1 = seed + XXH_PRIME64_1 + XXH_PRIME64_2;
+        u64 v2 = seed + XXH_PRIME64_2;
+        u64 v3 = seed;
+        u64 v4 = seed - XXH_PRIME64_1;
+        const u8* limit = end - 32;
+        do {
+            v1 = xxhRound( v1, xxhRead64( at +  0 ) );
+            v2 = xxhRound( v2, xxhRead64( at +  8 ) );
+            v3 = xxhRound( v3, xxhRead64( at + 16 ) );
+            v4 = xxhRound( v4, xxhRead64( at + 24 ) );
+            at += 32;
+        } while( at <= limit );
+
+        hash = xxhRotl( v1, 1 ) + xxhRotl( v2, 7 ) + xxhRotl( v3, 12 ) + xxhRotl( v4, 18 );
+        hash = xxhMergeRound( hash, v1 );
+        hash = xxhMergeRound( hash, v2 );
+        hash = xxhMergeRound( hash, v3 );
+        hash = xxhMergeRound( hash, v4 );
+    } else {
+        hash = seed + XXH_PRIME64_5;
+    }
+
+    hash += (u64)size;
+
+    while( at + 8 <= end ) {
+        hash ^= xxhRound( 0, xxhRead64( at ) );
+        hash  = xxhRotl( hash, 27 ) * XXH_PRIME64_1 + XXH_PRIME64_4;
+        at += 8;
+    }
+    if( at + 4 <= end ) {
+        hash ^= (u64)xxhRead32( at ) * XXH_PRIME64_1;
+        hash  = xxhRotl( hash, 23 ) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        at += 4;
+    }
+    while( at < end ) {
+        hash ^= (u64)(*at) * XXH_PRIME64_5;
+        hash  = xxhRotl( hash, 11 ) * XXH_PRIME64_1;
+        at++;
+    }
+
+    hash ^= hash >> 33;
+    hash *= XXH_PRIME64_2;
+    hash ^= hash >> 29;
+    hash *= XXH_PRIME64_3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+/// @brief Grow array, capacity stays at or below maxCapacity
+static bool growArrayLimited(
+    void** array, usize elementSize, usize* capacity, usize count, usize maxCapacity
+) {
+    if( count <= *capacity ) {
+        return true;
+    }
+    // NOTE(alicia): byte size of array must fit in usize as well
+    usize sizeLimit = (usize)U64::MAX / elementSize;
+    if( maxCapacity > sizeLimit ) {
+        maxCapacity = sizeLimit;
+    }
+    if( count > maxCapacity ) {
+        return false;
+    }
+    usize newCapacity = *capacity ? *capacity : 16;
+    while( newCapacity < count ) {
+        newCapacity = newCapacity > maxCapacity / 2 ? maxCapacity : newCapacity * 2;
+    }
+    void* newArray = Platform::Alloc( newCapacity * elementSize );
+    if( !newArray ) {
+        return false;
+    }
+    if( *array ) {
+        Platform::MemCopy( *capacity * elementSize, *array, newArray );
+        Platform::Free( *array );
+    }
+    *array    = newArray;
+    *capacity = newCapacity;
+    return true;
+}
+bool growArray( void** array, usize elementSize, usize* capacity, usize count ) {
+    return growArrayLimited( array, elementSize, capacity, count, (usize)U64::MAX );
+}
+bool growArray( void** array, usize elementSize, u32* capacity, usize count ) {
+    usize wideCapacity = *capacity;
+    if( !growArrayLimited( array, elementSize, &wideCapacity, count, U32::MAX ) ) {
+        return false;
+    }
+    *capacity = (u32)wideCapacity;
+    return true;
+}
+
+void u64ToHexString( u64 value, usize dstSize, char* dst ) {
+    const char* HEX_DIGITS = "0123456789abcdef";
+    if( dstSize < 17 ) {
+        if( dstSize > 0 ) {
+            dst[0] = '\0';
+        }
+        return;
+    }
+    ucycles( 16 ) {
+        dst[15 - i] = HEX_DIGITS[ ( value >> ( i * 4 ) ) & 0xF ];
+    }
+    dst[16] = '\0';
+}
@@ -289,6 +289,29 @@ void stringCopy( usize srcLen, const wchar_t* src, usize dstSize, wchar_t* dst )
 /// @param dst destination buffer
 void stringCopy( const wchar_t* src, usize dstSize, wchar_t* dst );
 
+/// @brief 64-bit non-cryptographic hash of a buffer ( xxHash64 )
+/// @param size size of buffer
+/// @param data buffer to hash
+/// @param seed hash seed
+/// @return hash
+u64 hashBytes( usize size, const void* data, u64 seed );
+
+/// @brief Grow array to hold at least count elements, capacity doubles. Contents are kept.
+/// @param array [in/out] array to grow, can point to null
+/// @param elementSize size of each element in bytes
+/// @param capacity [in/out] number of elements array has room for
+/// @param count number of elements array needs room for
+/// @return false if allocation failed or size doesn't fit in usize, array and capacity are unchanged
+bool growArray( void** array, usize elementSize, usize* capacity, usize count );
+/// @brief Grow array with a 32-bit capacity, fails if capacity would pass U32::MAX
+bool growArray( void** array, usize elementSize, u32* capacity, usize count );
+
+/// @brief Write value as a fixed width hexadecimal string. Result is null-terminated.
+/// @param value value to write
+/// @param dstSize size of destination buffer, must be at least 17
+/// @param dst destination buffer
+void u64ToHexString( u64 value, usize dstSize, char* dst );
+
 /// My own implementation of std::vector
 class DynList {
     /// @brief reserve space